@@ -726,6 +726,46 @@ function create_tests()
             "standalone_examples/benchmarks/benchmark_single_view_depth_sensor.py",
             "--num-frames 10 --num-cameras 2",
         },
+        {
+            "tests-standalone_benchmarks-benchmark_omap_generation",
+            "standalone_examples/benchmarks/benchmark_omap_generation.py",
+            "--num-runs 1 --cell-size 0.2 --adaptive-levels 0 4",
+        },
+        {
+            "tests-standalone_benchmarks-benchmark_mobility_gen_path_planning",
+            "standalone_examples/benchmarks/benchmark_mobility_gen_path_planning.py",
+            "--num-queries 2 --map-size 1024",
+        },
+        {
+            "tests-standalone_benchmarks-benchmark_ros2_dynamic_message",
+            "standalone_examples/benchmarks/benchmark_ros2_dynamic_message.py",
+            "--num-frames 10 --num-pairs 2",
+        },
+        {
+            "tests-standalone_benchmarks-benchmark_contact_sensors",
+            "standalone_examples/benchmarks/benchmark_contact_sensors.py",
+            "--num-frames 10 --num-cubes 64 --num-sensors 16",
+        },
+        {
+            "tests-standalone_benchmarks-benchmark_urdf_parse",
+            "standalone_examples/benchmarks/benchmark_urdf_parse.py",
+            "--num-links 20000 --num-runs 1",
+        },
+        {
+            "tests-standalone_benchmarks-benchmark_ros2_typed_messages",
+            "standalone_examples/benchmarks/benchmark_ros2_typed_messages.py",
+            "--num-frames 10 --num-robots 2",
+        },
+        {
+            "tests-standalone_benchmarks-benchmark_ros2_compressed_image",
+            "standalone_examples/benchmarks/benchmark_ros2_compressed_image.py",
+            "--num-frames 10 --num-cameras 2 --width 640 --height 480",
+        },
+        {
+            "tests-standalone_benchmarks-benchmark_ros2_subscribe_transform_tree",
+            "standalone_examples/benchmarks/benchmark_ros2_subscribe_transform_tree.py",
+            "--num-frames 10 --num-transforms 20",
+        },
     }
 
     for _, test in ipairs(benchmark_tests) do
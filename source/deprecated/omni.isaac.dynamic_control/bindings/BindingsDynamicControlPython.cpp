@@ -75,6 +75,55 @@ py::class_<InterfaceType> defineInterfaceClass(py::module& m,
     return py::class_<InterfaceType>(m, className, docString);
 }
 
+using omni::isaac::dynamic_control::DcHandle;
+using omni::isaac::dynamic_control::DynamicControl;
+using HandleArray = py::array_t<DcHandle, py::array::c_style | py::array::forcecast>;
+using ArticulationSetGetter = bool(CARB_ABI*)(const DcHandle*, size_t, size_t, float*);
+using ArticulationSetSetter = bool(CARB_ABI*)(const DcHandle*, size_t, size_t, const float*);
+
+// Articulations in a set are expected to share the dof count of the first one
+size_t getArticulationSetDofCount(const DynamicControl* dc, const HandleArray& artHandles)
+{
+    return artHandles.size() > 0 ? dc->getArticulationDofCount(artHandles.data()[0]) : 0;
+}
+
+py::object getArticulationSetValues(const DynamicControl* dc,
+                                    ArticulationSetGetter DynamicControl::*getter,
+                                    const HandleArray& artHandles)
+{
+    if (dc && dc->isSimulating())
+    {
+        size_t numDofs = getArticulationSetDofCount(dc, artHandles);
+        if (numDofs > 0)
+        {
+            size_t count = artHandles.size();
+            auto arr = py::array_t<float, py::array::c_style>({ ssize_t(count), ssize_t(numDofs) });
+            if ((dc->*getter)(artHandles.data(), count, numDofs, arr.mutable_data()))
+            {
+                return arr;
+            }
+        }
+    }
+    return py::none();
+}
+
+bool setArticulationSetValues(const DynamicControl* dc,
+                              ArticulationSetSetter DynamicControl::*setter,
+                              const HandleArray& artHandles,
+                              const py::array_t<float, py::array::c_style | py::array::forcecast>& values)
+{
+    if (dc && dc->isSimulating())
+    {
+        size_t numDofs = getArticulationSetDofCount(dc, artHandles);
+        size_t count = artHandles.size();
+        if (numDofs > 0 && size_t(values.size()) == count * numDofs)
+        {
+            return (dc->*setter)(artHandles.data(), count, numDofs, values.data());
+        }
+    }
+    return false;
+}
+
 PYBIND11_MODULE(_dynamic_control, m)
 {
     using namespace carb;
@@ -922,6 +971,104 @@ PYBIND11_MODULE(_dynamic_control, m)
             },
             "Get array of an actor's degree-of-freedom effective masses")
 
+        // articulation sets
+
+        .def(
+            "get_articulations_dof_states",
+            [](const DynamicControl* dc, const HandleArray& artHandles, DcStateFlags flags) -> py::object
+            {
+                if (dc && dc->isSimulating())
+                {
+                    size_t numDofs = getArticulationSetDofCount(dc, artHandles);
+                    if (numDofs > 0)
+                    {
+                        size_t count = artHandles.size();
+                        auto arr = py::array_t<DcDofState, py::array::c_style>({ ssize_t(count), ssize_t(numDofs) });
+                        if (dc->getArticulationsDofStates(artHandles.data(), count, numDofs, arr.mutable_data(), flags))
+                        {
+                            return arr;
+                        }
+                    }
+                }
+                return py::none();
+            },
+            R"pbdoc(
+                Gets the degree-of-freedom states of a set of articulations with the same number of degrees of freedom
+
+                Args:
+                    arg0 (:obj:`numpy.ndarray`): Handles to the articulations
+                    arg1 (int): Flags for the states to get
+
+                Returns:
+                    :obj:`numpy.ndarray`: [N, num_dofs] array of degree-of-freedom states, None on failure
+            )pbdoc")
+        .def(
+            "set_articulations_dof_states",
+            [](const DynamicControl* dc, const HandleArray& artHandles,
+               const py::array_t<DcDofState, py::array::c_style>& states, DcStateFlags flags)
+            {
+                if (dc && dc->isSimulating())
+                {
+                    size_t numDofs = getArticulationSetDofCount(dc, artHandles);
+                    size_t count = artHandles.size();
+                    if (numDofs > 0 && size_t(states.size()) == count * numDofs)
+                    {
+                        return dc->setArticulationsDofStates(artHandles.data(), count, numDofs, states.data(), flags);
+                    }
+                }
+                return false;
+            },
+            R"pbdoc(
+                Sets the degree-of-freedom states of a set of articulations with the same number of degrees of freedom
+
+                Args:
+                    arg0 (:obj:`numpy.ndarray`): Handles to the articulations
+                    arg1 (:obj:`numpy.ndarray`): [N, num_dofs] array of degree-of-freedom states
+                    arg2 (int): Flags for the states to set
+
+                Returns:
+                    bool: True if the states of all articulations were set
+            )pbdoc")
+        .def(
+            "set_articulations_dof_position_targets",
+            [](const DynamicControl* dc, const HandleArray& artHandles,
+               const py::array_t<float, py::array::c_style | py::array::forcecast>& targets)
+            {
+                return setArticulationSetValues(
+                    dc, &DynamicControl::setArticulationsDofPositionTargets, artHandles, targets);
+            },
+            "Sets the degree-of-freedom position targets of a set of articulations from a [N, num_dofs] array")
+        .def(
+            "get_articulations_dof_position_targets",
+            [](const DynamicControl* dc, const HandleArray& artHandles)
+            { return getArticulationSetValues(dc, &DynamicControl::getArticulationsDofPositionTargets, artHandles); },
+            "Get [N, num_dofs] array of position targets for a set of articulations")
+        .def(
+            "set_articulations_dof_velocity_targets",
+            [](const DynamicControl* dc, const HandleArray& artHandles,
+               const py::array_t<float, py::array::c_style | py::array::forcecast>& targets)
+            {
+                return setArticulationSetValues(
+                    dc, &DynamicControl::setArticulationsDofVelocityTargets, artHandles, targets);
+            },
+            "Sets the degree-of-freedom velocity targets of a set of articulations from a [N, num_dofs] array")
+        .def(
+            "get_articulations_dof_velocity_targets",
+            [](const DynamicControl* dc, const HandleArray& artHandles)
+            { return getArticulationSetValues(dc, &DynamicControl::getArticulationsDofVelocityTargets, artHandles); },
+            "Get [N, num_dofs] array of velocity targets for a set of articulations")
+        .def(
+            "set_articulations_dof_efforts",
+            [](const DynamicControl* dc, const HandleArray& artHandles,
+               const py::array_t<float, py::array::c_style | py::array::forcecast>& efforts)
+            { return setArticulationSetValues(dc, &DynamicControl::setArticulationsDofEfforts, artHandles, efforts); },
+            "Sets the degree-of-freedom efforts of a set of articulations from a [N, num_dofs] array")
+        .def(
+            "get_articulations_dof_efforts",
+            [](const DynamicControl* dc, const HandleArray& artHandles)
+            { return getArticulationSetValues(dc, &DynamicControl::getArticulationsDofEfforts, artHandles); },
+            "Get [N, num_dofs] array of efforts for a set of articulations")
+
         // rigid bodies
 
         .def("get_rigid_body_name", wrapInterfaceFunction(&DynamicControl::getRigidBodyName),
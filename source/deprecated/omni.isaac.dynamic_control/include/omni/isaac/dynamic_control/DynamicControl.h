@@ -34,7 +34,7 @@ namespace dynamic_control
  */
 struct DynamicControl
 {
-    CARB_PLUGIN_INTERFACE("omni::isaac::dynamic_control::DynamicControl", 0, 1);
+    CARB_PLUGIN_INTERFACE("omni::isaac::dynamic_control::DynamicControl", 0, 2);
 
 
     // DcContext*(CARB_ABI* createContext)(const char* scenePath);
@@ -851,6 +851,118 @@ struct DynamicControl
      */
     DcRayCastResult(CARB_ABI* rayCast)(const carb::Float3& origin, const carb::Float3& direction, float max_distrance);
 
+    //===== Articulation sets =====//
+
+    /**
+     * @brief Gets the degree of freedom states of a set of articulations
+     * @details Articulations are processed in parallel, a set listing an articulation more than once is rejected.
+     * @param[in] artHandles Array of articulation handles
+     * @param[in] count Number of articulation handles
+     * @param[in] numDofs Number of degrees of freedom of every articulation in the set
+     * @param[out] states Row-major [count, numDofs] array to be filled with degree of freedom states
+     * @param[in] flags Flags indicating which states to get (position, velocity, etc.)
+     * @return True if the states of all articulations were read, false otherwise
+     */
+    bool(CARB_ABI* getArticulationsDofStates)(
+        const DcHandle* artHandles, size_t count, size_t numDofs, DcDofState* states, const DcStateFlags& flags);
+
+    /**
+     * @brief Sets the degree of freedom states of a set of articulations
+     * @details Articulations are processed in parallel, a set listing an articulation more than once is rejected.
+     * @param[in] artHandles Array of articulation handles
+     * @param[in] count Number of articulation handles
+     * @param[in] numDofs Number of degrees of freedom of every articulation in the set
+     * @param[in] states Row-major [count, numDofs] array of degree of freedom states to set
+     * @param[in] flags Flags indicating which states to set (position, velocity, etc.)
+     * @return True if the states of all articulations were set, false otherwise
+     */
+    bool(CARB_ABI* setArticulationsDofStates)(
+        const DcHandle* artHandles, size_t count, size_t numDofs, const DcDofState* states, const DcStateFlags& flags);
+
+    /**
+     * @brief Sets the position targets of a set of articulations
+     * @details A set listing an articulation more than once is rejected.
+     * @param[in] artHandles Array of articulation handles
+     * @param[in] count Number of articulation handles
+     * @param[in] numDofs Number of degrees of freedom of every articulation in the set
+     * @param[in] targets Row-major [count, numDofs] array of position targets to set
+     * @return True if the targets of all articulations were set, false otherwise
+     */
+    bool(CARB_ABI* setArticulationsDofPositionTargets)(const DcHandle* artHandles,
+                                                        size_t count,
+                                                        size_t numDofs,
+                                                        const float* targets);
+
+    /**
+     * @brief Gets the position targets of a set of articulations
+     * @details A set listing an articulation more than once is rejected.
+     * @param[in] artHandles Array of articulation handles
+     * @param[in] count Number of articulation handles
+     * @param[in] numDofs Number of degrees of freedom of every articulation in the set
+     * @param[out] targets Row-major [count, numDofs] array to be filled with position targets
+     * @return True if the targets of all articulations were read, false otherwise
+     */
+    bool(CARB_ABI* getArticulationsDofPositionTargets)(const DcHandle* artHandles,
+                                                        size_t count,
+                                                        size_t numDofs,
+                                                        float* targets);
+
+    /**
+     * @brief Sets the velocity targets of a set of articulations
+     * @details A set listing an articulation more than once is rejected.
+     * @param[in] artHandles Array of articulation handles
+     * @param[in] count Number of articulation handles
+     * @param[in] numDofs Number of degrees of freedom of every articulation in the set
+     * @param[in] targets Row-major [count, numDofs] array of velocity targets to set
+     * @return True if the targets of all articulations were set, false otherwise
+     */
+    bool(CARB_ABI* setArticulationsDofVelocityTargets)(const DcHandle* artHandles,
+                                                        size_t count,
+                                                        size_t numDofs,
+                                                        const float* targets);
+
+    /**
+     * @brief Gets the velocity targets of a set of articulations
+     * @details A set listing an articulation more than once is rejected.
+     * @param[in] artHandles Array of articulation handles
+     * @param[in] count Number of articulation handles
+     * @param[in] numDofs Number of degrees of freedom of every articulation in the set
+     * @param[out] targets Row-major [count, numDofs] array to be filled with velocity targets
+     * @return True if the targets of all articulations were read, false otherwise
+     */
+    bool(CARB_ABI* getArticulationsDofVelocityTargets)(const DcHandle* artHandles,
+                                                        size_t count,
+                                                        size_t numDofs,
+                                                        float* targets);
+
+    /**
+     * @brief Sets the efforts of a set of articulations
+     * @details Articulations are processed in parallel, a set listing an articulation more than once is rejected.
+     * @param[in] artHandles Array of articulation handles
+     * @param[in] count Number of articulation handles
+     * @param[in] numDofs Number of degrees of freedom of every articulation in the set
+     * @param[in] efforts Row-major [count, numDofs] array of efforts to set
+     * @return True if the efforts of all articulations were set, false otherwise
+     */
+    bool(CARB_ABI* setArticulationsDofEfforts)(const DcHandle* artHandles,
+                                                size_t count,
+                                                size_t numDofs,
+                                                const float* efforts);
+
+    /**
+     * @brief Gets the efforts of a set of articulations
+     * @details Articulations are processed in parallel, a set listing an articulation more than once is rejected.
+     * @param[in] artHandles Array of articulation handles
+     * @param[in] count Number of articulation handles
+     * @param[in] numDofs Number of degrees of freedom of every articulation in the set
+     * @param[out] efforts Row-major [count, numDofs] array to be filled with efforts
+     * @return True if the efforts of all articulations were read, false otherwise
+     */
+    bool(CARB_ABI* getArticulationsDofEfforts)(const DcHandle* artHandles,
+                                                size_t count,
+                                                size_t numDofs,
+                                                float* efforts);
+
 #if 0
     DcShape(CARB_ABI* createShape)(int ndims, ...);
 
@@ -518,6 +518,8 @@ bool DcContext::refreshPhysicsPointers(DcArticulation* art, bool verbose)
     art->pxArticulationCache = nullptr;
     art->pxArticulation = nullptr;
     art->cacheAge = -1;
+    art->cacheFlags = PxArticulationCacheFlags(0);
+    art->dirtyFlags = PxArticulationCacheFlags(0);
 
     PxArticulationReducedCoordinate* abase =
         (PxArticulationReducedCoordinate*)physx->getPhysXPtr(art->path, omni::physx::PhysXType::ePTArticulation);
@@ -601,8 +603,29 @@ bool DcContext::refreshPhysicsPointers(DcD6Joint* j, bool verbose)
     return false;
 }
 
+void DcContext::queueArticulationFlush(const DcArticulation* art)
+{
+    std::lock_guard<std::mutex> lock(mDirtyArticulationsMutex);
+    mDirtyArticulations.push_back(art->handle);
+}
+
+void DcContext::flushArticulationCaches()
+{
+    std::lock_guard<std::mutex> lock(mDirtyArticulationsMutex);
+    for (DcHandle handle : mDirtyArticulations)
+    {
+        DcArticulation* art = getArticulation(handle);
+        if (art)
+        {
+            art->flushCache();
+        }
+    }
+    mDirtyArticulations.clear();
+}
+
 void DcContext::refreshPhysicsPointers(bool verbose)
 {
+    mDirtyArticulations.clear();
     for (auto& kv : mArticulationMap)
     {
         DcArticulation* art = getArticulation(kv.second);
@@ -25,7 +25,9 @@
 #include <carb/PluginUtils.h>
 #include <carb/events/EventsUtils.h>
 #include <carb/logging/Log.h>
+#include <carb/tasking/ITasking.h>
 
+#include <PxSceneLock.h>
 #include <extensions/PxRigidBodyExt.h>
 #include <isaacsim/core/includes/UsdNoticeListener.h>
 #include <omni/isaac/dynamic_control/DynamicControl.h>
@@ -33,6 +35,9 @@
 #include <omni/physx/IPhysx.h>
 #include <omni/physx/IPhysxSceneQuery.h>
 
+#include <algorithm>
+#include <atomic>
+#include <limits>
 #include <map>
 #include <string>
 #include <vector>
@@ -41,7 +46,10 @@ const struct carb::PluginImplDesc g_kPluginDesc = { "omni.isaac.dynamic_control.
                                                     "NVIDIA", carb::PluginHotReload::eDisabled, "dev" };
 
 CARB_PLUGIN_IMPL(g_kPluginDesc, omni::isaac::dynamic_control::DynamicControl)
-CARB_PLUGIN_IMPL_DEPS(omni::physx::IPhysx, omni::physx::IPhysxSceneQuery, omni::kit::IStageUpdate)
+CARB_PLUGIN_IMPL_DEPS(omni::physx::IPhysx,
+                      omni::physx::IPhysxSceneQuery,
+                      omni::kit::IStageUpdate,
+                      carb::tasking::ITasking)
 
 using namespace ::physx;
 using namespace pxr;
@@ -63,9 +71,11 @@ constexpr PxD6Axis::Enum g_dcToPxAxis[6]{
 omni::kit::StageUpdatePtr g_su = nullptr;
 omni::kit::StageUpdateNode* g_suNode = nullptr;
 omni::physx::SubscriptionId gStepSubscription;
+omni::physx::SubscriptionId gPreStepSubscription;
 carb::events::ISubscriptionPtr gEventSubscription;
 static omni::physx::IPhysx* gPhysXInterface = nullptr;
 omni::physx::IPhysxSceneQuery* gPhysxSceneQuery = nullptr;
+carb::tasking::ITasking* gTasking = nullptr;
 // Only one "current" context is supported now.  This is due to limitations in the IStageUpdate interface.
 uint32_t g_dcCtxId = 0;
 std::unique_ptr<DcContext> g_dcCtx = nullptr;
@@ -324,16 +334,26 @@ bool DcArticulation::refreshCache(const ::physx::PxArticulationCacheFlags& flags
         {
             return false;
         }
+        cacheAge = -1;
+        dirtyFlags = PxArticulationCacheFlags(0);
     }
 
-    // if (cacheAge < ctx->frameno)
-    //{
-
-    pxArticulation->copyInternalStateToCache(*pxArticulationCache, flags);
-
+    // the scene timestamp advances with every completed simulation step
+    const int64_t timestamp = static_cast<int64_t>(pxArticulation->getScene()->getTimestamp());
+    if (cacheAge != timestamp)
+    {
+        cacheFlags = PxArticulationCacheFlags(0);
+    }
+    if ((cacheFlags & flags) == flags)
+    {
+        return true;
+    }
 
-    //    cacheAge = ctx->frameno;
-    //}
+    // pending writes live in the cache, apply them before reading the articulation state back
+    flushCache();
+    pxArticulation->copyInternalStateToCache(*pxArticulationCache, flags & ~cacheFlags);
+    cacheFlags |= flags;
+    cacheAge = timestamp;
     // if (computeForces)
     // {
     //     // Call this before any inverse dynamics methods
@@ -348,6 +368,49 @@ bool DcArticulation::refreshCache(const ::physx::PxArticulationCacheFlags& flags
     return true;
 }
 
+void DcArticulation::queueCacheWrite(const ::physx::PxArticulationCacheFlags& flags) const
+{
+    // the cache still holds the written values, everything else has to be read back after the write
+    cacheFlags &= (flags | dirtyFlags);
+    if (!ctx->isStepping)
+    {
+        // no step is coming to flush the write, e.g. while paused
+        dirtyFlags |= flags;
+        flushCache();
+        return;
+    }
+    if (!dirtyFlags)
+    {
+        ctx->queueArticulationFlush(this);
+    }
+    dirtyFlags |= flags;
+}
+
+void DcArticulation::flushCache() const
+{
+    if (dirtyFlags && pxArticulation && pxArticulationCache && pxArticulation->getScene())
+    {
+        pxArticulation->applyCache(*pxArticulationCache, dirtyFlags);
+    }
+    dirtyFlags = PxArticulationCacheFlags(0);
+}
+
+void DcArticulation::invalidateCache(const ::physx::PxArticulationCacheFlags& flags) const
+{
+    cacheFlags &= ~flags;
+}
+
+namespace
+{
+// Rigid body state of articulation links depends on pending articulation cache writes
+inline void flushArticulationWrites()
+{
+    if (g_dcCtx)
+    {
+        g_dcCtx->flushArticulationCaches();
+    }
+}
+}
 
 bool CARB_ABI DcWakeUpRigidBody(DcHandle bodyHandle)
 {
@@ -890,6 +953,7 @@ DcRigidBodyState* CARB_ABI DcGetArticulationBodyStates(DcHandle artHandle, const
         return nullptr;
     }
 
+    art->flushCache();
     for (size_t i = 0; i < art->numRigidBodies(); i++)
     {
         PxRigidBody* body = art->rigidBodies[i]->pxRigidBody;
@@ -1256,6 +1320,9 @@ DcDofState* CARB_ABI DcGetArticulationDofStates(DcHandle artHandle, const DcStat
         // {
         //     printf("dof %d, force:  %f\n", i, art->pxArticulationCache->jointSolverForces[art->dofs[i]->cacheIdx]);
         // }
+        // gravity compensation is computed into jointForce, apply pending efforts before it is overwritten
+        art->flushCache();
+        art->invalidateCache(PxArticulationCacheFlag::eFORCE);
         // // Call this before any inverse dynamics methods
         art->pxArticulation->commonInit();
         // printf("--computeJointForce--\n");
@@ -1311,30 +1378,32 @@ DcDofState* CARB_ABI DcGetArticulationDofStates(DcHandle artHandle, const DcStat
     return art->dofStateCache.data();
 }
 
-bool CARB_ABI DcSetArticulationDofStates(DcHandle artHandle, const DcDofState* states, const DcStateFlags& flags)
+namespace
 {
-    if (!DC_CHECK_SIMULATING())
+PxArticulationCacheFlags getDofStateCacheFlags(const DcStateFlags& flags)
+{
+    PxArticulationCacheFlags pxFlags = PxArticulationCacheFlags(0);
+    if (flags & kDcStatePos)
     {
-        return false;
+        pxFlags |= PxArticulationCacheFlag::ePOSITION;
     }
-
-    DcArticulation* art = DC_LOOKUP_ARTICULATION(artHandle);
-    if (!art || !flags)
+    if (flags & kDcStateVel)
     {
-        return false;
+        pxFlags |= PxArticulationCacheFlag::eVELOCITY;
     }
-
-    if (!art->refreshCache())
+    if (flags & kDcStateEffort)
     {
-        return false;
+        pxFlags |= PxArticulationCacheFlag::eFORCE;
     }
+    return pxFlags;
+}
 
+// Copies dof states into the articulation cache, touches only the cache memory and makes no PhysX calls
+void scatterDofStates(const DcArticulation* art, const DcDofState* states, const DcStateFlags& flags)
+{
     size_t numDofs = art->numDofs();
-    PxArticulationCacheFlags pxFlags = PxArticulationCacheFlags(0);
-
     if (flags & kDcStatePos)
     {
-        pxFlags |= PxArticulationCacheFlag::ePOSITION;
         for (size_t i = 0; i < numDofs; i++)
         {
             size_t dofIndex = art->dofs[i]->cacheIdx;
@@ -1345,7 +1414,6 @@ bool CARB_ABI DcSetArticulationDofStates(DcHandle artHandle, const DcDofState* s
 
     if (flags & kDcStateVel)
     {
-        pxFlags |= PxArticulationCacheFlag::eVELOCITY;
         for (size_t i = 0; i < numDofs; i++)
         {
             art->pxArticulationCache->jointVelocity[art->dofs[i]->cacheIdx] = states[i].vel;
@@ -1353,21 +1421,49 @@ bool CARB_ABI DcSetArticulationDofStates(DcHandle artHandle, const DcDofState* s
     }
     if (flags & kDcStateEffort)
     {
-        pxFlags |= PxArticulationCacheFlag::eFORCE;
         for (size_t i = 0; i < numDofs; i++)
         {
             art->pxArticulationCache->jointForce[art->dofs[i]->cacheIdx] = states[i].effort;
         }
     }
+}
 
+// Applies dof states staged in the cache by scatterDofStates
+void commitDofStates(const DcArticulation* art, const DcStateFlags& flags)
+{
     // deprecated jointSolverForces is removed from pxArticulationCache
     // ZeroArray(art->pxArticulationCache->jointSolverForces, art->pxArticulation->getDofs());
     ZeroArray(art->pxArticulationCache->jointAcceleration, art->pxArticulation->getDofs());
 
     ZeroArray(art->pxArticulationCache->linkVelocity, art->pxArticulation->getNbLinks());
     ZeroArray(art->pxArticulationCache->linkAcceleration, art->pxArticulation->getNbLinks());
+    art->invalidateCache(PxArticulationCacheFlag::eACCELERATION | PxArticulationCacheFlag::eLINK_VELOCITY |
+                         PxArticulationCacheFlag::eLINK_ACCELERATION);
+
+    art->queueCacheWrite(getDofStateCacheFlags(flags));
+}
+}
+
+bool CARB_ABI DcSetArticulationDofStates(DcHandle artHandle, const DcDofState* states, const DcStateFlags& flags)
+{
+    if (!DC_CHECK_SIMULATING())
+    {
+        return false;
+    }
+
+    DcArticulation* art = DC_LOOKUP_ARTICULATION(artHandle);
+    if (!art || !flags)
+    {
+        return false;
+    }
+
+    if (!art->refreshCache())
+    {
+        return false;
+    }
 
-    art->pxArticulation->applyCache(*art->pxArticulationCache, pxFlags);
+    scatterDofStates(art, states, flags);
+    commitDofStates(art, flags);
 
     return true;
 }
@@ -1543,8 +1639,8 @@ bool CARB_ABI DcSetArticulationDofEfforts(DcHandle artHandle, const float* effor
         art->pxArticulationCache->jointForce[dof->cacheIdx] = efforts[i];
     }
 
-    // apply forces
-    art->pxArticulation->applyCache(*art->pxArticulationCache, PxArticulationCacheFlag::eFORCE);
+    // apply forces before the next simulation step
+    art->queueCacheWrite(PxArticulationCacheFlag::eFORCE);
 
     return true;
 }
@@ -1599,6 +1695,7 @@ bool CARB_ABI DcGetArticulationDofMasses(DcHandle artHandle, float* masses)
         return false;
     }
 
+    art->flushCache();
     art->pxArticulation->commonInit();
     art->pxArticulation->computeGeneralizedMassMatrix(*art->pxArticulationCache);
     size_t numDofs = art->numDofs();
@@ -1610,6 +1707,263 @@ bool CARB_ABI DcGetArticulationDofMasses(DcHandle artHandle, float* masses)
     return true;
 }
 
+namespace
+{
+// Runs fn() while holding the write lock of the scene the articulation is in
+template <typename Func>
+bool runWithSceneWriteLock(const DcArticulation* art, Func&& fn)
+{
+    PxScene* scene = art->pxArticulation ? art->pxArticulation->getScene() : nullptr;
+    if (!scene)
+    {
+        return fn();
+    }
+    PxSceneWriteLock lock(*scene);
+    return fn();
+}
+
+void gatherNothing(DcArticulation*, size_t)
+{
+}
+
+bool finishNothing(DcArticulation*)
+{
+    return true;
+}
+
+// Processes every articulation of a set whose rows are packed with numDofs entries each, in three phases.
+// prepare(art, rowOffset) makes the PhysX calls, e.g. refreshing the cache, serially under the scene write lock.
+// gather(art, rowOffset) only copies rows between the caller arrays and the articulation cache, so it runs in parallel.
+// finish(art) applies what was written to the cache, serially under the scene write lock.
+// The handles are resolved serially first, and a set listing an articulation more than once is rejected, since its
+// rows would be read and written concurrently.
+template <typename Prepare, typename Gather, typename Finish>
+bool forEachArticulationInSet(const DcHandle* artHandles,
+                              size_t count,
+                              size_t numDofs,
+                              const char* funcname,
+                              Prepare&& prepare,
+                              Gather&& gather,
+                              Finish&& finish)
+{
+    if (!checkSimulating(funcname))
+    {
+        return false;
+    }
+    if (!artHandles && count > 0)
+    {
+        return false;
+    }
+
+    std::vector<DcArticulation*> arts(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        DcArticulation* art = lookupArticulation(artHandles[i], funcname);
+        if (!art)
+        {
+            return false;
+        }
+        if (art->numDofs() != numDofs)
+        {
+            CARB_LOG_ERROR("%s: Articulation %s has %zu dofs, expected %zu", funcname, art->path.GetText(),
+                           art->numDofs(), numDofs);
+            return false;
+        }
+        arts[i] = art;
+    }
+    std::vector<DcArticulation*> sortedArts(arts);
+    std::sort(sortedArts.begin(), sortedArts.end());
+    auto duplicate = std::adjacent_find(sortedArts.begin(), sortedArts.end());
+    if (duplicate != sortedArts.end())
+    {
+        CARB_LOG_ERROR("%s: Articulation %s is listed more than once", funcname, (*duplicate)->path.GetText());
+        return false;
+    }
+
+    flushArticulationWrites();
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (!runWithSceneWriteLock(arts[i], [&]() { return prepare(arts[i], i * numDofs); }))
+        {
+            return false;
+        }
+    }
+
+    auto process = [&](size_t index) { gather(arts[index], index * numDofs); };
+    if (gTasking && count > 1)
+    {
+        gTasking->applyRange(count, process);
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            process(i);
+        }
+    }
+
+    bool success = true;
+    for (DcArticulation* art : arts)
+    {
+        if (!runWithSceneWriteLock(art, [&]() { return finish(art); }))
+        {
+            success = false;
+        }
+    }
+    return success;
+}
+
+bool refreshArticulationCache(DcArticulation* art, size_t)
+{
+    return art->refreshCache();
+}
+}
+
+bool CARB_ABI DcGetArticulationsDofStates(
+    const DcHandle* artHandles, size_t count, size_t numDofs, DcDofState* states, const DcStateFlags& flags)
+{
+    if (!states)
+    {
+        return false;
+    }
+    // states are computed into the dof state buffer of each articulation, then copied out in parallel
+    return forEachArticulationInSet(
+        artHandles, count, numDofs, __func__,
+        [&](DcArticulation* art, size_t) { return DcGetArticulationDofStates(art->handle, flags) != nullptr; },
+        [&](DcArticulation* art, size_t offset)
+        { std::copy(art->dofStateCache.begin(), art->dofStateCache.begin() + numDofs, states + offset); },
+        finishNothing);
+}
+
+bool CARB_ABI DcSetArticulationsDofStates(
+    const DcHandle* artHandles, size_t count, size_t numDofs, const DcDofState* states, const DcStateFlags& flags)
+{
+    if (!states || !flags)
+    {
+        return false;
+    }
+    // states are copied into each articulation cache in parallel, then queued for the next simulation step
+    return forEachArticulationInSet(
+        artHandles, count, numDofs, __func__, refreshArticulationCache,
+        [&](DcArticulation* art, size_t offset) { scatterDofStates(art, states + offset, flags); },
+        [&](DcArticulation* art)
+        {
+            commitDofStates(art, flags);
+            return true;
+        });
+}
+
+bool CARB_ABI DcSetArticulationsDofPositionTargets(const DcHandle* artHandles,
+                                                   size_t count,
+                                                   size_t numDofs,
+                                                   const float* targets)
+{
+    if (!targets)
+    {
+        return false;
+    }
+    // drive targets are set on the PhysX joints, so there is nothing to copy in parallel
+    return forEachArticulationInSet(
+        artHandles, count, numDofs, __func__,
+        [&](DcArticulation* art, size_t offset)
+        { return DcSetArticulationDofPositionTargets(art->handle, targets + offset); },
+        gatherNothing, finishNothing);
+}
+
+bool CARB_ABI DcGetArticulationsDofPositionTargets(const DcHandle* artHandles,
+                                                   size_t count,
+                                                   size_t numDofs,
+                                                   float* targets)
+{
+    if (!targets)
+    {
+        return false;
+    }
+    return forEachArticulationInSet(
+        artHandles, count, numDofs, __func__,
+        [&](DcArticulation* art, size_t offset)
+        { return DcGetArticulationDofPositionTargets(art->handle, targets + offset); },
+        gatherNothing, finishNothing);
+}
+
+bool CARB_ABI DcSetArticulationsDofVelocityTargets(const DcHandle* artHandles,
+                                                   size_t count,
+                                                   size_t numDofs,
+                                                   const float* targets)
+{
+    if (!targets)
+    {
+        return false;
+    }
+    return forEachArticulationInSet(
+        artHandles, count, numDofs, __func__,
+        [&](DcArticulation* art, size_t offset)
+        { return DcSetArticulationDofVelocityTargets(art->handle, targets + offset); },
+        gatherNothing, finishNothing);
+}
+
+bool CARB_ABI DcGetArticulationsDofVelocityTargets(const DcHandle* artHandles,
+                                                   size_t count,
+                                                   size_t numDofs,
+                                                   float* targets)
+{
+    if (!targets)
+    {
+        return false;
+    }
+    return forEachArticulationInSet(
+        artHandles, count, numDofs, __func__,
+        [&](DcArticulation* art, size_t offset)
+        { return DcGetArticulationDofVelocityTargets(art->handle, targets + offset); },
+        gatherNothing, finishNothing);
+}
+
+bool CARB_ABI DcSetArticulationsDofEfforts(const DcHandle* artHandles,
+                                           size_t count,
+                                           size_t numDofs,
+                                           const float* efforts)
+{
+    if (!efforts)
+    {
+        return false;
+    }
+    // efforts are copied into each articulation cache in parallel, then queued for the next simulation step
+    return forEachArticulationInSet(
+        artHandles, count, numDofs, __func__, refreshArticulationCache,
+        [&](DcArticulation* art, size_t offset)
+        {
+            for (size_t i = 0; i < numDofs; i++)
+            {
+                art->pxArticulationCache->jointForce[art->dofs[i]->cacheIdx] = efforts[offset + i];
+            }
+        },
+        [&](DcArticulation* art)
+        {
+            art->queueCacheWrite(PxArticulationCacheFlag::eFORCE);
+            return true;
+        });
+}
+
+bool CARB_ABI DcGetArticulationsDofEfforts(const DcHandle* artHandles, size_t count, size_t numDofs, float* efforts)
+{
+    if (!efforts)
+    {
+        return false;
+    }
+    // the cache is refreshed serially, then the efforts are copied out in parallel
+    return forEachArticulationInSet(
+        artHandles, count, numDofs, __func__, refreshArticulationCache,
+        [&](DcArticulation* art, size_t offset)
+        {
+            for (size_t i = 0; i < numDofs; i++)
+            {
+                efforts[offset + i] = art->pxArticulationCache->jointForce[art->dofs[i]->cacheIdx];
+            }
+        },
+        finishNothing);
+}
+
 // rigid bodies
 
 const char* CARB_ABI DcGetRigidBodyName(DcHandle bodyHandle)
@@ -1694,6 +2048,7 @@ DcTransform CARB_ABI DcGetRigidBodyPose(DcHandle bodyHandle)
         return kTransformIdentity;
     }
 
+    flushArticulationWrites();
     DcRigidBody* body = DC_LOOKUP_RIGID_BODY(bodyHandle);
     if (body && body->pxRigidBody)
     {
@@ -1717,6 +2072,7 @@ carb::Float3 CARB_ABI DcGetRigidBodyLinearVelocity(DcHandle bodyHandle)
         return kFloat3Zero;
     }
 
+    flushArticulationWrites();
     DcRigidBody* body = DC_LOOKUP_RIGID_BODY(bodyHandle);
     if (body && body->pxRigidBody)
     {
@@ -1732,6 +2088,7 @@ carb::Float3 CARB_ABI DcGetRigidBodyLocalLinearVelocity(DcHandle bodyHandle)
         return kFloat3Zero;
     }
 
+    flushArticulationWrites();
     DcRigidBody* body = DC_LOOKUP_RIGID_BODY(bodyHandle);
     if (body && body->pxRigidBody)
     {
@@ -1751,6 +2108,7 @@ carb::Float3 CARB_ABI DcGetRigidBodyAngularVelocity(DcHandle bodyHandle)
         return kFloat3Zero;
     }
 
+    flushArticulationWrites();
     DcRigidBody* body = DC_LOOKUP_RIGID_BODY(bodyHandle);
     if (body && body->pxRigidBody)
     {
@@ -2026,6 +2384,7 @@ bool CARB_ABI DcGetRelativeBodyPoses(DcHandle parentHandle,
     {
         return false;
     }
+    flushArticulationWrites();
     DcRigidBody* parent = DC_LOOKUP_RIGID_BODY(parentHandle);
     if (parent && parent->pxRigidBody)
     {
@@ -2354,6 +2713,9 @@ DcDofState CARB_ABI DcGetDofState(DcHandle dofHandle, const DcStateFlags& flags)
             if (flags & kDcStateEffort)
             {
                 // Not efficient, faster to use batched version for entire articulation
+                // gravity compensation is computed into jointForce, apply pending efforts before it is overwritten
+                dof->art->flushCache();
+                dof->art->invalidateCache(PxArticulationCacheFlag::eFORCE);
                 dof->art->pxArticulation->commonInit();
                 // dof->art->pxArticulation->computeJointForce(*dof->art->pxArticulationCache);
                 // state.effort = dof->art->pxArticulationCache->jointForce[dof->cacheIdx];
@@ -2395,7 +2757,7 @@ bool CARB_ABI DcSetDofState(DcHandle dofHandle, const DcDofState* state, const D
                 art->pxArticulationCache->jointForce[dof->cacheIdx] = state->effort;
             }
 #if 1
-            art->pxArticulation->applyCache(*art->pxArticulationCache, pxFlags);
+            art->queueCacheWrite(pxFlags);
 #else
             ZeroArray(art->pxArticulationCache->jointForce, art->pxArticulation->getDofs());
             ZeroArray(art->pxArticulationCache->jointAcceleration, art->pxArticulation->getDofs());
@@ -2443,7 +2805,7 @@ bool CARB_ABI DcSetDofPosition(DcHandle dofHandle, float pos)
         {
             art->pxArticulationCache->jointPosition[dof->cacheIdx] = pos;
 #if 1
-            art->pxArticulation->applyCache(*art->pxArticulationCache, PxArticulationCacheFlag::ePOSITION);
+            art->queueCacheWrite(PxArticulationCacheFlag::ePOSITION);
 #else
             ZeroArray(art->pxArticulationCache->jointForce, art->pxArticulation->getDofs());
             ZeroArray(art->pxArticulationCache->jointAcceleration, art->pxArticulation->getDofs());
@@ -2491,7 +2853,7 @@ bool CARB_ABI DcSetDofVelocity(DcHandle dofHandle, float vel)
         {
             art->pxArticulationCache->jointVelocity[dof->cacheIdx] = vel;
 #if 1
-            art->pxArticulation->applyCache(*art->pxArticulationCache, PxArticulationCacheFlag::eVELOCITY);
+            art->queueCacheWrite(PxArticulationCacheFlag::eVELOCITY);
 #else
             ZeroArray(art->pxArticulationCache->jointForce, art->pxArticulation->getDofs());
             ZeroArray(art->pxArticulationCache->jointAcceleration, art->pxArticulation->getDofs());
@@ -2730,17 +3092,16 @@ bool CARB_ABI DcSetDofEffort(DcHandle dofHandle, float effort)
         return false;
     }
 
-    // Calling this method for individual dofs is not very efficient,
-    // since it uses the full parent articulation cache each time.
-    // Prefer DcApplyArticulationDofEfforts for multiple DOF efforts.
+    // The parent articulation cache is refreshed at most once per physics step and
+    // writes are applied together before the next step.
 
     // clear forces
     // ZeroArray(art->pxArticulationCache->jointForce, art->pxArticulation->getDofs());
 
     art->pxArticulationCache->jointForce[dof->cacheIdx] = effort;
 
-    // apply forces
-    art->pxArticulation->applyCache(*art->pxArticulationCache, PxArticulationCacheFlag::eFORCE);
+    // apply forces before the next simulation step
+    art->queueCacheWrite(PxArticulationCacheFlag::eFORCE);
 
     return true;
 }
@@ -2764,9 +3125,8 @@ float CARB_ABI DcGetDofEffort(DcHandle dofHandle)
         return 0.0f;
     }
 
-    // Calling this method for individual dofs is not very efficient,
-    // since it uses the full parent articulation cache each time.
-    // Prefer DcApplyArticulationDofEfforts for multiple DOF efforts.
+    // The parent articulation cache is refreshed at most once per physics step and
+    // writes are applied together before the next step.
 
     // clear forces
     // ZeroArray(art->pxArticulationCache->jointForce, art->pxArticulation->getDofs());
@@ -3645,6 +4005,9 @@ void SuPause()
     if (g_dcCtx)
     {
         g_dcCtx->wasPaused = true;
+        // writes made while paused are applied immediately, apply the ones still waiting for a step
+        g_dcCtx->isStepping = false;
+        g_dcCtx->flushArticulationCaches();
     }
 }
 
@@ -3677,6 +4040,7 @@ void SuStop()
         // g_dcCtx->refreshPhysicsPointers(false);
         g_dcCtx->isSimulating = false;
         g_dcCtx->wasPaused = false;
+        g_dcCtx->isStepping = false;
     }
 }
 
@@ -3690,6 +4054,17 @@ void SuUpdate(float timeElapsed, void* userData)
     }
 }
 
+void SuPreStep(float timeElapsed, void* userData)
+{
+    CARB_PROFILE_ZONE(0, "DcPhysx::SuPreStep");
+    if (g_dcCtx)
+    {
+        // apply articulation writes queued since the last step, other pre-step callbacks already ran
+        g_dcCtx->isStepping = true;
+        g_dcCtx->flushArticulationCaches();
+    }
+}
+
 
 void CARB_ABI onPrimRemove(const pxr::SdfPath& primPath, void* userData)
 {
@@ -3771,7 +4146,12 @@ CARB_EXPORT void carbOnPluginStartup()
         auto desc = gPhysxSceneQuery->getInterfaceDesc();
         CARB_LOG_INFO("Acquired interface '%s', version %d.%d\n", desc.name, desc.version.major, desc.version.minor);
     }
+    gTasking = carb::getCachedInterface<carb::tasking::ITasking>();
+
     gStepSubscription = gPhysXInterface->subscribePhysicsOnStepEvents(false, 0, SuUpdate, nullptr);
+    // run last among the pre-step callbacks so writes they make are flushed into the same step
+    gPreStepSubscription =
+        gPhysXInterface->subscribePhysicsOnStepEvents(true, std::numeric_limits<int>::max(), SuPreStep, nullptr);
 
     gEventSubscription = carb::events::createSubscriptionToPop(
         gPhysXInterface->getSimulationEventStreamV2().get(),
@@ -3816,6 +4196,7 @@ CARB_EXPORT void carbOnPluginShutdown()
 {
     using namespace omni::isaac::dynamic_control;
     gPhysXInterface->unsubscribePhysicsOnStepEvents(gStepSubscription);
+    gPhysXInterface->unsubscribePhysicsOnStepEvents(gPreStepSubscription);
     gEventSubscription = nullptr;
     if (g_suNode)
     {
@@ -3949,4 +4330,13 @@ void fillInterface(omni::isaac::dynamic_control::DynamicControl& iface)
     iface.setOriginOffset = DcSetOriginOffset;
 
     iface.rayCast = DcRayCast;
+
+    iface.getArticulationsDofStates = DcGetArticulationsDofStates;
+    iface.setArticulationsDofStates = DcSetArticulationsDofStates;
+    iface.setArticulationsDofPositionTargets = DcSetArticulationsDofPositionTargets;
+    iface.getArticulationsDofPositionTargets = DcGetArticulationsDofPositionTargets;
+    iface.setArticulationsDofVelocityTargets = DcSetArticulationsDofVelocityTargets;
+    iface.getArticulationsDofVelocityTargets = DcGetArticulationsDofVelocityTargets;
+    iface.setArticulationsDofEfforts = DcSetArticulationsDofEfforts;
+    iface.getArticulationsDofEfforts = DcGetArticulationsDofEfforts;
 }
@@ -18,6 +18,7 @@
 #include "DcCommon.h"
 #include "DcTypes.h"
 
+#include <mutex>
 
 namespace omni
 {
@@ -300,12 +301,32 @@ public:
      */
     bool wasPaused = false;
 
+    /**
+     * @brief Flag indicating whether physics steps are being run
+     * @details Set by the pre-step callback and cleared on pause and stop. Articulation writes are deferred to the
+     * next step only while this is set, otherwise they are applied immediately.
+     */
+    bool isStepping = false;
+
     /**
      * @brief Refreshes the physics pointers after a reset
      * @param[in] verbose Whether to print verbose output
      */
     void refreshPhysicsPointers(bool verbose);
 
+    /**
+     * @brief Registers an articulation with pending cache writes
+     * @details Safe to call concurrently for different articulations.
+     * @param[in] art The articulation to flush before the next simulation step
+     */
+    void queueArticulationFlush(const DcArticulation* art);
+
+    /**
+     * @brief Applies the pending cache writes of all articulations
+     * @details Called before each simulation step and before reading state the pending writes affect.
+     */
+    void flushArticulationCaches();
+
 private:
     // refresh after a physics reset
     bool refreshPhysicsPointers(DcRigidBody* body, bool verbose);
@@ -336,6 +357,10 @@ private:
     // e.g., dof at the same path as a revolute/prismatic joint
     // e.g., multiple dofs of a spherical joint
     std::unordered_map<pxr::SdfPath, std::set<DcHandle>, pxr::SdfPath::Hash> mHandleMap;
+
+    // Articulations with pending cache writes, stored as handles so removed articulations are skipped
+    std::vector<DcHandle> mDirtyArticulations;
+    std::mutex mDirtyArticulationsMutex;
 };
 
 }
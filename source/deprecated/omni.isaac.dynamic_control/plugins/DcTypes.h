@@ -281,11 +281,38 @@ struct DcArticulation
 
     /**
      * @brief Refreshes the PhysX articulation cache
+     * @details
+     * The cache is stamped with the scene timestamp and the flags it was filled with, so repeated
+     * reads within one physics step are served from memory. Pending writes are flushed before any
+     * part of the cache is copied back from the articulation.
+     *
      * @param[in] flags Flags indicating which parts of the cache to refresh
      * @return True if successful, false otherwise
      */
     bool refreshCache(const ::physx::PxArticulationCacheFlags& flags = ::physx::PxArticulationCacheFlag::eALL) const;
 
+    /**
+     * @brief Marks parts of the cache as written, to be applied to the articulation by flushCache
+     * @details
+     * While the simulation is stepping, writes to the same articulation within one physics step are coalesced into a
+     * single applyCache right before the step. Otherwise the write is applied immediately. Cached state that is not
+     * being written is invalidated, since it may depend on the written state.
+     *
+     * @param[in] flags Flags indicating which parts of the cache were written
+     */
+    void queueCacheWrite(const ::physx::PxArticulationCacheFlags& flags) const;
+
+    /**
+     * @brief Applies pending cache writes to the articulation
+     */
+    void flushCache() const;
+
+    /**
+     * @brief Drops parts of the cache whose contents no longer match the articulation state
+     * @param[in] flags Flags indicating which parts of the cache to invalidate
+     */
+    void invalidateCache(const ::physx::PxArticulationCacheFlags& flags) const;
+
     /**
      * @brief Handle to this articulation
      */
@@ -352,10 +379,20 @@ struct DcArticulation
     mutable ::physx::PxArticulationCache* pxArticulationCache = nullptr;
 
     /**
-     * @brief Age of the cache, used to determine when to refresh
+     * @brief Scene timestamp the cache was refreshed at, used to determine when to refresh
      */
     mutable int64_t cacheAge = -1;
 
+    /**
+     * @brief Parts of the cache that are valid for cacheAge
+     */
+    mutable ::physx::PxArticulationCacheFlags cacheFlags = ::physx::PxArticulationCacheFlags(0);
+
+    /**
+     * @brief Parts of the cache that were written and not yet applied to the articulation
+     */
+    mutable ::physx::PxArticulationCacheFlags dirtyFlags = ::physx::PxArticulationCacheFlags(0);
+
     /**
      * @brief Cache of rigid body states
      */
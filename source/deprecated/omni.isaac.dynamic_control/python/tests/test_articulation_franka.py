@@ -22,7 +22,7 @@ from isaacsim.storage.native import get_assets_root_path_async
 from omni.isaac.dynamic_control import _dynamic_control
 from omni.isaac.dynamic_control import conversions as dc_conversions
 from omni.isaac.dynamic_control import utils as dc_utils
-from pxr import Gf
+from pxr import Gf, UsdGeom
 
 
 # Having a test class dervived from omni.kit.test.AsyncTestCase declared on the root of module will make it auto-discoverable by omni.kit.test
@@ -298,6 +298,44 @@ class TestArticulationFranka(omni.kit.test.AsyncTestCase):
                     msg=f"{self._dc.get_dof_position_target(dof_ptr)} += {new_pos}",
                 )
 
+    async def test_articulation_set(self, gpu=False):
+        dc_utils.set_scene_physics_type(gpu)
+        # second robot placed next to the first one
+        UsdGeom.Xform.Define(self._stage, "/env_1").AddTranslateOp().Set(Gf.Vec3d(0, 1.0, 0))
+        prim = self._stage.DefinePrim("/env_1/panda", "Xform")
+        prim.GetReferences().AddReference(
+            self._assets_root_path + "/Isaac/Robots/FrankaRobotics/FrankaPanda/franka.usd"
+        )
+        self._timeline.play()
+        await omni.kit.app.get_app().next_update_async()
+        arts = np.array([self._dc.get_articulation(path) for path in ["/panda", "/env_1/panda"]], dtype=np.uint64)
+        self.assertTrue(np.all(arts != _dynamic_control.INVALID_HANDLE))
+        num_dofs = self._dc.get_articulation_dof_count(int(arts[0]))
+
+        # batched reads match the per articulation reads
+        dof_states = self._dc.get_articulations_dof_states(arts, _dynamic_control.STATE_ALL)
+        self.assertEqual(dof_states.shape, (2, num_dofs))
+        for i, art in enumerate(arts):
+            single_states = self._dc.get_articulation_dof_states(int(art), _dynamic_control.STATE_POS)
+            self.assertTrue(np.allclose(dof_states["pos"][i], single_states["pos"]))
+
+        # batched writes are visible to per articulation reads
+        targets = np.stack([np.full(num_dofs, 0.01, dtype=np.float32), np.full(num_dofs, 0.02, dtype=np.float32)])
+        self.assertTrue(self._dc.set_articulations_dof_position_targets(arts, targets))
+        self.assertTrue(np.allclose(self._dc.get_articulations_dof_position_targets(arts), targets))
+        self.assertTrue(np.allclose(self._dc.get_articulation_dof_position_targets(int(arts[1])), targets[1]))
+        # values must have exactly one row per articulation, and each articulation may only be listed once
+        self.assertFalse(self._dc.set_articulations_dof_position_targets(arts, np.concatenate([targets, targets])))
+        duplicates = np.array([arts[1], arts[1]])
+        self.assertFalse(self._dc.set_articulations_dof_efforts(duplicates, targets))
+        self.assertIsNone(self._dc.get_articulations_dof_states(duplicates, _dynamic_control.STATE_POS))
+        dof_states["pos"] = targets
+        self.assertTrue(self._dc.set_articulations_dof_states(arts, dof_states, _dynamic_control.STATE_POS))
+        await omni.kit.app.get_app().next_update_async()
+        dof_states = self._dc.get_articulations_dof_states(arts, _dynamic_control.STATE_POS)
+        self.assertTrue(np.allclose(dof_states["pos"], targets, atol=1e-2))
+        pass
+
     # async def test_masses(self, gpu=False):
     #     dc_utils.set_scene_physics_type(gpu)
     #     self._physics_scene = UsdPhysics.Scene(self._stage.GetPrimAtPath("/physicsScene"))
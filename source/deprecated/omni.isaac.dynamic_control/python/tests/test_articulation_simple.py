@@ -646,6 +646,79 @@ class TestArticulationSimple(omni.kit.test.AsyncTestCase):
             f"new_pose.p = {new_pose.p}",
         )
 
+    async def test_dof_write_read_back(self, gpu=False):
+        dc_utils.set_scene_physics_type(gpu)
+        self._timeline.play()
+        await omni.kit.app.get_app().next_update_async()
+        art = self._dc.get_articulation("/Articulation")
+        self.assertNotEqual(art, _dynamic_control.INVALID_HANDLE)
+        slider_body = self._dc.find_articulation_body(art, "Slider")
+        dof_ptr = self._dc.find_articulation_dof(art, "RevoluteJoint")
+        pos_target = math.radians(45)
+        # writes are visible to reads made before the next physics step
+        self._dc.set_dof_position(dof_ptr, pos_target)
+        self.assertAlmostEqual(self._dc.get_dof_position(dof_ptr), pos_target, delta=1e-6)
+        state = self._dc.get_articulation_dof_states(art, _dynamic_control.STATE_POS)
+        self.assertAlmostEqual(state["pos"][0], pos_target, delta=1e-6, msg=f'{state["pos"]}')
+        # rigid body reads of links see the pending write as well
+        new_pose = self._dc.get_rigid_body_pose(slider_body)
+        self.assertTrue(
+            np.allclose([new_pose.p.x, new_pose.p.y, new_pose.p.z], [1.06066, 1.06066, 0], atol=1e-5), f"{new_pose.p}"
+        )
+
+    async def test_dof_write_coalescing(self, gpu=False):
+        dc_utils.set_scene_physics_type(gpu)
+        self._timeline.play()
+        await omni.kit.app.get_app().next_update_async()
+        art = self._dc.get_articulation("/Articulation")
+        self.assertNotEqual(art, _dynamic_control.INVALID_HANDLE)
+        slider_body = self._dc.find_articulation_body(art, "Slider")
+        revolute_ptr = self._dc.find_articulation_dof(art, "RevoluteJoint")
+        prismatic_ptr = self._dc.get_articulation_dof(art, 1)
+        props = self._dc.get_articulation_dof_properties(art)
+        for i in range(self._dc.get_articulation_dof_count(art)):
+            props[i]["stiffness"] = 1e8
+            props[i]["damping"] = 1e8
+        self._dc.set_articulation_dof_properties(art, props)
+        # several writes to the same articulation within one step all reach the simulation
+        new_state = [math.radians(45), 1.00]
+        self._dc.set_dof_position(revolute_ptr, 0.0)
+        self._dc.set_dof_position(revolute_ptr, new_state[0])
+        self._dc.set_dof_position(prismatic_ptr, new_state[1])
+        self._dc.set_dof_velocity(revolute_ptr, 0.0)
+        self._dc.set_articulation_dof_position_targets(art, new_state)
+        await omni.kit.app.get_app().next_update_async()
+        state = self._dc.get_articulation_dof_states(art, _dynamic_control.STATE_ALL)
+        self.assertTrue(np.allclose(new_state, state["pos"], atol=1e-4), f'{new_state}, {state["pos"]}')
+        new_pose = self._dc.get_rigid_body_pose(slider_body)
+        self.assertTrue(
+            np.allclose([new_pose.p.x, new_pose.p.y, new_pose.p.z], [1.76777, 1.76777, 0], atol=1e-4), f"{new_pose.p}"
+        )
+
+    async def test_dof_write_paused(self, gpu=False):
+        dc_utils.set_scene_physics_type(gpu)
+        self._timeline.play()
+        await omni.kit.app.get_app().next_update_async()
+        art = self._dc.get_articulation("/Articulation")
+        self.assertNotEqual(art, _dynamic_control.INVALID_HANDLE)
+        slider_body = self._dc.find_articulation_body(art, "Slider")
+        dof_ptr = self._dc.find_articulation_dof(art, "RevoluteJoint")
+        self._timeline.pause()
+        await omni.kit.app.get_app().next_update_async()
+        # no physics step runs while paused, the write has to be applied right away
+        pos_target = math.radians(45)
+        self._dc.set_dof_position(dof_ptr, pos_target)
+        await omni.kit.app.get_app().next_update_async()
+        self.assertAlmostEqual(self._dc.get_dof_position(dof_ptr), pos_target, delta=1e-6)
+        new_pose = self._dc.get_rigid_body_pose(slider_body)
+        self.assertTrue(
+            np.allclose([new_pose.p.x, new_pose.p.y, new_pose.p.z], [1.06066, 1.06066, 0], atol=1e-5), f"{new_pose.p}"
+        )
+        # the write survives resuming the simulation
+        self._timeline.play()
+        await omni.kit.app.get_app().next_update_async()
+        self.assertAlmostEqual(self._dc.get_dof_position(dof_ptr), pos_target, delta=1e-2)
+
     async def test_articulation_type(self, gpu=False):
         dc_utils.set_scene_physics_type(gpu)
 
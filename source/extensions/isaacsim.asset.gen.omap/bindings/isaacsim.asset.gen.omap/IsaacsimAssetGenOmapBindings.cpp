@@ -24,6 +24,7 @@
 #include <omni/physx/IPhysx.h>
 #include <pybind11/chrono.h>
 #include <pybind11/functional.h>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
@@ -132,6 +133,29 @@ Args:
     min_bound (tuple of float): Minimum bound to map up to.
     max_bound (tuple of float): Maximum bound to map up to.
 
+Returns:
+    None
+)doc")
+        .def("set_num_threads", &MapGenerator::setNumThreads, R"doc(Set the number of worker threads used for map generation.
+
+The grid is split into tiles that are processed in parallel and merged into the map once.
+
+Args:
+    num_threads (int): Number of worker threads. 0 uses all hardware threads and 1 runs serially.
+
+Returns:
+    None
+)doc")
+        .def("set_adaptive_levels", &MapGenerator::setAdaptiveLevels,
+             R"doc(Enable coarse-to-fine map generation.
+
+Generation starts with one overlap query per block of 2^levels cells along each axis.
+Blocks that do not overlap any geometry are marked free without further queries, and
+blocks that do are subdivided until single cells are reached.
+
+Args:
+    levels (int): Number of octree levels above single cells at which generation starts. 0 tests every cell.
+
 Returns:
     None
 )doc")
@@ -154,6 +178,30 @@ Generates a map based on the settings and transform set. Creates a full
 Args:
     None
 
+Returns:
+    None
+)doc")
+        .def("update_regions", &MapGenerator::updateRegions, R"doc(Update the map inside a set of regions.
+
+Re-queries only the cells that intersect the given axis-aligned regions and patches the
+map in place, using the settings of the last generate2d() or generate3d() call.
+Pass both the old and the new bounds of an object that moved.
+
+Args:
+    min_points (list of tuple): Minimum corner of each region in stage coordinates.
+    max_points (list of tuple): Maximum corner of each region in stage coordinates.
+
+Returns:
+    None
+)doc")
+        .def("update_prims", &MapGenerator::updatePrims, R"doc(Update the map around a set of changed prims.
+
+Re-queries the cells inside the current bounds of each prim, and inside the bounds
+recorded during the previous call for the same prim.
+
+Args:
+    prim_paths (list of str): Paths of the prims that changed.
+
 Returns:
     None
 )doc")
@@ -190,6 +238,131 @@ Returns:
     list: 2D array containing values for each cell in the occupancy map.
         Values correspond to the occupancy state of each cell (occupied,
         unoccupied, or unknown) as configured in update_settings().
+        Empty until generate2d() or generate3d() is called, and laid out with
+        get_buffer_dimensions() until the map is generated again.
+)doc")
+        .def("get_buffer_dimensions", &MapGenerator::getBufferDimensions,
+             R"doc(Get the dimensions of the map at the last generation in cell units.
+
+Returns:
+    tuple: Dimensions (width, height, depth) of get_buffer() and the buffer views, which differ
+        from get_dimensions() after changing the settings or transform until the map is generated again.
+)doc")
+        .def(
+            "get_buffer_view",
+            [](py::object self)
+            {
+                MapGenerator& generator = self.cast<MapGenerator&>();
+                const std::vector<float>& buffer = generator.getDenseBuffer();
+                // The buffer keeps the layout of the last generation, not the current settings
+                carb::Int3 dims = generator.getBufferDimensions();
+                if (buffer.empty() || buffer.size() != static_cast<size_t>(dims.x) * dims.y)
+                {
+                    return py::array_t<float>();
+                }
+                // The generator owns the memory, keep it alive for as long as the array exists
+                py::array_t<float> view(
+                    py::buffer_info(const_cast<float*>(buffer.data()), sizeof(float),
+                                    py::format_descriptor<float>::format(), 2, { dims.y, dims.x },
+                                    { sizeof(float) * dims.x, sizeof(float) }),
+                    self);
+                view.attr("setflags")(py::arg("write") = false);
+                return view;
+            },
+            R"doc(Get the occupancy buffer as a read-only numpy array without copying.
+
+The array shares memory with the generator. Its content matches get_buffer(), shaped as
+(rows, columns) = (dimensions[1], dimensions[0]) with the dimensions of the last generation.
+Calling this again after generating or updating the map refreshes the same memory in place,
+so earlier arrays see the new values.
+
+Returns:
+    numpy.ndarray: 2D float32 array of occupancy values, empty before the map is generated.
+
+Warning:
+    Arrays returned before a generation with different bounds or cell size must not be used.
+)doc")
+        .def(
+            "get_occupancy_grid_view",
+            [](py::object self)
+            {
+                MapGenerator& generator = self.cast<MapGenerator&>();
+                const std::vector<int8_t>& buffer = generator.getOccupancyGridBuffer();
+                carb::Int3 dims = generator.getBufferDimensions();
+                if (buffer.empty() || buffer.size() != static_cast<size_t>(dims.x) * dims.y)
+                {
+                    return py::array_t<int8_t>();
+                }
+                py::array_t<int8_t> view(
+                    py::buffer_info(const_cast<int8_t*>(buffer.data()), sizeof(int8_t),
+                                    py::format_descriptor<int8_t>::format(), 2, { dims.y, dims.x },
+                                    { sizeof(int8_t) * dims.x, sizeof(int8_t) }),
+                    self);
+                view.attr("setflags")(py::arg("write") = false);
+                return view;
+            },
+            R"doc(Get the occupancy map encoded as nav_msgs/OccupancyGrid data without copying.
+
+Cells are 100 for occupied, 0 for free and -1 for unknown. Rows start at the minimum
+corner of the map with X increasing along each row, so the array can be flattened
+directly into the data field of an OccupancyGrid message. Use ``view.view(numpy.uint8)``
+for an unsigned encoding where unknown cells are 255.
+
+Returns:
+    numpy.ndarray: 2D int8 array of shape (dimensions[1], dimensions[0]) at the last generation,
+    empty before the map is generated.
+
+Warning:
+    Arrays returned before a generation with different bounds or cell size must not be used.
+)doc")
+        .def("set_flood_fill_seeds", &MapGenerator::setFloodFillSeeds,
+             R"doc(Set the points from which free space is flood filled in the 2D buffer.
+
+Cells connected to any of the seeds without crossing an occupied cell are marked as
+unoccupied, all other cells that are not occupied are marked as unknown.
+
+Args:
+    seeds (list of tuple): Seed positions in stage coordinates. An empty list fills from the origin passed to set_transform().
+
+Returns:
+    None
+)doc")
+        .def(
+            "get_region_labels_view",
+            [](py::object self)
+            {
+                MapGenerator& generator = self.cast<MapGenerator&>();
+                const std::vector<int32_t>& labels = generator.getRegionLabels();
+                carb::Int3 dims = generator.getBufferDimensions();
+                if (labels.empty() || labels.size() != static_cast<size_t>(dims.x) * dims.y)
+                {
+                    return py::array_t<int32_t>();
+                }
+                py::array_t<int32_t> view(
+                    py::buffer_info(const_cast<int32_t*>(labels.data()), sizeof(int32_t),
+                                    py::format_descriptor<int32_t>::format(), 2, { dims.y, dims.x },
+                                    { sizeof(int32_t) * dims.x, sizeof(int32_t) }),
+                    self);
+                view.attr("setflags")(py::arg("write") = false);
+                return view;
+            },
+            R"doc(Get the connected region ID of every cell of the 2D map without copying.
+
+Cells that are not occupied are labelled with the ID of the 4-connected region they belong
+to, numbered from 1. Occupied cells are labelled 0. Two cells are reachable from each other
+if and only if they share a label. The layout matches get_buffer_view().
+
+Returns:
+    numpy.ndarray: 2D int32 array of shape (dimensions[1], dimensions[0]) at the last generation,
+    empty before the map is generated.
+
+Warning:
+    Arrays returned before a generation with different bounds or cell size must not be used.
+)doc")
+        .def("get_num_regions", &MapGenerator::getNumRegions, R"doc(Get the number of connected regions in the 2D map.
+
+Returns:
+    int: Largest label returned by get_region_labels_view().
 )doc")
         .def("get_colored_byte_buffer", &MapGenerator::getColoredByteBuffer, R"doc(Generate a colored visualization buffer.
 
@@ -332,6 +505,31 @@ Args:
 
 Returns:
     list: Vector of byte values representing RGBA colors for each cell in the map.
+)doc")
+        .def("update_regions", wrapInterfaceFunction(&OccupancyMap::updateRegions),
+             R"doc(Update the occupancy map inside a set of regions.
+
+Re-queries only the cells that intersect the given axis-aligned regions and patches
+the current map in place. Pass both the old and the new bounds of an object that moved.
+
+Args:
+    min_points (list of tuple): Minimum corner of each region in world coordinates.
+    max_points (list of tuple): Maximum corner of each region in world coordinates.
+
+Returns:
+    None
+)doc")
+        .def("update_prims", wrapInterfaceFunction(&OccupancyMap::updatePrims),
+             R"doc(Update the occupancy map around a set of changed prims.
+
+Re-queries the cells inside the current bounds of each prim and inside its bounds
+recorded during the previous update.
+
+Args:
+    prim_paths (list of str): Paths of the prims that changed.
+
+Returns:
+    None
 )doc");
 }
 }
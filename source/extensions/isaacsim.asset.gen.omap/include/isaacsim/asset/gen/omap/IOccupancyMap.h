@@ -18,6 +18,9 @@
 #include <carb/Defines.h>
 #include <carb/Types.h>
 
+#include <string>
+#include <vector>
+
 namespace isaacsim
 {
 namespace asset
@@ -38,7 +41,7 @@ namespace omap
  */
 struct OccupancyMap
 {
-    CARB_PLUGIN_INTERFACE("isaacsim::asset::gen::omap::OccupancyMap", 0, 1);
+    CARB_PLUGIN_INTERFACE("isaacsim::asset::gen::omap::OccupancyMap", 0, 2);
 
     /**
      * @brief Generates the occupancy map
@@ -156,6 +159,31 @@ struct OccupancyMap
     std::vector<char>(CARB_ABI* getColoredByteBuffer)(const carb::Int4& occupied,
                                                       const carb::Int4& unoccupied,
                                                       const carb::Int4& unknown);
+
+    /**
+     * @brief Updates the occupancy map inside a set of regions
+     * @details
+     * Re-queries only the cells that intersect the given axis-aligned regions and patches
+     * the current map in place. Pass both the old and the new bounds of an object that moved.
+     *
+     * @param[in] minPoints Minimum corner of each region in world coordinates
+     * @param[in] maxPoints Maximum corner of each region in world coordinates
+     *
+     * @pre A map must have been generated with generateMap()
+     */
+    void(CARB_ABI* updateRegions)(const std::vector<carb::Float3>& minPoints, const std::vector<carb::Float3>& maxPoints);
+
+    /**
+     * @brief Updates the occupancy map around a set of changed prims
+     * @details
+     * Re-queries the cells inside the current bounds of each prim and inside its bounds
+     * recorded during the previous update.
+     *
+     * @param[in] primPaths Paths of the prims that changed
+     *
+     * @pre A map must have been generated with generateMap()
+     */
+    void(CARB_ABI* updatePrims)(const std::vector<std::string>& primPaths);
 };
 
 } // namespace omap
@@ -21,6 +21,12 @@
 
 #include <carb/Defines.h>
 #include <carb/Types.h>
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 #if defined(_WIN32)
 #    include <PxPhysicsAPI.h>
 #else
@@ -33,6 +39,7 @@
 namespace octomap
 {
 class OcTree;
+class OcTreeKey;
 }
 
 namespace physx
@@ -68,6 +75,8 @@ namespace omap
 #    define DLL_EXPORT
 #endif
 
+struct CellKeyBuffer;
+
 /**
  * @class MapGenerator
  * @brief Generator class for creating 2D and 3D occupancy maps from USD stages
@@ -144,6 +153,35 @@ public:
      */
     void setTransform(carb::Float3 inputOrigin, carb::Float3 minPoint, carb::Float3 maxPoint);
 
+    /**
+     * @brief Sets the number of worker threads used for map generation
+     * @details
+     * The grid is split into square tiles of cells that are distributed across the worker threads.
+     * Each worker performs its overlap queries into its own key buffers, and the results are merged
+     * into the octree once all tiles are processed.
+     *
+     * @param[in] numThreads Number of worker threads, 0 uses the hardware concurrency and 1 runs serially
+     *                       on the calling thread
+     *
+     * @note The PhysX scene must not be simulating while a map is generated
+     */
+    void setNumThreads(uint32_t numThreads);
+
+    /**
+     * @brief Enables coarse-to-fine map generation
+     * @details
+     * Generation starts with one overlap query per block of 2^levels cells along each axis, aligned
+     * with the octree. Blocks that do not overlap any geometry are classified as free without further
+     * queries, blocks that do are subdivided until the leaf level is reached. In 3D, free blocks are
+     * stored as coarse octree leaves.
+     *
+     * @param[in] levels Number of octree levels above the leaves at which generation starts,
+     *                   0 tests every cell individually
+     *
+     * @note This significantly reduces the number of PhysX queries on sparse scenes
+     */
+    void setAdaptiveLevels(uint32_t levels);
+
     /**
      * @brief Generates a 2D occupancy map
      * @details
@@ -170,6 +208,34 @@ public:
      */
     void generate3d();
 
+    /**
+     * @brief Updates the occupancy map inside a set of regions
+     * @details
+     * Re-queries only the cells that intersect the given axis-aligned regions and patches the
+     * octree in place, using the settings of the last generate2d() or generate3d() call.
+     * Pass both the old and the new bounds of an object that moved.
+     *
+     * @param[in] minPoints Minimum corner of each region in world coordinates
+     * @param[in] maxPoints Maximum corner of each region in world coordinates
+     *
+     * @pre A map must have been generated with generate2d() or generate3d()
+     * @pre minPoints and maxPoints must have the same size
+     */
+    void updateRegions(const std::vector<carb::Float3>& minPoints, const std::vector<carb::Float3>& maxPoints);
+
+    /**
+     * @brief Updates the occupancy map around a set of changed prims
+     * @details
+     * Re-queries the cells inside the current bounds of each prim, and inside the bounds recorded
+     * during the previous call for the same prim. Prims with a PhysX actor use the actor bounds,
+     * other prims use their USD world bounds.
+     *
+     * @param[in] primPaths Paths of the prims that changed
+     *
+     * @pre A map must have been generated with generate2d() or generate3d()
+     */
+    void updatePrims(const std::vector<std::string>& primPaths);
+
     /**
      * @brief Retrieves positions of all occupied cells
      * @details
@@ -235,6 +301,8 @@ public:
      * @return Vector of occupancy values for all cells
      *
      * @note The buffer is stored in row-major order (x, then y, then z)
+     * @note The buffer is empty until the map is generated, and keeps the layout of the last generation
+     *       (see getBufferDimensions()) until the map is generated again
      */
     std::vector<float> getBuffer();
 
@@ -256,7 +324,117 @@ public:
                                            const carb::Int4& unoccupied,
                                            const carb::Int4& unknown);
 
+    /**
+     * @brief Gets the persistent 2D occupancy buffer
+     * @details
+     * Same content and layout as getBuffer(), but returns a reference to a buffer owned by the
+     * generator instead of a copy. The buffer is maintained incrementally by generation and
+     * region updates, and refreshed in place by this call when the map changed.
+     *
+     * @return Reference to the occupancy buffer
+     *
+     * @warning The reference is invalidated when the map is regenerated with different dimensions
+     */
+    const std::vector<float>& getDenseBuffer();
+
+    /**
+     * @brief Gets the dimensions of the persistent 2D buffers
+     * @details
+     * The buffers returned by getBuffer(), getDenseBuffer(), getOccupancyGridBuffer() and getRegionLabels()
+     * are laid out with the dimensions of the last generation. They differ from getDimensions() after the
+     * bounds or cell size are changed until the map is generated again.
+     *
+     * @return Number of cells in each dimension at the last generation, zero before the first one
+     */
+    carb::Int3 getBufferDimensions() const;
+
+    /**
+     * @brief Gets the 2D occupancy map encoded as nav_msgs/OccupancyGrid data
+     * @details
+     * Cells are encoded as 100 for occupied, 0 for free and -1 for unknown. Rows start at the
+     * minimum corner of the map with X increasing along each row. The encoding is produced
+     * together with the dense buffer and reuses its storage between calls.
+     *
+     * @return Reference to the encoded buffer
+     *
+     * @warning The reference is invalidated when the map is regenerated with different dimensions
+     */
+    const std::vector<int8_t>& getOccupancyGridBuffer();
+
+    /**
+     * @brief Sets the points from which free space is flood filled
+     * @details
+     * Cells of the 2D buffer connected to any of the seeds without crossing an occupied cell are
+     * marked as unoccupied, all other non-occupied cells are marked as unknown. By default the
+     * map origin passed to setTransform() is the only seed.
+     *
+     * @param[in] seeds Seed positions in world coordinates, an empty list restores the default
+     */
+    void setFloodFillSeeds(const std::vector<carb::Float3>& seeds);
+
+    /**
+     * @brief Labels the connected regions of the 2D occupancy map
+     * @details
+     * Every cell that is not occupied is assigned the ID of the 4-connected region it belongs to,
+     * numbered from 1. Occupied cells are labelled 0. Two cells are reachable from each other
+     * if and only if they share a label.
+     *
+     * @return Reference to the labels, laid out as in getBuffer()
+     *
+     * @warning The reference is invalidated when the map is regenerated with different dimensions
+     */
+    const std::vector<int32_t>& getRegionLabels();
+
+    /**
+     * @brief Gets the number of connected regions in the 2D occupancy map
+     *
+     * @return Number of regions labelled by getRegionLabels()
+     */
+    int32_t getNumRegions();
+
 private:
+    /**
+     * @brief Rebuilds the column occupancy counts after a full generation
+     *
+     * @param[in] buffers Key buffers produced by the generation workers
+     */
+    void resetDenseGrid(const std::vector<CellKeyBuffer>& buffers);
+
+    /**
+     * @brief Computes the index of the 2D grid column containing a cell
+     *
+     * @param[in] key Octree key of the cell
+     *
+     * @return Column index, or the size of the grid if the cell is outside of it
+     */
+    size_t columnIndex(const octomap::OcTreeKey& key) const;
+
+    /**
+     * @brief Computes the 2D grid cell containing a point
+     *
+     * @param[in] point Position in world coordinates
+     *
+     * @return Column and row of the cell, which may lie outside of the grid
+     */
+    carb::Int2 cellOfPoint(const carb::Float3& point) const;
+
+    /**
+     * @brief Refreshes the persistent dense buffers if the map changed
+     *
+     * @param[in] encodeOccupancyGrid Whether the ROS occupancy grid encoding should be refreshed
+     */
+    void refreshDenseBuffers(bool encodeOccupancyGrid);
+
+    /**
+     * @brief Kind of map produced by the last generation
+     */
+    enum class GenerationMode
+    {
+        eNone, ///< No map has been generated
+        e2d, ///< Map was generated with generate2d()
+        e3d, ///< Map was generated with generate3d()
+    };
+
     /**
      * @brief Cell size in meters
      * @details Controls the resolution of the occupancy map
@@ -328,6 +506,97 @@ private:
      * @details Used when generating the occupancy buffer
      */
     float m_unknownValue = 0.5f;
+
+    /**
+     * @brief Number of worker threads used for generation
+     * @details 0 selects the hardware concurrency, 1 runs the sweep on the calling thread
+     */
+    uint32_t m_numThreads = 0;
+
+    /**
+     * @brief Number of octree levels above the leaves at which generation starts
+     * @details 0 disables coarse-to-fine generation
+     */
+    uint32_t m_adaptiveLevels = 0;
+
+    /**
+     * @brief Kind of map produced by the last generation
+     * @details Determines the overlap geometry used by updateRegions()
+     */
+    GenerationMode m_generatedMode = GenerationMode::eNone;
+
+    /**
+     * @brief Bounds of the prims passed to updatePrims()
+     * @details Maps prim paths to their minimum and maximum world bounds at the last update
+     */
+    std::unordered_map<std::string, std::pair<carb::Float3, carb::Float3>> m_primBounds;
+
+    /**
+     * @brief Minimum bound of the 2D grid at the last generation
+     */
+    carb::Float3 m_gridMin = { 0.0f, 0.0f, 0.0f };
+
+    /**
+     * @brief Cell size of the 2D grid at the last generation
+     */
+    float m_gridCellSize = 0.05f;
+
+    /**
+     * @brief Maximum bound of the 2D grid at the last generation
+     */
+    carb::Float3 m_gridMax = { 0.0f, 0.0f, 0.0f };
+
+    /**
+     * @brief Dimensions of the grid at the last generation
+     */
+    carb::Int3 m_gridDimensions = { 0, 0, 0 };
+
+    /**
+     * @brief Number of occupied cells projecting onto each column of the 2D grid
+     * @details Maintained by generation and region updates so the dense buffer never iterates the octree
+     */
+    std::vector<int32_t> m_columnOccupancy;
+
+    /**
+     * @brief Persistent 2D occupancy buffer
+     */
+    std::vector<float> m_denseBuffer;
+
+    /**
+     * @brief Persistent nav_msgs/OccupancyGrid encoding of the 2D occupancy buffer
+     */
+    std::vector<int8_t> m_occupancyGridBuffer;
+
+    /**
+     * @brief Whether m_denseBuffer needs to be rebuilt
+     */
+    bool m_denseBufferDirty = true;
+
+    /**
+     * @brief Whether m_occupancyGridBuffer needs to be rebuilt
+     */
+    bool m_occupancyGridDirty = true;
+
+    /**
+     * @brief Seed positions of the free space flood fill
+     * @details Empty to fill from the map origin
+     */
+    std::vector<carb::Float3> m_floodFillSeeds;
+
+    /**
+     * @brief Connected region ID of each cell of the 2D grid, 0 for occupied cells
+     */
+    std::vector<int32_t> m_regionLabels;
+
+    /**
+     * @brief Number of regions in m_regionLabels
+     */
+    int32_t m_numRegions = 0;
+
+    /**
+     * @brief Whether m_regionLabels needs to be rebuilt
+     */
+    bool m_regionLabelsDirty = true;
 };
 
 }
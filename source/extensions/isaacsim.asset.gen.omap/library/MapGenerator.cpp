@@ -23,6 +23,7 @@
 #include <isaacsim/asset/gen/omap/MapGenerator.h>
 #include <octomap/octomap.h>
 #include <omni/physx/IPhysx.h>
+#include <pxr/usd/usdGeom/bboxCache.h>
 #include <pxr/usd/usdPhysics/scene.h>
 
 #include <PxActor.h>
@@ -32,7 +33,10 @@
 #include <PxPhysicsAPI.h>
 #include <PxRigidDynamic.h>
 #include <PxScene.h>
-#include <stack>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <thread>
 
 namespace isaacsim
 {
@@ -43,6 +47,21 @@ namespace gen
 namespace omap
 {
 
+/**
+ * @brief Keys of the cells classified by a single generation worker
+ */
+struct CellKeyBuffer
+{
+    /** @brief Keys of cells that overlapped scene geometry */
+    std::vector<octomap::OcTreeKey> occupied;
+
+    /** @brief Keys of cells that did not overlap scene geometry */
+    std::vector<octomap::OcTreeKey> unoccupied;
+
+    /** @brief Keys and octree depths of blocks of cells that did not overlap scene geometry */
+    std::vector<std::pair<octomap::OcTreeKey, unsigned int>> unoccupiedBlocks;
+};
+
 namespace
 {
 
@@ -83,6 +102,543 @@ namespace
     return nullptr;
 }
 
+/**
+ * @brief Number of cells along each side of a square generation tile
+ */
+constexpr size_t kTileSize = 32;
+
+/**
+ * @brief Runs a worker function on a number of threads
+ * @details
+ * The calling thread acts as the first worker, so a single worker runs without spawning threads.
+ *
+ * @param[in] numWorkers Number of workers to run
+ * @param[in] worker Function invoked with the index of each worker
+ */
+template <typename Worker>
+void runWorkers(size_t numWorkers, Worker&& worker)
+{
+    std::vector<std::thread> threads;
+    threads.reserve(numWorkers > 0 ? numWorkers - 1 : 0);
+    for (size_t i = 1; i < numWorkers; ++i)
+    {
+        threads.emplace_back(worker, i);
+    }
+    worker(0);
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+/**
+ * @brief Resolves the number of generation workers
+ *
+ * @param[in] numThreads Requested number of threads, 0 uses the hardware concurrency
+ * @param[in] numTasks Number of tasks that will be distributed across the workers
+ *
+ * @return Number of workers, at least one
+ */
+size_t resolveNumWorkers(uint32_t numThreads, size_t numTasks)
+{
+    if (numThreads == 0)
+    {
+        numThreads = std::thread::hardware_concurrency();
+    }
+    return std::max<size_t>(1, std::min<size_t>(numThreads, numTasks));
+}
+
+/**
+ * @brief Computes the cell center coordinates along one axis of the map volume
+ * @details
+ * Accumulates in single precision so that the generated cells match the layout
+ * produced by the original nested float loops.
+ *
+ * @param[in] minValue Lower bound of the axis
+ * @param[in] maxValue Upper bound of the axis
+ * @param[in] offset Offset added to each center, typically the map origin
+ * @param[in] cellSize Size of each cell
+ *
+ * @return Cell center coordinates along the axis
+ */
+std::vector<float> computeCellCenters(float minValue, float maxValue, float offset, float cellSize)
+{
+    std::vector<float> centers;
+    for (float v = minValue + cellSize / 2.0f; v <= maxValue - cellSize / 2.0f; v += cellSize)
+    {
+        centers.push_back(v + offset);
+    }
+    return centers;
+}
+
+/**
+ * @brief Classifies all cells of a grid with PhysX overlap queries
+ * @details
+ * Splits the XY plane into square tiles of kTileSize cells that are handed out to the
+ * worker threads through an atomic counter. Every tile is swept over all Z layers and
+ * each worker appends the resulting keys to its own buffer, so no synchronization is
+ * needed until the buffers are merged into the octree.
+ *
+ * @param[in] scene PhysX scene to query
+ * @param[in] tree Octree used to convert coordinates into keys
+ * @param[in] cellGeom Geometry used for the overlap test of a single cell
+ * @param[in] xs Cell center X coordinates in world space
+ * @param[in] ys Cell center Y coordinates in world space
+ * @param[in] keyZs Z coordinates used to compute the octree key of each layer
+ * @param[in] poseZs Z coordinates used to position the overlap geometry of each layer
+ * @param[in] numThreads Number of workers, 0 uses the hardware concurrency
+ *
+ * @return One key buffer per worker
+ *
+ * @pre keyZs and poseZs must have the same size
+ */
+std::vector<CellKeyBuffer> sweepCells(::physx::PxScene& scene,
+                                      const octomap::OcTree& tree,
+                                      const ::physx::PxBoxGeometry& cellGeom,
+                                      const std::vector<float>& xs,
+                                      const std::vector<float>& ys,
+                                      const std::vector<float>& keyZs,
+                                      const std::vector<float>& poseZs,
+                                      uint32_t numThreads)
+{
+    const size_t tilesX = (xs.size() + kTileSize - 1) / kTileSize;
+    const size_t tilesY = (ys.size() + kTileSize - 1) / kTileSize;
+    const size_t numTiles = tilesX * tilesY;
+    const size_t numWorkers = resolveNumWorkers(numThreads, numTiles);
+
+    std::vector<CellKeyBuffer> buffers(numWorkers);
+    std::atomic<size_t> nextTile{ 0 };
+
+    auto worker = [&](size_t workerIndex)
+    {
+        CellKeyBuffer& buffer = buffers[workerIndex];
+        ::physx::PxOverlapHit hit;
+        for (size_t tile = nextTile++; tile < numTiles; tile = nextTile++)
+        {
+            const size_t x0 = (tile % tilesX) * kTileSize;
+            const size_t y0 = (tile / tilesX) * kTileSize;
+            const size_t x1 = std::min(x0 + kTileSize, xs.size());
+            const size_t y1 = std::min(y0 + kTileSize, ys.size());
+
+            for (size_t ix = x0; ix < x1; ++ix)
+            {
+                for (size_t iy = y0; iy < y1; ++iy)
+                {
+                    for (size_t iz = 0; iz < keyZs.size(); ++iz)
+                    {
+                        octomap::OcTreeKey key = tree.coordToKey(octomap::point3d(xs[ix], ys[iy], keyZs[iz]));
+                        ::physx::PxTransform pose(::physx::PxVec3(xs[ix], ys[iy], poseZs[iz]));
+
+                        if (::physx::PxSceneQueryExt::overlapAny(scene, cellGeom, pose, hit))
+                        {
+                            buffer.occupied.push_back(key);
+                        }
+                        else
+                        {
+                            buffer.unoccupied.push_back(key);
+                        }
+                    }
+                }
+            }
+        }
+    };
+
+    runWorkers(numWorkers, worker);
+
+    return buffers;
+}
+
+/**
+ * @brief Contiguous range of cell indices along one axis
+ */
+struct CellRange
+{
+    /** @brief First cell index */
+    size_t begin;
+
+    /** @brief One past the last cell index */
+    size_t end;
+};
+
+/**
+ * @brief Splits an axis into ranges of cells that share the same octree block
+ * @details
+ * Cells belong to the same block at a given level when their keys only differ in the lowest
+ * level bits. Since consecutive cells map to consecutive keys the blocks are contiguous.
+ *
+ * @param[in] keys Octree key of each cell along the axis
+ * @param[in] range Range of cells to split
+ * @param[in] level Number of key bits ignored when comparing cells
+ *
+ * @return Ranges of cells belonging to the same block, in order
+ */
+std::vector<CellRange> splitRange(const std::vector<octomap::key_type>& keys, CellRange range, unsigned int level)
+{
+    std::vector<CellRange> ranges;
+    size_t begin = range.begin;
+    for (size_t i = range.begin + 1; i <= range.end; ++i)
+    {
+        if (i == range.end || (keys[i] >> level) != (keys[begin] >> level))
+        {
+            ranges.push_back({ begin, i });
+            begin = i;
+        }
+    }
+    return ranges;
+}
+
+/**
+ * @brief Finds the cells along one axis whose extent intersects an interval
+ *
+ * @param[in] centers Sorted cell center coordinates along the axis
+ * @param[in] minValue Lower bound of the interval
+ * @param[in] maxValue Upper bound of the interval
+ * @param[in] cellSize Size of each cell
+ *
+ * @return Range of intersecting cells, empty if the interval is outside of the map
+ */
+CellRange cellsInInterval(const std::vector<float>& centers, float minValue, float maxValue, float cellSize)
+{
+    auto first = std::lower_bound(centers.begin(), centers.end(), minValue - cellSize / 2.0f);
+    auto last = std::upper_bound(first, centers.end(), maxValue + cellSize / 2.0f);
+    return { static_cast<size_t>(first - centers.begin()), static_cast<size_t>(last - centers.begin()) };
+}
+
+/**
+ * @brief Coarse-to-fine cell classification with PhysX overlap queries
+ * @details
+ * The grid is divided into blocks that are aligned with the octree at a given number of levels
+ * above the leaves. Each block is tested with a single overlap query covering all of its cells.
+ * Blocks without any overlap are classified as free without further queries, while blocks that
+ * overlap scene geometry are subdivided into their octree children until the leaf level is reached.
+ *
+ * In 3D, free blocks that fully cover an octree node are stored as that node, so the resulting
+ * tree contains coarse leaves. In 2D every free cell is stored as a leaf because the key of a
+ * 2D cell is fixed in Z.
+ *
+ * @note An overlap query cannot tell a fully occupied block from a partially occupied one,
+ *       so occupied space is always resolved down to the leaf level.
+ */
+class AdaptiveSweep
+{
+public:
+    /**
+     * @brief Constructs the sweep for a grid of cells
+     *
+     * @param[in] scene PhysX scene to query
+     * @param[in] tree Octree used to convert coordinates into keys
+     * @param[in] cellSize Size of each cell
+     * @param[in] xs Cell center X coordinates in world space
+     * @param[in] ys Cell center Y coordinates in world space
+     * @param[in] keyZs Z coordinates used to compute the octree key of each layer
+     * @param[in] poseZs Z coordinates used to position the overlap geometry of each layer
+     * @param[in] zHalfExtent Half height of the overlap geometry in 2D, ignored in 3D
+     * @param[in] is2d Whether the grid is a single 2D layer of columns
+     */
+    AdaptiveSweep(::physx::PxScene& scene,
+                  const octomap::OcTree& tree,
+                  float cellSize,
+                  const std::vector<float>& xs,
+                  const std::vector<float>& ys,
+                  const std::vector<float>& keyZs,
+                  const std::vector<float>& poseZs,
+                  float zHalfExtent,
+                  bool is2d)
+        : m_scene(scene),
+          m_tree(tree),
+          m_cellSize(cellSize),
+          m_xs(xs),
+          m_ys(ys),
+          m_keyZs(keyZs),
+          m_poseZs(poseZs),
+          m_zHalfExtent(zHalfExtent),
+          m_is2d(is2d)
+    {
+        m_keysX.reserve(xs.size());
+        for (float x : xs)
+        {
+            m_keysX.push_back(tree.coordToKey(x));
+        }
+        m_keysY.reserve(ys.size());
+        for (float y : ys)
+        {
+            m_keysY.push_back(tree.coordToKey(y));
+        }
+        m_keysZ.reserve(keyZs.size());
+        for (float z : keyZs)
+        {
+            m_keysZ.push_back(tree.coordToKey(z));
+        }
+    }
+
+    /**
+     * @brief Classifies all cells of the grid
+     *
+     * @param[in] levels Number of octree levels above the leaves at which the sweep starts
+     * @param[in] numThreads Number of workers, 0 uses the hardware concurrency
+     *
+     * @return One key buffer per worker
+     */
+    std::vector<CellKeyBuffer> run(unsigned int levels, uint32_t numThreads)
+    {
+        levels = std::min(levels, m_tree.getTreeDepth());
+
+        // Top level blocks are distributed across the workers
+        std::vector<CellRange> rangesX = splitRange(m_keysX, { 0, m_xs.size() }, levels);
+        std::vector<CellRange> rangesY = splitRange(m_keysY, { 0, m_ys.size() }, levels);
+        std::vector<CellRange> rangesZ =
+            m_is2d ? std::vector<CellRange>{ { 0, m_keyZs.size() } } : splitRange(m_keysZ, { 0, m_keyZs.size() }, levels);
+
+        const size_t numBlocks = rangesX.size() * rangesY.size() * rangesZ.size();
+        const size_t numWorkers = resolveNumWorkers(numThreads, numBlocks);
+
+        std::vector<CellKeyBuffer> buffers(numWorkers);
+        std::atomic<size_t> nextBlock{ 0 };
+
+        runWorkers(numWorkers,
+                   [&](size_t workerIndex)
+                   {
+                       for (size_t block = nextBlock++; block < numBlocks; block = nextBlock++)
+                       {
+                           const size_t ix = block % rangesX.size();
+                           const size_t iy = (block / rangesX.size()) % rangesY.size();
+                           const size_t iz = block / (rangesX.size() * rangesY.size());
+                           classify(levels, rangesX[ix], rangesY[iy], rangesZ[iz], buffers[workerIndex]);
+                       }
+                   });
+
+        return buffers;
+    }
+
+private:
+    /**
+     * @brief Classifies a block of cells, subdividing it while it overlaps scene geometry
+     */
+    void classify(unsigned int level, CellRange rx, CellRange ry, CellRange rz, CellKeyBuffer& buffer) const
+    {
+        if (rx.begin == rx.end || ry.begin == ry.end || rz.begin == rz.end)
+        {
+            return;
+        }
+
+        // Box covering all cells of the block
+        float centerX = (m_xs[rx.begin] + m_xs[rx.end - 1]) / 2.0f;
+        float centerY = (m_ys[ry.begin] + m_ys[ry.end - 1]) / 2.0f;
+        float centerZ = (m_poseZs[rz.begin] + m_poseZs[rz.end - 1]) / 2.0f;
+        // Blocks are slightly inflated so rounding never classifies a touching cell as free
+        float margin = level > 0 ? m_cellSize * 1e-3f : 0.0f;
+        float halfZ = m_is2d ? m_zHalfExtent : (rz.end - rz.begin) * m_cellSize / 2.0f + margin;
+        ::physx::PxBoxGeometry blockGeom(::physx::PxVec3((rx.end - rx.begin) * m_cellSize / 2.0f + margin,
+                                                         (ry.end - ry.begin) * m_cellSize / 2.0f + margin, halfZ));
+        ::physx::PxTransform pose(::physx::PxVec3(centerX, centerY, centerZ));
+        ::physx::PxOverlapHit hit;
+
+        if (!::physx::PxSceneQueryExt::overlapAny(m_scene, blockGeom, pose, hit))
+        {
+            writeFree(level, rx, ry, rz, buffer);
+            return;
+        }
+
+        if (level == 0)
+        {
+            for (size_t iz = rz.begin; iz < rz.end; ++iz)
+            {
+                buffer.occupied.push_back(cellKey(rx.begin, ry.begin, iz));
+            }
+            return;
+        }
+
+        // Subdivide into the octree children of the block
+        std::vector<CellRange> childrenX = splitRange(m_keysX, rx, level - 1);
+        std::vector<CellRange> childrenY = splitRange(m_keysY, ry, level - 1);
+        std::vector<CellRange> childrenZ = m_is2d ? std::vector<CellRange>{ rz } : splitRange(m_keysZ, rz, level - 1);
+        for (const auto& cz : childrenZ)
+        {
+            for (const auto& cy : childrenY)
+            {
+                for (const auto& cx : childrenX)
+                {
+                    classify(level - 1, cx, cy, cz, buffer);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Stores a block of free cells as the coarsest octree nodes that cover it exactly
+     */
+    void writeFree(unsigned int level, CellRange rx, CellRange ry, CellRange rz, CellKeyBuffer& buffer) const
+    {
+        const size_t blockSize = size_t(1) << level;
+        const bool fullBlock = !m_is2d && rx.end - rx.begin == blockSize && ry.end - ry.begin == blockSize &&
+                               rz.end - rz.begin == blockSize;
+
+        if (level == 0 || fullBlock)
+        {
+            if (level == 0)
+            {
+                for (size_t iz = rz.begin; iz < rz.end; ++iz)
+                {
+                    buffer.unoccupied.push_back(cellKey(rx.begin, ry.begin, iz));
+                }
+            }
+            else
+            {
+                buffer.unoccupiedBlocks.emplace_back(cellKey(rx.begin, ry.begin, rz.begin), m_tree.getTreeDepth() - level);
+            }
+            return;
+        }
+
+        // Block is clipped by the map bounds or 2D, split it without further queries
+        std::vector<CellRange> childrenX = splitRange(m_keysX, rx, level - 1);
+        std::vector<CellRange> childrenY = splitRange(m_keysY, ry, level - 1);
+        std::vector<CellRange> childrenZ = m_is2d ? std::vector<CellRange>{ rz } : splitRange(m_keysZ, rz, level - 1);
+        for (const auto& cz : childrenZ)
+        {
+            for (const auto& cy : childrenY)
+            {
+                for (const auto& cx : childrenX)
+                {
+                    writeFree(level - 1, cx, cy, cz, buffer);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the octree key of a cell
+     */
+    octomap::OcTreeKey cellKey(size_t ix, size_t iy, size_t iz) const
+    {
+        return octomap::OcTreeKey(m_keysX[ix], m_keysY[iy], m_keysZ[iz]);
+    }
+
+    ::physx::PxScene& m_scene;
+    const octomap::OcTree& m_tree;
+    float m_cellSize;
+    const std::vector<float>& m_xs;
+    const std::vector<float>& m_ys;
+    const std::vector<float>& m_keyZs;
+    const std::vector<float>& m_poseZs;
+    float m_zHalfExtent;
+    bool m_is2d;
+    std::vector<octomap::key_type> m_keysX;
+    std::vector<octomap::key_type> m_keysY;
+    std::vector<octomap::key_type> m_keysZ;
+};
+
+/**
+ * @brief Sets the value of the octree node at a given depth and removes its children
+ * @details
+ * The node is created along with its parents if needed, turning it into a coarse leaf
+ * that covers all cells below it.
+ *
+ * @param[in,out] tree Octree to update
+ * @param[in] key Key of any cell inside the node
+ * @param[in] depth Depth of the node, where 0 is the root
+ * @param[in] logOdds Log odds value assigned to the node
+ */
+void setNodeAtDepth(octomap::OcTree& tree, const octomap::OcTreeKey& key, unsigned int depth, float logOdds)
+{
+    if (!tree.getRoot())
+    {
+        // Creates the root, the path below it is removed again when the node is collapsed
+        tree.updateNode(key, false, true);
+    }
+
+    octomap::OcTreeNode* node = tree.getRoot();
+    for (unsigned int d = 0; d < depth; ++d)
+    {
+        unsigned int pos = octomap::computeChildIdx(key, tree.getTreeDepth() - 1 - d);
+        if (!tree.nodeChildExists(node, pos))
+        {
+            tree.createNodeChild(node, pos);
+        }
+        node = tree.getNodeChild(node, pos);
+    }
+
+    for (unsigned int i = 0; i < 8; ++i)
+    {
+        if (tree.nodeChildExists(node, i))
+        {
+            tree.deleteNodeChild(node, i);
+        }
+    }
+    node->setLogOdds(logOdds);
+}
+
+/**
+ * @brief Writes the classified cells of all workers into the octree
+ * @details
+ * Unoccupied blocks and cells are written before occupied ones, then the inner nodes are updated once.
+ *
+ * @param[in,out] tree Octree to update
+ * @param[in] buffers Key buffers produced by sweepCells()
+ */
+void mergeCellKeys(octomap::OcTree& tree, const std::vector<CellKeyBuffer>& buffers)
+{
+    for (const auto& buffer : buffers)
+    {
+        for (const auto& [key, depth] : buffer.unoccupiedBlocks)
+        {
+            setNodeAtDepth(tree, key, depth, tree.getProbMissLog());
+        }
+    }
+
+    for (const auto& buffer : buffers)
+    {
+        for (const auto& key : buffer.unoccupied)
+        {
+            tree.updateNode(key, false, true);
+        }
+    }
+
+    for (const auto& buffer : buffers)
+    {
+        for (const auto& key : buffer.occupied)
+        {
+            tree.updateNode(key, true, true);
+        }
+    }
+
+    tree.updateInnerOccupancy();
+}
+
+/**
+ * @brief Appends the centers of all cells covered by an octree leaf
+ * @details
+ * Leaves written by adaptive generation can be larger than a single cell, in which
+ * case the centers of every cell inside the leaf are appended.
+ *
+ * @param[in] it Leaf iterator pointing to the leaf
+ * @param[in] resolution Size of a single cell
+ * @param[in,out] pos Vector the cell centers are appended to
+ */
+void appendLeafCellCenters(const octomap::OcTree::leaf_iterator& it, double resolution, std::vector<carb::Float3>& pos)
+{
+    octomap::point3d center = it.getCoordinate();
+    const int numCells = static_cast<int>(std::lround(it.getSize() / resolution));
+    if (numCells <= 1)
+    {
+        pos.push_back(carb::Float3({ center.x(), center.y(), center.z() }));
+        return;
+    }
+
+    const double start = -it.getSize() / 2.0 + resolution / 2.0;
+    for (int ix = 0; ix < numCells; ++ix)
+    {
+        for (int iy = 0; iy < numCells; ++iy)
+        {
+            for (int iz = 0; iz < numCells; ++iz)
+            {
+                pos.push_back(carb::Float3({ static_cast<float>(center.x() + start + ix * resolution),
+                                             static_cast<float>(center.y() + start + iy * resolution),
+                                             static_cast<float>(center.z() + start + iz * resolution) }));
+            }
+        }
+    }
+}
+
 } // anonymous namespace
 
 /**
@@ -162,6 +718,7 @@ void MapGenerator::updateSettings(const float cellSize,
     m_unoccupiedValue = unoccupiedValue;
     m_unknownValue = unknownValue;
     m_tree->setResolution(m_cellSize);
+    m_denseBufferDirty = true;
 }
 
 /**
@@ -199,13 +756,45 @@ void MapGenerator::setTransform(carb::Float3 inputOrigin, carb::Float3 inputMinP
     m_inputMaxPoint = roundedMax;
 }
 
+/**
+ * @brief Sets the number of worker threads used for map generation
+ * @details
+ * Controls how many threads perform the tiled overlap sweep in generate2d() and generate3d().
+ *
+ * @param[in] numThreads Number of worker threads, 0 uses the hardware concurrency and 1 runs serially
+ *
+ * @post m_numThreads will be updated
+ */
+void MapGenerator::setNumThreads(uint32_t numThreads)
+{
+    m_numThreads = numThreads;
+}
+
+/**
+ * @brief Enables coarse-to-fine map generation
+ * @details
+ * Sets the number of octree levels above the leaf level at which the overlap sweep starts.
+ * Blocks without any overlap are classified as free with a single query, blocks that overlap
+ * scene geometry are subdivided down to the leaf level.
+ *
+ * @param[in] levels Number of octree levels above the leaves, 0 tests every cell individually
+ *
+ * @post m_adaptiveLevels will be updated
+ */
+void MapGenerator::setAdaptiveLevels(uint32_t levels)
+{
+    m_adaptiveLevels = levels;
+}
+
 /**
  * @brief Generates a 2D occupancy map using PhysX overlap queries
  * @details
  * Creates a 2D projection of the occupancy map by performing overlap tests
  * at each cell in the XY plane. The method uses a tall box that extends
- * in the Z direction to detect obstacles at any height. The octree is updated
- * with both occupied and free cells based on the collision test results.
+ * in the Z direction to detect obstacles at any height. The grid is swept in tiles
+ * across m_numThreads workers and the octree is updated once with both occupied
+ * and free cells based on the collision test results. When m_adaptiveLevels is set,
+ * free blocks of columns are detected with a single query.
  *
  * @pre m_physxScenePtr must be valid
  * @pre m_tree must be valid
@@ -238,51 +827,28 @@ void MapGenerator::generate2d()
     float geomHeight = ::physx::PxAbs(m_inputMaxPoint.z - m_inputMinPoint.z) / 2.0f + m_cellSize / 2.0f;
     ::physx::PxBoxGeometry cellGeom(::physx::PxVec3(m_cellSize / 2.0f, m_cellSize / 2.0f, geomHeight));
 
-    // Sets to store occupied and unoccupied cell keys
-    octomap::KeySet occupiedCells;
-    octomap::KeySet unoccupiedCells;
-    ::physx::PxOverlapHit hit;
-
-    // Iterate through XY grid
-    for (float ix = m_inputMinPoint.x + m_cellSize / 2.0f; ix <= m_inputMaxPoint.x - m_cellSize / 2.0f; ix += m_cellSize)
-    {
-        for (float iy = m_inputMinPoint.y + m_cellSize / 2.0f; iy <= m_inputMaxPoint.y - m_cellSize / 2.0f;
-             iy += m_cellSize)
-        {
-            // Convert world coordinates to octree key
-            octomap::OcTreeKey key =
-                m_tree->coordToKey(octomap::point3d(ix + m_inputOrigin.x, iy + m_inputOrigin.y, m_inputOrigin.z));
+    // Cell centers in world coordinates, the box is centered vertically in the map volume
+    std::vector<float> xs = computeCellCenters(m_inputMinPoint.x, m_inputMaxPoint.x, m_inputOrigin.x, m_cellSize);
+    std::vector<float> ys = computeCellCenters(m_inputMinPoint.y, m_inputMaxPoint.y, m_inputOrigin.y, m_cellSize);
+    float height = m_inputOrigin.z + m_inputMinPoint.z + (m_inputMaxPoint.z - m_inputMinPoint.z) / 2.0f;
 
-            // Position the overlap test box
-            float height = m_inputOrigin.z + m_inputMinPoint.z + (m_inputMaxPoint.z - m_inputMinPoint.z) / 2.0f;
-            ::physx::PxTransform pose(::physx::PxVec3(ix + m_inputOrigin.x, iy + m_inputOrigin.y, height));
+    std::vector<float> keyZs = { m_inputOrigin.z };
+    std::vector<float> poseZs = { height };
 
-            // Perform overlap test and store result
-            if (::physx::PxSceneQueryExt::overlapAny(*m_physxScenePtr, cellGeom, pose, hit))
-            {
-                occupiedCells.insert(key);
-            }
-            else
-            {
-                unoccupiedCells.insert(key);
-            }
-        }
-    }
-
-    // Update octree with unoccupied cells
-    for (const auto& key : unoccupiedCells)
+    // Classify the XY grid in parallel tiles and merge the results into the octree
+    std::vector<CellKeyBuffer> buffers;
+    if (m_adaptiveLevels > 0)
     {
-        m_tree->updateNode(key, false, true);
+        AdaptiveSweep sweep(*m_physxScenePtr, *m_tree, m_cellSize, xs, ys, keyZs, poseZs, geomHeight, true);
+        buffers = sweep.run(m_adaptiveLevels, m_numThreads);
     }
-
-    // Update octree with occupied cells
-    for (const auto& key : occupiedCells)
+    else
     {
-        m_tree->updateNode(key, true, true);
+        buffers = sweepCells(*m_physxScenePtr, *m_tree, cellGeom, xs, ys, keyZs, poseZs, m_numThreads);
     }
-
-    // Update internal nodes of the octree
-    m_tree->updateInnerOccupancy();
+    mergeCellKeys(*m_tree, buffers);
+    m_generatedMode = GenerationMode::e2d;
+    resetDenseGrid(buffers);
 }
 
 /**
@@ -291,8 +857,9 @@ void MapGenerator::generate2d()
  * Creates a full 3D volumetric representation of the occupancy map by
  * performing overlap tests at each cell in the XYZ volume. The method uses
  * a cube-shaped test geometry to detect collisions with scene objects.
- * The octree is updated with both occupied and free cells based on the
- * collision test results.
+ * The grid is swept in tiles across m_numThreads workers and the octree is
+ * updated once with both occupied and free cells based on the collision test results.
+ * When m_adaptiveLevels is set, free blocks are stored as coarse octree leaves.
  *
  * @pre m_physxScenePtr must be valid
  * @pre m_tree must be valid
@@ -325,54 +892,204 @@ void MapGenerator::generate3d()
     // Use a cube with half extents equal to half the cell size
     ::physx::PxBoxGeometry cellGeom(::physx::PxVec3(m_cellSize / 2.0f, m_cellSize / 2.0f, m_cellSize / 2.0f));
 
-    // Sets to store occupied and unoccupied cell keys
-    octomap::KeySet occupiedCells, unoccupiedCells;
+    // Cell centers in world coordinates
+    std::vector<float> xs = computeCellCenters(m_inputMinPoint.x, m_inputMaxPoint.x, m_inputOrigin.x, m_cellSize);
+    std::vector<float> ys = computeCellCenters(m_inputMinPoint.y, m_inputMaxPoint.y, m_inputOrigin.y, m_cellSize);
+    std::vector<float> zs = computeCellCenters(m_inputMinPoint.z, m_inputMaxPoint.z, m_inputOrigin.z, m_cellSize);
+
+    // Classify the XYZ grid in parallel tiles and merge the results into the octree
+    std::vector<CellKeyBuffer> buffers;
+    if (m_adaptiveLevels > 0)
+    {
+        AdaptiveSweep sweep(*m_physxScenePtr, *m_tree, m_cellSize, xs, ys, zs, zs, 0.0f, false);
+        buffers = sweep.run(m_adaptiveLevels, m_numThreads);
+    }
+    else
+    {
+        buffers = sweepCells(*m_physxScenePtr, *m_tree, cellGeom, xs, ys, zs, zs, m_numThreads);
+    }
+    mergeCellKeys(*m_tree, buffers);
+    m_generatedMode = GenerationMode::e3d;
+    resetDenseGrid(buffers);
+}
+
+/**
+ * @brief Re-queries the cells inside a set of regions and patches the octree in place
+ * @details
+ * Uses the same overlap geometry as the last generate2d() or generate3d() call and only
+ * tests the cells whose extent intersects one of the regions. Cell values are overwritten
+ * instead of accumulated, so repeated updates yield the same state as a full regeneration.
+ * Coarse leaves touched by a region are expanded as needed.
+ *
+ * @param[in] minPoints Minimum corner of each region in world coordinates
+ * @param[in] maxPoints Maximum corner of each region in world coordinates
+ *
+ * @pre A map must have been generated with generate2d() or generate3d()
+ * @pre minPoints and maxPoints must have the same size
+ *
+ * @post Cells inside the regions reflect the current state of the PhysX scene
+ */
+void MapGenerator::updateRegions(const std::vector<carb::Float3>& minPoints, const std::vector<carb::Float3>& maxPoints)
+{
+    if (!m_physxScenePtr)
+    {
+        CARB_LOG_ERROR("Physics scene not initialized");
+        return;
+    }
+
+    if (!m_tree)
+    {
+        CARB_LOG_ERROR("Octree not initialized");
+        return;
+    }
+
+    if (m_generatedMode == GenerationMode::eNone)
+    {
+        CARB_LOG_ERROR("Occupancy map must be generated before regions can be updated");
+        return;
+    }
+
+    if (minPoints.size() != maxPoints.size())
+    {
+        CARB_LOG_ERROR("Number of minimum points (%zu) does not match number of maximum points (%zu)",
+                       minPoints.size(), maxPoints.size());
+        return;
+    }
+
+    const bool is3d = m_generatedMode == GenerationMode::e3d;
+
+    // Overlap geometry and cell layout match the last generation
+    float geomHalfHeight =
+        is3d ? m_cellSize / 2.0f : ::physx::PxAbs(m_inputMaxPoint.z - m_inputMinPoint.z) / 2.0f + m_cellSize / 2.0f;
+    ::physx::PxBoxGeometry cellGeom(::physx::PxVec3(m_cellSize / 2.0f, m_cellSize / 2.0f, geomHalfHeight));
+
+    std::vector<float> xs = computeCellCenters(m_inputMinPoint.x, m_inputMaxPoint.x, m_inputOrigin.x, m_cellSize);
+    std::vector<float> ys = computeCellCenters(m_inputMinPoint.y, m_inputMaxPoint.y, m_inputOrigin.y, m_cellSize);
+    std::vector<float> keyZs;
+    std::vector<float> poseZs;
+    if (is3d)
+    {
+        keyZs = computeCellCenters(m_inputMinPoint.z, m_inputMaxPoint.z, m_inputOrigin.z, m_cellSize);
+        poseZs = keyZs;
+    }
+    else
+    {
+        keyZs = { m_inputOrigin.z };
+        poseZs = { m_inputOrigin.z + m_inputMinPoint.z + (m_inputMaxPoint.z - m_inputMinPoint.z) / 2.0f };
+    }
+
+    const float occupiedLogOdds = m_tree->getProbHitLog();
+    const float unoccupiedLogOdds = m_tree->getProbMissLog();
     ::physx::PxOverlapHit hit;
 
-    // Iterate through XYZ grid
-    for (float ix = m_inputMinPoint.x + m_cellSize / 2.0f; ix <= m_inputMaxPoint.x - m_cellSize / 2.0f; ix += m_cellSize)
+    for (size_t i = 0; i < minPoints.size(); ++i)
     {
-        for (float iy = m_inputMinPoint.y + m_cellSize / 2.0f; iy <= m_inputMaxPoint.y - m_cellSize / 2.0f;
-             iy += m_cellSize)
+        CellRange rx = cellsInInterval(xs, minPoints[i].x, maxPoints[i].x, m_cellSize);
+        CellRange ry = cellsInInterval(ys, minPoints[i].y, maxPoints[i].y, m_cellSize);
+        // 2D columns span the whole map height
+        CellRange rz = is3d ? cellsInInterval(poseZs, minPoints[i].z, maxPoints[i].z, m_cellSize) :
+                              CellRange{ 0, poseZs.size() };
+
+        for (size_t ix = rx.begin; ix < rx.end; ++ix)
         {
-            for (float iz = m_inputMinPoint.z + m_cellSize / 2.0f; iz <= m_inputMaxPoint.z - m_cellSize / 2.0f;
-                 iz += m_cellSize)
+            for (size_t iy = ry.begin; iy < ry.end; ++iy)
             {
-                // Convert world coordinates to octree key
-                octomap::OcTreeKey key = m_tree->coordToKey(
-                    octomap::point3d(ix + m_inputOrigin.x, iy + m_inputOrigin.y, iz + m_inputOrigin.z));
-
-                // Position the overlap test cube
-                ::physx::PxTransform pose(
-                    ::physx::PxVec3(ix + m_inputOrigin.x, iy + m_inputOrigin.y, iz + m_inputOrigin.z));
-
-                // Perform overlap test and store result
-                if (::physx::PxSceneQueryExt::overlapAny(*m_physxScenePtr, cellGeom, pose, hit))
-                {
-                    occupiedCells.insert(key);
-                }
-                else
+                for (size_t iz = rz.begin; iz < rz.end; ++iz)
                 {
-                    unoccupiedCells.insert(key);
+                    octomap::OcTreeKey key = m_tree->coordToKey(octomap::point3d(xs[ix], ys[iy], keyZs[iz]));
+                    ::physx::PxTransform pose(::physx::PxVec3(xs[ix], ys[iy], poseZs[iz]));
+
+                    bool occupied = ::physx::PxSceneQueryExt::overlapAny(*m_physxScenePtr, cellGeom, pose, hit);
+
+                    // Keep the occupied cell count of the column in sync with the octree
+                    octomap::OcTreeNode* node = m_tree->search(key);
+                    bool wasOccupied = node && m_tree->isNodeOccupied(node);
+                    if (occupied != wasOccupied)
+                    {
+                        size_t column = columnIndex(key);
+                        if (column < m_columnOccupancy.size())
+                        {
+                            m_columnOccupancy[column] += occupied ? 1 : -1;
+                            m_denseBufferDirty = true;
+                        }
+                    }
+
+                    // Non lazy evaluation keeps the inner nodes along the path consistent
+                    m_tree->setNodeValue(key, occupied ? occupiedLogOdds : unoccupiedLogOdds, false);
                 }
             }
         }
     }
+}
 
-    // Update octree with unoccupied cells
-    for (octomap::KeySet::iterator iter = unoccupiedCells.begin(); iter != unoccupiedCells.end(); ++iter)
-    {
-        m_tree->updateNode(*iter, false, true);
-    }
+/**
+ * @brief Re-queries the cells covered by a set of prims at their previous and current locations
+ * @details
+ * The current bounds of each prim are read from its PhysX actor when it has one, so simulated
+ * bodies are tracked without USD write back, and from the USD stage otherwise. Bounds are
+ * remembered between calls so the cells at the previous location of a prim are refreshed as well.
+ *
+ * @param[in] primPaths Paths of the prims that changed
+ *
+ * @pre A map must have been generated with generate2d() or generate3d()
+ *
+ * @note The first update of a prim only knows its current bounds. Pass the previous bounds
+ *       explicitly through updateRegions() if the prim moved before it was first updated.
+ */
+void MapGenerator::updatePrims(const std::vector<std::string>& primPaths)
+{
+    std::vector<carb::Float3> minPoints;
+    std::vector<carb::Float3> maxPoints;
+    pxr::UsdGeomBBoxCache bboxCache(pxr::UsdTimeCode::Default(), { pxr::UsdGeomTokens->default_ }, true);
 
-    // Update octree with occupied cells
-    for (octomap::KeySet::iterator iter = occupiedCells.begin(); iter != occupiedCells.end(); ++iter)
+    for (const auto& primPath : primPaths)
     {
-        m_tree->updateNode(*iter, true, true);
+        // Cells at the previous location of the prim
+        auto previous = m_primBounds.find(primPath);
+        if (previous != m_primBounds.end())
+        {
+            minPoints.push_back(previous->second.first);
+            maxPoints.push_back(previous->second.second);
+        }
+
+        pxr::SdfPath path(primPath);
+        carb::Float3 minPoint;
+        carb::Float3 maxPoint;
+        ::physx::PxActor* actor =
+            static_cast<::physx::PxActor*>(m_physx->getPhysXPtr(path, omni::physx::PhysXType::ePTActor));
+        if (actor)
+        {
+            ::physx::PxBounds3 bounds = actor->getWorldBounds();
+            minPoint = { bounds.minimum.x, bounds.minimum.y, bounds.minimum.z };
+            maxPoint = { bounds.maximum.x, bounds.maximum.y, bounds.maximum.z };
+        }
+        else
+        {
+            pxr::UsdPrim prim = m_stage->GetPrimAtPath(path);
+            if (!prim)
+            {
+                CARB_LOG_WARN("Prim %s not found, only its previous bounds will be updated", primPath.c_str());
+                m_primBounds.erase(primPath);
+                continue;
+            }
+            pxr::GfRange3d range = bboxCache.ComputeWorldBound(prim).ComputeAlignedRange();
+            if (range.IsEmpty())
+            {
+                m_primBounds.erase(primPath);
+                continue;
+            }
+            minPoint = { static_cast<float>(range.GetMin()[0]), static_cast<float>(range.GetMin()[1]),
+                         static_cast<float>(range.GetMin()[2]) };
+            maxPoint = { static_cast<float>(range.GetMax()[0]), static_cast<float>(range.GetMax()[1]),
+                         static_cast<float>(range.GetMax()[2]) };
+        }
+
+        minPoints.push_back(minPoint);
+        maxPoints.push_back(maxPoint);
+        m_primBounds[primPath] = { minPoint, maxPoint };
     }
 
-    // Update internal nodes of the octree
-    m_tree->updateInnerOccupancy();
+    updateRegions(minPoints, maxPoints);
 }
 
 /**
@@ -400,7 +1117,7 @@ std::vector<carb::Float3> MapGenerator::getOccupiedPositions()
         {
             if (m_tree->isNodeOccupied(&(*it)))
             {
-                pos.push_back(carb::Float3({ it.getCoordinate().x(), it.getCoordinate().y(), it.getCoordinate().z() }));
+                appendLeafCellCenters(it, m_tree->getResolution(), pos);
             }
         }
     }
@@ -430,7 +1147,7 @@ std::vector<carb::Float3> MapGenerator::getFreePositions()
     {
         if (!m_tree->isNodeOccupied(&(*it)))
         {
-            pos.push_back(carb::Float3({ it.getCoordinate().x(), it.getCoordinate().y(), it.getCoordinate().z() }));
+            appendLeafCellCenters(it, m_tree->getResolution(), pos);
         }
     }
     return pos;
@@ -511,87 +1228,237 @@ carb::Int3 MapGenerator::getDimensions()
     return numCells;
 }
 
-// Direction vectors for 4-way connectivity (up, right, down, left)
-int g_row[] = { -1, 0, 1, 0 };
-int g_col[] = { 0, 1, 0, -1 };
+namespace
+{
 
 /**
- * @brief Checks if a given cell position is valid and matches the target value
+ * @brief Fills every cell 4-connected to the seeds on the stack using horizontal spans
  * @details
- * Validates whether a specified position is within the grid boundaries
- * and whether the cell at that position has the target value.
+ * Each popped seed is extended left and right into the longest matching span of its row,
+ * the span is filled, and one new seed is pushed for each run of matching cells in the rows
+ * directly above and below it. Only one entry per run is stored instead of one per cell.
  *
- * @param[in] buffer The grid buffer to check
  * @param[in] numCells Dimensions of the grid (width, height)
- * @param[in] x X coordinate to check
- * @param[in] y Y coordinate to check
- * @param[in] target Value we're looking to match
- *
- * @return true if position is valid and matches target value, false otherwise
+ * @param[in,out] stack Seeds to fill from, empty on return. Reused between calls to avoid allocations
+ * @param[in] match Returns whether the cell at a linear index should be filled
+ * @param[in] fill Fills the cell at a linear index
  *
- * @pre buffer must be a valid pointer to a grid buffer
+ * @pre fill must make match return false for the filled cell, otherwise the fill does not terminate
  */
-bool isSafe(float* buffer, carb::Int2 numCells, int x, int y, float target)
+template <typename Match, typename Fill>
+void scanlineFill(carb::Int2 numCells, std::vector<carb::Int2>& stack, Match&& match, Fill&& fill)
 {
-    if (x < 0 || x >= numCells.x || y < 0 || y >= numCells.y)
+    while (!stack.empty())
     {
-        return false;
+        carb::Int2 seed = stack.back();
+        stack.pop_back();
+
+        const size_t rowStart = static_cast<size_t>(seed.y) * numCells.x;
+        if (!match(rowStart + seed.x))
+        {
+            continue;
+        }
+
+        int left = seed.x;
+        while (left > 0 && match(rowStart + left - 1))
+        {
+            left--;
+        }
+        int right = seed.x;
+        while (right + 1 < numCells.x && match(rowStart + right + 1))
+        {
+            right++;
+        }
+        for (int x = left; x <= right; x++)
+        {
+            fill(rowStart + x);
+        }
+
+        for (int y : { seed.y - 1, seed.y + 1 })
+        {
+            if (y < 0 || y >= numCells.y)
+            {
+                continue;
+            }
+            const size_t neighborStart = static_cast<size_t>(y) * numCells.x;
+            bool inRun = false;
+            for (int x = left; x <= right; x++)
+            {
+                bool matches = match(neighborStart + x);
+                if (matches && !inRun)
+                {
+                    stack.push_back({ x, y });
+                }
+                inRun = matches;
+            }
+        }
     }
-    size_t index = y * numCells.x + x;
-    return buffer[index] == target;
 }
 
 /**
- * @brief Performs a flood fill operation using Depth-First Search
+ * @brief Performs a flood fill from several seeds using scanline spans
  * @details
- * Starting from position (sx,sy), replaces all connected cells matching the target value
- * with the replacement value. Uses 4-way connectivity (up, right, down, left).
- * The algorithm uses depth-first search with a stack to avoid recursion stack overflow.
+ * For each seed, replaces all cells 4-connected to it that hold the same value as the seed
+ * cell with the replacement value. Seeds outside of the grid, or on cells already holding
+ * the replacement value, are skipped.
  *
  * @param[in,out] buffer The grid buffer to modify
  * @param[in] numCells Dimensions of the grid (width, height)
- * @param[in] sx Starting X coordinate
- * @param[in] sy Starting Y coordinate
+ * @param[in] seeds Starting cells of the fill
  * @param[in] replacement Value to fill connected regions with
  *
  * @pre buffer must be a valid pointer to a grid buffer
- * @pre (sx,sy) must be a valid position within the grid
+ */
+void floodfill(float* buffer, carb::Int2 numCells, const std::vector<carb::Int2>& seeds, float replacement)
+{
+    std::vector<carb::Int2> stack;
+    for (const auto& seed : seeds)
+    {
+        if (seed.x < 0 || seed.x >= numCells.x || seed.y < 0 || seed.y >= numCells.y)
+        {
+            continue;
+        }
+        const float target = buffer[static_cast<size_t>(seed.y) * numCells.x + seed.x];
+        if (target == replacement)
+        {
+            continue;
+        }
+        stack.push_back(seed);
+        scanlineFill(
+            numCells, stack, [buffer, target](size_t index) { return buffer[index] == target; },
+            [buffer, replacement](size_t index) { buffer[index] = replacement; });
+    }
+}
+
+}
+
+/**
+ * @brief Rebuilds the column occupancy counts after a full generation
+ * @details
+ * Stores the layout of the 2D grid and counts the occupied cells that project onto each
+ * column directly from the generated keys, without iterating the octree leaves.
+ *
+ * @param[in] buffers Key buffers produced by the generation workers
  *
- * @post All cells connected to (sx,sy) with the same initial value will be changed to replacement
+ * @post m_columnOccupancy matches the generated map and the dense buffers are marked dirty
  */
-void floodfill(float* buffer, carb::Int2 numCells, int sx, int sy, float replacement)
+void MapGenerator::resetDenseGrid(const std::vector<CellKeyBuffer>& buffers)
 {
-    // Get the target value we're replacing at the start position
-    size_t startIndex = sy * numCells.x + sx;
-    float target = buffer[startIndex];
+    m_gridMin = getMinBound();
+    m_gridCellSize = m_cellSize;
+    m_gridMax = getMaxBound();
+    m_gridDimensions = getDimensions();
 
-    // Stack for DFS - stores coordinates as (x,y) pairs
-    std::stack<std::pair<int, int>> stack;
-    stack.push({ sx, sy });
+    m_columnOccupancy.assign(std::max(0, m_gridDimensions.x * m_gridDimensions.y), 0);
+    for (const auto& buffer : buffers)
+    {
+        for (const auto& key : buffer.occupied)
+        {
+            size_t column = columnIndex(key);
+            if (column < m_columnOccupancy.size())
+            {
+                m_columnOccupancy[column]++;
+            }
+        }
+    }
+    m_denseBufferDirty = true;
+}
 
-    // Process cells until stack is empty
-    while (!stack.empty())
+/**
+ * @brief Computes the index of the 2D grid column containing a cell
+ * @details
+ * Rows follow the Y axis and columns follow the negative X axis, matching the layout of getBuffer().
+ *
+ * @param[in] key Octree key of the cell
+ *
+ * @return Column index, or the size of the grid if the cell is outside of it
+ */
+size_t MapGenerator::columnIndex(const octomap::OcTreeKey& key) const
+{
+    octomap::point3d coord = m_tree->keyToCoord(key);
+    int row = static_cast<int>(coord.y() / m_gridCellSize - m_gridMin.y / m_gridCellSize);
+    int col = static_cast<int>((-coord.x() + m_gridMin.x + m_gridMax.x) / m_gridCellSize -
+                               m_gridMin.x / m_gridCellSize);
+    if (row < 0 || row >= m_gridDimensions.y || col < 0 || col >= m_gridDimensions.x)
     {
-        // Get next cell to process
-        auto [x, y] = stack.top();
-        stack.pop();
+        return m_columnOccupancy.size();
+    }
+    return static_cast<size_t>(row) * m_gridDimensions.x + col;
+}
 
-        // Fill current cell
-        size_t index = y * numCells.x + x;
-        buffer[index] = replacement;
+/**
+ * @brief Computes the 2D grid cell containing a point
+ * @details
+ * Uses the same layout as getBuffer(), rows follow the Y axis and columns follow the negative X axis.
+ *
+ * @param[in] point Position in world coordinates
+ *
+ * @return Column and row of the cell, which may lie outside of the grid
+ */
+carb::Int2 MapGenerator::cellOfPoint(const carb::Float3& point) const
+{
+    return { static_cast<int>(-point.x / m_gridCellSize + m_gridMax.x / m_gridCellSize),
+             static_cast<int>(point.y / m_gridCellSize - m_gridMin.y / m_gridCellSize) };
+}
 
-        // Check all 4 neighboring cells
-        for (int k = 0; k < 4; k++)
+/**
+ * @brief Refreshes the persistent dense buffers
+ * @details
+ * Rebuilds the occupancy buffer from the column counts when the map changed, then flood
+ * fills the free space reachable from the map origin. The ROS occupancy grid encoding is
+ * produced from the same buffer when requested. Storage is reused between calls as long
+ * as the map dimensions do not change.
+ *
+ * @param[in] encodeOccupancyGrid Whether the ROS occupancy grid encoding should be refreshed
+ */
+void MapGenerator::refreshDenseBuffers(bool encodeOccupancyGrid)
+{
+    if (m_denseBufferDirty)
+    {
+        m_denseBuffer.resize(m_columnOccupancy.size());
+        for (size_t i = 0; i < m_columnOccupancy.size(); ++i)
         {
-            int newX = x + g_col[k];
-            int newY = y + g_row[k];
+            m_denseBuffer[i] = m_columnOccupancy[i] > 0 ? m_occupiedValue : m_unknownValue;
+        }
 
-            // If neighbor is valid and matches target, add to stack
-            if (isSafe(buffer, numCells, newX, newY, target))
+        // Fill known free space from the seeds, or from the robot's position if none were set
+        std::vector<carb::Int2> seedCells;
+        if (m_floodFillSeeds.empty())
+        {
+            seedCells.push_back(cellOfPoint(m_inputOrigin));
+        }
+        for (const auto& seed : m_floodFillSeeds)
+        {
+            seedCells.push_back(cellOfPoint(seed));
+        }
+        floodfill(m_denseBuffer.data(), { m_gridDimensions.x, m_gridDimensions.y }, seedCells, m_unoccupiedValue);
+
+        m_denseBufferDirty = false;
+        m_occupancyGridDirty = true;
+        m_regionLabelsDirty = true;
+    }
+
+    if (encodeOccupancyGrid && m_occupancyGridDirty)
+    {
+        // nav_msgs/OccupancyGrid rows start at the minimum corner with X increasing along each row
+        m_occupancyGridBuffer.resize(m_denseBuffer.size());
+        const int width = m_gridDimensions.x;
+        for (size_t i = 0; i < m_denseBuffer.size(); ++i)
+        {
+            const size_t row = i / width;
+            const size_t col = width - 1 - i % width;
+            int8_t value = -1;
+            if (m_denseBuffer[i] == m_occupiedValue)
             {
-                stack.push({ newX, newY });
+                value = 100;
             }
+            else if (m_denseBuffer[i] == m_unoccupiedValue)
+            {
+                value = 0;
+            }
+            m_occupancyGridBuffer[row * width + col] = value;
         }
+        m_occupancyGridDirty = false;
     }
 }
 
@@ -610,54 +1477,134 @@ void floodfill(float* buffer, carb::Int2 numCells, int sx, int sy, float replace
  *
  * @pre m_tree should be valid
  *
- * @note Returns an empty vector if the octree is not initialized or dimensions are invalid
+ * @note Returns an empty vector if the octree is not initialized or the map was never generated
  * @note The buffer is stored in row-major order with y as rows and x as columns
+ * @note This returns a copy of the persistent buffer, see getDenseBuffer()
+ * @note The layout follows getBufferDimensions(), which only changes when the map is generated
  */
 std::vector<float> MapGenerator::getBuffer()
 {
-    std::vector<float> buffer;
     if (!m_tree)
     {
-        return buffer;
+        return std::vector<float>();
     }
+    refreshDenseBuffers(false);
+    return m_denseBuffer;
+}
 
-    // Get map bounds and dimensions
-    carb::Float3 min = getMinBound();
-    carb::Float3 max = getMaxBound();
-    carb::Int3 numCells = getDimensions();
+/**
+ * @brief Gets the persistent 2D occupancy buffer
+ * @details
+ * Refreshes the buffer in place if the map changed since the last call and returns a reference
+ * to it, avoiding the copy made by getBuffer().
+ *
+ * @return Reference to the occupancy buffer, laid out as in getBuffer()
+ *
+ * @note The reference stays valid until the map is regenerated with different dimensions
+ */
+const std::vector<float>& MapGenerator::getDenseBuffer()
+{
+    refreshDenseBuffers(false);
+    return m_denseBuffer;
+}
 
-    // Validate grid size
-    if (numCells.x * numCells.y <= 0)
-    {
-        return buffer;
-    }
+/**
+ * @brief Gets the dimensions of the persistent 2D buffers
+ *
+ * @return Number of cells in each dimension at the last generation
+ */
+carb::Int3 MapGenerator::getBufferDimensions() const
+{
+    return m_gridDimensions;
+}
 
-    // Initialize buffer with unknown values
-    buffer.resize(numCells.x * numCells.y);
-    std::fill(buffer.begin(), buffer.end(), m_unknownValue);
+/**
+ * @brief Gets the 2D occupancy map encoded as nav_msgs/OccupancyGrid data
+ * @details
+ * Cells are encoded as 100 for occupied, 0 for free and -1 for unknown. Rows start at the
+ * minimum corner of the map with X increasing along each row, as expected by ROS.
+ *
+ * @return Reference to the encoded buffer
+ *
+ * @note The reference stays valid until the map is regenerated with different dimensions
+ */
+const std::vector<int8_t>& MapGenerator::getOccupancyGridBuffer()
+{
+    refreshDenseBuffers(true);
+    return m_occupancyGridBuffer;
+}
 
-    // Mark occupied cells in the buffer
-    for (auto it = m_tree->begin_leafs(); it != m_tree->end_leafs(); ++it)
+/**
+ * @brief Sets the points from which free space is flood filled
+ * @details
+ * Cells of the 2D buffer that are connected to any of the seeds without crossing an occupied
+ * cell are marked as unoccupied, all other non-occupied cells are marked as unknown.
+ *
+ * @param[in] seeds Seed positions in world coordinates, an empty list fills from the map origin
+ *
+ * @post The dense buffers are rebuilt on the next access
+ */
+void MapGenerator::setFloodFillSeeds(const std::vector<carb::Float3>& seeds)
+{
+    m_floodFillSeeds = seeds;
+    m_denseBufferDirty = true;
+}
+
+/**
+ * @brief Labels the connected regions of the 2D occupancy map
+ * @details
+ * Every cell of the 2D buffer that is not occupied is assigned the ID of the 4-connected
+ * region it belongs to, numbered from 1 in row-major order of their first cell. Occupied cells
+ * are labelled 0. Regions are filled with scanline spans and the labels are cached until the
+ * map changes.
+ *
+ * @return Reference to the labels, laid out as in getBuffer()
+ *
+ * @note The reference stays valid until the map is regenerated with different dimensions
+ */
+const std::vector<int32_t>& MapGenerator::getRegionLabels()
+{
+    refreshDenseBuffers(false);
+    if (m_regionLabelsDirty)
     {
-        if (m_tree->isNodeOccupied(&(*it)))
-        {
-            // Convert 3D world coordinates to 2D grid coordinates
-            size_t index =
-                static_cast<size_t>(it.getCoordinate().y() / m_cellSize - min.y / m_cellSize) * numCells.x +
-                static_cast<size_t>((-it.getCoordinate().x() + min.x + max.x) / m_cellSize - min.x / m_cellSize);
+        const carb::Int2 numCells = { m_gridDimensions.x, m_gridDimensions.y };
+        const float* buffer = m_denseBuffer.data();
+        const float occupiedValue = m_occupiedValue;
+        int32_t* labels = nullptr;
 
-            buffer[index] = m_occupiedValue;
+        m_regionLabels.assign(m_denseBuffer.size(), 0);
+        labels = m_regionLabels.data();
+        m_numRegions = 0;
+
+        std::vector<carb::Int2> stack;
+        for (size_t i = 0; i < m_denseBuffer.size(); ++i)
+        {
+            if (labels[i] != 0 || buffer[i] == occupiedValue)
+            {
+                continue;
+            }
+            const int32_t label = ++m_numRegions;
+            stack.push_back({ static_cast<int>(i % numCells.x), static_cast<int>(i / numCells.x) });
+            scanlineFill(
+                numCells, stack,
+                [buffer, labels, occupiedValue](size_t index)
+                { return labels[index] == 0 && buffer[index] != occupiedValue; },
+                [labels, label](size_t index) { labels[index] = label; });
         }
+        m_regionLabelsDirty = false;
     }
+    return m_regionLabels;
+}
 
-    // Calculate starting point for flood fill (robot's position)
-    carb::Int2 startPos = { static_cast<int>(-m_inputOrigin.x / m_cellSize + max.x / m_cellSize),
-                            static_cast<int>(m_inputOrigin.y / m_cellSize - min.y / m_cellSize) };
-
-    // Fill known free space from robot's position
-    floodfill(buffer.data(), { numCells.x, numCells.y }, startPos.x, startPos.y, m_unoccupiedValue);
-
-    return buffer;
+/**
+ * @brief Gets the number of connected regions in the 2D occupancy map
+ *
+ * @return Number of regions labelled by getRegionLabels()
+ */
+int32_t MapGenerator::getNumRegions()
+{
+    getRegionLabels();
+    return m_numRegions;
 }
 
 /**
@@ -690,8 +1637,8 @@ std::vector<char> MapGenerator::getColoredByteBuffer(const carb::Int4& occupied,
         return colorBuffer;
     }
 
-    // Get the grid representation
-    std::vector<float> buffer = getBuffer();
+    // Get the grid representation without copying it
+    const std::vector<float>& buffer = getDenseBuffer();
 
     // Allocate color buffer (4 bytes per cell for RGBA)
     colorBuffer.resize(buffer.size() * 4);
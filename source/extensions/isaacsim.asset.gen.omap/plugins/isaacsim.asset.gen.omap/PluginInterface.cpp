@@ -417,6 +417,41 @@ std::vector<char> getColoredByteBuffer(const carb::Int4& occupied, const carb::I
     return std::vector<char>();
 }
 
+/**
+ * @brief Updates the occupancy map inside a set of regions
+ * @details
+ * Re-queries the cells intersecting the given regions and patches the current map in place.
+ *
+ * @param[in] minPoints Minimum corner of each region in world coordinates
+ * @param[in] maxPoints Maximum corner of each region in world coordinates
+ *
+ * @note Does nothing if g_generator is not initialized
+ */
+void CARB_ABI updateRegions(const std::vector<carb::Float3>& minPoints, const std::vector<carb::Float3>& maxPoints)
+{
+    if (g_generator)
+    {
+        g_generator->updateRegions(minPoints, maxPoints);
+    }
+}
+
+/**
+ * @brief Updates the occupancy map around a set of changed prims
+ * @details
+ * Re-queries the cells inside the previous and current bounds of each prim.
+ *
+ * @param[in] primPaths Paths of the prims that changed
+ *
+ * @note Does nothing if g_generator is not initialized
+ */
+void CARB_ABI updatePrims(const std::vector<std::string>& primPaths)
+{
+    if (g_generator)
+    {
+        g_generator->updatePrims(primPaths);
+    }
+}
+
 /**
  * @brief Callback function when a stage is attached
  * @details
@@ -552,4 +587,6 @@ void fillInterface(isaacsim::asset::gen::omap::OccupancyMap& iface)
     iface.getDimensions = getDimensions;
     iface.getBuffer = getBuffer;
     iface.getColoredByteBuffer = getColoredByteBuffer;
+    iface.updateRegions = updateRegions;
+    iface.updatePrims = updatePrims;
 }
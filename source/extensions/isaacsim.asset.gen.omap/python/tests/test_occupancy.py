@@ -199,3 +199,179 @@ class TestOccupancyMapGenerator(omni.kit.test.AsyncTestCase):
         self.assertEqual(buffer[75, 29], 4)
         self.assertEqual(buffer[40, 40], 5)
         self.assertEqual(buffer[75, 20], 4)
+
+    async def create_synthetic_generator(self):
+        await omni.usd.get_context().new_stage_async()
+        context = omni.usd.get_context()
+        self._stage = context.get_stage()
+        self.add_cube("/cube_1", 1.00, (1.00, 0, 0))
+        self.add_cube("/cube_2", 1.00, (1.00, 2.00, 0))
+        self.add_cube("/cube_3", 1.00, (-1.50, -1.50, 0))
+        self._physx = omni.physx.get_physx_interface()
+
+        await omni.kit.app.get_app().next_update_async()
+        UsdPhysics.Scene.Define(self._stage, Sdf.Path("/World/physicsScene"))
+        await omni.kit.app.get_app().next_update_async()
+        self._timeline.play()
+        await omni.kit.app.get_app().next_update_async()
+        generator = _omap.Generator(self._physx, context.get_stage_id())
+        generator.update_settings(0.05, 4, 5, 6)
+        generator.set_transform((0, 0, 0), (-2.00, -2.00, -0.5), (2.00, 2.00, 0.5))
+        return generator
+
+    def rounded_positions(self, positions):
+        return sorted((round(p[0], 3), round(p[1], 3), round(p[2], 3)) for p in positions)
+
+    def generate_results(self, generator):
+        generator.generate2d()
+        buffer = generator.get_buffer()
+        generator.generate3d()
+        occupied = self.rounded_positions(generator.get_occupied_positions())
+        free = self.rounded_positions(generator.get_free_positions())
+        return buffer, occupied, free
+
+    async def test_parallel_generation_matches_serial(self):
+        generator = await self.create_synthetic_generator()
+
+        generator.set_num_threads(1)
+        serial_buffer, serial_occupied, _ = self.generate_results(generator)
+        generator.set_num_threads(4)
+        parallel_buffer, parallel_occupied, _ = self.generate_results(generator)
+        self._timeline.stop()
+
+        self.assertGreater(len(serial_buffer), 0)
+        self.assertEqual(serial_buffer, parallel_buffer)
+        self.assertGreater(len(serial_occupied), 0)
+        self.assertEqual(serial_occupied, parallel_occupied)
+
+    async def test_adaptive_generation_matches_dense(self):
+        generator = await self.create_synthetic_generator()
+
+        dense_buffer, dense_occupied, dense_free = self.generate_results(generator)
+        generator.set_adaptive_levels(4)
+        adaptive_buffer, adaptive_occupied, adaptive_free = self.generate_results(generator)
+        self._timeline.stop()
+
+        self.assertEqual(dense_buffer, adaptive_buffer)
+        self.assertEqual(dense_occupied, adaptive_occupied)
+        self.assertEqual(dense_free, adaptive_free)
+
+    async def test_update_prims_matches_regeneration(self):
+        generator = await self.create_synthetic_generator()
+        generator.generate2d()
+        # Record the bounds of the cube before it moves
+        generator.update_prims(["/cube_3"])
+
+        self._stage.GetPrimAtPath("/cube_3").GetAttribute("xformOp:translate").Set((0.0, -1.25, 0))
+        await omni.kit.app.get_app().next_update_async()
+        generator.update_prims(["/cube_3"])
+        updated_buffer = generator.get_buffer()
+
+        generator.generate2d()
+        regenerated_buffer = generator.get_buffer()
+        self._timeline.stop()
+
+        self.assertEqual(updated_buffer, regenerated_buffer)
+
+    async def test_update_regions_matches_regeneration(self):
+        generator = await self.create_synthetic_generator()
+        generator.generate3d()
+
+        self._stage.GetPrimAtPath("/cube_1").GetAttribute("xformOp:translate").Set((1.00, -0.25, 0))
+        await omni.kit.app.get_app().next_update_async()
+        # Old and new bounds of the cube
+        generator.update_regions([(0.5, -0.5, -0.5), (0.5, -0.75, -0.5)], [(1.5, 0.5, 0.5), (1.5, 0.25, 0.5)])
+        updated_occupied = self.rounded_positions(generator.get_occupied_positions())
+        updated_free = self.rounded_positions(generator.get_free_positions())
+
+        generator.generate3d()
+        regenerated_occupied = self.rounded_positions(generator.get_occupied_positions())
+        regenerated_free = self.rounded_positions(generator.get_free_positions())
+        self._timeline.stop()
+
+        self.assertEqual(updated_occupied, regenerated_occupied)
+        self.assertEqual(updated_free, regenerated_free)
+
+    async def test_buffer_views(self):
+        generator = await self.create_synthetic_generator()
+        generator.generate2d()
+        dims = generator.get_dimensions()
+
+        view = generator.get_buffer_view()
+        self.assertEqual(view.shape, (dims[1], dims[0]))
+        self.assertFalse(view.flags.writeable)
+        np.testing.assert_array_equal(view.flatten(), np.array(generator.get_buffer(), dtype=np.float32))
+
+        grid = generator.get_occupancy_grid_view()
+        self.assertEqual(grid.shape, (dims[1], dims[0]))
+        # OccupancyGrid columns increase along X while the buffer columns decrease along X
+        expected = np.full(view.shape, -1, dtype=np.int8)
+        expected[view == 4] = 100
+        expected[view == 5] = 0
+        np.testing.assert_array_equal(grid, expected[:, ::-1])
+
+        # Views are refreshed in place after an incremental update
+        self._stage.GetPrimAtPath("/cube_1").GetAttribute("xformOp:translate").Set((1.00, -0.25, 0))
+        await omni.kit.app.get_app().next_update_async()
+        generator.update_regions([(0.5, -0.5, -0.5), (0.5, -0.75, -0.5)], [(1.5, 0.5, 0.5), (1.5, 0.25, 0.5)])
+        refreshed = generator.get_buffer_view()
+        self._timeline.stop()
+
+        self.assertEqual(refreshed.__array_interface__["data"][0], view.__array_interface__["data"][0])
+        np.testing.assert_array_equal(view, refreshed)
+        np.testing.assert_array_equal(view.flatten(), np.array(generator.get_buffer(), dtype=np.float32))
+
+    async def test_buffer_views_follow_generation(self):
+        generator = await self.create_synthetic_generator()
+        # Nothing is exposed before the map is generated
+        self.assertEqual(generator.get_buffer_view().size, 0)
+        self.assertEqual(generator.get_occupancy_grid_view().size, 0)
+        self.assertEqual(generator.get_region_labels_view().size, 0)
+
+        generator.generate2d()
+        dims = generator.get_dimensions()
+        self.assertEqual(tuple(generator.get_buffer_dimensions()), tuple(dims))
+
+        # Finer cells change the current dimensions, but the views keep the layout of their buffers
+        generator.update_settings(0.025, 4, 5, 6)
+        self.assertNotEqual(tuple(generator.get_dimensions()), tuple(dims))
+        self.assertEqual(tuple(generator.get_buffer_dimensions()), tuple(dims))
+        self.assertEqual(generator.get_buffer_view().shape, (dims[1], dims[0]))
+        self.assertEqual(generator.get_occupancy_grid_view().shape, (dims[1], dims[0]))
+        self.assertEqual(len(generator.get_buffer()), dims[0] * dims[1])
+        self.assertEqual(generator.get_region_labels_view().shape, (dims[1], dims[0]))
+
+        generator.generate2d()
+        self._timeline.stop()
+        new_dims = generator.get_dimensions()
+        self.assertEqual(tuple(generator.get_buffer_dimensions()), tuple(new_dims))
+        self.assertEqual(generator.get_buffer_view().shape, (new_dims[1], new_dims[0]))
+
+    async def test_flood_fill_seeds_and_region_labels(self):
+        generator = await self.create_synthetic_generator()
+        # Wall splitting the map in two regions, the origin is on the positive X side
+        wall = self.add_cube("/wall", 1.00, (-0.5, 0, 0))
+        wall.AddScaleOp().Set((0.1, 5.0, 1.0))
+        await omni.kit.app.get_app().next_update_async()
+
+        generator.generate2d()
+        buffer = generator.get_buffer_view().copy()
+        labels = generator.get_region_labels_view()
+        self.assertEqual(labels.shape, buffer.shape)
+        self.assertEqual(generator.get_num_regions(), 2)
+        np.testing.assert_array_equal(labels == 0, buffer == 4)
+        self.assertEqual(len(np.unique(labels[buffer == 5])), 1)
+        self.assertEqual(len(np.unique(labels[buffer == 6])), 1)
+        self.assertNotEqual(labels[buffer == 5][0], labels[buffer == 6][0])
+
+        # Seeding both sides of the wall marks all the free space
+        generator.set_flood_fill_seeds([(0.0, 0.0, 0.0), (-1.0, 1.0, 0.0)])
+        seeded = generator.get_buffer_view()
+        self.assertFalse(np.any(seeded == 6))
+        np.testing.assert_array_equal(seeded == 4, buffer == 4)
+        self.assertEqual(generator.get_num_regions(), 2)
+
+        # An empty list restores the fill from the origin
+        generator.set_flood_fill_seeds([])
+        np.testing.assert_array_equal(generator.get_buffer_view(), buffer)
+        self._timeline.stop()
@@ -339,6 +339,12 @@ struct Mesh
     /** @brief Path to converted USD mesh file. */
     std::string m_convertedUsdMesh;
 
+    /** @brief Key of the mesh in the mesh conversion cache, empty if the cache is not used. */
+    std::string m_conversionCacheKey;
+
+    /** @brief Whether the converted USD mesh file was copied from the mesh conversion cache. */
+    bool m_convertedFromCache = false;
+
     /** @brief Scale factor applied to the mesh (X, Y, Z). */
     Vec3 scale = { 1.0f, 1.0f, 1.0f };
 
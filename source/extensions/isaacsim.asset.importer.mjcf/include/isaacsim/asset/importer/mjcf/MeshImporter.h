@@ -20,7 +20,11 @@
 
 #include "omniverse_asset_converter.h"
 
+#include <carb/settings/ISettings.h>
+#include <carb/tokens/TokensUtils.h>
+
 #include <isaacsim/asset/importer/mjcf/Mesh.h>
+#include <isaacsim/core/includes/utils/MeshConversionCache.h>
 #include <isaacsim/core/includes/utils/Path.h>
 #include <isaacsim/core/includes/utils/Usd.h>
 
@@ -28,6 +32,60 @@
 using namespace isaacsim::core::includes::utils::path;
 namespace mesh
 {
+using isaacsim::core::includes::utils::MeshConversionCache;
+
+/** @brief Omni Converter flags used for every mesh, they are part of the mesh conversion cache key. */
+constexpr int kConverterFlags = OMNI_CONVERTER_FLAGS_SINGLE_MESH_FILE | OMNI_CONVERTER_FLAGS_IGNORE_CAMERAS |
+                                OMNI_CONVERTER_FLAGS_USE_METER_PER_UNIT | OMNI_CONVERTER_FLAGS_MERGE_ALL_MESHES |
+                                OMNI_CONVERTER_FLAGS_IGNORE_LIGHTS | OMNI_CONVERTER_FLAGS_FBX_CONVERT_TO_Z_UP |
+                                OMNI_CONVERTER_FLAGS_FBX_BAKING_SCALES_INTO_MESH | OMNI_CONVERTER_FLAGS_IGNORE_PIVOTS;
+
+/**
+ * @brief Omni Converter release the meshes are converted with, part of the mesh conversion cache key.
+ * @note Keep in sync with the omniverse_asset_converter package in deps/ext-deps.packman.xml.
+ */
+constexpr const char* kConverterVersion = "3.2.2+release.1853";
+
+/**
+ * @brief Gets the persistent mesh conversion cache configured by the extension settings.
+ * @details The cache is shared by every import in the process so its counters add up over a session.
+ * @return Mesh conversion cache, disabled if the settings turn it off
+ */
+inline MeshConversionCache& getMeshConversionCache()
+{
+    static MeshConversionCache cache = []()
+    {
+        std::string directory;
+        int64_t maxSizeMb = 0;
+        carb::settings::ISettings* settings = carb::getCachedInterface<carb::settings::ISettings>();
+        if (settings && settings->getAsBool("/exts/isaacsim.asset.importer.mjcf/mesh_cache_enabled"))
+        {
+            const char* path = settings->getStringBuffer("/exts/isaacsim.asset.importer.mjcf/mesh_cache_path");
+            if (path && path[0])
+            {
+                directory = carb::tokens::resolveString(carb::getCachedInterface<carb::tokens::ITokens>(), path);
+            }
+            maxSizeMb = settings->getAsInt64("/exts/isaacsim.asset.importer.mjcf/mesh_cache_max_size_mb");
+        }
+        return MeshConversionCache(directory, maxSizeMb > 0 ? static_cast<uint64_t>(maxSizeMb) * 1024 * 1024 : 0);
+    }();
+    return cache;
+}
+
+/**
+ * @brief Logs the hit and miss counters of the mesh conversion cache.
+ */
+inline void logMeshConversionCacheStats()
+{
+    auto& cache = getMeshConversionCache();
+    if (cache.isEnabled())
+    {
+        auto stats = cache.getStats();
+        CARB_LOG_INFO("Mesh conversion cache: %llu hits, %llu misses, %llu stored, %llu evicted",
+                      static_cast<unsigned long long>(stats.hits), static_cast<unsigned long long>(stats.misses),
+                      static_cast<unsigned long long>(stats.stores), static_cast<unsigned long long>(stats.evictions));
+    }
+}
 
 inline std::string StatusToString(OmniConverterStatus status)
 {
@@ -229,12 +287,13 @@ public:
 
     /**
      * @brief Waits for asset conversion to complete and processes the results.
-     * @param[in] future Future object tracking conversion progress
+     * @param[in] future Future object tracking conversion progress, null if the mesh was copied from the cache
      * @param[in] usdStage USD stage to add converted mesh to
      * @param[in] mesh_usd_path Path to converted USD mesh file
      * @param[in] meshStagePath Path in stage where mesh should be placed
      * @param[in] rootPath Root path for organizing assets
      * @param[in,out] materialPaths Map tracking material paths to avoid duplicates
+     * @param[in] cacheKey Key the converted mesh is added to the mesh conversion cache under, empty to skip it
      * @return Path to the imported mesh primitive in the stage
      */
     pxr::SdfPath waitForConverter(OmniConverterFuture* future,
@@ -242,20 +301,26 @@ public:
                                   const std::string& mesh_usd_path,
                                   const std::string& meshStagePath,
                                   const pxr::SdfPath& rootPath,
-                                  std::map<pxr::TfToken, pxr::SdfPath>& materialPaths)
+                                  std::map<pxr::TfToken, pxr::SdfPath>& materialPaths,
+                                  const std::string& cacheKey = std::string())
     {
         OmniConverterStatus status = OmniConverterStatus::OK;
         // Wait for the converter to finish
-        if (future == nullptr)
-        {
-            CARB_LOG_ERROR("Error: Future is null");
-            return pxr::SdfPath();
-        }
-        while (omniConverterCheckFutureStatus(future) == OmniConverterStatus::IN_PROGRESS)
+        if (future != nullptr)
         {
+            while (omniConverterCheckFutureStatus(future) == OmniConverterStatus::IN_PROGRESS)
+            {
+            }
+            status = omniConverterCheckFutureStatus(future);
+            omniConverterReleaseFuture(future);
+            auto& cache = getMeshConversionCache();
+            if (status == OmniConverterStatus::OK && cache.isEnabled() && !cacheKey.empty())
+            {
+                // Textures written next to the converted mesh are cached along with it
+                cache.store(cacheKey, mesh_usd_path,
+                            isaacsim::core::includes::utils::usd::localizeAssetPaths(mesh_usd_path));
+            }
         }
-        status = omniConverterCheckFutureStatus(future);
-        omniConverterReleaseFuture(future);
 
         if (status == OmniConverterStatus::OK)
         {
@@ -309,11 +374,20 @@ public:
         std::string mesh_usd_path = pathJoin(getParent(meshPath), getPathStem(meshPath.c_str()) + ".tmp.usd");
 
         CARB_LOG_INFO("Importing Mesh %s\n    (%s)", meshPath.c_str(), mesh_usd_path.c_str());
-        // Set up the Omni Converter flags
-        int flags = OMNI_CONVERTER_FLAGS_SINGLE_MESH_FILE | OMNI_CONVERTER_FLAGS_IGNORE_CAMERAS |
-                    OMNI_CONVERTER_FLAGS_USE_METER_PER_UNIT | OMNI_CONVERTER_FLAGS_MERGE_ALL_MESHES |
-                    OMNI_CONVERTER_FLAGS_IGNORE_LIGHTS | OMNI_CONVERTER_FLAGS_FBX_CONVERT_TO_Z_UP |
-                    OMNI_CONVERTER_FLAGS_FBX_BAKING_SCALES_INTO_MESH | OMNI_CONVERTER_FLAGS_IGNORE_PIVOTS;
+        mesh->m_convertedUsdMesh = mesh_usd_path;
+
+        // Reuse a previous conversion of the same mesh content
+        auto& cache = getMeshConversionCache();
+        if (cache.isEnabled())
+        {
+            mesh->m_conversionCacheKey = MeshConversionCache::makeKey(
+                meshPath, std::string(kConverterVersion) + " " + std::to_string(kConverterFlags));
+            if (cache.fetch(mesh->m_conversionCacheKey, mesh_usd_path))
+            {
+                mesh->m_convertedFromCache = true;
+                return;
+            }
+        }
 
         // Set up the log and progress callbacks for the Omni Converter
         omniConverterSetLogCallback([](const char* message) { CARB_LOG_INFO("%s", message); });
@@ -321,8 +395,8 @@ public:
                                          { CARB_LOG_INFO("Progress: %d / %d", progress, total); });
 
         // Create a new Omni Converter future for the mesh import
-        mesh->m_assetConvertStatus = omniConverterCreateAsset(meshPath.c_str(), mesh_usd_path.c_str(), flags);
-        mesh->m_convertedUsdMesh = mesh_usd_path;
+        mesh->m_assetConvertStatus =
+            omniConverterCreateAsset(meshPath.c_str(), mesh_usd_path.c_str(), kConverterFlags);
     }
 };
 
@@ -384,9 +384,13 @@ public:
 
     /**
      * @brief Adds contact filter primitives to USD.
+     * @details
+     * Bodies with the same contype/conaffinity masks share a collision group and groups that never collide are
+     * filtered against each other. Filtered pairs are only authored for the body pairs the groups cannot express.
      * @param[in] stage USD stage to add to
+     * @param[in] rootPath Root path for USD primitives
      */
-    void AddContactFilters(pxr::UsdStageWeakPtr stage);
+    void AddContactFilters(pxr::UsdStageWeakPtr stage, std::string rootPath);
 
     /**
      * @brief Adds tendon primitives to USD.
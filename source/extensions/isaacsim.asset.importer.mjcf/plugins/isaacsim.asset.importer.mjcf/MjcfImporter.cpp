@@ -16,6 +16,7 @@
 
 #include "isaacsim/robot/schema/robot_schema.h"
 
+#include <isaacsim/asset/importer/mjcf/MeshImporter.h>
 #include <isaacsim/asset/importer/mjcf/MjcfImporter.h>
 #include <isaacsim/core/includes/math/core/Maths.h>
 #include <isaacsim/core/includes/utils/Path.h>
@@ -289,7 +290,7 @@ bool MJCFImporter::AddPhysicsEntities(std::unordered_map<std::string, pxr::UsdSt
     }
     {
         pxr::UsdEditContext context(stages["stage"], stages["physics_stage"]->GetRootLayer());
-        AddContactFilters(stages["stage"]);
+        AddContactFilters(stages["stage"], rootPrimPath);
         AddTendons(stages["stage"], rootPrimPath);
 
         addWorldGeomsAndSites(stages, rootPrimPath, config, instanceableUSDPath);
@@ -359,6 +360,7 @@ bool MJCFImporter::AddPhysicsEntities(std::unordered_map<std::string, pxr::UsdSt
 
         jointPrim.CreateExcludeFromArticulationAttr().Set(true);
     }
+    mesh::logMeshConversionCacheStats();
     return true;
 }
 
@@ -621,25 +623,166 @@ void MJCFImporter::addWorldGeomsAndSites(std::unordered_map<std::string, pxr::Us
     addVisualSites(stages["base_stage"], dummyLink, &worldBody, dummyPath, config);
 }
 
-void MJCFImporter::AddContactFilters(pxr::UsdStageWeakPtr stage)
+void MJCFImporter::AddContactFilters(pxr::UsdStageWeakPtr stage, std::string rootPath)
 {
-    // adding collision filtering pairs
+    // Collision geoms are authored under the prim of their body, so contacts are filtered per body
+    std::vector<std::string> bodyPaths;
+    std::map<std::string, int> bodyPathToIdx;
+    std::vector<int> geomBody(contactGraph.size(), -1);
     for (int i = 0; i < (int)contactGraph.size(); i++)
     {
-        std::string& primPath = nameToUsdCollisionPrim[contactGraph[i]->name];
-        pxr::UsdPhysicsFilteredPairsAPI filteredPairsAPI =
-            pxr::UsdPhysicsFilteredPairsAPI::Apply(stage->GetPrimAtPath(pxr::SdfPath(primPath)));
-        std::set<int> neighborhood = contactGraph[i]->adjacentNodes;
-        neighborhood.insert(i);
-        for (int j = 0; j < (int)contactGraph.size(); j++)
-        {
-            if (neighborhood.find(j) == neighborhood.end())
+        auto primPath = nameToUsdCollisionPrim.find(contactGraph[i]->name);
+        if (primPath == nameToUsdCollisionPrim.end())
+        {
+            continue;
+        }
+        auto body = bodyPathToIdx.emplace(primPath->second, (int)bodyPaths.size());
+        if (body.second)
+        {
+            bodyPaths.push_back(primPath->second);
+        }
+        geomBody[i] = body.first->second;
+    }
+    const size_t numBodies = bodyPaths.size();
+    if (numBodies == 0)
+    {
+        return;
+    }
+
+    // Two bodies collide only if every pair of their geoms is allowed to collide
+    std::vector<char> collides(numBodies * numBodies, 1);
+    for (int i = 0; i < (int)contactGraph.size(); i++)
+    {
+        for (int j = i + 1; j < (int)contactGraph.size(); j++)
+        {
+            int a = geomBody[i];
+            int b = geomBody[j];
+            if (a < 0 || b < 0 || a == b)
+            {
+                continue;
+            }
+            if (contactGraph[i]->adjacentNodes.find(j) == contactGraph[i]->adjacentNodes.end())
+            {
+                collides[a * numBodies + b] = 0;
+                collides[b * numBodies + a] = 0;
+            }
+        }
+    }
+
+    // Bodies with the same contype/conaffinity masks share a collision group. Bodies named in explicit contact
+    // pairs get a group of their own, since pairs enable contacts the masks alone do not allow.
+    std::set<int> pairBodies;
+    for (auto& contact : contacts)
+    {
+        if (contact->type != MJCFContact::PAIR)
+        {
+            continue;
+        }
+        for (const std::string& geomName : { contact->geom1, contact->geom2 })
+        {
+            auto index = geomNameToIdx.find(geomName);
+            if (index != geomNameToIdx.end() && geomBody[index->second] >= 0)
+            {
+                pairBodies.insert(geomBody[index->second]);
+            }
+        }
+    }
+    std::vector<std::set<std::pair<int, int>>> bodyMasks(numBodies);
+    for (int i = 0; i < (int)contactGraph.size(); i++)
+    {
+        if (geomBody[i] >= 0)
+        {
+            bodyMasks[geomBody[i]].insert({ collisionGeoms[i]->contype, collisionGeoms[i]->conaffinity });
+        }
+    }
+    std::map<std::set<std::pair<int, int>>, int> masksToGroup;
+    std::vector<std::vector<int>> groups;
+    for (int b = 0; b < (int)numBodies; b++)
+    {
+        int group = (int)groups.size();
+        if (!pairBodies.count(b))
+        {
+            group = masksToGroup.emplace(bodyMasks[b], group).first->second;
+        }
+        if (group == (int)groups.size())
+        {
+            groups.emplace_back();
+        }
+        groups[group].push_back(b);
+    }
+
+    std::string groupsPath = rootPath + "/collision_groups";
+    stage->DefinePrim(pxr::SdfPath(groupsPath), pxr::TfToken("Scope"));
+    // The collision prototypes under /collisions must stay out of the new groups too
+    pxr::UsdPhysicsCollisionGroup collidersGroup =
+        pxr::UsdPhysicsCollisionGroup(stage->GetPrimAtPath(pxr::SdfPath("/collisions/collidersCollisionGroup")));
+    std::vector<pxr::UsdPhysicsCollisionGroup> groupPrims;
+    for (size_t g = 0; g < groups.size(); g++)
+    {
+        pxr::UsdPhysicsCollisionGroup groupPrim = pxr::UsdPhysicsCollisionGroup::Define(
+            stage, pxr::SdfPath(groupsPath + "/group_" + std::to_string(g)));
+        pxr::UsdRelationship includesRel = groupPrim.GetCollidersCollectionAPI().CreateIncludesRel();
+        for (int b : groups[g])
+        {
+            includesRel.AddTarget(pxr::SdfPath(bodyPaths[b]));
+        }
+        if (collidersGroup)
+        {
+            collidersGroup.CreateFilteredGroupsRel().AddTarget(groupPrim.GetPath());
+        }
+        groupPrims.push_back(groupPrim);
+    }
+
+    // Filter whole groups when none of their bodies collide, and fall back to filtered pairs for the exceptions
+    size_t numBlockedPairs = 0;
+    size_t numFilteredGroups = 0;
+    size_t numFilteredPairs = 0;
+    for (size_t ga = 0; ga < groups.size(); ga++)
+    {
+        for (size_t gb = ga; gb < groups.size(); gb++)
+        {
+            bool anyCollides = false;
+            std::vector<std::pair<int, int>> blocked;
+            for (size_t ia = 0; ia < groups[ga].size(); ia++)
+            {
+                for (size_t ib = (ga == gb ? ia + 1 : 0); ib < groups[gb].size(); ib++)
+                {
+                    int a = groups[ga][ia];
+                    int b = groups[gb][ib];
+                    if (collides[a * numBodies + b])
+                    {
+                        anyCollides = true;
+                    }
+                    else
+                    {
+                        blocked.push_back({ a, b });
+                    }
+                }
+            }
+            numBlockedPairs += blocked.size();
+            if (blocked.empty())
+            {
+                continue;
+            }
+            if (!anyCollides)
+            {
+                groupPrims[ga].CreateFilteredGroupsRel().AddTarget(groupPrims[gb].GetPath());
+                numFilteredGroups++;
+                continue;
+            }
+            for (const auto& pair : blocked)
             {
-                std::string& filteredPrimPath = nameToUsdCollisionPrim[contactGraph[j]->name];
-                filteredPairsAPI.CreateFilteredPairsRel().AddTarget(pxr::SdfPath(filteredPrimPath));
+                pxr::UsdPhysicsFilteredPairsAPI filteredPairsAPI =
+                    pxr::UsdPhysicsFilteredPairsAPI::Apply(stage->GetPrimAtPath(pxr::SdfPath(bodyPaths[pair.first])));
+                filteredPairsAPI.CreateFilteredPairsRel().AddTarget(pxr::SdfPath(bodyPaths[pair.second]));
+                numFilteredPairs++;
             }
         }
     }
+    CARB_LOG_INFO(
+        "Contact filtering for %zu bodies: %zu collision groups, %zu filtered group pairs and %zu filtered body pairs "
+        "authored for %zu non-colliding body pairs",
+        numBodies, groups.size(), numFilteredGroups, numFilteredPairs, numBlockedPairs);
 }
 
 void createTendonAxisRootAPI(const pxr::UsdPhysicsJoint& rootJointPrim,
@@ -1497,7 +1640,7 @@ bool MJCFImporter::createContactGraph()
         {
             MJCFGeom* geom1 = collisionGeoms[i];
             MJCFGeom* geom2 = collisionGeoms[j];
-            if ((geom1->contype & geom2->conaffinity) || (geom2->contype && geom1->conaffinity))
+            if ((geom1->contype & geom2->conaffinity) || (geom2->contype & geom1->conaffinity))
             {
                 contactGraph[i]->adjacentNodes.insert(j);
                 contactGraph[j]->adjacentNodes.insert(i);
@@ -255,12 +255,12 @@ pxr::UsdPrim createUsdMesh(pxr::UsdStageWeakPtr stage,
                            float scale,
                            bool importMaterials)
 {
-    if (mesh->m_assetConvertStatus != nullptr)
+    if (mesh->m_assetConvertStatus != nullptr || mesh->m_convertedFromCache)
     {
         mesh::MeshImporter mesh_importer;
-        pxr::SdfPath mesh_usd_path =
-            mesh_importer.waitForConverter(mesh->m_assetConvertStatus, stage, mesh->m_convertedUsdMesh, path.GetText(),
-                                           stage->GetDefaultPrim().GetPath(), materialPaths);
+        pxr::SdfPath mesh_usd_path = mesh_importer.waitForConverter(
+            mesh->m_assetConvertStatus, stage, mesh->m_convertedUsdMesh, path.GetText(),
+            stage->GetDefaultPrim().GetPath(), materialPaths, mesh->m_conversionCacheKey);
         mesh->m_assetConvertStatus = nullptr;
         pxr::UsdPrim prim = stage->GetPrimAtPath(mesh_usd_path);
         pxr::UsdGeomXformable xformable(prim);
@@ -21,6 +21,8 @@
 
 #include <carb/PluginUtils.h>
 #include <carb/logging/Log.h>
+#include <carb/settings/ISettings.h>
+#include <carb/tokens/ITokens.h>
 
 #include <isaacsim/asset/importer/mjcf/IMjcf.h>
 #include <isaacsim/asset/importer/mjcf/MjcfImporter.h>
@@ -44,7 +46,7 @@ const struct carb::PluginImplDesc kPluginImpl = { EXTENSION_NAME, "MJCF Utilitie
                                                   carb::PluginHotReload::eEnabled, "dev" };
 
 CARB_PLUGIN_IMPL(kPluginImpl, isaacsim::asset::importer::mjcf::Mjcf)
-CARB_PLUGIN_IMPL_DEPS(omni::kit::IApp, carb::logging::ILogging)
+CARB_PLUGIN_IMPL_DEPS(omni::kit::IApp, carb::logging::ILogging, carb::settings::ISettings, carb::tokens::ITokens)
 
 namespace
 {
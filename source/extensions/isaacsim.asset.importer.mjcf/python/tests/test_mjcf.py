@@ -315,6 +315,89 @@ class TestMJCF(omni.kit.test.AsyncTestCase):
         # nothing crashes
         self._timeline.stop()
 
+    async def test_mjcf_contact_filtering(self):
+        stage = omni.usd.get_context().get_stage()
+        status, import_config = omni.kit.commands.execute("MJCFCreateImportConfig")
+        import_config.set_import_inertia_tensor(True)
+        omni.kit.commands.execute(
+            "MJCFCreateAsset",
+            mjcf_path=self._extension_path + "/data/mjcf/open_ai_assets/hand/manipulate_egg_touch_sensors.xml",
+            import_config=import_config,
+            prim_path="/shadow_hand",
+        )
+        await omni.kit.app.get_app().next_update_async()
+
+        # contype/conaffinity masks map to a few collision groups instead of a filtered pair per geom pair
+        groups = [prim for prim in stage.Traverse() if prim.IsA(UsdPhysics.CollisionGroup)]
+        self.assertGreater(len(groups), 2)
+        num_filtered_pairs = 0
+        for prim in stage.Traverse():
+            if prim.HasAPI(UsdPhysics.FilteredPairsAPI):
+                num_filtered_pairs += len(UsdPhysics.FilteredPairsAPI(prim).GetFilteredPairsRel().GetTargets())
+        self.assertLess(num_filtered_pairs, len(groups))
+
+        # Start Simulation and wait
+        self._timeline.play()
+        await omni.kit.app.get_app().next_update_async()
+        await asyncio.sleep(1.0)
+        # nothing crashes
+        self._timeline.stop()
+
+        await omni.usd.get_context().new_stage_async()
+        await omni.kit.app.get_app().next_update_async()
+        stage = omni.usd.get_context().get_stage()
+        status, import_config = omni.kit.commands.execute("MJCFCreateImportConfig")
+        omni.kit.commands.execute(
+            "MJCFCreateAsset",
+            mjcf_path=self._extension_path + "/data/mjcf/tests/contact_filtering.xml",
+            import_config=import_config,
+            prim_path="/contact_filtering",
+        )
+        await omni.kit.app.get_app().next_update_async()
+
+        bodies = {
+            prim.GetName(): prim.GetPath()
+            for prim in stage.Traverse()
+            if prim.HasAPI(UsdPhysics.RigidBodyAPI) and prim.GetName().startswith("box_")
+        }
+        self.assertEqual(len(bodies), 5)
+        body_groups = {}
+        for prim in stage.Traverse():
+            if prim.IsA(UsdPhysics.CollisionGroup):
+                group = UsdPhysics.CollisionGroup(prim)
+                for target in group.GetCollidersCollectionAPI().GetIncludesRel().GetTargets():
+                    body_groups[target] = prim.GetPath()
+
+        def groups_filtered(body_a, body_b):
+            for first, second in [(body_a, body_b), (body_b, body_a)]:
+                group = UsdPhysics.CollisionGroup(stage.GetPrimAtPath(body_groups[bodies[first]]))
+                if body_groups[bodies[second]] in group.GetFilteredGroupsRel().GetTargets():
+                    return True
+            return False
+
+        def pair_filtered(body_a, body_b):
+            for first, second in [(body_a, body_b), (body_b, body_a)]:
+                prim = stage.GetPrimAtPath(bodies[first])
+                if prim.HasAPI(UsdPhysics.FilteredPairsAPI):
+                    if bodies[second] in UsdPhysics.FilteredPairsAPI(prim).GetFilteredPairsRel().GetTargets():
+                        return True
+            return False
+
+        # Bodies with the same masks share a group, the others get a group each
+        self.assertEqual(body_groups[bodies["box_a"]], body_groups[bodies["box_b"]])
+        self.assertEqual(body_groups[bodies["box_a"]], body_groups[bodies["box_e"]])
+        self.assertEqual(len({body_groups[bodies[name]] for name in ["box_a", "box_c", "box_d"]}), 3)
+        # contype 1 and 2 never meet, so the whole group pair is filtered
+        self.assertTrue(groups_filtered("box_a", "box_c"))
+        # box_d collides with box_a through its contype and with box_c through its conaffinity
+        self.assertFalse(groups_filtered("box_a", "box_d"))
+        self.assertFalse(groups_filtered("box_c", "box_d"))
+        self.assertFalse(pair_filtered("box_a", "box_d"))
+        # The excluded pair inside the shared group falls back to a filtered pair
+        self.assertTrue(pair_filtered("box_b", "box_e"))
+        self.assertFalse(pair_filtered("box_a", "box_b"))
+        self.assertFalse(pair_filtered("box_a", "box_e"))
+
     async def test_mjcf_import_humanoid_100(self):
         stage = omni.usd.get_context().get_stage()
         status, import_config = omni.kit.commands.execute("MJCFCreateImportConfig")
@@ -476,6 +476,14 @@ PYBIND11_MODULE(_urdf, m)
                 Returns:
                     :obj:`float`: The natural stiffness of the joint
 
+                )pbdoc")
+        .def("get_mesh_conversion_cache_stats", wrapInterfaceFunction(&Urdf::getMeshConversionCacheStats),
+             R"pbdoc(
+                Get the counters of the mesh conversion cache shared by every import.
+
+                Returns:
+                    :obj:`dict`: The cache ``hits``, ``misses``, ``stores`` and ``evictions`` since the extension was loaded
+
                 )pbdoc");
 }
 }
@@ -142,7 +142,7 @@ struct ImportConfig
  */
 struct Urdf
 {
-    CARB_PLUGIN_INTERFACE("isaacsim::asset::importer::urdf::Urdf", 0, 1);
+    CARB_PLUGIN_INTERFACE("isaacsim::asset::importer::urdf::Urdf", 0, 2);
 
     /**
      * @brief Parses a URDF file into a UrdfRobot data structure
@@ -193,6 +193,12 @@ struct Urdf
      * @return Python dictionary containing kinematic chain information
      */
     pybind11::dict(CARB_ABI* getKinematicChain)(const UrdfRobot& robot);
+
+    /**
+     * @brief Gets the counters of the mesh conversion cache shared by every import
+     * @return Python dictionary with the cache hits, misses, stores and evictions since the plugin was loaded
+     */
+    pybind11::dict(CARB_ABI* getMeshConversionCacheStats)();
 };
 }
 }
@@ -18,8 +18,12 @@
 #include <pch/UsdPCH.h>
 // clang-format on
 
+#include <isaacsim/core/includes/utils/MeshConversionCache.h>
+#include <omniverse_asset_converter.h>
 
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 
 namespace isaacsim
@@ -30,12 +34,93 @@ namespace importer
 {
 namespace urdf
 {
+/**
+ * @class MeshConversionQueue
+ * @brief Converts the mesh files of a robot to temporary USD files concurrently.
+ * @details
+ * Conversions start as soon as they are requested, up to a concurrency limit, and queued conversions start
+ * as running ones finish. SimpleImport waits for the conversion of a mesh before merging it into the stage,
+ * so the remaining meshes keep converting while earlier ones are merged. Meshes found in the persistent mesh
+ * conversion cache are copied from it instead of being converted, and new conversions are added to it.
+ */
+class MeshConversionQueue
+{
+public:
+    /**
+     * @brief Creates an empty conversion queue.
+     * @param[in] outputDir Directory the temporary USD files are written to
+     * @param[in] maxConcurrent Maximum number of conversions running at once, 0 uses the hardware thread count
+     */
+    MeshConversionQueue(const std::string& outputDir, size_t maxConcurrent = 0);
+
+    /**
+     * @brief Cancels the running conversions and deletes the temporary files that were not merged.
+     */
+    ~MeshConversionQueue();
+
+    MeshConversionQueue(const MeshConversionQueue&) = delete;
+    MeshConversionQueue& operator=(const MeshConversionQueue&) = delete;
+
+    /**
+     * @brief Requests the conversion of a mesh file, repeated requests for the same file are ignored.
+     * @param[in] meshPath Path of the mesh file to convert
+     */
+    void request(const std::string& meshPath);
+
+    /**
+     * @brief Waits for the conversion of a mesh file, requesting it first if needed.
+     * @details The caller owns the temporary USD file once this returns.
+     * @param[in] meshPath Path of the mesh file as passed to request()
+     * @param[out] usdPath Temporary USD file the mesh was converted to
+     * @return Final status of the conversion
+     */
+    OmniConverterStatus wait(const std::string& meshPath, std::string& usdPath);
+
+private:
+    struct Conversion
+    {
+        std::string usdPath;
+        std::string cacheKey;
+        OmniConverterFuture* future = nullptr;
+        OmniConverterStatus status = OmniConverterStatus::IN_PROGRESS;
+        bool consumed = false;
+    };
+
+    void start(const std::string& meshPath, Conversion& conversion);
+    void pollRunning();
+
+    std::string m_outputDir;
+    size_t m_maxConcurrent;
+    std::unordered_map<std::string, Conversion> m_conversions;
+    std::vector<std::string> m_running;
+    std::vector<std::string> m_queued;
+    size_t m_nextQueued = 0;
+};
+
+/**
+ * @brief Imports a mesh file into the stage, reusing the prim of a previous import of the same file.
+ * @param[in] usdStage Stage to import the mesh into
+ * @param[in] path Prim path the mesh is imported under
+ * @param[in] meshPath Path of the mesh file
+ * @param[in,out] meshList Meshes imported so far, by mesh file
+ * @param[in,out] materialList Materials imported so far, by shader parameters
+ * @param[in] rootPath Robot prim the materials are created under
+ * @param[in] conversions Queue the mesh conversion was requested on, the mesh is converted on its own if null
+ * @return Path of the imported mesh prim
+ */
 pxr::SdfPath SimpleImport(pxr::UsdStageRefPtr usdStage,
                           const std::string& path,
                           const std::string& meshPath,
                           std::map<pxr::TfToken, pxr::SdfPath>& meshList,
                           std::map<pxr::TfToken, pxr::SdfPath>& materialList,
-                          const pxr::SdfPath& rootPath);
+                          const pxr::SdfPath& rootPath,
+                          MeshConversionQueue* conversions = nullptr);
+
+/**
+ * @brief Gets the counters of the mesh conversion cache shared by every import of the process.
+ * @return Cache hits, misses, stores and evictions since the plugin was loaded
+ */
+isaacsim::core::includes::utils::MeshConversionCache::Stats getMeshConversionCacheStats();
 
 
 }
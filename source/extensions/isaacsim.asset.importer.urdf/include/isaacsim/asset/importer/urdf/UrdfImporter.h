@@ -75,6 +75,7 @@ private:
     std::map<std::string, std::string> matPrimPaths;
     std::map<pxr::TfToken, pxr::SdfPath> meshPaths;
     std::map<pxr::TfToken, pxr::SdfPath> materialPaths;
+    std::unique_ptr<MeshConversionQueue> meshConversions_;
 
 public:
     /**
@@ -125,6 +126,13 @@ public:
 
 
 private:
+    /**
+     * @brief Starts converting the mesh files referenced by the robot links.
+     * @param[in] baseStage Stage the converted meshes are imported into
+     * @param[in] robot Robot whose visual and collision meshes are converted
+     */
+    void queueMeshConversions(const pxr::UsdStageRefPtr& baseStage, const UrdfRobot& robot);
+
     /**
      * @brief Adds a rigid body link to the USD stage.
      * @param[in,out] stageMap Map of stage names to USD stage references
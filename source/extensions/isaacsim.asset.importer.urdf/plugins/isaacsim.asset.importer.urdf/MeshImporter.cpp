@@ -14,18 +14,28 @@
 // limitations under the License.
 
 #include <carb/logging/Log.h>
+#include <carb/settings/ISettings.h>
+#include <carb/tokens/TokensUtils.h>
 
 #include <isaacsim/asset/importer/urdf/ImportHelpers.h>
 #include <isaacsim/asset/importer/urdf/MeshImporter.h>
+#include <isaacsim/core/includes/utils/MeshConversionCache.h>
 #include <isaacsim/core/includes/utils/Path.h>
+#include <isaacsim/core/includes/utils/Usd.h>
 
 #include <OmniClient.h>
+#include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <condition_variable>
 #include <filesystem>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <omniverse_asset_converter.h>
 #include <set>
 #include <stack>
+#include <thread>
 #include <tinyxml2.h>
 #include <unordered_set>
 
@@ -38,6 +48,86 @@ namespace importer
 namespace urdf
 {
 using namespace isaacsim::core::includes::utils::path;
+using isaacsim::core::includes::utils::MeshConversionCache;
+
+namespace
+{
+// Omni Converter flags used for every mesh, they are part of the cache key
+constexpr int kConverterFlags = OMNI_CONVERTER_FLAGS_SINGLE_MESH_FILE | OMNI_CONVERTER_FLAGS_IGNORE_CAMERAS |
+                                OMNI_CONVERTER_FLAGS_USE_METER_PER_UNIT | OMNI_CONVERTER_FLAGS_MERGE_ALL_MESHES |
+                                OMNI_CONVERTER_FLAGS_IGNORE_LIGHTS | OMNI_CONVERTER_FLAGS_FBX_CONVERT_TO_Z_UP |
+                                OMNI_CONVERTER_FLAGS_FBX_BAKING_SCALES_INTO_MESH | OMNI_CONVERTER_FLAGS_IGNORE_PIVOTS;
+
+// Omni Converter release the meshes are converted with, part of the cache key. Keep in sync with the
+// omniverse_asset_converter package in deps/ext-deps.packman.xml
+constexpr const char* kConverterVersion = "3.2.2+release.1853";
+
+// Counts the progress reports of all running conversions, waits block on it instead of sleeping
+std::mutex gConverterProgressMutex;
+std::condition_variable gConverterProgress;
+uint64_t gConverterProgressCount = 0;
+
+// Status checks still run at this interval in case a conversion finishes without reporting progress
+constexpr std::chrono::milliseconds kConverterStatusInterval(20);
+
+void notifyConverterProgress()
+{
+    {
+        std::lock_guard<std::mutex> lock(gConverterProgressMutex);
+        gConverterProgressCount++;
+    }
+    gConverterProgress.notify_all();
+}
+
+uint64_t getConverterProgressCount()
+{
+    std::lock_guard<std::mutex> lock(gConverterProgressMutex);
+    return gConverterProgressCount;
+}
+
+// Blocks until a conversion reports progress after seenCount was read, or the status interval elapses
+void waitForConverterProgress(uint64_t seenCount)
+{
+    std::unique_lock<std::mutex> lock(gConverterProgressMutex);
+    gConverterProgress.wait_for(
+        lock, kConverterStatusInterval, [seenCount] { return gConverterProgressCount != seenCount; });
+}
+
+// Cache directory from the extension settings, empty when the cache is disabled
+std::string getMeshCacheDirectory()
+{
+    carb::settings::ISettings* settings = carb::getCachedInterface<carb::settings::ISettings>();
+    if (!settings || !settings->getAsBool("/exts/isaacsim.asset.importer.urdf/mesh_cache_enabled"))
+    {
+        return std::string();
+    }
+    const char* path = settings->getStringBuffer("/exts/isaacsim.asset.importer.urdf/mesh_cache_path");
+    if (!path || !path[0])
+    {
+        return std::string();
+    }
+    return carb::tokens::resolveString(carb::getCachedInterface<carb::tokens::ITokens>(), path);
+}
+
+uint64_t getMeshCacheMaxSize()
+{
+    carb::settings::ISettings* settings = carb::getCachedInterface<carb::settings::ISettings>();
+    if (!settings)
+    {
+        return 0;
+    }
+    int64_t maxSizeMb = settings->getAsInt64("/exts/isaacsim.asset.importer.urdf/mesh_cache_max_size_mb");
+    return maxSizeMb > 0 ? static_cast<uint64_t>(maxSizeMb) * 1024 * 1024 : 0;
+}
+
+// Shared by every import in the process so the hit and miss counters add up over a session
+MeshConversionCache& getMeshConversionCache()
+{
+    static MeshConversionCache cache(getMeshCacheDirectory(), getMeshCacheMaxSize());
+    return cache;
+}
+}
+
 std::string StatusToString(OmniConverterStatus status)
 {
     switch (status)
@@ -275,25 +365,163 @@ void rotateMeshX(pxr::UsdGeomXformable mesh)
     mesh.AddScaleOp(pxr::UsdGeomXformOp::PrecisionDouble).Set(pxr::GfVec3d(1, 1, 1));
 }
 
-pxr::SdfPath waitForConverter(OmniConverterFuture* future,
-                              pxr::UsdStageRefPtr usdStage,
-                              const std::string& meshStagePath,
-                              const std::string& mesh_usd_path,
-                              const std::string& meshPath,
-                              const pxr::SdfPath& rootPath,
-                              std::map<pxr::TfToken, pxr::SdfPath>& materialPaths)
+MeshConversionQueue::MeshConversionQueue(const std::string& outputDir, size_t maxConcurrent)
+    : m_outputDir(outputDir),
+      m_maxConcurrent(maxConcurrent > 0 ? maxConcurrent : std::max(1u, std::thread::hardware_concurrency()))
 {
-    OmniConverterStatus status = OmniConverterStatus::OK;
-    bool isCollada = isColladaFile(meshPath);
-    UpAxis upAxis = isCollada ? getColladaUpAxis(meshPath) : UpAxis::UNKNOWN;
+    // Set up the log and progress callbacks for the Omni Converter
+    omniConverterSetLogCallback([](const char* message) { CARB_LOG_INFO("%s", message); });
+    omniConverterSetProgressCallback(
+        [](OmniConverterFuture* future, uint32_t progress, uint32_t total)
+        {
+            CARB_LOG_INFO("Progress: %d / %d", progress, total);
+            notifyConverterProgress();
+        });
+}
+
+MeshConversionQueue::~MeshConversionQueue()
+{
+    for (const auto& meshPath : m_running)
+    {
+        omniConverterCancelFuture(m_conversions[meshPath].future);
+    }
+    while (true)
+    {
+        const uint64_t progressCount = getConverterProgressCount();
+        pollRunning();
+        if (m_running.empty())
+        {
+            break;
+        }
+        waitForConverterProgress(progressCount);
+    }
+    for (const auto& conversion : m_conversions)
+    {
+        if (conversion.second.status == OmniConverterStatus::OK && !conversion.second.consumed)
+        {
+            omniClientWait(omniClientDelete(conversion.second.usdPath.c_str(), {}, {}));
+        }
+    }
+    MeshConversionCache& cache = getMeshConversionCache();
+    if (cache.isEnabled())
+    {
+        MeshConversionCache::Stats stats = cache.getStats();
+        CARB_LOG_INFO("Mesh conversion cache: %llu hits, %llu misses, %llu stored, %llu evicted",
+                      static_cast<unsigned long long>(stats.hits), static_cast<unsigned long long>(stats.misses),
+                      static_cast<unsigned long long>(stats.stores), static_cast<unsigned long long>(stats.evictions));
+    }
+}
 
-    // Wait for the converter to finish
-    while (omniConverterCheckFutureStatus(future) == OmniConverterStatus::IN_PROGRESS)
+void MeshConversionQueue::request(const std::string& meshPath)
+{
+    if (m_conversions.count(meshPath))
     {
+        return;
     }
+    Conversion& conversion = m_conversions[meshPath];
+    // Meshes from different folders can share a file name, number the outputs to keep them apart
+    conversion.usdPath = pathJoin(
+        m_outputDir, getPathStem(meshPath.c_str()) + "." + std::to_string(m_conversions.size()) + ".tmp.usd");
 
-    status = omniConverterCheckFutureStatus(future);
-    omniConverterReleaseFuture(future);
+    MeshConversionCache& cache = getMeshConversionCache();
+    if (cache.isEnabled())
+    {
+        conversion.cacheKey = MeshConversionCache::makeKey(
+            resolve_path(meshPath), std::string(kConverterVersion) + " " + std::to_string(kConverterFlags));
+        if (cache.fetch(conversion.cacheKey, conversion.usdPath))
+        {
+            conversion.status = OmniConverterStatus::OK;
+            return;
+        }
+    }
+    if (m_running.size() < m_maxConcurrent)
+    {
+        start(meshPath, conversion);
+    }
+    else
+    {
+        m_queued.push_back(meshPath);
+    }
+}
+
+OmniConverterStatus MeshConversionQueue::wait(const std::string& meshPath, std::string& usdPath)
+{
+    request(meshPath);
+    Conversion& conversion = m_conversions[meshPath];
+    if (!conversion.future && conversion.status == OmniConverterStatus::IN_PROGRESS)
+    {
+        // Still queued, start it now instead of waiting for a free slot
+        m_queued.erase(std::find(m_queued.begin() + m_nextQueued, m_queued.end(), meshPath));
+        start(meshPath, conversion);
+    }
+    // Check the futures whenever a conversion reports progress, finished ones free their slot for queued meshes
+    while (true)
+    {
+        const uint64_t progressCount = getConverterProgressCount();
+        pollRunning();
+        if (conversion.status != OmniConverterStatus::IN_PROGRESS)
+        {
+            break;
+        }
+        waitForConverterProgress(progressCount);
+    }
+    conversion.consumed = true;
+    usdPath = conversion.usdPath;
+    return conversion.status;
+}
+
+void MeshConversionQueue::start(const std::string& meshPath, Conversion& conversion)
+{
+    conversion.future =
+        omniConverterCreateAsset(resolve_path(meshPath).c_str(), conversion.usdPath.c_str(), kConverterFlags);
+    m_running.push_back(meshPath);
+}
+
+void MeshConversionQueue::pollRunning()
+{
+    auto finished = std::remove_if(m_running.begin(), m_running.end(),
+                                   [this](const std::string& meshPath)
+                                   {
+                                       Conversion& conversion = m_conversions[meshPath];
+                                       OmniConverterStatus status = omniConverterCheckFutureStatus(conversion.future);
+                                       if (status == OmniConverterStatus::IN_PROGRESS)
+                                       {
+                                           return false;
+                                       }
+                                       omniConverterReleaseFuture(conversion.future);
+                                       conversion.future = nullptr;
+                                       conversion.status = status;
+                                       MeshConversionCache& cache = getMeshConversionCache();
+                                       if (status == OmniConverterStatus::OK && cache.isEnabled() &&
+                                           !conversion.cacheKey.empty())
+                                       {
+                                           // Textures written next to the converted mesh are cached along with it
+                                           cache.store(conversion.cacheKey, conversion.usdPath,
+                                                       isaacsim::core::includes::utils::usd::localizeAssetPaths(
+                                                           conversion.usdPath));
+                                       }
+                                       return true;
+                                   });
+    m_running.erase(finished, m_running.end());
+
+    // Fill the free slots with queued conversions, skipping the ones wait() already started
+    while (m_running.size() < m_maxConcurrent && m_nextQueued < m_queued.size())
+    {
+        const std::string& meshPath = m_queued[m_nextQueued++];
+        start(meshPath, m_conversions[meshPath]);
+    }
+}
+
+pxr::SdfPath mergeConvertedMesh(OmniConverterStatus status,
+                                pxr::UsdStageRefPtr usdStage,
+                                const std::string& meshStagePath,
+                                const std::string& mesh_usd_path,
+                                const std::string& meshPath,
+                                const pxr::SdfPath& rootPath,
+                                std::map<pxr::TfToken, pxr::SdfPath>& materialPaths)
+{
+    bool isCollada = isColladaFile(meshPath);
+    UpAxis upAxis = isCollada ? getColladaUpAxis(meshPath) : UpAxis::UNKNOWN;
 
     if (status == OmniConverterStatus::OK)
     {
@@ -344,7 +572,8 @@ pxr::SdfPath SimpleImport(pxr::UsdStageRefPtr usdStage,
                           const std::string& meshPath,
                           std::map<pxr::TfToken, pxr::SdfPath>& meshList,
                           std::map<pxr::TfToken, pxr::SdfPath>& materialsList,
-                          const pxr::SdfPath& rootPath)
+                          const pxr::SdfPath& rootPath,
+                          MeshConversionQueue* conversions)
 {
     // Check if the mesh has already been imported
     pxr::SdfPath mesh_dst;
@@ -357,28 +586,23 @@ pxr::SdfPath SimpleImport(pxr::UsdStageRefPtr usdStage,
     {
         // Log a message indicating that we're importing a new mesh
 
-        // Get the stage path and create a temporary USD file path
-        std::string stage_path = usdStage->GetRootLayer()->GetIdentifier();
         std::string mesh_abs_path = resolve_path(meshPath);
-        std::string mesh_usd_path = pathJoin(getParent(stage_path), getPathStem(meshPath.c_str()) + ".tmp.usd");
-
         CARB_LOG_INFO("Importing Mesh %s %s\n    (%s)", path.c_str(), meshPath.c_str(), mesh_abs_path.c_str());
-        // Set up the Omni Converter flags
-        int flags = OMNI_CONVERTER_FLAGS_SINGLE_MESH_FILE | OMNI_CONVERTER_FLAGS_IGNORE_CAMERAS |
-                    OMNI_CONVERTER_FLAGS_USE_METER_PER_UNIT | OMNI_CONVERTER_FLAGS_MERGE_ALL_MESHES |
-                    OMNI_CONVERTER_FLAGS_IGNORE_LIGHTS | OMNI_CONVERTER_FLAGS_FBX_CONVERT_TO_Z_UP |
-                    OMNI_CONVERTER_FLAGS_FBX_BAKING_SCALES_INTO_MESH | OMNI_CONVERTER_FLAGS_IGNORE_PIVOTS;
-
-        // Set up the log and progress callbacks for the Omni Converter
-        omniConverterSetLogCallback([](const char* message) { CARB_LOG_INFO("%s", message); });
-        omniConverterSetProgressCallback([](OmniConverterFuture* future, uint32_t progress, uint32_t total)
-                                         { CARB_LOG_INFO("Progress: %d / %d", progress, total); });
-
-        // Create a new Omni Converter future for the mesh import
-        auto future = omniConverterCreateAsset(mesh_abs_path.c_str(), mesh_usd_path.c_str(), flags);
+
+        // Convert the mesh on its own when it was not requested ahead of time
+        std::unique_ptr<MeshConversionQueue> localConversions;
+        if (!conversions)
+        {
+            std::string stage_path = usdStage->GetRootLayer()->GetIdentifier();
+            localConversions = std::make_unique<MeshConversionQueue>(getParent(stage_path), 1);
+            conversions = localConversions.get();
+        }
+        std::string mesh_usd_path;
+        OmniConverterStatus status = conversions->wait(meshPath, mesh_usd_path);
+
         pxr::SdfPath next_path(isaacsim::asset::importer::urdf::GetNewSdfPathString(usdStage, path));
-        mesh_dst = waitForConverter(
-            future, usdStage, next_path.GetString(), mesh_usd_path, mesh_abs_path, rootPath, materialsList);
+        mesh_dst = mergeConvertedMesh(
+            status, usdStage, next_path.GetString(), mesh_usd_path, mesh_abs_path, rootPath, materialsList);
 
         // Add the new mesh to the mesh list
         meshList.emplace(pxr::TfToken(meshPath), mesh_dst);
@@ -386,6 +610,11 @@ pxr::SdfPath SimpleImport(pxr::UsdStageRefPtr usdStage,
 
     return mesh_dst;
 }
+
+MeshConversionCache::Stats getMeshConversionCacheStats()
+{
+    return getMeshConversionCache().getStats();
+}
 }
 }
 }
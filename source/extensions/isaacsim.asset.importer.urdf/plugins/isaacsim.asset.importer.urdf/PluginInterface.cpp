@@ -21,9 +21,12 @@
 
 #include <carb/PluginUtils.h>
 #include <carb/logging/Log.h>
+#include <carb/settings/ISettings.h>
+#include <carb/tokens/ITokens.h>
 
 #include <isaacsim/asset/importer/urdf/IUrdf.h>
 #include <isaacsim/asset/importer/urdf/ImportHelpers.h>
+#include <isaacsim/asset/importer/urdf/MeshImporter.h>
 #include <isaacsim/asset/importer/urdf/UrdfImporter.h>
 #include <isaacsim/core/includes/utils/Path.h>
 #include <omni/ext/IExt.h>
@@ -48,7 +51,7 @@ const struct carb::PluginImplDesc kPluginImpl = { "isaacsim.asset.importer.urdf"
                                                   carb::PluginHotReload::eEnabled, "dev" };
 
 CARB_PLUGIN_IMPL(kPluginImpl, isaacsim::asset::importer::urdf::Urdf)
-CARB_PLUGIN_IMPL_DEPS(omni::kit::IApp, carb::logging::ILogging)
+CARB_PLUGIN_IMPL_DEPS(omni::kit::IApp, carb::logging::ILogging, carb::settings::ISettings, carb::tokens::ITokens)
 
 namespace
 {
@@ -518,6 +521,18 @@ pybind11::dict getKinematicChain(const isaacsim::asset::importer::urdf::UrdfRobo
     return robotDict;
 }
 
+pybind11::dict getMeshConversionCacheStats()
+{
+    isaacsim::core::includes::utils::MeshConversionCache::Stats stats =
+        isaacsim::asset::importer::urdf::getMeshConversionCacheStats();
+    pybind11::dict statsDict;
+    statsDict["hits"] = stats.hits;
+    statsDict["misses"] = stats.misses;
+    statsDict["stores"] = stats.stores;
+    statsDict["evictions"] = stats.evictions;
+    return statsDict;
+}
+
 CARB_EXPORT void carbOnPluginStartup()
 {
     CARB_LOG_INFO("Startup URDF Extension");
@@ -537,5 +552,6 @@ void fillInterface(isaacsim::asset::importer::urdf::Urdf& iface)
     iface.parseUrdfString = parseUrdfString;
     iface.importRobot = importRobot;
     iface.getKinematicChain = getKinematicChain;
+    iface.getMeshConversionCacheStats = getMeshConversionCacheStats;
     iface.computeJointNaturalStiffess = computeJointNaturalStiffess;
 }
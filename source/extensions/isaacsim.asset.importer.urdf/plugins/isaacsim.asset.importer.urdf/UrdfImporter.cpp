@@ -159,6 +159,7 @@ pxr::UsdPrim addMeshReference(UrdfGeometry geometry,
                               std::string meshName,
                               std::map<pxr::TfToken, pxr::SdfPath>& meshList,
                               std::map<pxr::TfToken, pxr::SdfPath>& materialList,
+                              MeshConversionQueue* meshConversions,
                               const pxr::SdfPath& robotRoot,
                               pxr::UsdGeomXform usdXform)
 {
@@ -179,7 +180,7 @@ pxr::UsdPrim addMeshReference(UrdfGeometry geometry,
     {
         CARB_LOG_INFO("Found Mesh At: %s (%s)", meshPath.c_str(), meshName.c_str());
         std::string next_path = std::string("/meshes/") + makeValidUSDIdentifier(getPathStem(meshPath.c_str()));
-        path = SimpleImport(stage, next_path, meshPath, meshList, materialList, robotRoot);
+        path = SimpleImport(stage, next_path, meshPath, meshList, materialList, robotRoot, meshConversions);
         usdXform.GetPrim().GetReferences().AddInternalReference(path);
     }
     return usdXform.GetPrim();
@@ -244,6 +245,7 @@ pxr::UsdPrim addMesh(pxr::UsdStageWeakPtr stage,
                      std::string meshName,
                      std::map<pxr::TfToken, pxr::SdfPath>& meshList,
                      std::map<pxr::TfToken, pxr::SdfPath>& materialList,
+                     MeshConversionQueue* meshConversions,
                      const pxr::SdfPath& robotRoot,
                      Transform origin,
                      const double distanceScale,
@@ -266,8 +268,8 @@ pxr::UsdPrim addMesh(pxr::UsdStageWeakPtr stage,
     switch (geometry.type)
     {
     case UrdfGeometryType::MESH:
-        return addMeshReference(
-            geometry, stage, assetRoot, urdfPath, meshName, meshList, materialList, robotRoot, usdXform);
+        return addMeshReference(geometry, stage, assetRoot, urdfPath, meshName, meshList, materialList, meshConversions,
+                                robotRoot, usdXform);
     case UrdfGeometryType::SPHERE:
         return addSphere(stage, meshName, geometry.radius, usdXform);
     case UrdfGeometryType::BOX:
@@ -472,7 +474,8 @@ void UrdfImporter::addRigidBody(std::unordered_map<std::string, pxr::UsdStageRef
         loadMaterial = (color.r >= 0 && color.g >= 0 && color.b >= 0);
         pxr::UsdPrim prim =
             addMesh(stages["base_stage"], link.visuals[i].geometry, assetRoot_, urdfPath_, meshName, meshPaths,
-                    materialPaths, robotPrim.GetPath(), link.visuals[i].origin, config.distanceScale, false);
+                    materialPaths, meshConversions_.get(), robotPrim.GetPath(), link.visuals[i].origin,
+                    config.distanceScale, false);
         if (!prim)
         {
             CARB_LOG_WARN("Prim %s not created", meshName.c_str());
@@ -554,8 +557,9 @@ void UrdfImporter::addRigidBody(std::unordered_map<std::string, pxr::UsdStageRef
             CARB_LOG_INFO("Creating collider Prim %s", meshName.c_str());
         }
         pxr::UsdPrim prim = addMesh(stages["base_stage"], link.collisions[i].geometry, assetRoot_, urdfPath_, meshName,
-                                    meshPaths, materialPaths, robotPrim.GetPath(), link.collisions[i].origin,
-                                    config.distanceScale, config.replaceCylindersWithCapsules);
+                                    meshPaths, materialPaths, meshConversions_.get(), robotPrim.GetPath(),
+                                    link.collisions[i].origin, config.distanceScale,
+                                    config.replaceCylindersWithCapsules);
         // Enable collisions on prim
         if (prim)
         {
@@ -1354,6 +1358,35 @@ pxr::UsdShadeMaterial UrdfImporter::addMaterial(pxr::UsdStageWeakPtr stage,
     return pxr::UsdShadeMaterial();
 }
 
+void UrdfImporter::queueMeshConversions(const pxr::UsdStageRefPtr& baseStage, const UrdfRobot& robot)
+{
+    meshConversions_ =
+        std::make_unique<MeshConversionQueue>(getParent(baseStage->GetRootLayer()->GetIdentifier()));
+    auto queueGeometry = [this](const UrdfGeometry& geometry)
+    {
+        if (geometry.type != UrdfGeometryType::MESH)
+        {
+            return;
+        }
+        std::string meshPath = resolveXrefPath(assetRoot_, urdfPath_, geometry.meshFilePath);
+        if (!meshPath.empty() && !IsUsdFile(meshPath) && !meshPaths.count(pxr::TfToken(meshPath)))
+        {
+            meshConversions_->request(meshPath);
+        }
+    };
+    for (const auto& link : robot.links)
+    {
+        for (const auto& visual : link.second.visuals)
+        {
+            queueGeometry(visual.geometry);
+        }
+        for (const auto& collision : link.second.collisions)
+        {
+            queueGeometry(collision.geometry);
+        }
+    }
+}
+
 std::string UrdfImporter::addToStage(std::unordered_map<std::string, pxr::UsdStageRefPtr> stages,
                                      const UrdfRobot& urdfRobot,
                                      bool getArticulationRoot = false)
@@ -1363,6 +1396,8 @@ std::string UrdfImporter::addToStage(std::unordered_map<std::string, pxr::UsdSta
         CARB_LOG_WARN("Cannot add robot to stage, number of links is zero");
         return "";
     }
+    // Convert all meshes while the stage is being set up, they are merged as the links are added
+    queueMeshConversions(stages["base_stage"], urdfRobot);
     // The limit for links is now a 32bit index so this shouldn't be needed anymore
     // if (urdfRobot.links.size() >= 64)
     // {
@@ -1483,6 +1518,8 @@ std::string UrdfImporter::addToStage(std::unordered_map<std::string, pxr::UsdSta
     addLinksAndJoints(stages, Transform(), chain.baseNode.get(), urdfRobot, robotPrim);
 
     addLoopJoints(stages, robotPrim, urdfRobot, config);
+    // All links are added, drop conversions that were not used
+    meshConversions_.reset();
 
     setAuthoringLayer(stages["stage"], stages["base_stage"]->GetRootLayer()->GetIdentifier());
     pxr::UsdGeomImageable(stages["stage"]->GetPrimAtPath(pxr::SdfPath("/visuals")))
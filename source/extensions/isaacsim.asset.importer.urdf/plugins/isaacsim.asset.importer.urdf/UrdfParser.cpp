@@ -14,13 +14,18 @@
 // limitations under the License.
 
 #include <carb/logging/Log.h>
+#include <carb/tasking/ITasking.h>
 
 #include <isaacsim/asset/importer/urdf/UrdfParser.h>
 #include <isaacsim/core/includes/utils/Path.h>
 #include <isaacsim/core/includes/utils/Usd.h>
 
+#include <algorithm>
+#include <cstring>
 #include <sstream>
 #include <stdexcept>
+#include <unordered_map>
+#include <vector>
 
 namespace isaacsim
 {
@@ -917,167 +922,223 @@ bool parseMaterial(const XMLElement& element, UrdfMaterial& material)
     return true;
 }
 
-bool parseMaterials(const XMLElement& root, std::map<std::string, UrdfMaterial>& urdfMaterials)
+namespace
 {
-    auto materialElement = root.FirstChildElement("material");
-    if (materialElement)
-    {
-        do
-        {
-            UrdfMaterial material;
-            auto name = materialElement->Attribute("name");
-            if (name)
-            {
-                material.name = makeValidUSDIdentifier(name);
-            }
-            else
-            {
-                CARB_LOG_ERROR("*** Found unnamed material ");
-                return false;
-            }
 
-            auto elem = materialElement->FirstChildElement("color");
-            if (elem)
-            {
-                if (!parseColor(elem->Attribute("rgba"), material.color.r, material.color.g, material.color.b,
-                                material.color.a))
-                {
-                    return false;
-                }
-            }
-            elem = materialElement->FirstChildElement("texture");
-            if (elem)
-            {
-                auto matString = elem->Attribute("filename");
-                if (matString == nullptr)
-                {
-                    CARB_LOG_ERROR("*** filename required for material with texture ");
-                    return false;
-                }
-            }
+// Top level elements of a robot description, gathered in one pass over the document so the element kinds do not
+// each need their own pass over thousands of siblings
+struct RobotElements
+{
+    std::vector<const XMLElement*> materials;
+    std::vector<const XMLElement*> links;
+    std::vector<const XMLElement*> joints;
+};
 
-            urdfMaterials.emplace(material.name, material);
+RobotElements collectRobotElements(const XMLElement& root)
+{
+    RobotElements elements;
+    for (auto element = root.FirstChildElement(); element; element = element->NextSiblingElement())
+    {
+        const char* name = element->Name();
+        if (strcmp(name, "link") == 0)
+        {
+            elements.links.push_back(element);
+        }
+        else if (strcmp(name, "joint") == 0)
+        {
+            elements.joints.push_back(element);
+        }
+        else if (strcmp(name, "material") == 0)
+        {
+            elements.materials.push_back(element);
+        }
+    }
+    return elements;
+}
 
-        } while ((materialElement = materialElement->NextSiblingElement("material")));
+// Runs fn(i) for every index in [0, count), on the tasking pool when it is available
+template <typename Fn>
+void parallelFor(size_t count, Fn&& fn)
+{
+    carb::tasking::ITasking* tasking = carb::getCachedInterface<carb::tasking::ITasking>();
+    if (tasking != nullptr && count > 1)
+    {
+        tasking->applyRange(count, fn);
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            fn(i);
+        }
     }
-    return true;
 }
 
-bool parseLinks(const XMLElement& root, std::map<std::string, UrdfLink>& urdfLinks)
+// Parses every element independently, then adds the results by name in document order so the first of duplicate
+// names is kept, as with the serial parse
+template <typename T, typename ParseFn>
+bool parseElements(const std::vector<const XMLElement*>& elements, std::map<std::string, T>& output, ParseFn parse)
 {
-    auto linkElement = root.FirstChildElement("link");
-    if (linkElement)
+    std::vector<T> parsed(elements.size());
+    std::vector<char> succeeded(elements.size(), 0);
+    parallelFor(elements.size(), [&](size_t i) { succeeded[i] = parse(*elements[i], parsed[i]) ? 1 : 0; });
+    for (size_t i = 0; i < parsed.size(); i++)
     {
-        do
+        if (!succeeded[i])
         {
-            UrdfLink link;
+            return false;
+        }
+        output.emplace(parsed[i].name, std::move(parsed[i]));
+    }
+    return true;
+}
 
-            // name
-            auto name = linkElement->Attribute("name");
-            if (name)
-            {
-                link.name = makeValidUSDIdentifier(name);
-            }
-            else
-            {
-                CARB_LOG_ERROR("*** Found unnamed link ");
-                return false;
-            }
+bool parseMaterialElement(const XMLElement& materialElement, UrdfMaterial& material)
+{
+    auto name = materialElement.Attribute("name");
+    if (name)
+    {
+        material.name = makeValidUSDIdentifier(name);
+    }
+    else
+    {
+        CARB_LOG_ERROR("*** Found unnamed material ");
+        return false;
+    }
 
-            // visuals
-            auto visualElement = linkElement->FirstChildElement("visual");
-            if (visualElement)
-            {
-                do
-                {
-                    UrdfVisual visual;
-                    auto name = visualElement->Attribute("name");
-                    if (name)
-                    {
-                        visual.name = makeValidUSDIdentifier(name);
-                    }
+    auto elem = materialElement.FirstChildElement("color");
+    if (elem)
+    {
+        if (!parseColor(
+                elem->Attribute("rgba"), material.color.r, material.color.g, material.color.b, material.color.a))
+        {
+            return false;
+        }
+    }
+    elem = materialElement.FirstChildElement("texture");
+    if (elem)
+    {
+        auto matString = elem->Attribute("filename");
+        if (matString == nullptr)
+        {
+            CARB_LOG_ERROR("*** filename required for material with texture ");
+            return false;
+        }
+    }
+    return true;
+}
 
-                    if (!parseOrigin(*visualElement, visual.origin))
-                    {
-                        // optional default to identity transform
-                        visual.origin = Transform();
-                    }
+bool parseLinkElement(const XMLElement& linkElement, UrdfLink& link)
+{
+    // name
+    auto name = linkElement.Attribute("name");
+    if (name)
+    {
+        link.name = makeValidUSDIdentifier(name);
+    }
+    else
+    {
+        CARB_LOG_ERROR("*** Found unnamed link ");
+        return false;
+    }
 
-                    if (!parseGeometry(*visualElement, visual.geometry))
-                    {
-                        CARB_LOG_ERROR("*** Found visual without geometry ");
-                        return false;
-                    }
+    // visuals
+    for (auto visualElement = linkElement.FirstChildElement("visual"); visualElement;
+         visualElement = visualElement->NextSiblingElement("visual"))
+    {
+        UrdfVisual visual;
+        auto name = visualElement->Attribute("name");
+        if (name)
+        {
+            visual.name = makeValidUSDIdentifier(name);
+        }
 
-                    if (!parseMaterial(*visualElement, visual.material))
-                    {
-                        // optional, use default if not specified
-                        visual.material = UrdfMaterial();
-                    }
+        if (!parseOrigin(*visualElement, visual.origin))
+        {
+            // optional default to identity transform
+            visual.origin = Transform();
+        }
 
-                    link.visuals.push_back(visual);
+        if (!parseGeometry(*visualElement, visual.geometry))
+        {
+            CARB_LOG_ERROR("*** Found visual without geometry ");
+            return false;
+        }
 
-                } while ((visualElement = visualElement->NextSiblingElement("visual")));
-            }
+        if (!parseMaterial(*visualElement, visual.material))
+        {
+            // optional, use default if not specified
+            visual.material = UrdfMaterial();
+        }
 
-            // collisions
-            auto collisionElement = linkElement->FirstChildElement("collision");
-            if (collisionElement)
-            {
-                do
-                {
-                    UrdfCollision collision;
-                    auto name = collisionElement->Attribute("name");
-                    if (name)
-                    {
-                        collision.name = makeValidUSDIdentifier(name);
-                    }
+        link.visuals.push_back(std::move(visual));
+    }
 
-                    if (!parseOrigin(*collisionElement, collision.origin))
-                    {
-                        // optional default to identity transform
-                        collision.origin = Transform();
-                    }
+    // collisions
+    for (auto collisionElement = linkElement.FirstChildElement("collision"); collisionElement;
+         collisionElement = collisionElement->NextSiblingElement("collision"))
+    {
+        UrdfCollision collision;
+        auto name = collisionElement->Attribute("name");
+        if (name)
+        {
+            collision.name = makeValidUSDIdentifier(name);
+        }
 
-                    if (!parseGeometry(*collisionElement, collision.geometry))
-                    {
-                        CARB_LOG_ERROR("*** Found collision without geometry ");
-                        return false;
-                    }
+        if (!parseOrigin(*collisionElement, collision.origin))
+        {
+            // optional default to identity transform
+            collision.origin = Transform();
+        }
 
-                    link.collisions.push_back(collision);
+        if (!parseGeometry(*collisionElement, collision.geometry))
+        {
+            CARB_LOG_ERROR("*** Found collision without geometry ");
+            return false;
+        }
 
-                } while ((collisionElement = collisionElement->NextSiblingElement("collision")));
-            }
+        link.collisions.push_back(std::move(collision));
+    }
 
-            // inertia
-            if (!parseInertial(*linkElement, link.inertial))
-            {
-                // optional, use default if not specified
-                link.inertial = UrdfInertial();
-            }
+    // inertia
+    if (!parseInertial(linkElement, link.inertial))
+    {
+        // optional, use default if not specified
+        link.inertial = UrdfInertial();
+    }
+    return true;
+}
 
-            // auto femElement = linkElement->FirstChildElement("fem");
-            // if (femElement)
-            // {
-            //     do
-            //     {
-            //         UrdfFem fem;
-            //         if (!parseFem(*femElement, fem))
-            //         {
-            //             return false;
-            //         }
+bool parseMaterialElements(const std::vector<const XMLElement*>& elements,
+                           std::map<std::string, UrdfMaterial>& urdfMaterials)
+{
+    for (const XMLElement* element : elements)
+    {
+        UrdfMaterial material;
+        if (!parseMaterialElement(*element, material))
+        {
+            return false;
+        }
+        urdfMaterials.emplace(material.name, material);
+    }
+    return true;
+}
 
-            //         link.softs.push_back(fem);
+bool parseLinkElements(const std::vector<const XMLElement*>& elements, std::map<std::string, UrdfLink>& urdfLinks)
+{
+    return parseElements(elements, urdfLinks, parseLinkElement);
+}
 
-            //     } while ((femElement = femElement->NextSiblingElement("fem")));
-            // }
+} // namespace
 
-            urdfLinks.emplace(link.name, link);
+bool parseMaterials(const XMLElement& root, std::map<std::string, UrdfMaterial>& urdfMaterials)
+{
+    return parseMaterialElements(collectRobotElements(root).materials, urdfMaterials);
+}
 
-        } while ((linkElement = linkElement->NextSiblingElement("link")));
-    }
-    return true;
+bool parseLinks(const XMLElement& root, std::map<std::string, UrdfLink>& urdfLinks)
+{
+    return parseLinkElements(collectRobotElements(root).links, urdfLinks);
 }
 
 
@@ -1129,100 +1190,20 @@ Matrix33 InertiaMatrix(const UrdfInertia& inertia)
 }
 
 
-Matrix33 compute_parallel_axis_inertia(const UrdfLink& link, const Vec3& distance)
+Matrix33 compute_parallel_axis_inertia(float mass, const Vec3& distance)
 {
     Matrix33 d_dot = Matrix33::Identity() * Dot(distance, distance);
     Matrix33 d_outer = Outer(distance, distance);
-    return InertiaMatrix(link.inertial.inertia) + link.inertial.mass * (d_dot - d_outer);
+    return mass * (d_dot - d_outer);
 }
 
-void compute_accumulated_inertias(const UrdfRobot& robot,
-                                  const std::string& joint_name,
-                                  Matrix33& backward_accumulated_inertia,
-                                  Matrix33& forward_accumulated_inertia)
+Matrix33 compute_parallel_axis_inertia(const UrdfLink& link, const Vec3& distance)
 {
-    auto it = robot.joints.find(joint_name);
-    if (it == robot.joints.end())
-    {
-        CARB_LOG_ERROR("Computing Accumulated inertia: Joint not found (%s)", joint_name.c_str());
-    }
-    const UrdfJoint& joint = it->second;
-
-    struct jointsToVisit
-    {
-        std::string name;
-        Transform forward_position;
-        bool is_forward;
-    };
-    // Reset the accumulated inertias
-    backward_accumulated_inertia = Matrix33();
-    forward_accumulated_inertia = Matrix33();
-
-
-    auto accumulate_inertia = [&](std::vector<jointsToVisit>& joints_to_visit, Matrix33& accumulated_inertia)
-    {
-        std::set<std::string> visited_joints; // keep track of visited joints
-        jointsToVisit start_joint = joints_to_visit.back();
-
-        while (!joints_to_visit.empty())
-        {
-            jointsToVisit current_joint = joints_to_visit.back();
-            joints_to_visit.pop_back();
-            if (visited_joints.find(current_joint.name) == visited_joints.end())
-            {
-                // CARB_LOG_WARN("Computing Accumulated inertia:  (%s, %s)", current_joint.name.c_str(),
-                //               current_joint.is_forward ? "forward" : "backward");
-                visited_joints.insert(current_joint.name);
-                auto it = robot.joints.find(current_joint.name);
-                if (it != robot.joints.end())
-                {
-                    const UrdfJoint& this_joint = it->second;
-                    const UrdfLink& current_link = current_joint.is_forward ? robot.links.at(this_joint.childLinkName) :
-                                                                              robot.links.at(this_joint.parentLinkName);
-                    Transform distance;
-                    if (current_joint.is_forward)
-                    {
-                        distance = current_joint.forward_position * this_joint.origin * (current_link.inertial.origin);
-                    }
-                    else
-                    {
-                        distance =
-                            Inverse(this_joint.origin) * current_joint.forward_position * current_link.inertial.origin;
-                    }
-                    accumulated_inertia += compute_parallel_axis_inertia(current_link, distance.p);
-                    // CARB_LOG_WARN("Accumulated Inertia: %f", L2_magnitude(accumulated_inertia));
-                    {
-                        if (!current_joint.is_forward)
-                        {
-                            joints_to_visit.push_back({ this_joint.parentJoint,
-                                                        Inverse(this_joint.origin) * current_joint.forward_position,
-                                                        false });
-                        }
-                        if (!(!current_joint.is_forward && current_joint.name == start_joint.name))
-                        {
-                            for (const std::string& child_joint : this_joint.childrenJoints)
-                            {
-                                // if (visited_joints.find(child_joint) == visited_joints.end()) {
-                                joints_to_visit.push_back(
-                                    { child_joint, current_joint.forward_position * this_joint.origin, true });
-                                // }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-    };
-
-    // CARB_LOG_WARN("Computing Backward Accumulated Inertia start (%s)", joint.name.c_str());
-    std::vector<jointsToVisit> joints_to_visit = { { joint.name, Transform(), false } };
-    accumulate_inertia(joints_to_visit, backward_accumulated_inertia);
-    // CARB_LOG_WARN("Computing Forward Accumulated Inertia start (%s)", joint.name.c_str());
-    joints_to_visit = { { joint.name, Transform(), true } };
-    accumulate_inertia(joints_to_visit, forward_accumulated_inertia);
+    Matrix33 d_dot = Matrix33::Identity() * Dot(distance, distance);
+    Matrix33 d_outer = Outer(distance, distance);
+    return InertiaMatrix(link.inertial.inertia) + link.inertial.mass * (d_dot - d_outer);
 }
 
-
 float computeSimpleStiffness(const UrdfRobot& robot, std::string joint, float naturalFrequency)
 {
 
@@ -1237,107 +1218,110 @@ float computeSimpleStiffness(const UrdfRobot& robot, std::string joint, float na
     return inertia * naturalFrequency * naturalFrequency;
 }
 
-bool parseJoints(const XMLElement& root, std::map<std::string, UrdfJoint>& urdfJoints)
+namespace
 {
-    for (auto jointElement = root.FirstChildElement("joint"); jointElement;
-         jointElement = jointElement->NextSiblingElement("joint"))
-    {
-        UrdfJoint joint;
 
-        // name
-        auto name = jointElement->Attribute("name");
-        if (name)
-        {
-            joint.name = makeValidUSDIdentifier(name);
-        }
-        else
-        {
-            CARB_LOG_ERROR("*** Found unnamed joint ");
-            return false;
-        }
+bool parseJointElement(const XMLElement& jointElement, UrdfJoint& joint)
+{
+    // name
+    auto name = jointElement.Attribute("name");
+    if (name)
+    {
+        joint.name = makeValidUSDIdentifier(name);
+    }
+    else
+    {
+        CARB_LOG_ERROR("*** Found unnamed joint ");
+        return false;
+    }
 
-        auto type = jointElement->Attribute("type");
-        if (type)
-        {
-            if (!parseJointType(type, joint.type))
-            {
-                return false;
-            }
-        }
-        else
+    auto type = jointElement.Attribute("type");
+    if (type)
+    {
+        if (!parseJointType(type, joint.type))
         {
-            CARB_LOG_ERROR("*** Found untyped joint ");
             return false;
         }
+    }
+    else
+    {
+        CARB_LOG_ERROR("*** Found untyped joint ");
+        return false;
+    }
 
-        auto dontCollapse = jointElement->Attribute("dont_collapse");
-        if (dontCollapse)
-        {
-            joint.dontCollapse = dontCollapse;
-        }
-        else
-        {
-            // default: if not specified, collapse the joint
-            joint.dontCollapse = false;
-        }
+    auto dontCollapse = jointElement.Attribute("dont_collapse");
+    if (dontCollapse)
+    {
+        joint.dontCollapse = dontCollapse;
+    }
+    else
+    {
+        // default: if not specified, collapse the joint
+        joint.dontCollapse = false;
+    }
 
 
-        auto parentElement = jointElement->FirstChildElement("parent");
-        if (parentElement)
-        {
-            joint.parentLinkName = makeValidUSDIdentifier(parentElement->Attribute("link"));
-        }
-        else
-        {
-            CARB_LOG_ERROR("*** Joint has no parent link ");
-            return false;
-        }
+    auto parentElement = jointElement.FirstChildElement("parent");
+    if (parentElement)
+    {
+        joint.parentLinkName = makeValidUSDIdentifier(parentElement->Attribute("link"));
+    }
+    else
+    {
+        CARB_LOG_ERROR("*** Joint has no parent link ");
+        return false;
+    }
 
-        auto childElement = jointElement->FirstChildElement("child");
-        if (childElement)
-        {
-            joint.childLinkName = makeValidUSDIdentifier(childElement->Attribute("link"));
-        }
-        else
-        {
-            CARB_LOG_ERROR("*** Joint has no child link ");
-            return false;
-        }
+    auto childElement = jointElement.FirstChildElement("child");
+    if (childElement)
+    {
+        joint.childLinkName = makeValidUSDIdentifier(childElement->Attribute("link"));
+    }
+    else
+    {
+        CARB_LOG_ERROR("*** Joint has no child link ");
+        return false;
+    }
 
-        if (!parseOrigin(*jointElement, joint.origin))
-        {
-            // optional, default to identity
-            joint.origin = Transform();
-        }
+    if (!parseOrigin(jointElement, joint.origin))
+    {
+        // optional, default to identity
+        joint.origin = Transform();
+    }
 
-        if (!parseAxis(*jointElement, joint.axis))
-        {
-            // optional, default to (1,0,0)
-            joint.axis = UrdfAxis();
-        }
+    if (!parseAxis(jointElement, joint.axis))
+    {
+        // optional, default to (1,0,0)
+        joint.axis = UrdfAxis();
+    }
 
-        if (!parseLimit(*jointElement, joint.limit))
+    if (!parseLimit(jointElement, joint.limit))
+    {
+        if (joint.type == UrdfJointType::REVOLUTE || joint.type == UrdfJointType::PRISMATIC)
         {
-            if (joint.type == UrdfJointType::REVOLUTE || joint.type == UrdfJointType::PRISMATIC)
-            {
-                CARB_LOG_ERROR("*** limit must be specified for revolute and prismatic ");
-                return false;
-            }
-            joint.limit = UrdfLimit();
+            CARB_LOG_ERROR("*** limit must be specified for revolute and prismatic ");
+            return false;
         }
+        joint.limit = UrdfLimit();
+    }
 
-        if (!parseDynamics(*jointElement, joint.dynamics))
-        {
-            // optional
-            joint.dynamics = UrdfDynamics();
-        }
+    if (!parseDynamics(jointElement, joint.dynamics))
+    {
+        // optional
+        joint.dynamics = UrdfDynamics();
+    }
+    return true;
+}
 
-        urdfJoints.emplace(joint.name, joint);
+bool parseJointElements(const std::vector<const XMLElement*>& elements, std::map<std::string, UrdfJoint>& urdfJoints)
+{
+    if (!parseElements(elements, urdfJoints, parseJointElement))
+    {
+        return false;
     }
 
     // Add second pass to parse mimic information
-    for (auto jointElement = root.FirstChildElement("joint"); jointElement;
-         jointElement = jointElement->NextSiblingElement("joint"))
+    for (const XMLElement* jointElement : elements)
     {
         auto name = jointElement->Attribute("name");
         if (name)
@@ -1361,6 +1345,13 @@ bool parseJoints(const XMLElement& root, std::map<std::string, UrdfJoint>& urdfJ
     return true;
 }
 
+} // namespace
+
+bool parseJoints(const XMLElement& root, std::map<std::string, UrdfJoint>& urdfJoints)
+{
+    return parseJointElements(collectRobotElements(root).joints, urdfJoints);
+}
+
 bool parseLoopJoints(const XMLElement& element, std::map<std::string, UrdfLoopJoint>& loopJoints)
 {
     for (auto jointElement = element.FirstChildElement("loop_joint"); jointElement;
@@ -1882,6 +1873,198 @@ bool parseSensors(const XMLElement& root, std::map<std::string, UrdfLink>& urdfL
 //     return true;
 // }
 
+namespace
+{
+
+// Joints and links of a robot addressed by index, for walking the tree without name lookups
+struct JointTree
+{
+    struct Node
+    {
+        const UrdfJoint* joint = nullptr;
+        const UrdfLink* parentLink = nullptr;
+        const UrdfLink* childLink = nullptr;
+        int parentJoint = -1;
+        std::vector<int> childrenJoints;
+    };
+    std::vector<Node> nodes;
+
+    explicit JointTree(const UrdfRobot& robot)
+    {
+        std::unordered_map<std::string, int> jointIndices;
+        for (const auto& joint : robot.joints)
+        {
+            jointIndices.emplace(joint.first, static_cast<int>(nodes.size()));
+            Node node;
+            node.joint = &joint.second;
+            auto parentLink = robot.links.find(joint.second.parentLinkName);
+            node.parentLink = parentLink != robot.links.end() ? &parentLink->second : nullptr;
+            auto childLink = robot.links.find(joint.second.childLinkName);
+            node.childLink = childLink != robot.links.end() ? &childLink->second : nullptr;
+            if (!node.parentLink || !node.childLink)
+            {
+                CARB_LOG_ERROR("Computing Accumulated inertia: Link not found for joint (%s)", joint.first.c_str());
+            }
+            nodes.push_back(std::move(node));
+        }
+        for (Node& node : nodes)
+        {
+            auto parentJoint = jointIndices.find(node.joint->parentJoint);
+            node.parentJoint = parentJoint != jointIndices.end() ? parentJoint->second : -1;
+            for (const std::string& childJoint : node.joint->childrenJoints)
+            {
+                auto child = jointIndices.find(childJoint);
+                if (child != jointIndices.end())
+                {
+                    node.childrenJoints.push_back(child->second);
+                }
+            }
+        }
+    }
+
+    // Links summed the way compute_parallel_axis_inertia() adds them one by one: the link inertias as authored and
+    // the link masses moved to the origin of the frame the group is expressed in
+    struct MassProperties
+    {
+        float mass = 0.0f;
+        Vec3 com;
+        Matrix33 massInertia; // Inertia of the link masses about com
+        Matrix33 linkInertia; // Sum of the link inertias in their own frames
+    };
+
+    static MassProperties linkMassProperties(const UrdfLink& link)
+    {
+        MassProperties properties;
+        properties.mass = link.inertial.mass;
+        properties.com = link.inertial.origin.p;
+        properties.linkInertia = InertiaMatrix(link.inertial.inertia);
+        return properties;
+    }
+
+    static MassProperties transformed(const MassProperties& properties, const Transform& transform)
+    {
+        const Matrix33 rotation(transform.q);
+        MassProperties result = properties;
+        result.com = TransformPoint(transform, properties.com);
+        result.massInertia = rotation * properties.massInertia * Transpose(rotation);
+        return result;
+    }
+
+    static void combine(MassProperties& accumulated, const MassProperties& properties)
+    {
+        accumulated.linkInertia += properties.linkInertia;
+        const float mass = accumulated.mass + properties.mass;
+        if (mass <= 0.0f)
+        {
+            return;
+        }
+        const Vec3 com = (accumulated.mass * accumulated.com + properties.mass * properties.com) / mass;
+        accumulated.massInertia = accumulated.massInertia +
+                                  compute_parallel_axis_inertia(accumulated.mass, accumulated.com - com) +
+                                  properties.massInertia +
+                                  compute_parallel_axis_inertia(properties.mass, properties.com - com);
+        accumulated.mass = mass;
+        accumulated.com = com;
+    }
+
+    static Matrix33 inertiaAboutOrigin(const MassProperties& properties)
+    {
+        return properties.linkInertia + properties.massInertia +
+               compute_parallel_axis_inertia(properties.mass, properties.com);
+    }
+
+    // Accumulates the inertia of the links on the parent side (backward) and on the child side (forward) of every
+    // joint. The child side is every link below the joint, about the origin of the joint's parent link, and is
+    // accumulated in one post-order pass over the tree. The parent side walks up from the joint, taking each parent
+    // link and the child side of each sibling joint from that pass. The poses on the parent side are composed in the
+    // order the path is walked, so they depend on the whole path and cannot be folded into the subtrees.
+    void computeAccumulatedInertias(std::vector<Matrix33>& backward_accumulated_inertia,
+                                    std::vector<Matrix33>& forward_accumulated_inertia) const
+    {
+        const size_t count = nodes.size();
+        backward_accumulated_inertia.assign(count, Matrix33());
+        forward_accumulated_inertia.assign(count, Matrix33());
+
+        // Pre-order walk from the root joints
+        std::vector<int> order;
+        order.reserve(count);
+        std::vector<char> visited(count);
+        std::vector<int> stack;
+        for (size_t i = count; i-- > 0;)
+        {
+            if (nodes[i].parentJoint < 0)
+            {
+                stack.push_back(static_cast<int>(i));
+            }
+        }
+        while (!stack.empty())
+        {
+            const int index = stack.back();
+            stack.pop_back();
+            if (visited[index])
+            {
+                continue;
+            }
+            visited[index] = 1;
+            order.push_back(index);
+            const std::vector<int>& children = nodes[index].childrenJoints;
+            for (auto child = children.rbegin(); child != children.rend(); ++child)
+            {
+                stack.push_back(*child);
+            }
+        }
+
+        // Post-order, every joint is reached after all of the joints below it
+        std::vector<MassProperties> subtrees(count);
+        std::vector<MassProperties> forwardProperties(count);
+        for (auto it = order.rbegin(); it != order.rend(); ++it)
+        {
+            const Node& node = nodes[*it];
+            if (node.childLink)
+            {
+                combine(subtrees[*it], linkMassProperties(*node.childLink));
+            }
+            forwardProperties[*it] = transformed(subtrees[*it], node.joint->origin);
+            forward_accumulated_inertia[*it] = inertiaAboutOrigin(forwardProperties[*it]);
+            if (node.parentJoint >= 0)
+            {
+                combine(subtrees[node.parentJoint], forwardProperties[*it]);
+            }
+        }
+
+        for (int index : order)
+        {
+            Matrix33& accumulated = backward_accumulated_inertia[index];
+            Transform forwardPosition;
+            int previous = -1;
+            for (int current = index; current >= 0; previous = current, current = nodes[current].parentJoint)
+            {
+                const Node& node = nodes[current];
+                if (node.parentLink)
+                {
+                    const Transform distance =
+                        Inverse(node.joint->origin) * forwardPosition * node.parentLink->inertial.origin;
+                    accumulated += compute_parallel_axis_inertia(*node.parentLink, distance.p);
+                }
+                if (previous >= 0)
+                {
+                    const Transform siblingPosition = forwardPosition * node.joint->origin;
+                    for (int sibling : node.childrenJoints)
+                    {
+                        if (sibling != previous && visited[sibling])
+                        {
+                            accumulated += inertiaAboutOrigin(transformed(forwardProperties[sibling], siblingPosition));
+                        }
+                    }
+                }
+                forwardPosition = Inverse(node.joint->origin) * forwardPosition;
+            }
+        }
+    }
+};
+
+} // namespace
+
 void populateJointTree(isaacsim::asset::importer::urdf::UrdfRobot& robot)
 {
     // CARB_LOG_WARN("Populating Joint Tree");
@@ -1908,19 +2091,16 @@ void populateJointTree(isaacsim::asset::importer::urdf::UrdfRobot& robot)
         // CARB_LOG_WARN("Parent Joint: %s", joint.second.parentJoint.c_str());
     }
 
-    for (auto& joint : robot.joints)
+    // The inertias on both sides of every joint come from a single pass over an index based copy of the tree
+    JointTree tree(robot);
+    std::vector<Matrix33> parent_inertias;
+    std::vector<Matrix33> child_inertias;
+    tree.computeAccumulatedInertias(parent_inertias, child_inertias);
+    for (size_t i = 0; i < tree.nodes.size(); i++)
     {
-        Matrix33 parent_inertia;
-        Matrix33 child_inertia;
-
-        compute_accumulated_inertias(robot, joint.second.name, parent_inertia, child_inertia);
-
-        float m0 = L2_magnitude(parent_inertia);
-        float m1 = L2_magnitude(child_inertia);
-
-        float mass_eq = computeEquivalentInertia(m0, m1);
-        // CARB_LOG_WARN("Joint: %s, Equivalent Inertia: %f", joint.second.name.c_str(), mass_eq);
-        joint.second.jointInertia = mass_eq;
+        float m0 = L2_magnitude(parent_inertias[i]);
+        float m1 = L2_magnitude(child_inertias[i]);
+        robot.joints.at(tree.nodes[i].joint->name).jointInertia = computeEquivalentInertia(m0, m1);
     }
 }
 
@@ -1936,15 +2116,16 @@ bool parseRobot(const XMLElement& root, UrdfRobot& urdfRobot)
     urdfRobot.joints.clear();
     urdfRobot.materials.clear();
 
-    if (!parseMaterials(root, urdfRobot.materials))
+    RobotElements elements = collectRobotElements(root);
+    if (!parseMaterialElements(elements.materials, urdfRobot.materials))
     {
         return false;
     }
-    if (!parseLinks(root, urdfRobot.links))
+    if (!parseLinkElements(elements.links, urdfRobot.links))
     {
         return false;
     }
-    if (!parseJoints(root, urdfRobot.joints))
+    if (!parseJointElements(elements.joints, urdfRobot.joints))
     {
         return false;
     }
@@ -50,6 +50,25 @@ class TestUrdf(omni.kit.test.AsyncTestCase):
         await omni.kit.app.get_app().next_update_async()
         pass
 
+    # Tests the joint inertias estimated from the links on both sides of every joint against known values
+    async def test_urdf_joint_inertia(self):
+        urdf_path = os.path.abspath(self._extension_path + "/data/urdf/tests/test_basic.urdf")
+        status, import_config = omni.kit.commands.execute("URDFCreateImportConfig")
+        import_config.merge_fixed_joints = False
+        status, robot = omni.kit.commands.execute("URDFParseFile", urdf_path=urdf_path, import_config=import_config)
+
+        expected = {
+            "root_to_base": 0.0,
+            "base_joint": 3.983588,
+            "elbow_joint": 6.494528,
+            "wrist_joint": 7.533438,
+            "finger_1_joint": 1.662326,
+            "finger_2_joint": 4.641233,
+            "finger_3_joint": 0.092819,
+        }
+        for name, inertia in expected.items():
+            self.assertAlmostEqual(robot.joints[name].inertia, inertia, delta=1e-4 * max(1.0, inertia))
+
     # Tests to make sure visual mesh names are incremented
     async def test_urdf_mesh_naming(self):
         urdf_path = os.path.abspath(self._extension_path + "/data/urdf/tests/test_names.urdf")
@@ -251,6 +270,33 @@ class TestUrdf(omni.kit.test.AsyncTestCase):
         self.assertEqual(len(result[1]), 3)  # Metallic texture is unsuported by assimp on OBJ
         pass
 
+    # Tests that a second import of the same mesh comes from the conversion cache and keeps its textures
+    async def test_urdf_mesh_conversion_cache_hit(self):
+        from isaacsim.asset.importer.urdf._urdf import acquire_urdf_interface
+
+        urdf_interface = acquire_urdf_interface()
+        base_path = self._extension_path + "/data/urdf/tests/test_textures_urdf"
+        basename = "cube_obj"
+        urdf_path = "{}/{}.urdf".format(base_path, basename)
+
+        for i, name in enumerate(["cache_first", "cache_second"]):
+            dest_path = "{}/{}/{}.usd".format(self.dest_path, name, basename)
+            mats_path = "{}/{}/configuration/materials/textures".format(self.dest_path, name)
+            omni.client.create_folder("{}/{}".format(self.dest_path, name))
+            omni.client.create_folder(mats_path)
+            status, import_config = omni.kit.commands.execute("URDFCreateImportConfig")
+            hits = urdf_interface.get_mesh_conversion_cache_stats()["hits"]
+
+            omni.kit.commands.execute(
+                "URDFParseAndImportFile", urdf_path=urdf_path, import_config=import_config, dest_path=dest_path
+            )
+            await omni.kit.app.get_app().next_update_async()
+            if i == 1:
+                self.assertGreater(urdf_interface.get_mesh_conversion_cache_stats()["hits"], hits)
+            result = omni.client.list(mats_path)
+            self.assertEqual(result[0], omni.client.Result.OK)
+            self.assertEqual(len(result[1]), 3)
+
     async def test_urdf_textured_in_memory(self):
 
         base_path = self._extension_path + "/data/urdf/tests/test_textures_urdf"
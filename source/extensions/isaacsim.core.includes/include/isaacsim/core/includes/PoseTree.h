@@ -16,6 +16,7 @@
 
 #include "Conversions.h"
 #include "Pose.h"
+#include "UsdNoticeListener.h"
 #include "UsdUtilities.h"
 
 #include <foundation/PxTransform.h>
@@ -29,6 +30,15 @@
 #include <physx/include/foundation/PxTransform.h>
 #include <usdrt/scenegraph/usd/rt/xformable.h>
 
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 using namespace omni::physics::tensors;
 using namespace isaacsim::core::includes::conversions;
 
@@ -41,6 +51,83 @@ namespace includes
 namespace posetree
 {
 
+/**
+ * @class PoseTreeUsdNoticeListener
+ * @brief Records stage resyncs affecting the prims of a pose tree.
+ * @details
+ * A resync of a watched prim, of one of its ancestors or of one of its descendants can add or remove physics
+ * objects and links, so the pose tree builds its frame table again on its next call.
+ */
+class PoseTreeUsdNoticeListener : public isaacsim::core::includes::UsdNoticeListener<pxr::UsdNotice::ObjectsChanged>
+{
+public:
+    /**
+     * @brief Constructs a new listener for a stage.
+     * @param[in] stage Stage to watch
+     */
+    PoseTreeUsdNoticeListener(pxr::UsdStageWeakPtr stage) : m_stage(stage)
+    {
+    }
+
+    /**
+     * @brief Sets the prims whose resyncs are recorded.
+     * @param[in] paths Paths of the watched prims
+     */
+    void setWatchedPaths(const pxr::SdfPathVector& paths)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_paths = paths;
+    }
+
+    /**
+     * @brief Checks whether a watched prim was resynced since the last call, and clears the flag.
+     * @return True if a watched prim was resynced
+     */
+    bool consumeResync()
+    {
+        return m_resynced.exchange(false);
+    }
+
+    /**
+     * @brief Handles USD object change notifications
+     * @param[in] objectsChanged The notification containing information about changed objects
+     */
+    virtual void handleNotice(const pxr::UsdNotice::ObjectsChanged& objectsChanged) override
+    {
+        if (m_stage != objectsChanged.GetStage())
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const pxr::SdfPath& path : objectsChanged.GetResyncedPaths())
+        {
+            const pxr::SdfPath primPath = path == pxr::SdfPath::AbsoluteRootPath() ? path : path.GetPrimPath();
+            for (const pxr::SdfPath& watched : m_paths)
+            {
+                if (primPath.HasPrefix(watched) || watched.HasPrefix(primPath))
+                {
+                    m_resynced = true;
+                    return;
+                }
+            }
+        }
+    }
+
+private:
+    /** @brief Weak pointer to the USD stage being monitored */
+    pxr::UsdStageWeakPtr m_stage = nullptr;
+
+    /** @brief Guards m_paths, notices can be sent from any thread editing the stage */
+    std::mutex m_mutex;
+
+    /** @brief Paths of the watched prims */
+    pxr::SdfPathVector m_paths;
+
+    /** @brief Whether a watched prim was resynced since the last consumeResync() call */
+    std::atomic<bool> m_resynced{ false };
+};
+
 /**
  * @class PoseTree
  * @brief A utility class for managing and traversing hierarchical pose transformations in a scene.
@@ -72,6 +159,21 @@ static void createTensorDesc(TensorDesc& tensorDesc, void* dataPtr, int numXform
 class PoseTree
 {
 public:
+    /**
+     * @brief Transform from a parent frame to a child frame of the tree.
+     */
+    struct FrameTransform
+    {
+        /** @brief Index of the parent frame name in getFrameNames() */
+        uint32_t parentFrame;
+
+        /** @brief Index of the child frame name in getFrameNames() */
+        uint32_t childFrame;
+
+        /** @brief Pose of the child frame relative to the parent frame */
+        ::physx::PxTransform transform;
+    };
+
     /**
      * @brief Constructs a new PoseTree instance.
      * @details Initializes the PoseTree with USD stage and dynamic control references.
@@ -93,8 +195,21 @@ public:
         m_simView = simulationView;
         m_rigidXformData.resize(7);
         createTensorDesc(m_rigidTransformTensor, (void*)m_rigidXformData.data(), 1, TensorDataType::eFloat32);
+        m_noticeListener = std::make_unique<PoseTreeUsdNoticeListener>(pxr::UsdStageWeakPtr(m_usdStage));
+        m_noticeListener->registerListener();
     }
 
+    /**
+     * @brief Releases the physics views created for the frame table.
+     */
+    ~PoseTree()
+    {
+        releaseViews();
+    }
+
+    PoseTree(const PoseTree&) = delete;
+    PoseTree& operator=(const PoseTree&) = delete;
+
     /**
      * @brief Sets the parent prim path and frame name for the pose tree.
      * @details Establishes the root reference frame for subsequent pose calculations.
@@ -108,6 +223,8 @@ public:
     {
         m_parentPath = parentPath;
         m_parentFrame = parentFrame;
+        m_framesDirty = true;
+        updateWatchedPaths();
     }
 
     /**
@@ -119,156 +236,135 @@ public:
     void setTargetPrimPaths(const pxr::SdfPathVector& targets)
     {
         m_targets = targets;
+        m_framesDirty = true;
+        updateWatchedPaths();
     }
 
     /**
-     * @brief Traverses the complete pose tree and processes each transform.
+     * @brief Computes the transforms of all frames of the tree.
      * @details
-     * Performs a depth-first traversal of the pose tree, computing transforms between parent and child frames.
+     * The physics views, frame names and frame hierarchy are built on the first call after the parent or the
+     * targets change, after a stage resync of one of their prims, ancestors or descendants, when the physics object
+     * type of a prim posed from fabric or USD changes, and on the call after reading from a physics view failed. Every
+     * other call only reads the poses, with one batched query per physics view, into storage that is reused between
+     * calls.
      * Handles different types of prims including:
      * - Articulations and their bodies
      * - Rigid bodies
      * - Regular transforms
      * - Special cases like cameras
      *
-     * @param[in] processTransform Callback function to handle each computed transform
-     *
-     * @note The callback function receives:
-     *       - Parent frame name (string)
-     *       - Child frame name (string)
-     *       - Relative transform between frames (PxTransform)
+     * @return Transforms in depth-first order, valid until the next call
      *
      * @warning For cameras without RTXLidar API, an additional 180-degree rotation about the x-axis is applied
      */
-    void processAllFrames(
-        std::function<void(const std::string&, const std::string&, const ::physx::PxTransform&)>& processTransform)
+    const std::vector<FrameTransform>& computeFrameTransforms()
     {
-        // If the parent prim path is not empty, get the type of prim and its pose.
-        if (!m_parentPath.IsEmpty())
+        // Always consume the resync flag so a resync handled by this build does not trigger another one
+        const bool resynced = m_noticeListener->consumeResync();
+        if (m_framesDirty || resynced || objectTypesChanged())
         {
-            ObjectType objectType = m_simView->getObjectType(m_parentPath.GetString().c_str());
-            if (objectType == ObjectType::eArticulationLink || objectType == ObjectType::eArticulationRootLink ||
-                objectType == ObjectType::eRigidBody)
-            {
-                IRigidBodyView* rb = m_simView->createRigidBodyView(m_parentPath.GetString().c_str());
-                m_parentPose = getRigidBodyPose(rb);
-            }
-            else
-            {
-                // TODO: handle non types
-                m_parentPose = getXformPose(m_parentPath);
-            }
-
-            m_parentFrame =
-                getUniqueFrameName(getName(m_usdStage->GetPrimAtPath(m_parentPath)), m_parentPath.GetString());
+            buildFrames();
         }
-        // For each target prim determine its type and compute the associated poses
-        for (pxr::SdfPath primPath : m_targets)
+        if (!fetchPoses())
         {
-            ObjectType objectType = m_simView->getObjectType(primPath.GetString().c_str());
-            if (objectType == ObjectType::eArticulation || objectType == ObjectType::eArticulationRootLink)
-            {
-                IArticulationView* articulation = m_simView->createArticulationView(primPath.GetString().c_str());
-                const IArticulationMetatype* mt = articulation->getSharedMetatype();
-                uint32_t linkCount = articulation->getMaxLinks();
-                std::vector<std::string> linkPaths(linkCount);
-                std::vector<std::vector<int>> childLinks(linkCount);
-                for (uint32_t j = 0; j < linkCount; ++j)
-                {
-                    linkPaths[j] = articulation->getUsdLinkPath(0, j);
-                    std::string parentName =
-                        mt->getLinkParentName(j) ? mt->getLinkParentName(j) : ""; // mt->getLinkParentName(j)
-                                                                                  // could be
-                                                                                  // nullptr
-                    int32_t parentIdx = mt->findLinkIndex(mt->getLinkParentName(j));
-                    if (parentIdx >= 0)
-                    {
-                        childLinks[parentIdx].push_back(j);
-                    }
-                }
-                m_linkXformData.resize(7 * linkCount);
-                createTensorDesc(
-                    m_artiTransformTensor, (void*)m_linkXformData.data(), linkCount, TensorDataType::eFloat32);
-
-                articulation->getLinkTransforms(&m_artiTransformTensor);
+            // A view was invalidated, for example by prims being removed, so create the views again on the next call
+            // and keep the last poses read from it for this one
+            m_framesDirty = true;
+        }
 
-                float* data = static_cast<float*>(m_artiTransformTensor.data);
-                ::physx::PxTransform body1Pose = ::physx::PxTransform(
-                    ::physx::PxVec3(data[0], data[1], data[2]), ::physx::PxQuat(data[3], data[4], data[5], data[6]));
-                std::string framePath = linkPaths[0];
-                std::string bodyName = getName(m_usdStage->GetPrimAtPath(pxr::SdfPath(framePath)));
+        const bool hasParent = !m_parentPath.IsEmpty();
+        if (m_parentSource == SourceType::eRigidBody)
+        {
+            m_parentPose = poseAt(m_rigidBodyData, m_parentIndex);
+        }
+        else if (hasParent)
+        {
+            // TODO: handle non types
+            m_parentPose = getXformPose(m_parentPath);
+        }
 
-                if (!m_parentPath.IsEmpty())
-                {
-                    body1Pose = m_parentPose.transformInv(body1Pose);
-                }
-                std::string childFrameId = getUniqueFrameName(bodyName, framePath);
-                if (m_parentFrame != childFrameId)
-                {
-                    // articulations always have an extra transform to the base link/rigid body
-                    processTransform(m_parentFrame, childFrameId, body1Pose);
-                }
-                for (size_t j = 0; j < linkCount; j++)
-                {
-                    ::physx::PxTransform body0Pose(
-                        ::physx::PxVec3(data[7 * j + 0], data[7 * j + 1], data[7 * j + 2]),
-                        ::physx::PxQuat(data[7 * j + 3], data[7 * j + 4], data[7 * j + 5], data[7 * j + 6]));
-                    std::string parentPath = linkPaths[j];
-                    std::string parentName = getName(m_usdStage->GetPrimAtPath(pxr::SdfPath(parentPath)));
-                    size_t num_children = childLinks[j].size();
-                    for (size_t k = 0; k < num_children; k++)
-                    {
-                        size_t childIdx = childLinks[j][k];
-                        ::physx::PxTransform body1Pose(
-                            ::physx::PxVec3(data[7 * childIdx + 0], data[7 * childIdx + 1], data[7 * childIdx + 2]),
-                            ::physx::PxQuat(data[7 * childIdx + 3], data[7 * childIdx + 4], data[7 * childIdx + 5],
-                                            data[7 * childIdx + 6]));
-                        ::physx::PxTransform body0Tbody1(body0Pose.transformInv(body1Pose));
-                        std::string framePath = linkPaths[childIdx];
-                        auto bodyName = getName(m_usdStage->GetPrimAtPath(pxr::SdfPath(framePath)));
-                        processTransform(getUniqueFrameName(parentName, parentPath),
-                                         getUniqueFrameName(bodyName, framePath), body0Tbody1);
-                    }
-                }
-            }
-            else if (objectType == ObjectType::eArticulationLink || objectType == ObjectType::eRigidBody)
+        for (size_t i = 0; i < m_frames.size(); i++)
+        {
+            const FrameSource& source = m_frameSources[i];
+            ::physx::PxTransform pose;
+            switch (source.type)
             {
-                IRigidBodyView* rigidBody = m_simView->createRigidBodyView(primPath.GetString().c_str());
-                ::physx::PxTransform body1Pose = getRigidBodyPose(rigidBody);
-                std::string childFrameId =
-                    getUniqueFrameName(getName(m_usdStage->GetPrimAtPath(primPath)), primPath.GetString());
-                if (m_parentFrame != childFrameId)
-                {
-                    if (!m_parentPath.IsEmpty())
-                    {
-                        body1Pose = m_parentPose.transformInv(body1Pose);
-                    }
-
-                    processTransform(m_parentFrame, childFrameId, body1Pose);
-                }
-            }
-            else
+            case SourceType::eArticulationLink:
             {
-                pxr::UsdPrim prim = m_usdStage->GetPrimAtPath(primPath);
-
-                ::physx::PxTransform body1Pose = getXformPose(primPath);
-
-
-                if (prim.IsA<pxr::UsdGeomCamera>() && !prim.HasAPI<pxr::IsaacSensorIsaacRtxLidarSensorAPI>())
+                const size_t offset = m_articulations[source.index].dataOffset;
+                ::physx::PxTransform body0Pose = poseAt(m_linkData, offset / 7 + source.parentLink);
+                ::physx::PxTransform body1Pose = poseAt(m_linkData, offset / 7 + source.childLink);
+                m_frames[i].transform = body0Pose.transformInv(body1Pose);
+                continue;
+            }
+            case SourceType::eArticulationRoot:
+                // articulations always have an extra transform to the base link/rigid body
+                pose = poseAt(m_linkData, m_articulations[source.index].dataOffset / 7);
+                break;
+            case SourceType::eRigidBody:
+                pose = poseAt(m_rigidBodyData, source.index);
+                break;
+            case SourceType::eXform:
+            default:
+                pose = getXformPose(m_xforms[source.index].path);
+                if (m_xforms[source.index].isCamera)
                 {
                     // Regular camera (not RTXLidar), Rotate 180 degrees about x-axis
                     // pxr::GfMatrix4d(1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1);
                     ::physx::PxQuat omniTCamera(1, 0, 0, 0);
-                    body1Pose = body1Pose * ::physx::PxTransform(omniTCamera);
+                    pose = pose * ::physx::PxTransform(omniTCamera);
                 }
+                break;
+            }
+            if (hasParent)
+            {
+                pose = m_parentPose.transformInv(pose);
+            }
+            m_frames[i].transform = pose;
+        }
+        return m_frames;
+    }
 
-                if (!m_parentPath.IsEmpty())
-                {
-                    body1Pose = m_parentPose.transformInv(body1Pose);
-                }
+    /**
+     * @brief Gets the names of the frames referenced by computeFrameTransforms().
+     * @return Unique frame names
+     */
+    const std::vector<std::string>& getFrameNames() const
+    {
+        return m_frameNames;
+    }
 
-                processTransform(m_parentFrame, getUniqueFrameName(getName(prim), primPath.GetString()), body1Pose);
-            }
+    /**
+     * @brief Gets a counter incremented every time the frame table is built.
+     * @details Callers caching frame names can compare it between calls to know when to refresh them.
+     *
+     * @return Version of the frame table, 0 before it is first built
+     */
+    uint64_t getFrameTableVersion() const
+    {
+        return m_frameTableVersion;
+    }
+
+    /**
+     * @brief Traverses the complete pose tree and processes each transform.
+     * @details
+     * Performs a depth-first traversal of the pose tree, computing transforms between parent and child frames.
+     * See computeFrameTransforms() for the types of prims handled.
+     *
+     * @param[in] processTransform Callback function to handle each computed transform
+     *
+     * @note The callback function receives:
+     *       - Parent frame name (string)
+     *       - Child frame name (string)
+     *       - Relative transform between frames (PxTransform)
+     */
+    void processAllFrames(
+        std::function<void(const std::string&, const std::string&, const ::physx::PxTransform&)>& processTransform)
+    {
+        for (const FrameTransform& frame : computeFrameTransforms())
+        {
+            processTransform(m_frameNames[frame.parentFrame], m_frameNames[frame.childFrame], frame.transform);
         }
     }
 
@@ -371,6 +467,360 @@ public:
     }
 
 private:
+    /** @brief Where the pose of a frame is read from */
+    enum class SourceType
+    {
+        eNone,
+        eRigidBody,
+        eArticulationRoot,
+        eArticulationLink,
+        eXform
+    };
+
+    /** @brief Source of the pose of a frame, parallel to m_frames */
+    struct FrameSource
+    {
+        /** @brief Kind of source */
+        SourceType type;
+
+        /** @brief Rigid body slot, articulation or transform index depending on the type */
+        uint32_t index;
+
+        /** @brief Parent link of an articulation link frame */
+        uint32_t parentLink;
+
+        /** @brief Child link of an articulation link frame */
+        uint32_t childLink;
+    };
+
+    /** @brief Articulation target and the location of its link poses in m_linkData */
+    struct ArticulationEntry
+    {
+        /** @brief View of the articulation */
+        IArticulationView* view;
+
+        /** @brief Number of links */
+        uint32_t linkCount;
+
+        /** @brief Offset of the first link pose in m_linkData */
+        size_t dataOffset;
+    };
+
+    /** @brief Rigid body view and the slot of its first body in m_rigidBodyData */
+    struct RigidBodyEntry
+    {
+        /** @brief View of one or more rigid bodies */
+        IRigidBodyView* view;
+
+        /** @brief Slot of the first body of the view */
+        uint32_t slot;
+    };
+
+    /** @brief Target without physics, posed from fabric or USD */
+    struct XformEntry
+    {
+        /** @brief Path of the prim */
+        pxr::SdfPath path;
+
+        /** @brief Whether the prim is a camera that is not an RTX lidar */
+        bool isCamera;
+
+        /** @brief Physics object type of the prim when the frame table was built */
+        ObjectType objectType;
+    };
+
+    /**
+     * @brief Reads a pose from position and quaternion data.
+     * @param[in] data Poses as 7 floats each
+     * @param[in] index Index of the pose
+     * @return The pose
+     */
+    static ::physx::PxTransform poseAt(const std::vector<float>& data, size_t index)
+    {
+        const float* pose = data.data() + 7 * index;
+        return ::physx::PxTransform(
+            ::physx::PxVec3(pose[0], pose[1], pose[2]), ::physx::PxQuat(pose[3], pose[4], pose[5], pose[6]));
+    }
+
+    /**
+     * @brief Gets the index of a frame name, adding it if needed.
+     * @param[in] name Unique frame name
+     * @return Index in m_frameNames
+     */
+    uint32_t addFrameName(const std::string& name)
+    {
+        auto it = m_frameIndices.find(name);
+        if (it != m_frameIndices.end())
+        {
+            return it->second;
+        }
+        uint32_t index = static_cast<uint32_t>(m_frameNames.size());
+        m_frameNames.push_back(name);
+        m_frameIndices.emplace(name, index);
+        return index;
+    }
+
+    /**
+     * @brief Adds a frame to the frame table.
+     * @param[in] parentFrame Parent frame name
+     * @param[in] childFrame Child frame name
+     * @param[in] source Source of the pose of the frame
+     */
+    void addFrame(const std::string& parentFrame, const std::string& childFrame, const FrameSource& source)
+    {
+        FrameTransform frame;
+        frame.parentFrame = addFrameName(parentFrame);
+        frame.childFrame = addFrameName(childFrame);
+        frame.transform = ::physx::PxTransform(::physx::PxIdentity);
+        m_frames.push_back(frame);
+        m_frameSources.push_back(source);
+    }
+
+    /**
+     * @brief Passes the parent and target paths to the notice listener.
+     */
+    void updateWatchedPaths()
+    {
+        pxr::SdfPathVector paths = m_targets;
+        if (!m_parentPath.IsEmpty())
+        {
+            paths.push_back(m_parentPath);
+        }
+        m_noticeListener->setWatchedPaths(paths);
+    }
+
+    /**
+     * @brief Checks whether a prim posed from fabric or USD became a physics object, or stopped being one.
+     * @details A rigid body or articulation removed from physics fails to be read in fetchPoses() instead.
+     *
+     * @return True if the object type of the parent or of a transform target changed since the frame table was built
+     */
+    bool objectTypesChanged() const
+    {
+        if (m_parentSource == SourceType::eXform &&
+            m_simView->getObjectType(m_parentPath.GetString().c_str()) != m_parentObjectType)
+        {
+            return true;
+        }
+        for (const XformEntry& xform : m_xforms)
+        {
+            if (m_simView->getObjectType(xform.path.GetString().c_str()) != xform.objectType)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Releases the physics views of the frame table.
+     */
+    void releaseViews()
+    {
+        for (RigidBodyEntry& rigidBody : m_rigidBodyViews)
+        {
+            if (rigidBody.view)
+            {
+                rigidBody.view->release();
+            }
+        }
+        m_rigidBodyViews.clear();
+        for (ArticulationEntry& articulation : m_articulations)
+        {
+            articulation.view->release();
+        }
+        m_articulations.clear();
+    }
+
+    /**
+     * @brief Builds the physics views, frame names and frame hierarchy from the parent and target prims.
+     * @details Frame names are made unique in the same order as the frames are published.
+     */
+    void buildFrames()
+    {
+        releaseViews();
+        m_frames.clear();
+        m_frameSources.clear();
+        m_frameNames.clear();
+        m_frameIndices.clear();
+        m_xforms.clear();
+        m_framesDirty = false;
+        m_frameTableVersion++;
+
+        std::vector<std::string> rigidBodyPaths;
+        std::unordered_map<std::string, uint32_t> rigidBodySlots;
+        auto addRigidBody = [&rigidBodyPaths, &rigidBodySlots](const std::string& path)
+        {
+            auto it = rigidBodySlots.emplace(path, static_cast<uint32_t>(rigidBodyPaths.size()));
+            if (it.second)
+            {
+                rigidBodyPaths.push_back(path);
+            }
+            return it.first->second;
+        };
+
+        // If the parent prim path is not empty, get the type of prim and its name.
+        m_parentSource = SourceType::eNone;
+        if (!m_parentPath.IsEmpty())
+        {
+            ObjectType objectType = m_simView->getObjectType(m_parentPath.GetString().c_str());
+            if (objectType == ObjectType::eArticulationLink || objectType == ObjectType::eArticulationRootLink ||
+                objectType == ObjectType::eRigidBody)
+            {
+                m_parentSource = SourceType::eRigidBody;
+                m_parentIndex = addRigidBody(m_parentPath.GetString());
+            }
+            else
+            {
+                m_parentSource = SourceType::eXform;
+                m_parentObjectType = objectType;
+            }
+
+            m_parentFrame =
+                getUniqueFrameName(getName(m_usdStage->GetPrimAtPath(m_parentPath)), m_parentPath.GetString());
+        }
+
+        // For each target prim determine its type and the frames it publishes
+        size_t linkDataSize = 0;
+        for (const pxr::SdfPath& primPath : m_targets)
+        {
+            // Targets removed from the stage publish no frames until they are added back
+            if (!m_usdStage->GetPrimAtPath(primPath))
+            {
+                continue;
+            }
+            ObjectType objectType = m_simView->getObjectType(primPath.GetString().c_str());
+            if (objectType == ObjectType::eArticulation || objectType == ObjectType::eArticulationRootLink)
+            {
+                IArticulationView* articulation = m_simView->createArticulationView(primPath.GetString().c_str());
+                if (!articulation)
+                {
+                    CARB_LOG_WARN("Unable to create an articulation view for %s", primPath.GetText());
+                    continue;
+                }
+                const IArticulationMetatype* mt = articulation->getSharedMetatype();
+                uint32_t linkCount = articulation->getMaxLinks();
+                std::vector<std::string> linkPaths(linkCount);
+                std::vector<std::vector<uint32_t>> childLinks(linkCount);
+                for (uint32_t j = 0; j < linkCount; ++j)
+                {
+                    linkPaths[j] = articulation->getUsdLinkPath(0, j);
+                    // mt->getLinkParentName(j) could be nullptr
+                    int32_t parentIdx = mt->findLinkIndex(mt->getLinkParentName(j));
+                    if (parentIdx >= 0)
+                    {
+                        childLinks[parentIdx].push_back(j);
+                    }
+                }
+                const uint32_t articulationIndex = static_cast<uint32_t>(m_articulations.size());
+                m_articulations.push_back({ articulation, linkCount, linkDataSize });
+                linkDataSize += 7 * static_cast<size_t>(linkCount);
+                if (linkCount == 0)
+                {
+                    continue;
+                }
+
+                std::string childFrameId =
+                    getUniqueFrameName(getName(m_usdStage->GetPrimAtPath(pxr::SdfPath(linkPaths[0]))), linkPaths[0]);
+                if (m_parentFrame != childFrameId)
+                {
+                    addFrame(m_parentFrame, childFrameId, { SourceType::eArticulationRoot, articulationIndex, 0, 0 });
+                }
+                for (uint32_t j = 0; j < linkCount; j++)
+                {
+                    const std::string& parentPath = linkPaths[j];
+                    std::string parentName = getName(m_usdStage->GetPrimAtPath(pxr::SdfPath(parentPath)));
+                    for (uint32_t childIdx : childLinks[j])
+                    {
+                        const std::string& framePath = linkPaths[childIdx];
+                        std::string parentFrame = getUniqueFrameName(parentName, parentPath);
+                        std::string childFrame =
+                            getUniqueFrameName(getName(m_usdStage->GetPrimAtPath(pxr::SdfPath(framePath))), framePath);
+                        addFrame(
+                            parentFrame, childFrame, { SourceType::eArticulationLink, articulationIndex, j, childIdx });
+                    }
+                }
+            }
+            else if (objectType == ObjectType::eArticulationLink || objectType == ObjectType::eRigidBody)
+            {
+                uint32_t slot = addRigidBody(primPath.GetString());
+                std::string childFrameId =
+                    getUniqueFrameName(getName(m_usdStage->GetPrimAtPath(primPath)), primPath.GetString());
+                if (m_parentFrame != childFrameId)
+                {
+                    addFrame(m_parentFrame, childFrameId, { SourceType::eRigidBody, slot, 0, 0 });
+                }
+            }
+            else
+            {
+                pxr::UsdPrim prim = m_usdStage->GetPrimAtPath(primPath);
+                const bool isCamera =
+                    prim.IsA<pxr::UsdGeomCamera>() && !prim.HasAPI<pxr::IsaacSensorIsaacRtxLidarSensorAPI>();
+                const uint32_t xformIndex = static_cast<uint32_t>(m_xforms.size());
+                m_xforms.push_back({ primPath, isCamera, objectType });
+                addFrame(m_parentFrame, getUniqueFrameName(getName(prim), primPath.GetString()),
+                         { SourceType::eXform, xformIndex, 0, 0 });
+            }
+        }
+        m_linkData.assign(linkDataSize, 0.0f);
+
+        // All rigid bodies are read through a single view when possible, otherwise through one view per body
+        m_rigidBodyData.assign(7 * rigidBodyPaths.size(), 0.0f);
+        for (size_t i = 0; i < rigidBodyPaths.size(); i++)
+        {
+            // Bodies without a view keep the identity pose
+            m_rigidBodyData[7 * i + 6] = 1.0f;
+        }
+        if (!rigidBodyPaths.empty())
+        {
+            IRigidBodyView* rigidBodies = m_simView->createRigidBodyView(rigidBodyPaths);
+            if (rigidBodies && rigidBodies->getCount() == rigidBodyPaths.size())
+            {
+                m_rigidBodyViews.push_back({ rigidBodies, 0 });
+            }
+            else
+            {
+                if (rigidBodies)
+                {
+                    rigidBodies->release();
+                }
+                for (size_t i = 0; i < rigidBodyPaths.size(); i++)
+                {
+                    m_rigidBodyViews.push_back(
+                        { m_simView->createRigidBodyView(rigidBodyPaths[i].c_str()), static_cast<uint32_t>(i) });
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Reads the poses of all rigid bodies and articulation links, with one query per view.
+     * @return False if a view could not be read
+     */
+    bool fetchPoses()
+    {
+        bool success = true;
+        for (const RigidBodyEntry& rigidBody : m_rigidBodyViews)
+        {
+            if (!rigidBody.view)
+            {
+                continue;
+            }
+            createTensorDesc(m_rigidTransformTensor, m_rigidBodyData.data() + 7 * static_cast<size_t>(rigidBody.slot),
+                             rigidBody.view->getCount(), TensorDataType::eFloat32);
+            success = rigidBody.view->getTransforms(&m_rigidTransformTensor) && success;
+        }
+        for (const ArticulationEntry& articulation : m_articulations)
+        {
+            createTensorDesc(m_artiTransformTensor, m_linkData.data() + articulation.dataOffset, articulation.linkCount,
+                             TensorDataType::eFloat32);
+            success = articulation.view->getLinkTransforms(&m_artiTransformTensor) && success;
+        }
+        // getRigidBodyPose() reads single bodies through the rigid body tensor
+        createTensorDesc(m_rigidTransformTensor, (void*)m_rigidXformData.data(), 1, TensorDataType::eFloat32);
+        return success;
+    }
+
     /** @brief SDF path to the parent prim */
     pxr::SdfPath m_parentPath;
 
@@ -407,8 +857,50 @@ private:
     /** @brief Storage for rigid body transform data (7 floats: position + quaternion) */
     std::vector<float> m_rigidXformData;
 
-    /** @brief Storage for articulation link transform data */
-    std::vector<float> m_linkXformData;
+    /** @brief Whether the frame table must be built again before computing transforms */
+    bool m_framesDirty = true;
+
+    /** @brief Number of times the frame table was built */
+    uint64_t m_frameTableVersion = 0;
+
+    /** @brief Unique names of the frames in the table */
+    std::vector<std::string> m_frameNames;
+
+    /** @brief Index of each frame name in m_frameNames */
+    std::unordered_map<std::string, uint32_t> m_frameIndices;
+
+    /** @brief Frame table with the transforms of the last computeFrameTransforms() call */
+    std::vector<FrameTransform> m_frames;
+
+    /** @brief Source of the pose of each frame in m_frames */
+    std::vector<FrameSource> m_frameSources;
+
+    /** @brief Source of the parent pose */
+    SourceType m_parentSource = SourceType::eNone;
+
+    /** @brief Physics object type of the parent when the frame table was built, if it is posed from fabric or USD */
+    ObjectType m_parentObjectType = ObjectType::eInvalid;
+
+    /** @brief Rigid body slot of the parent, if it is a rigid body */
+    uint32_t m_parentIndex = 0;
+
+    /** @brief Views of the rigid body targets and parent */
+    std::vector<RigidBodyEntry> m_rigidBodyViews;
+
+    /** @brief Poses of the rigid body targets and parent, 7 floats per body */
+    std::vector<float> m_rigidBodyData;
+
+    /** @brief Views of the articulation targets */
+    std::vector<ArticulationEntry> m_articulations;
+
+    /** @brief Poses of the links of all articulation targets, 7 floats per link */
+    std::vector<float> m_linkData;
+
+    /** @brief Targets posed from fabric or USD */
+    std::vector<XformEntry> m_xforms;
+
+    /** @brief Listener recording stage resyncs of the parent and targets */
+    std::unique_ptr<PoseTreeUsdNoticeListener> m_noticeListener;
 };
 }
 }
@@ -0,0 +1,551 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <carb/logging/Log.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace isaacsim
+{
+namespace core
+{
+namespace includes
+{
+namespace utils
+{
+
+/**
+ * @class MeshConversionCache
+ * @brief On-disk cache of mesh files converted to USD, shared between imports and processes.
+ * @details
+ * Entries are keyed by a hash of the source mesh file content, of the files it references (OBJ material libraries
+ * and their textures, Collada images, glTF buffers and images) and of everything else that changes the conversion
+ * output (converter version and flags, ...), so a mesh is converted again only when one of them changes. Files the
+ * converted mesh references relative to its own directory, such as the textures the converter writes next to it, are
+ * stored with the entry and restored next to the file it is fetched to. Entries are written atomically, and once the
+ * cache grows past its size limit the least recently used ones are removed.
+ */
+class MeshConversionCache
+{
+public:
+    /**
+     * @brief Cache hit and miss counters.
+     */
+    struct Stats
+    {
+        uint64_t hits = 0; //!< Lookups that found a converted mesh
+        uint64_t misses = 0; //!< Lookups that found nothing
+        uint64_t stores = 0; //!< Converted meshes added to the cache
+        uint64_t evictions = 0; //!< Entries removed to stay below the size limit
+    };
+
+    /**
+     * @brief Creates a cache in the given directory.
+     * @param[in] directory Directory the converted meshes are stored in, an empty path disables the cache
+     * @param[in] maxSizeBytes Total size the cache is trimmed down to once an added entry takes it past it, 0 for no
+     *            limit
+     */
+    MeshConversionCache(const std::string& directory, uint64_t maxSizeBytes)
+        : m_directory(directory), m_maxSizeBytes(maxSizeBytes)
+    {
+    }
+
+    /**
+     * @brief Checks whether the cache is used.
+     * @return True if the cache has a directory
+     */
+    bool isEnabled() const
+    {
+        return !m_directory.empty();
+    }
+
+    /**
+     * @brief Computes the cache key of a mesh file.
+     * @details Material libraries referenced by the mesh are hashed by content, the textures and buffers referenced
+     *          by the mesh or its material libraries by size and modification time.
+     *
+     * @param[in] meshPath Path of the local mesh file
+     * @param[in] variant Conversion settings that change the output, such as the converter version and flags
+     * @return Cache key, empty if the file cannot be read
+     */
+    static std::string makeKey(const std::string& meshPath, const std::string& variant)
+    {
+        // 64-bit FNV-1a over the file content, the referenced files and the variant
+        uint64_t hash = 14695981039346656037ull;
+        if (!hashFileContent(meshPath, hash))
+        {
+            return std::string();
+        }
+        hashReferencedFiles(meshPath, hash);
+        hashString(std::to_string(kKeyVersion), hash);
+        hashString(variant, hash);
+
+        char key[17];
+        std::snprintf(key, sizeof(key), "%016llx", static_cast<unsigned long long>(hash));
+        return key;
+    }
+
+    /**
+     * @brief Lists the files a mesh or material library file references, as written in the file.
+     * @details Handles the material libraries of OBJ files, the texture maps of MTL files, the images of Collada
+     *          files and the buffers and images of glTF files. Other formats reference no files.
+     *
+     * @param[in] path Path of the local mesh or material library file
+     * @return Referenced paths, relative to the directory of the file unless absolute
+     */
+    static std::vector<std::string> findReferencedFiles(const std::string& path)
+    {
+        std::vector<std::string> references;
+        const std::string extension = lowercaseExtension(path);
+        if (extension != ".obj" && extension != ".mtl" && extension != ".dae" && extension != ".gltf")
+        {
+            return references;
+        }
+        std::ifstream file(path, std::ios::binary);
+        if (extension == ".obj" || extension == ".mtl")
+        {
+            std::string line;
+            while (std::getline(file, line))
+            {
+                std::istringstream tokens(line);
+                std::string keyword;
+                tokens >> keyword;
+                std::vector<std::string> arguments;
+                for (std::string argument; tokens >> argument;)
+                {
+                    arguments.push_back(argument);
+                }
+                if (arguments.empty())
+                {
+                    continue;
+                }
+                if (extension == ".obj" && keyword == "mtllib")
+                {
+                    references.insert(references.end(), arguments.begin(), arguments.end());
+                }
+                else if (extension == ".mtl" &&
+                         (keyword.compare(0, 4, "map_") == 0 || keyword == "bump" || keyword == "disp" ||
+                          keyword == "decal" || keyword == "refl" || keyword == "norm"))
+                {
+                    // Texture options come before the file name
+                    references.push_back(arguments.back());
+                }
+            }
+            return references;
+        }
+
+        const std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        if (extension == ".dae")
+        {
+            // <init_from> holds an image file name, or in Collada 1.5 a nested <ref> element with it
+            for (size_t begin = content.find("<init_from>"); begin != std::string::npos;
+                 begin = content.find("<init_from>", begin))
+            {
+                begin += 11;
+                const size_t end = content.find("</init_from>", begin);
+                if (end == std::string::npos)
+                {
+                    break;
+                }
+                std::string reference = content.substr(begin, end - begin);
+                const size_t ref = reference.find("<ref>");
+                if (ref != std::string::npos)
+                {
+                    reference = reference.substr(ref + 5, reference.find("</ref>") - ref - 5);
+                }
+                if (reference.compare(0, 7, "file://") == 0)
+                {
+                    reference = reference.substr(7);
+                }
+                if (!reference.empty() && reference.find('<') == std::string::npos)
+                {
+                    references.push_back(reference);
+                }
+                begin = end;
+            }
+        }
+        else
+        {
+            // Every "uri" names a buffer or image, skipping the ones embedded as data URIs
+            for (size_t begin = content.find("\"uri\""); begin != std::string::npos;
+                 begin = content.find("\"uri\"", begin))
+            {
+                const size_t open = content.find('"', content.find(':', begin + 5));
+                const size_t close = open == std::string::npos ? open : content.find('"', open + 1);
+                if (close == std::string::npos)
+                {
+                    break;
+                }
+                std::string reference = content.substr(open + 1, close - open - 1);
+                if (!reference.empty() && reference.compare(0, 5, "data:") != 0)
+                {
+                    references.push_back(reference);
+                }
+                begin = close;
+            }
+        }
+        return references;
+    }
+
+    /**
+     * @brief Copies a cached conversion to the given file.
+     * @details The files stored with the entry are copied to the same relative paths next to usdPath.
+     *
+     * @param[in] key Cache key from makeKey()
+     * @param[in] usdPath File to copy the converted mesh to
+     * @return True on a cache hit
+     */
+    bool fetch(const std::string& key, const std::string& usdPath)
+    {
+        if (!isEnabled() || key.empty())
+        {
+            return false;
+        }
+        std::error_code ec;
+        std::filesystem::path entry = entryPath(key);
+        std::filesystem::path files = filesPath(key);
+        const std::filesystem::path usdDirectory = std::filesystem::path(usdPath).parent_path();
+        if (std::filesystem::is_directory(files, ec) && !restoreFiles(files, usdDirectory))
+        {
+            m_misses++;
+            return false;
+        }
+        if (std::filesystem::copy_file(entry, usdPath, std::filesystem::copy_options::overwrite_existing, ec))
+        {
+            // Mark the entry as recently used for eviction
+            std::filesystem::last_write_time(entry, std::filesystem::file_time_type::clock::now(), ec);
+            m_hits++;
+            CARB_LOG_INFO("Mesh conversion cache hit %s -> %s", key.c_str(), usdPath.c_str());
+            return true;
+        }
+        m_misses++;
+        return false;
+    }
+
+    /**
+     * @brief Adds a converted mesh to the cache.
+     * @param[in] key Cache key from makeKey()
+     * @param[in] usdPath Converted mesh file to copy into the cache
+     * @param[in] dependencies Files the converted mesh references, relative to its directory, stored with it
+     */
+    void store(const std::string& key, const std::string& usdPath, const std::vector<std::string>& dependencies = {})
+    {
+        if (!isEnabled() || key.empty())
+        {
+            return;
+        }
+        std::error_code ec;
+        std::filesystem::create_directories(m_directory, ec);
+
+        // Copy under a unique name first so concurrent imports never read a partially written entry
+        std::filesystem::path entry = entryPath(key);
+        std::filesystem::path staging = entry;
+        staging += ".tmp" + std::to_string(std::random_device{}());
+        std::filesystem::path filesStaging = staging;
+        filesStaging += ".files";
+        uint64_t size = 0;
+        const std::filesystem::path usdDirectory = std::filesystem::path(usdPath).parent_path();
+        for (const std::string& dependency : dependencies)
+        {
+            const std::filesystem::path target = filesStaging / dependency;
+            std::filesystem::create_directories(target.parent_path(), ec);
+            if (!std::filesystem::copy_file(usdDirectory / dependency, target, ec))
+            {
+                CARB_LOG_WARN("Failed to add %s to the mesh conversion cache: %s", dependency.c_str(),
+                              ec.message().c_str());
+                std::filesystem::remove_all(filesStaging, ec);
+                return;
+            }
+            size += std::filesystem::file_size(target, ec);
+        }
+        if (!std::filesystem::copy_file(usdPath, staging, ec))
+        {
+            CARB_LOG_WARN("Failed to add %s to the mesh conversion cache: %s", usdPath.c_str(), ec.message().c_str());
+            std::filesystem::remove_all(filesStaging, ec);
+            return;
+        }
+        size += std::filesystem::file_size(staging, ec);
+        std::error_code replacedEc;
+        uint64_t replacedSize = std::filesystem::file_size(entry, replacedEc);
+        replacedSize = (replacedEc ? 0 : replacedSize) + directorySize(filesPath(key));
+
+        // The files go in place before the mesh that references them, fetch() only looks for them on a hit
+        std::filesystem::remove_all(filesPath(key), ec);
+        if (!dependencies.empty())
+        {
+            std::filesystem::rename(filesStaging, filesPath(key), ec);
+        }
+        if (!ec)
+        {
+            std::filesystem::rename(staging, entry, ec);
+        }
+        if (ec)
+        {
+            std::filesystem::remove(staging, ec);
+            std::filesystem::remove_all(filesStaging, ec);
+            return;
+        }
+        m_stores++;
+
+        // The directory is only listed again once the running total goes past the limit
+        if (m_maxSizeBytes != 0 && addToTotalSize(size, replacedSize))
+        {
+            trim();
+        }
+    }
+
+    /**
+     * @brief Gets the hit and miss counters since the cache was created.
+     * @return Cache counters
+     */
+    Stats getStats() const
+    {
+        Stats stats;
+        stats.hits = m_hits;
+        stats.misses = m_misses;
+        stats.stores = m_stores;
+        stats.evictions = m_evictions;
+        return stats;
+    }
+
+    /**
+     * @brief Removes the least recently used entries until the cache fits in its size limit.
+     * @details Lists the cache directory, which also resets the running total to the size of the entries written
+     *          by every process sharing the cache.
+     */
+    void trim()
+    {
+        if (!isEnabled() || m_maxSizeBytes == 0)
+        {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(m_trimMutex);
+
+        struct Entry
+        {
+            std::filesystem::path path;
+            std::filesystem::file_time_type lastUse;
+            uint64_t size;
+        };
+        std::vector<Entry> entries;
+        uint64_t totalSize = 0;
+        std::error_code ec;
+        for (const auto& file : std::filesystem::directory_iterator(m_directory, ec))
+        {
+            if (!file.is_regular_file(ec) || file.path().extension() != ".usd")
+            {
+                continue;
+            }
+            std::filesystem::path files = file.path();
+            files.replace_extension(".files");
+            Entry entry{ file.path(), file.last_write_time(ec), file.file_size(ec) + directorySize(files) };
+            totalSize += entry.size;
+            entries.push_back(std::move(entry));
+        }
+        m_totalSize = totalSize;
+        m_totalSizeKnown = true;
+        if (totalSize <= m_maxSizeBytes)
+        {
+            return;
+        }
+
+        std::sort(
+            entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.lastUse < b.lastUse; });
+        for (const auto& entry : entries)
+        {
+            if (totalSize <= m_maxSizeBytes)
+            {
+                break;
+            }
+            if (std::filesystem::remove(entry.path, ec))
+            {
+                std::filesystem::path files = entry.path;
+                std::filesystem::remove_all(files.replace_extension(".files"), ec);
+                totalSize -= entry.size;
+                m_evictions++;
+            }
+        }
+        m_totalSize = totalSize;
+    }
+
+private:
+    /** @brief Version of the key layout, changing it invalidates every existing entry */
+    static constexpr int kKeyVersion = 3;
+
+    static void hashBytes(const char* data, size_t size, uint64_t& hash)
+    {
+        for (size_t i = 0; i < size; i++)
+        {
+            hash ^= static_cast<uint8_t>(data[i]);
+            hash *= 1099511628211ull;
+        }
+    }
+
+    static void hashString(const std::string& value, uint64_t& hash)
+    {
+        // Hash the terminator too so consecutive strings cannot run into each other
+        hashBytes(value.c_str(), value.size() + 1, hash);
+    }
+
+    static bool hashFileContent(const std::string& path, uint64_t& hash)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+        {
+            return false;
+        }
+        std::vector<char> buffer(1 << 16);
+        while (file)
+        {
+            file.read(buffer.data(), buffer.size());
+            hashBytes(buffer.data(), static_cast<size_t>(file.gcount()), hash);
+        }
+        return true;
+    }
+
+    static void hashReferencedFiles(const std::string& path, uint64_t& hash)
+    {
+        const std::filesystem::path directory = std::filesystem::path(path).parent_path();
+        for (const std::string& reference : findReferencedFiles(path))
+        {
+            hashString(reference, hash);
+            const std::filesystem::path file = directory / reference;
+            // Only OBJ files reference material libraries, which in turn only reference textures
+            if (lowercaseExtension(reference) == ".mtl" && lowercaseExtension(path) == ".obj")
+            {
+                if (!hashFileContent(file.string(), hash))
+                {
+                    hashString("missing", hash);
+                }
+                hashReferencedFiles(file.string(), hash);
+                continue;
+            }
+            std::error_code ec;
+            const uint64_t size = std::filesystem::file_size(file, ec);
+            const auto modified = std::filesystem::last_write_time(file, ec).time_since_epoch().count();
+            hashString(ec ? std::string("missing") : std::to_string(size) + " " + std::to_string(modified), hash);
+        }
+    }
+
+    static std::string lowercaseExtension(const std::string& path)
+    {
+        std::string extension = std::filesystem::path(path).extension().string();
+        std::transform(extension.begin(), extension.end(), extension.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return extension;
+    }
+
+    /**
+     * @brief Adds a stored entry to the running total size.
+     * @param[in] size Size of the stored entry
+     * @param[in] replacedSize Size of the entry it replaced, 0 if there was none
+     * @return True if the cache directory must be trimmed, always the case until it was listed once
+     */
+    bool addToTotalSize(uint64_t size, uint64_t replacedSize)
+    {
+        std::lock_guard<std::mutex> lock(m_trimMutex);
+        if (!m_totalSizeKnown)
+        {
+            return true;
+        }
+        m_totalSize = m_totalSize + size > replacedSize ? m_totalSize + size - replacedSize : 0;
+        return m_totalSize > m_maxSizeBytes;
+    }
+
+    std::filesystem::path entryPath(const std::string& key) const
+    {
+        return std::filesystem::path(m_directory) / (key + ".usd");
+    }
+
+    std::filesystem::path filesPath(const std::string& key) const
+    {
+        return std::filesystem::path(m_directory) / (key + ".files");
+    }
+
+    /**
+     * @brief Copies the files stored with an entry to the same relative paths in the target directory.
+     * @details Files already there with the same size are kept, so source textures next to the target are not
+     *          rewritten, which would change their modification time and with it the cache key.
+     */
+    static bool restoreFiles(const std::filesystem::path& files, const std::filesystem::path& target)
+    {
+        std::error_code ec;
+        for (const auto& file : std::filesystem::recursive_directory_iterator(files, ec))
+        {
+            if (!file.is_regular_file(ec))
+            {
+                continue;
+            }
+            const std::filesystem::path destination = target / file.path().lexically_relative(files);
+            std::error_code sizeEc;
+            const uint64_t existingSize = std::filesystem::file_size(destination, sizeEc);
+            if (!sizeEc && existingSize == file.file_size(ec))
+            {
+                continue;
+            }
+            std::filesystem::create_directories(destination.parent_path(), ec);
+            if (!std::filesystem::copy_file(
+                    file.path(), destination, std::filesystem::copy_options::overwrite_existing, ec))
+            {
+                return false;
+            }
+        }
+        return !ec;
+    }
+
+    static uint64_t directorySize(const std::filesystem::path& directory)
+    {
+        uint64_t size = 0;
+        std::error_code ec;
+        for (const auto& file : std::filesystem::recursive_directory_iterator(directory, ec))
+        {
+            if (file.is_regular_file(ec))
+            {
+                size += file.file_size(ec);
+            }
+        }
+        return size;
+    }
+
+    std::string m_directory;
+    uint64_t m_maxSizeBytes;
+    std::mutex m_trimMutex;
+    uint64_t m_totalSize = 0;
+    bool m_totalSizeKnown = false;
+    std::atomic<uint64_t> m_hits{ 0 };
+    std::atomic<uint64_t> m_misses{ 0 };
+    std::atomic<uint64_t> m_stores{ 0 };
+    std::atomic<uint64_t> m_evictions{ 0 };
+};
+
+} // namespace utils
+} // namespace includes
+} // namespace core
+} // namespace isaacsim
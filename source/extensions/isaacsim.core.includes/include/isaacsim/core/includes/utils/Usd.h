@@ -17,12 +17,20 @@
 
 // clang-format off
 #include <pxr/pxr.h>
+#include <pxr/usd/sdf/assetPath.h>
+#include <pxr/usd/sdf/attributeSpec.h>
+#include <pxr/usd/sdf/layer.h>
 #include <pxr/usd/usd/stage.h>
 #include <pxr/usd/usdGeom/xform.h>
 #include <pxr/usd/usdGeom/xformable.h>
 #include <pxr/base/gf/matrix4d.h>
 // clang-format on
 
+#include <algorithm>
+#include <filesystem>
+#include <string>
+#include <vector>
+
 /**
  * Select a existing layer as edit target.
  *
@@ -171,6 +179,101 @@ inline std::string makeValidUSDIdentifier(const std::string& name)
     return validName;
 }
 
+/**
+ * Prepares a layer to be copied to another directory.
+ *
+ * Relative asset paths that point outside of the layer directory are made absolute, the ones inside it are
+ * listed so they can be copied along with the layer. Asset paths that do not name an existing file, such as
+ * MDL modules found through search paths, are left alone.
+ *
+ * @param layerPath Path of the layer file, saved if an asset path was made absolute.
+ * @return Files the layer references inside its directory, relative to it.
+ *
+ **/
+inline std::vector<std::string> localizeAssetPaths(const std::string& layerPath)
+{
+    std::vector<std::string> localFiles;
+    pxr::SdfLayerRefPtr layer = pxr::SdfLayer::FindOrOpen(layerPath);
+    if (!layer)
+    {
+        return localFiles;
+    }
+    const std::filesystem::path directory = std::filesystem::path(layer->GetRealPath()).parent_path();
+    bool changed = false;
+    auto localize = [&](const pxr::SdfAssetPath& assetPath)
+    {
+        const std::string& path = assetPath.GetAssetPath();
+        std::error_code ec;
+        if (path.empty() || path.find(':') != std::string::npos || std::filesystem::path(path).is_absolute())
+        {
+            return assetPath;
+        }
+        const std::filesystem::path file = (directory / path).lexically_normal();
+        if (!std::filesystem::is_regular_file(file, ec))
+        {
+            return assetPath;
+        }
+        const std::filesystem::path relative = file.lexically_relative(directory);
+        if (!relative.empty() && *relative.begin() != "..")
+        {
+            localFiles.push_back(relative.generic_string());
+            return assetPath;
+        }
+        changed = true;
+        return pxr::SdfAssetPath(file.generic_string());
+    };
+
+    std::vector<pxr::SdfPath> attributePaths;
+    layer->Traverse(pxr::SdfPath::AbsoluteRootPath(),
+                    [&attributePaths](const pxr::SdfPath& path)
+                    {
+                        if (path.IsPrimPropertyPath())
+                        {
+                            attributePaths.push_back(path);
+                        }
+                    });
+    for (const pxr::SdfPath& path : attributePaths)
+    {
+        pxr::SdfAttributeSpecHandle attribute = layer->GetAttributeAtPath(path);
+        if (!attribute || !attribute->HasDefaultValue())
+        {
+            continue;
+        }
+        const pxr::VtValue value = attribute->GetDefaultValue();
+        if (value.IsHolding<pxr::SdfAssetPath>())
+        {
+            const pxr::SdfAssetPath& assetPath = value.UncheckedGet<pxr::SdfAssetPath>();
+            const pxr::SdfAssetPath localized = localize(assetPath);
+            if (localized.GetAssetPath() != assetPath.GetAssetPath())
+            {
+                attribute->SetDefaultValue(pxr::VtValue(localized));
+            }
+        }
+        else if (value.IsHolding<pxr::VtArray<pxr::SdfAssetPath>>())
+        {
+            pxr::VtArray<pxr::SdfAssetPath> assetPaths = value.UncheckedGet<pxr::VtArray<pxr::SdfAssetPath>>();
+            bool arrayChanged = false;
+            for (pxr::SdfAssetPath& assetPath : assetPaths)
+            {
+                pxr::SdfAssetPath localized = localize(assetPath);
+                arrayChanged |= localized.GetAssetPath() != assetPath.GetAssetPath();
+                assetPath = localized;
+            }
+            if (arrayChanged)
+            {
+                attribute->SetDefaultValue(pxr::VtValue(assetPaths));
+            }
+        }
+    }
+    if (changed)
+    {
+        layer->Save();
+    }
+    std::sort(localFiles.begin(), localFiles.end());
+    localFiles.erase(std::unique(localFiles.begin(), localFiles.end()), localFiles.end());
+    return localFiles;
+}
+
 } // namespace usd
 } // namespace utils
 } // namespace core
@@ -0,0 +1,137 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/*
+Test is implemented using the doctest C++ testing framework:
+  https://github.com/doctest/doctest/blob/master/doc/markdown/readme.md
+*/
+
+#include <doctest/doctest.h>
+#include <isaacsim/core/includes/utils/MeshConversionCache.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+TEST_SUITE("isaacsim.core.includes.tests")
+{
+    TEST_CASE("MeshConversionCache")
+    {
+        namespace fs = std::filesystem;
+        using isaacsim::core::includes::utils::MeshConversionCache;
+
+        fs::path root = fs::temp_directory_path() / "isaacsim_mesh_conversion_cache_test";
+        fs::remove_all(root);
+        fs::create_directories(root);
+        std::ofstream((root / "a.obj").string()) << "mesh a";
+        std::ofstream((root / "b.obj").string()) << "mesh b";
+        std::ofstream((root / "converted.usd").string()) << std::string(100, 'x');
+
+        SUBCASE("keys depend on content and variant")
+        {
+            std::string keyA = MeshConversionCache::makeKey((root / "a.obj").string(), "flags");
+            CHECK(keyA.size() == 16);
+            CHECK(keyA == MeshConversionCache::makeKey((root / "a.obj").string(), "flags"));
+            CHECK(keyA != MeshConversionCache::makeKey((root / "b.obj").string(), "flags"));
+            CHECK(keyA != MeshConversionCache::makeKey((root / "a.obj").string(), "other flags"));
+            CHECK(MeshConversionCache::makeKey((root / "missing.obj").string(), "flags").empty());
+        }
+
+        SUBCASE("keys depend on referenced files")
+        {
+            fs::create_directories(root / "textures");
+            std::ofstream((root / "c.obj").string()) << "mtllib c.mtl\nv 0 0 0\n";
+            std::ofstream((root / "c.mtl").string()) << "newmtl m\nmap_Kd -s 1 1 1 textures/c.png\n";
+            std::ofstream((root / "textures" / "c.png").string()) << "png";
+
+            std::vector<std::string> references = MeshConversionCache::findReferencedFiles((root / "c.mtl").string());
+            REQUIRE(references.size() == 1);
+            CHECK(references[0] == "textures/c.png");
+
+            std::string key = MeshConversionCache::makeKey((root / "c.obj").string(), "flags");
+            CHECK(key == MeshConversionCache::makeKey((root / "c.obj").string(), "flags"));
+
+            // The texture is compared by size and modification time
+            std::ofstream((root / "textures" / "c.png").string()) << "new png";
+            std::string textureKey = MeshConversionCache::makeKey((root / "c.obj").string(), "flags");
+            CHECK(textureKey != key);
+
+            // The material library is compared by content
+            std::ofstream((root / "c.mtl").string()) << "newmtl m\nKd 1 0 0\nmap_Kd -s 1 1 1 textures/c.png\n";
+            std::string materialKey = MeshConversionCache::makeKey((root / "c.obj").string(), "flags");
+            CHECK(materialKey != textureKey);
+
+            fs::remove(root / "c.mtl");
+            CHECK(MeshConversionCache::makeKey((root / "c.obj").string(), "flags") != materialKey);
+        }
+
+        SUBCASE("hits, misses and evictions")
+        {
+            // Room for a single entry
+            MeshConversionCache cache((root / "cache").string(), 150);
+            std::string keyA = MeshConversionCache::makeKey((root / "a.obj").string(), "flags");
+            std::string keyB = MeshConversionCache::makeKey((root / "b.obj").string(), "flags");
+
+            CHECK_FALSE(cache.fetch(keyA, (root / "out.usd").string()));
+            cache.store(keyA, (root / "converted.usd").string());
+            CHECK(cache.fetch(keyA, (root / "out.usd").string()));
+            CHECK(fs::file_size(root / "out.usd") == 100);
+
+            // Replacing an entry does not count its size twice
+            cache.store(keyA, (root / "converted.usd").string());
+            CHECK(cache.fetch(keyA, (root / "out.usd").string()));
+
+            cache.store(keyB, (root / "converted.usd").string());
+            CHECK_FALSE(cache.fetch(keyA, (root / "out.usd").string()));
+            CHECK(cache.fetch(keyB, (root / "out.usd").string()));
+
+            MeshConversionCache::Stats stats = cache.getStats();
+            CHECK(stats.hits == 3);
+            CHECK(stats.misses == 2);
+            CHECK(stats.stores == 3);
+            CHECK(stats.evictions == 1);
+        }
+
+        SUBCASE("dependencies are restored next to the fetched mesh")
+        {
+            MeshConversionCache cache((root / "cache").string(), 0);
+            fs::create_directories(root / "materials" / "textures");
+            std::ofstream((root / "materials" / "textures" / "albedo.png").string()) << "png";
+            std::string key = MeshConversionCache::makeKey((root / "a.obj").string(), "flags");
+            cache.store(key, (root / "converted.usd").string(), { "materials/textures/albedo.png" });
+
+            fs::create_directories(root / "other");
+            CHECK(cache.fetch(key, (root / "other" / "out.usd").string()));
+            CHECK(fs::file_size(root / "other" / "out.usd") == 100);
+            CHECK(fs::file_size(root / "other" / "materials" / "textures" / "albedo.png") == 3);
+
+            // Entries whose dependencies cannot be read are not stored
+            std::ofstream((root / "d.obj").string()) << "mesh d";
+            std::string keyD = MeshConversionCache::makeKey((root / "d.obj").string(), "flags");
+            cache.store(keyD, (root / "converted.usd").string(), { "materials/textures/missing.png" });
+            CHECK_FALSE(cache.fetch(keyD, (root / "other" / "out.usd").string()));
+        }
+
+        SUBCASE("disabled without a directory")
+        {
+            MeshConversionCache cache("", 0);
+            CHECK_FALSE(cache.isEnabled());
+            cache.store("0123456789abcdef", (root / "converted.usd").string());
+            CHECK_FALSE(cache.fetch("0123456789abcdef", (root / "out.usd").string()));
+        }
+
+        fs::remove_all(root);
+    }
+}
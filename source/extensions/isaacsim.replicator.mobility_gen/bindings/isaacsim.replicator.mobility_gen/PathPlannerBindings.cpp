@@ -18,9 +18,18 @@
 #include <pybind11/stl.h>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cmath>
+#include <cstdint>
+#include <cstdlib>
 #include <iostream>
+#include <limits>
+#include <mutex>
 #include <queue>
+#include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 namespace py = pybind11;
@@ -62,32 +71,30 @@ float getDistance(Point& start, Point& end)
 }
 
 
-std::vector<Point> getChildren(Point& point,
-                               py::detail::unchecked_reference<uint8_t, 2> freespaceMap,
-                               py::detail::unchecked_mutable_reference<uint8_t, 2> visitedMap,
-                               int64_t rowCount,
-                               int64_t columnCount)
+size_t getChildren(Point& point,
+                   py::detail::unchecked_reference<uint8_t, 2> freespaceMap,
+                   py::detail::unchecked_mutable_reference<uint8_t, 2> visitedMap,
+                   int64_t rowCount,
+                   int64_t columnCount,
+                   std::array<Point, 8>& children)
 {
 
     // Initialize candidate locations
-    std::vector<Point> candidates = { // Top row
-                                      { point.row - 1, point.column - 1 },
-                                      { point.row - 1, point.column },
-                                      { point.row - 1, point.column + 1 },
-
-                                      // Middle row (exclude self)
-                                      { point.row, point.column - 1 },
-                                      { point.row, point.column + 1 },
-
-                                      // Bottom row
-                                      { point.row + 1, point.column - 1 },
-                                      { point.row + 1, point.column },
-                                      { point.row + 1, point.column + 1 }
-    };
+    const std::array<Point, 8> candidates = { { // Top row
+                                                { point.row - 1, point.column - 1 },
+                                                { point.row - 1, point.column },
+                                                { point.row - 1, point.column + 1 },
+
+                                                // Middle row (exclude self)
+                                                { point.row, point.column - 1 },
+                                                { point.row, point.column + 1 },
+
+                                                // Bottom row
+                                                { point.row + 1, point.column - 1 },
+                                                { point.row + 1, point.column },
+                                                { point.row + 1, point.column + 1 } } };
 
-    // Initialize output children
-    std::vector<Point> children;
-    children.reserve(8);
+    size_t childCount = 0;
 
     // Filter candidates and populate output
     for (int i = 0; i < 8; i++)
@@ -113,10 +120,10 @@ std::vector<Point> getChildren(Point& point,
         if (visitedMap(candidate.row, candidate.column))
             continue;
 
-        children.push_back(candidate);
+        children[childCount++] = candidate;
     }
 
-    return children;
+    return childCount;
 }
 
 void generatePaths(py::array_t<int64_t> startPoint,
@@ -140,6 +147,7 @@ void generatePaths(py::array_t<int64_t> startPoint,
     auto parentColumnMapUnchecked = parentColumnMap.mutable_unchecked<2>();
 
     std::priority_queue<PriorityQueueItem, std::vector<PriorityQueueItem>, PriorityQueueCompare> queue;
+    std::array<Point, 8> children;
 
     // Initialize
     distanceToStartMapUnchecked(start.row, start.column) = 0.0;
@@ -155,10 +163,10 @@ void generatePaths(py::array_t<int64_t> startPoint,
         queue.pop();
 
         // Add children
-        std::vector<Point> children =
-            getChildren(node.point, freespaceMapUnchecked, visitedMapUnchecked, rowCount, columnCount);
+        size_t childCount =
+            getChildren(node.point, freespaceMapUnchecked, visitedMapUnchecked, rowCount, columnCount, children);
 
-        for (unsigned int i = 0; i < children.size(); i++)
+        for (size_t i = 0; i < childCount; i++)
         {
 
             Point child = children[i];
@@ -211,9 +219,843 @@ std::vector<std::pair<int64_t, int64_t>> unrollPath(py::array_t<int64_t> endPoin
     return path;
 }
 
+// Occupancy grid view used by the goal-directed planners, cells outside of the map are not free
+struct Grid
+{
+    const uint8_t* data;
+    int64_t rowCount;
+    int64_t columnCount;
+
+    bool isFree(int64_t row, int64_t column) const
+    {
+        return row >= 0 && row < rowCount && column >= 0 && column < columnCount && data[row * columnCount + column];
+    }
+
+    int64_t index(int64_t row, int64_t column) const
+    {
+        return row * columnCount + column;
+    }
+};
+
+
+struct OpenListItem
+{
+    float priority;
+    float distanceToStart;
+    int64_t index;
+};
+
+
+// Orders the open list as a min-heap on priority, preferring nodes further from the start on ties
+struct OpenListCompare
+{
+    bool operator()(const OpenListItem& a, const OpenListItem& b) const
+    {
+        return a.priority > b.priority || (a.priority == b.priority && a.distanceToStart < b.distanceToStart);
+    }
+};
+
+
+// Largest map the search buffers can address, cell indices are stored as 32-bit parents
+const int64_t kMaxSearchCellCount = std::numeric_limits<int32_t>::max();
+
+
+// Per-cell search state reused between queries, 12 bytes per cell. Entries are only valid when their
+// stamp matches the current search (open) or the one after it (closed), so starting a new search on a
+// map of the same size does not clear anything.
+struct SearchBuffers
+{
+    std::vector<float> distanceToStart;
+    std::vector<int32_t> parent;
+    std::vector<uint32_t> cellStamp;
+    std::vector<OpenListItem> openList;
+    uint32_t stamp = 0;
+
+    void reset(size_t cellCount)
+    {
+        if (distanceToStart.size() != cellCount)
+        {
+            distanceToStart.assign(cellCount, 0.0f);
+            parent.assign(cellCount, -1);
+            cellStamp.assign(cellCount, 0);
+            openList.reserve(std::max<size_t>(openList.capacity(), 1024));
+            stamp = 0;
+        }
+        // Each search uses two stamp values, wrap around before the closed stamp overflows
+        stamp += 2;
+        if (stamp < 2)
+        {
+            std::fill(cellStamp.begin(), cellStamp.end(), 0);
+            stamp = 2;
+        }
+        openList.clear();
+    }
+
+    bool isOpen(int64_t index) const
+    {
+        return cellStamp[index] == stamp;
+    }
+
+    bool isClosed(int64_t index) const
+    {
+        return cellStamp[index] == stamp + 1;
+    }
+
+    void push(int64_t index, float distance, float priority, int64_t parentIndex)
+    {
+        distanceToStart[index] = distance;
+        parent[index] = static_cast<int32_t>(parentIndex);
+        cellStamp[index] = stamp;
+        openList.push_back({ priority, distance, index });
+        std::push_heap(openList.begin(), openList.end(), OpenListCompare());
+    }
+
+    // Pushes the node if it was not reached yet or if the new distance is shorter
+    void relax(int64_t index, float distance, float priority, int64_t parentIndex)
+    {
+        if (isClosed(index))
+        {
+            return;
+        }
+        if (isOpen(index) && distanceToStart[index] <= distance)
+        {
+            return;
+        }
+        push(index, distance, priority, parentIndex);
+    }
+
+    // Pops the closest open node, skipping entries superseded by a shorter distance
+    bool pop(OpenListItem& item)
+    {
+        while (!openList.empty())
+        {
+            std::pop_heap(openList.begin(), openList.end(), OpenListCompare());
+            item = openList.back();
+            openList.pop_back();
+            if (!isClosed(item.index) && item.distanceToStart == distanceToStart[item.index])
+            {
+                cellStamp[item.index] = stamp + 1;
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+
+const double kSqrt2 = std::sqrt(2.0);
+const float kSqrt2f = static_cast<float>(kSqrt2);
+
+
+// Shortest 8-connected distance between two cells on an empty grid
+double getOctileDistance(int64_t rowOffset, int64_t columnOffset)
+{
+    int64_t a = std::abs(rowOffset);
+    int64_t b = std::abs(columnOffset);
+    return static_cast<double>(std::max(a, b) - std::min(a, b)) + kSqrt2 * static_cast<double>(std::min(a, b));
+}
+
+
+int64_t getSign(int64_t value)
+{
+    return (value > 0) - (value < 0);
+}
+
+
+// Unrolls the parents from the goal, filling the straight and diagonal segments between jump points
+std::vector<Point> unrollSearchPath(const Grid& grid, const SearchBuffers& buffers, int64_t goalIndex)
+{
+    std::vector<Point> path;
+    int64_t index = goalIndex;
+    while (index >= 0)
+    {
+        Point point = { index / grid.columnCount, index % grid.columnCount };
+        const int64_t parentIndex = buffers.parent[index];
+        if (parentIndex >= 0)
+        {
+            const Point parent = { parentIndex / grid.columnCount, parentIndex % grid.columnCount };
+            const int64_t rowStep = getSign(parent.row - point.row);
+            const int64_t columnStep = getSign(parent.column - point.column);
+            while (!(point == parent))
+            {
+                path.push_back(point);
+                point = { point.row + rowStep, point.column + columnStep };
+            }
+        }
+        else
+        {
+            path.push_back(point);
+        }
+        index = parentIndex;
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+
+// A* over the 8-connected grid with the same move costs as generatePaths
+bool searchAStar(const Grid& grid, Point start, Point goal, SearchBuffers& buffers)
+{
+    static const int64_t kRowSteps[8] = { -1, -1, -1, 0, 0, 1, 1, 1 };
+    static const int64_t kColumnSteps[8] = { -1, 0, 1, -1, 1, -1, 0, 1 };
+
+    buffers.reset(static_cast<size_t>(grid.rowCount * grid.columnCount));
+    const int64_t goalIndex = grid.index(goal.row, goal.column);
+    buffers.push(grid.index(start.row, start.column), 0.0f,
+                 static_cast<float>(getOctileDistance(goal.row - start.row, goal.column - start.column)), -1);
+
+    OpenListItem node;
+    while (buffers.pop(node))
+    {
+        if (node.index == goalIndex)
+        {
+            return true;
+        }
+        const int64_t row = node.index / grid.columnCount;
+        const int64_t column = node.index % grid.columnCount;
+        for (int i = 0; i < 8; i++)
+        {
+            const int64_t childRow = row + kRowSteps[i];
+            const int64_t childColumn = column + kColumnSteps[i];
+            if (!grid.isFree(childRow, childColumn))
+            {
+                continue;
+            }
+            const float distance =
+                node.distanceToStart + ((kRowSteps[i] != 0 && kColumnSteps[i] != 0) ? kSqrt2f : 1.0f);
+            const float heuristic =
+                static_cast<float>(getOctileDistance(goal.row - childRow, goal.column - childColumn));
+            buffers.relax(grid.index(childRow, childColumn), distance, distance + heuristic, node.index);
+        }
+    }
+    return false;
+}
+
+
+// Moves from (row, column) in the given direction until a jump point is found. Diagonal moves
+// are allowed next to obstacles, matching the moves of generatePaths. Returns -1 if the move
+// runs into an obstacle or out of the map without finding a jump point.
+int64_t jump(const Grid& grid, int64_t row, int64_t column, int64_t rowStep, int64_t columnStep, const Point& goal)
+{
+    while (true)
+    {
+        row += rowStep;
+        column += columnStep;
+        if (!grid.isFree(row, column))
+        {
+            return -1;
+        }
+        if (row == goal.row && column == goal.column)
+        {
+            return grid.index(row, column);
+        }
+
+        if (rowStep != 0 && columnStep != 0)
+        {
+            // Forced neighbors behind the diagonal move
+            if ((grid.isFree(row + rowStep, column - columnStep) && !grid.isFree(row, column - columnStep)) ||
+                (grid.isFree(row - rowStep, column + columnStep) && !grid.isFree(row - rowStep, column)))
+            {
+                return grid.index(row, column);
+            }
+            // Jump points reachable from the horizontal and vertical components
+            if (jump(grid, row, column, 0, columnStep, goal) >= 0 || jump(grid, row, column, rowStep, 0, goal) >= 0)
+            {
+                return grid.index(row, column);
+            }
+        }
+        else if (columnStep != 0)
+        {
+            if ((grid.isFree(row + 1, column + columnStep) && !grid.isFree(row + 1, column)) ||
+                (grid.isFree(row - 1, column + columnStep) && !grid.isFree(row - 1, column)))
+            {
+                return grid.index(row, column);
+            }
+        }
+        else
+        {
+            if ((grid.isFree(row + rowStep, column + 1) && !grid.isFree(row, column + 1)) ||
+                (grid.isFree(row + rowStep, column - 1) && !grid.isFree(row, column - 1)))
+            {
+                return grid.index(row, column);
+            }
+        }
+    }
+}
+
+
+// Directions worth exploring from a node given the direction it was reached from
+size_t getPrunedDirections(const Grid& grid,
+                           int64_t row,
+                           int64_t column,
+                           int64_t rowStep,
+                           int64_t columnStep,
+                           std::array<std::pair<int64_t, int64_t>, 8>& directions)
+{
+    size_t count = 0;
+    if (rowStep == 0 && columnStep == 0)
+    {
+        // Start node, explore every direction
+        for (int64_t r = -1; r <= 1; r++)
+        {
+            for (int64_t c = -1; c <= 1; c++)
+            {
+                if ((r != 0 || c != 0) && grid.isFree(row + r, column + c))
+                {
+                    directions[count++] = { r, c };
+                }
+            }
+        }
+    }
+    else if (rowStep != 0 && columnStep != 0)
+    {
+        if (grid.isFree(row + rowStep, column))
+            directions[count++] = { rowStep, 0 };
+        if (grid.isFree(row, column + columnStep))
+            directions[count++] = { 0, columnStep };
+        if (grid.isFree(row + rowStep, column + columnStep))
+            directions[count++] = { rowStep, columnStep };
+        if (!grid.isFree(row, column - columnStep) && grid.isFree(row + rowStep, column - columnStep))
+            directions[count++] = { rowStep, -columnStep };
+        if (!grid.isFree(row - rowStep, column) && grid.isFree(row - rowStep, column + columnStep))
+            directions[count++] = { -rowStep, columnStep };
+    }
+    else if (columnStep != 0)
+    {
+        if (grid.isFree(row, column + columnStep))
+            directions[count++] = { 0, columnStep };
+        if (!grid.isFree(row + 1, column) && grid.isFree(row + 1, column + columnStep))
+            directions[count++] = { 1, columnStep };
+        if (!grid.isFree(row - 1, column) && grid.isFree(row - 1, column + columnStep))
+            directions[count++] = { -1, columnStep };
+    }
+    else
+    {
+        if (grid.isFree(row + rowStep, column))
+            directions[count++] = { rowStep, 0 };
+        if (!grid.isFree(row, column + 1) && grid.isFree(row + rowStep, column + 1))
+            directions[count++] = { rowStep, 1 };
+        if (!grid.isFree(row, column - 1) && grid.isFree(row + rowStep, column - 1))
+            directions[count++] = { rowStep, -1 };
+    }
+    return count;
+}
+
+
+// Jump Point Search over the 8-connected grid, only jump points are pushed on the open list
+bool searchJumpPoint(const Grid& grid, Point start, Point goal, SearchBuffers& buffers)
+{
+    buffers.reset(static_cast<size_t>(grid.rowCount * grid.columnCount));
+    const int64_t goalIndex = grid.index(goal.row, goal.column);
+    buffers.push(grid.index(start.row, start.column), 0.0f,
+                 static_cast<float>(getOctileDistance(goal.row - start.row, goal.column - start.column)), -1);
+
+    std::array<std::pair<int64_t, int64_t>, 8> directions;
+    OpenListItem node;
+    while (buffers.pop(node))
+    {
+        if (node.index == goalIndex)
+        {
+            return true;
+        }
+        const int64_t row = node.index / grid.columnCount;
+        const int64_t column = node.index % grid.columnCount;
+        int64_t rowStep = 0;
+        int64_t columnStep = 0;
+        const int64_t parentIndex = buffers.parent[node.index];
+        if (parentIndex >= 0)
+        {
+            rowStep = getSign(row - parentIndex / grid.columnCount);
+            columnStep = getSign(column - parentIndex % grid.columnCount);
+        }
+
+        const size_t directionCount = getPrunedDirections(grid, row, column, rowStep, columnStep, directions);
+        for (size_t i = 0; i < directionCount; i++)
+        {
+            const int64_t jumpIndex = jump(grid, row, column, directions[i].first, directions[i].second, goal);
+            if (jumpIndex < 0)
+            {
+                continue;
+            }
+            const int64_t jumpRow = jumpIndex / grid.columnCount;
+            const int64_t jumpColumn = jumpIndex % grid.columnCount;
+            const float distance =
+                node.distanceToStart + static_cast<float>(getOctileDistance(jumpRow - row, jumpColumn - column));
+            const float heuristic =
+                static_cast<float>(getOctileDistance(goal.row - jumpRow, goal.column - jumpColumn));
+            buffers.relax(jumpIndex, distance, distance + heuristic, node.index);
+        }
+    }
+    return false;
+}
+
+
+// Runs worker(taskIndex, workerIndex) for every task, spread over numWorkers threads
+template <typename Worker>
+void runParallel(size_t numTasks, size_t numWorkers, Worker&& worker)
+{
+    numWorkers = std::max<size_t>(1, std::min(numWorkers, numTasks));
+    if (numWorkers == 1)
+    {
+        for (size_t i = 0; i < numTasks; i++)
+        {
+            worker(i, 0);
+        }
+        return;
+    }
+
+    std::atomic<size_t> nextTask(0);
+    std::vector<std::thread> threads;
+    threads.reserve(numWorkers - 1);
+    auto run = [&](size_t workerIndex)
+    {
+        for (size_t i = nextTask++; i < numTasks; i = nextTask++)
+        {
+            worker(i, workerIndex);
+        }
+    };
+    for (size_t w = 1; w < numWorkers; w++)
+    {
+        threads.emplace_back(run, w);
+    }
+    run(0);
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+
+// One dimensional squared Euclidean distance transform (Felzenszwalb and Huttenlocher) of count
+// samples read and written with the given stride. vertices and boundaries are scratch storage.
+void distanceTransform1d(float* values,
+                         int64_t count,
+                         int64_t stride,
+                         std::vector<float>& input,
+                         std::vector<int64_t>& vertices,
+                         std::vector<float>& boundaries)
+{
+    const float kInfinity = std::numeric_limits<float>::infinity();
+    input.resize(count);
+    vertices.resize(count);
+    boundaries.resize(count + 1);
+    for (int64_t i = 0; i < count; i++)
+    {
+        input[i] = values[i * stride];
+    }
+
+    int64_t k = -1;
+    for (int64_t q = 0; q < count; q++)
+    {
+        if (input[q] == kInfinity)
+        {
+            continue;
+        }
+        float s = -kInfinity;
+        while (k >= 0)
+        {
+            const int64_t v = vertices[k];
+            s = ((input[q] + static_cast<float>(q * q)) - (input[v] + static_cast<float>(v * v))) /
+                static_cast<float>(2 * (q - v));
+            if (s > boundaries[k])
+            {
+                break;
+            }
+            k--;
+        }
+        k++;
+        vertices[k] = q;
+        boundaries[k] = k == 0 ? -kInfinity : s;
+        boundaries[k + 1] = kInfinity;
+    }
+
+    if (k < 0)
+    {
+        return; // no finite samples, leave the values at infinity
+    }
+    int64_t j = 0;
+    for (int64_t q = 0; q < count; q++)
+    {
+        while (boundaries[j + 1] < static_cast<float>(q))
+        {
+            j++;
+        }
+        const int64_t v = vertices[j];
+        values[q * stride] = static_cast<float>((q - v) * (q - v)) + input[v];
+    }
+}
+
+
+// Euclidean distance in cells from every cell to the closest cell that is not free. Cells outside
+// of the map are not considered obstacles, distances are infinite on maps without obstacles.
+void computeObstacleDistance(const Grid& grid, size_t numWorkers, std::vector<float>& distances)
+{
+    const size_t cellCount = static_cast<size_t>(grid.rowCount * grid.columnCount);
+    distances.resize(cellCount);
+    for (size_t i = 0; i < cellCount; i++)
+    {
+        distances[i] = grid.data[i] ? std::numeric_limits<float>::infinity() : 0.0f;
+    }
+
+    struct Scratch
+    {
+        std::vector<float> input;
+        std::vector<int64_t> vertices;
+        std::vector<float> boundaries;
+    };
+    std::vector<Scratch> scratch(std::max<size_t>(1, numWorkers));
+    float* data = distances.data();
+
+    runParallel(static_cast<size_t>(grid.columnCount), numWorkers,
+                [&](size_t column, size_t worker)
+                {
+                    Scratch& s = scratch[worker];
+                    distanceTransform1d(
+                        data + column, grid.rowCount, grid.columnCount, s.input, s.vertices, s.boundaries);
+                });
+    runParallel(static_cast<size_t>(grid.rowCount), numWorkers,
+                [&](size_t row, size_t worker)
+                {
+                    Scratch& s = scratch[worker];
+                    distanceTransform1d(
+                        data + row * grid.columnCount, grid.columnCount, 1, s.input, s.vertices, s.boundaries);
+                });
+
+    for (size_t i = 0; i < cellCount; i++)
+    {
+        distances[i] = std::sqrt(distances[i]);
+    }
+}
+
+
+// Workers used by PathPlanner when no thread count is set. Each worker keeps 12 bytes of search
+// state per map cell, so large maps should not fan out to every core by default
+const size_t kDefaultMaxWorkers = 4;
+
+
+// Planner owning a freespace map, its obstacle distance transform and one set of search buffers
+// per worker, answering batches of start and end pairs in parallel. Queries run without the GIL, so
+// the cached state is guarded by a mutex and batches from several Python threads run one at a time
+class PathPlanner
+{
+public:
+    PathPlanner(const uint8_t* freespaceMap, int64_t rowCount, int64_t columnCount)
+        : m_freespace(freespaceMap, freespaceMap + rowCount * columnCount),
+          m_rowCount(rowCount),
+          m_columnCount(columnCount)
+    {
+    }
+
+    int64_t getRowCount() const
+    {
+        return m_rowCount;
+    }
+
+    int64_t getColumnCount() const
+    {
+        return m_columnCount;
+    }
+
+    // Number of worker threads, 0 uses the hardware concurrency capped to kDefaultMaxWorkers
+    void setNumThreads(size_t numThreads)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_numThreads = numThreads;
+        if (m_searchBuffers.size() > getNumWorkers())
+        {
+            m_searchBuffers.resize(getNumWorkers());
+            m_searchBuffers.shrink_to_fit();
+        }
+    }
+
+    // Cells closer than this distance in cells to an obstacle are not traversed
+    void setMinObstacleDistance(float distance)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (distance != m_minObstacleDistance)
+        {
+            m_minObstacleDistance = distance;
+            m_traversable.clear();
+        }
+    }
+
+    float getMinObstacleDistance() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_minObstacleDistance;
+    }
+
+    // Computed on first use and kept for the lifetime of the planner
+    const std::vector<float>& getObstacleDistance()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return getObstacleDistanceLocked();
+    }
+
+    bool contains(const Point& point) const
+    {
+        return point.row >= 0 && point.row < m_rowCount && point.column >= 0 && point.column < m_columnCount;
+    }
+
+    // Solves every query, paths of unreachable queries are empty
+    void findPaths(const std::vector<Point>& starts,
+                   const std::vector<Point>& ends,
+                   bool useJumpPointSearch,
+                   std::vector<std::vector<Point>>& paths)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const Grid grid = getTraversableGrid();
+        const size_t numWorkers = std::max<size_t>(1, std::min(getNumWorkers(), starts.size()));
+        // Buffers start empty and are sized by their first search, workers that get no query allocate nothing
+        if (m_searchBuffers.size() < numWorkers)
+        {
+            m_searchBuffers.resize(numWorkers);
+        }
+
+        paths.resize(starts.size());
+        runParallel(starts.size(), numWorkers,
+                    [&](size_t query, size_t worker)
+                    {
+                        const Point& start = starts[query];
+                        const Point& end = ends[query];
+                        std::vector<Point>& path = paths[query];
+                        path.clear();
+                        if (!grid.isFree(start.row, start.column) || !grid.isFree(end.row, end.column))
+                        {
+                            return;
+                        }
+                        SearchBuffers& buffers = m_searchBuffers[worker];
+                        bool found = useJumpPointSearch ? searchJumpPoint(grid, start, end, buffers) :
+                                                          searchAStar(grid, start, end, buffers);
+                        if (found)
+                        {
+                            path = unrollSearchPath(grid, buffers, grid.index(end.row, end.column));
+                        }
+                    });
+    }
+
+private:
+    const std::vector<float>& getObstacleDistanceLocked()
+    {
+        if (m_obstacleDistance.empty() && !m_freespace.empty())
+        {
+            computeObstacleDistance({ m_freespace.data(), m_rowCount, m_columnCount }, getNumWorkers(),
+                                    m_obstacleDistance);
+        }
+        return m_obstacleDistance;
+    }
+
+    size_t getNumWorkers() const
+    {
+        if (m_numThreads > 0)
+        {
+            return m_numThreads;
+        }
+        return std::min<size_t>(kDefaultMaxWorkers, std::max(1u, std::thread::hardware_concurrency()));
+    }
+
+    // Freespace map with the cells too close to obstacles removed
+    Grid getTraversableGrid()
+    {
+        if (m_minObstacleDistance <= 0.0f)
+        {
+            return { m_freespace.data(), m_rowCount, m_columnCount };
+        }
+        if (m_traversable.empty())
+        {
+            const std::vector<float>& distances = getObstacleDistanceLocked();
+            m_traversable.resize(m_freespace.size());
+            for (size_t i = 0; i < m_freespace.size(); i++)
+            {
+                m_traversable[i] = m_freespace[i] && distances[i] >= m_minObstacleDistance;
+            }
+        }
+        return { m_traversable.data(), m_rowCount, m_columnCount };
+    }
+
+    std::vector<uint8_t> m_freespace;
+    int64_t m_rowCount;
+    int64_t m_columnCount;
+    size_t m_numThreads = 0;
+    float m_minObstacleDistance = 0.0f;
+    std::vector<float> m_obstacleDistance;
+    std::vector<uint8_t> m_traversable;
+    std::vector<SearchBuffers> m_searchBuffers;
+    mutable std::mutex m_mutex;
+};
+
+
+// Search state of the calling thread, kept alive between queries so the open list and per-cell
+// buffers are only allocated when the map size changes
+SearchBuffers& getSearchBuffers()
+{
+    thread_local SearchBuffers buffers;
+    return buffers;
+}
+
+py::array_t<int64_t> findPath(py::array_t<int64_t> startPoint,
+                              py::array_t<int64_t> endPoint,
+                              py::array_t<uint8_t, py::array::c_style | py::array::forcecast> freespaceMap,
+                              bool useJumpPointSearch)
+{
+    if (freespaceMap.ndim() != 2)
+    {
+        throw py::value_error("freespace map must be a 2D array");
+    }
+    const Grid grid = { freespaceMap.data(), freespaceMap.shape(0), freespaceMap.shape(1) };
+    if (grid.rowCount * grid.columnCount > kMaxSearchCellCount)
+    {
+        throw py::value_error("freespace map has too many cells");
+    }
+    auto startPointUnchecked = startPoint.unchecked<1>();
+    auto endPointUnchecked = endPoint.unchecked<1>();
+    const Point start = { startPointUnchecked(0), startPointUnchecked(1) };
+    const Point end = { endPointUnchecked(0), endPointUnchecked(1) };
+    if (start.row < 0 || start.row >= grid.rowCount || start.column < 0 || start.column >= grid.columnCount ||
+        end.row < 0 || end.row >= grid.rowCount || end.column < 0 || end.column >= grid.columnCount)
+    {
+        throw py::value_error("start and end points must be inside the freespace map");
+    }
+
+    std::vector<Point> path;
+    if (grid.isFree(start.row, start.column) && grid.isFree(end.row, end.column))
+    {
+        py::gil_scoped_release release;
+        SearchBuffers& buffers = getSearchBuffers();
+        bool found = useJumpPointSearch ? searchJumpPoint(grid, start, end, buffers) :
+                                          searchAStar(grid, start, end, buffers);
+        if (found)
+        {
+            path = unrollSearchPath(grid, buffers, grid.index(end.row, end.column));
+        }
+    }
+
+    py::array_t<int64_t> output({ static_cast<py::ssize_t>(path.size()), static_cast<py::ssize_t>(2) });
+    auto outputUnchecked = output.mutable_unchecked<2>();
+    for (size_t i = 0; i < path.size(); i++)
+    {
+        outputUnchecked(i, 0) = path[i].row;
+        outputUnchecked(i, 1) = path[i].column;
+    }
+    return output;
+}
+
+py::array_t<int64_t> findPathAStar(py::array_t<int64_t> startPoint,
+                                   py::array_t<int64_t> endPoint,
+                                   py::array_t<uint8_t, py::array::c_style | py::array::forcecast> freespaceMap)
+{
+    return findPath(startPoint, endPoint, freespaceMap, false);
+}
+
+py::array_t<int64_t> findPathJumpPoint(py::array_t<int64_t> startPoint,
+                                       py::array_t<int64_t> endPoint,
+                                       py::array_t<uint8_t, py::array::c_style | py::array::forcecast> freespaceMap)
+{
+    return findPath(startPoint, endPoint, freespaceMap, true);
+}
+
+std::vector<Point> toPoints(const PathPlanner& planner, py::array_t<int64_t> points, const char* name)
+{
+    if (points.ndim() != 2 || points.shape(1) != 2)
+    {
+        throw py::value_error(std::string(name) + " must be an (N, 2) array");
+    }
+    auto pointsUnchecked = points.unchecked<2>();
+    std::vector<Point> output(points.shape(0));
+    for (size_t i = 0; i < output.size(); i++)
+    {
+        output[i] = { pointsUnchecked(i, 0), pointsUnchecked(i, 1) };
+        if (!planner.contains(output[i]))
+        {
+            throw py::value_error(std::string(name) + " must be inside the freespace map");
+        }
+    }
+    return output;
+}
+
+py::tuple findPathsBatch(PathPlanner& planner,
+                         py::array_t<int64_t> startPoints,
+                         py::array_t<int64_t> endPoints,
+                         bool useJumpPointSearch)
+{
+    const std::vector<Point> starts = toPoints(planner, startPoints, "start points");
+    const std::vector<Point> ends = toPoints(planner, endPoints, "end points");
+    if (starts.size() != ends.size())
+    {
+        throw py::value_error("start and end points must have the same length");
+    }
+
+    std::vector<std::vector<Point>> paths;
+    {
+        py::gil_scoped_release release;
+        planner.findPaths(starts, ends, useJumpPointSearch, paths);
+    }
+
+    py::array_t<int64_t> offsets(static_cast<py::ssize_t>(paths.size() + 1));
+    auto offsetsUnchecked = offsets.mutable_unchecked<1>();
+    offsetsUnchecked(0) = 0;
+    for (size_t i = 0; i < paths.size(); i++)
+    {
+        offsetsUnchecked(i + 1) = offsetsUnchecked(i) + static_cast<int64_t>(paths[i].size());
+    }
+
+    const py::ssize_t pointCount = static_cast<py::ssize_t>(offsetsUnchecked(paths.size()));
+    py::array_t<int64_t> points({ pointCount, static_cast<py::ssize_t>(2) });
+    auto pointsUnchecked = points.mutable_unchecked<2>();
+    py::ssize_t row = 0;
+    for (const auto& path : paths)
+    {
+        for (const auto& point : path)
+        {
+            pointsUnchecked(row, 0) = point.row;
+            pointsUnchecked(row, 1) = point.column;
+            row++;
+        }
+    }
+    return py::make_tuple(points, offsets);
+}
+
 PYBIND11_MODULE(_path_planner, m)
 {
     m.doc() = "MobilityGen Path Planner C++ Bindings";
     m.def("generate_paths", &generatePaths, "Generate paths");
     m.def("unroll_path", &unrollPath, "Unroll a path");
+    m.def("find_path_astar", &findPathAStar, "Find the shortest path between two points with A*");
+    m.def("find_path_jps", &findPathJumpPoint, "Find the shortest path between two points with Jump Point Search");
+
+    py::class_<PathPlanner>(m, "PathPlanner", "Planner answering batches of path queries on one freespace map")
+        .def(py::init(
+                 [](py::array_t<uint8_t, py::array::c_style | py::array::forcecast> freespaceMap)
+                 {
+                     if (freespaceMap.ndim() != 2)
+                     {
+                         throw py::value_error("freespace map must be a 2D array");
+                     }
+                     if (freespaceMap.shape(0) * freespaceMap.shape(1) > kMaxSearchCellCount)
+                     {
+                         throw py::value_error("freespace map has too many cells");
+                     }
+                     return new PathPlanner(freespaceMap.data(), freespaceMap.shape(0), freespaceMap.shape(1));
+                 }),
+             "Create a planner owning a copy of the freespace map")
+        .def("set_num_threads", &PathPlanner::setNumThreads, "Set the number of worker threads, 0 uses up to 4 cores")
+        .def("set_min_obstacle_distance", &PathPlanner::setMinObstacleDistance,
+             "Set the distance in cells to the closest obstacle below which cells are not traversed")
+        .def("get_min_obstacle_distance", &PathPlanner::getMinObstacleDistance,
+             "Get the distance in cells to the closest obstacle below which cells are not traversed")
+        .def(
+            "get_obstacle_distance",
+            [](PathPlanner& planner)
+            {
+                const std::vector<float>& distances = planner.getObstacleDistance();
+                py::array_t<float> output({ static_cast<py::ssize_t>(planner.getRowCount()),
+                                            static_cast<py::ssize_t>(planner.getColumnCount()) });
+                std::copy(distances.begin(), distances.end(), output.mutable_data());
+                return output;
+            },
+            "Get the distance in cells from every cell to the closest cell that is not free")
+        .def("find_paths", &findPathsBatch, py::arg("start_points"), py::arg("end_points"),
+             py::arg("use_jump_point_search") = true,
+             "Find the shortest paths of a batch of (start, end) pairs in parallel, returning the concatenated "
+             "(M, 2) path points and the (N + 1) offsets of each path");
 }
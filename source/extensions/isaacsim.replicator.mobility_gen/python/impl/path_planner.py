@@ -61,6 +61,79 @@ def generate_paths(start: Tuple[int, int], freespace: np.ndarray) -> GeneratePat
     return GeneratePathsOutput(visited=visited, distance_to_start=distance_to_start, prev_i=prev_i, prev_j=prev_j)
 
 
+def find_path(start: Tuple[int, int], end: Tuple[int, int], freespace: np.ndarray, method: str = "jps") -> np.ndarray:
+    """Find the shortest 8-connected path between two cells of a freespace map.
+
+    Unlike generate_paths, the search is goal-directed and stops once the end cell is reached.
+
+    Args:
+        start: Start cell as (row, column).
+        end: End cell as (row, column).
+        freespace: 2D array, non-zero for cells that can be traversed.
+        method: "astar" for A*, or "jps" for Jump Point Search.
+
+    Returns:
+        (N, 2) array of cells from start to end, empty if the end cell cannot be reached.
+    """
+    start = np.array([start[0], start[1]], dtype=np.int64)
+    end = np.array([end[0], end[1]], dtype=np.int64)
+    freespace = np.ascontiguousarray(freespace, dtype=np.uint8)
+    if method == "astar":
+        return _path_planner.find_path_astar(start, end, freespace)
+    if method == "jps":
+        return _path_planner.find_path_jps(start, end, freespace)
+    raise ValueError(f"Unknown path planning method: {method}")
+
+
+class PathPlanner:
+    """Planner answering batches of path queries on one freespace map.
+
+    The planner keeps a copy of the map, its obstacle distance transform and the search buffers
+    of each worker thread between calls, so sampling many paths on the same map does not
+    rebuild any per-cell state.
+
+    A planner can be shared between Python threads. Queries run without the GIL, but calls on the
+    same planner are serialized, so threads that need to plan concurrently should own a planner each.
+
+    Args:
+        freespace: 2D array, non-zero for cells that can be traversed.
+        min_obstacle_distance: Cells closer than this distance in cells to a cell that is not free are not traversed.
+        num_threads: Number of worker threads, 0 uses up to 4 cores.
+    """
+
+    def __init__(self, freespace: np.ndarray, min_obstacle_distance: float = 0.0, num_threads: int = 0):
+        self._planner = _path_planner.PathPlanner(np.ascontiguousarray(freespace, dtype=np.uint8))
+        self._planner.set_min_obstacle_distance(min_obstacle_distance)
+        self._planner.set_num_threads(num_threads)
+
+    def obstacle_distance(self) -> np.ndarray:
+        """Distance in cells from every cell to the closest cell that is not free."""
+        return self._planner.get_obstacle_distance()
+
+    def find_paths(self, starts: np.ndarray, ends: np.ndarray, method: str = "jps") -> Tuple[np.ndarray, np.ndarray]:
+        """Find the shortest paths between pairs of cells in parallel.
+
+        Args:
+            starts: (N, 2) array of start cells as (row, column).
+            ends: (N, 2) array of end cells as (row, column).
+            method: "astar" for A*, or "jps" for Jump Point Search.
+
+        Returns:
+            (M, 2) array with the cells of all paths concatenated, and (N + 1) array of offsets where
+            path i is points[offsets[i]:offsets[i + 1]]. Paths that cannot be found are empty.
+        """
+        if method not in ("astar", "jps"):
+            raise ValueError(f"Unknown path planning method: {method}")
+        starts = np.ascontiguousarray(np.reshape(starts, (-1, 2)), dtype=np.int64)
+        ends = np.ascontiguousarray(np.reshape(ends, (-1, 2)), dtype=np.int64)
+        return self._planner.find_paths(starts, ends, method == "jps")
+
+    @staticmethod
+    def split_paths(points: np.ndarray, offsets: np.ndarray) -> List[np.ndarray]:
+        """Split the output of find_paths into one array per path."""
+        return np.split(points, offsets[1:-1])
+
+
 def compress_path(path: np.ndarray, eps=1e-3):
     pref = path[1:-1]
     pnext = path[2:]
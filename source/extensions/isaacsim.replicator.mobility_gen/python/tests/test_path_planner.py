@@ -21,7 +21,12 @@ import numpy as np
 #   For most things refer to unittest docs: https://docs.python.org/3/library/unittest.html
 import omni.kit.test
 import omni.usd
-from isaacsim.replicator.mobility_gen.impl.path_planner import compress_path, generate_paths
+from isaacsim.replicator.mobility_gen.impl.path_planner import (
+    PathPlanner,
+    compress_path,
+    find_path,
+    generate_paths,
+)
 
 
 # Having a test class dervived from omni.kit.test.AsyncTestCase declared on the root of module will make it auto-discoverable by omni.kit.test
@@ -73,6 +78,84 @@ class TestPathPlanner(omni.kit.test.AsyncTestCase):
 
         self.assertTrue(np.allclose(path, ground_truth))
 
+    def path_length(self, path):
+        steps = np.abs(np.diff(path, axis=0))
+        self.assertTrue(np.all(steps.max(axis=1) == 1))
+        return float(np.sum(np.where(steps.sum(axis=1) == 2, np.sqrt(2.0), 1.0)))
+
+    async def test_find_path_l_shaped(self):
+
+        freespace = np.array([[1, 0, 0], [1, 0, 0], [1, 1, 1]]).astype(np.uint8)
+        ground_truth = np.array([[0, 0], [1, 0], [2, 1], [2, 2]])
+
+        for method in ["astar", "jps"]:
+            path = find_path(start=(0, 0), end=(2, 2), freespace=freespace, method=method)
+            self.assertTrue(np.allclose(path, ground_truth))
+
+    async def test_find_path_unreachable(self):
+
+        freespace = np.array([[1, 0, 1], [1, 0, 1], [1, 0, 1]]).astype(np.uint8)
+
+        for method in ["astar", "jps"]:
+            path = find_path(start=(0, 0), end=(2, 2), freespace=freespace, method=method)
+            self.assertEqual(path.shape, (0, 2))
+
+    async def test_find_path_matches_generate_paths(self):
+
+        rng = np.random.default_rng(0)
+        for _ in range(20):
+            freespace = (rng.random((40, 60)) > 0.3).astype(np.uint8)
+            free_cells = np.argwhere(freespace)
+            start = tuple(free_cells[rng.integers(len(free_cells))])
+            end = tuple(free_cells[rng.integers(len(free_cells))])
+
+            output = generate_paths(start=start, freespace=freespace)
+            for method in ["astar", "jps"]:
+                path = find_path(start=start, end=end, freespace=freespace, method=method)
+                if not output.visited[end]:
+                    self.assertEqual(len(path), 0)
+                    continue
+                self.assertTrue(np.all(path[0] == start))
+                self.assertTrue(np.all(path[-1] == end))
+                self.assertTrue(np.all(freespace[path[:, 0], path[:, 1]]))
+                self.assertAlmostEqual(self.path_length(path), output.distance_to_start[end], places=3)
+
+    async def test_path_planner_batch_matches_single_queries(self):
+
+        rng = np.random.default_rng(1)
+        freespace = (rng.random((50, 50)) > 0.25).astype(np.uint8)
+        free_cells = np.argwhere(freespace)
+        starts = free_cells[rng.integers(len(free_cells), size=16)]
+        ends = free_cells[rng.integers(len(free_cells), size=16)]
+
+        planner = PathPlanner(freespace, num_threads=4)
+        for method in ["astar", "jps"]:
+            points, offsets = planner.find_paths(starts, ends, method=method)
+            self.assertEqual(offsets.shape, (len(starts) + 1,))
+            self.assertEqual(offsets[-1], len(points))
+            paths = PathPlanner.split_paths(points, offsets)
+            for start, end, path in zip(starts, ends, paths):
+                expected = find_path(start=start, end=end, freespace=freespace, method=method)
+                self.assertTrue(np.array_equal(path.reshape(-1, 2), expected))
+
+    async def test_path_planner_obstacle_distance(self):
+
+        freespace = np.ones((5, 7), dtype=np.uint8)
+        freespace[2, 3] = 0
+
+        planner = PathPlanner(freespace)
+        distance = planner.obstacle_distance()
+        rows, columns = np.indices(freespace.shape)
+        self.assertTrue(np.allclose(distance, np.hypot(rows - 2, columns - 3)))
+
+        # Paths keep the requested clearance from obstacles
+        planner = PathPlanner(freespace, min_obstacle_distance=1.5)
+        points, offsets = planner.find_paths(np.array([[2, 0]]), np.array([[2, 6]]))
+        self.assertEqual(len(offsets), 2)
+        self.assertEqual(points[0].tolist(), [2, 0])
+        self.assertEqual(points[-1].tolist(), [2, 6])
+        self.assertTrue(np.all(distance[points[:, 0], points[:, 1]] >= 1.5))
+
     async def test_compress_path_line(self):
 
         # 111 -> 1-1
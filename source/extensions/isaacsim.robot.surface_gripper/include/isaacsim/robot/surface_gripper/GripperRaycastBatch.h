@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <foundation/PxVec3.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace physx
+{
+class PxBatchQueryExt;
+class PxRigidActor;
+class PxScene;
+}
+
+namespace isaacsim
+{
+namespace robot
+{
+namespace surface_gripper
+{
+
+/**
+ * @class GripperRaycastBatch
+ * @brief Raycasts of gripper attachment points, executed together as one batched scene query per physics scene
+ * @details
+ * Each raycast starts at its attachment point moved along the ray by the clearance offset. A raycast that hits the
+ * actor of its own gripper is cast again with the clearance offset increased by a millimeter until it clears it, in
+ * further batches that contain only those raycasts. The batched query of each scene is kept across physics steps and
+ * only created again when a step casts more rays in that scene than it has room for.
+ */
+class GripperRaycastBatch
+{
+public:
+    GripperRaycastBatch() = default;
+    GripperRaycastBatch(const GripperRaycastBatch&) = delete;
+    GripperRaycastBatch& operator=(const GripperRaycastBatch&) = delete;
+
+    /**
+     * @brief Releases the batched scene queries.
+     */
+    ~GripperRaycastBatch();
+    /**
+     * @brief Result of a raycast.
+     */
+    struct Hit
+    {
+        physx::PxRigidActor* actor = nullptr; ///< Closest actor hit, nullptr if nothing was hit
+        float distance = 0.0f; ///< Distance from the ray start to the hit
+        float clearanceOffset = 0.0f; ///< Clearance offset the ray was cast with after skipping the gripper itself
+    };
+
+    /**
+     * @brief Adds a raycast to the batch.
+     * @param[in] scene Physics scene to query
+     * @param[in] origin Position of the attachment point in world space
+     * @param[in] direction Unit direction of the ray in world space
+     * @param[in] clearanceOffset Distance along the ray to skip before testing for hits
+     * @param[in] maxDistance Maximum distance from the attachment point to report hits at
+     * @param[in] ignoredActor Actor of the gripper, which is skipped by increasing the clearance offset
+     * @return Index of the raycast to get its result with getHit()
+     */
+    size_t addRaycast(physx::PxScene* scene,
+                      const physx::PxVec3& origin,
+                      const physx::PxVec3& direction,
+                      float clearanceOffset,
+                      float maxDistance,
+                      const physx::PxRigidActor* ignoredActor);
+
+    /**
+     * @brief Casts all rays added since the last clear().
+     */
+    void execute();
+
+    /**
+     * @brief Gets the result of a raycast after execute().
+     * @param[in] index Index returned by addRaycast()
+     * @return Result of the raycast
+     */
+    const Hit& getHit(size_t index) const
+    {
+        return m_hits[index];
+    }
+
+    /**
+     * @brief Gets the number of raycasts in the batch.
+     * @return Number of raycasts
+     */
+    size_t size() const
+    {
+        return m_hits.size();
+    }
+
+    /**
+     * @brief Removes all raycasts, keeping the allocated storage for the next physics step.
+     */
+    void clear();
+
+    /**
+     * @brief Releases the batched scene queries, which must be done before their physics scenes are released.
+     */
+    void releaseQueries();
+
+private:
+    /**
+     * @brief Batched query of a physics scene and the number of raycasts it has room for.
+     */
+    struct SceneQuery
+    {
+        physx::PxScene* scene = nullptr;
+        physx::PxBatchQueryExt* query = nullptr;
+        size_t capacity = 0;
+    };
+
+    /**
+     * @brief Gets the batched query of a scene, creating it again if it has no room for the given raycasts.
+     * @param[in] scene Physics scene to query
+     * @param[in] count Number of raycasts to cast in one execution
+     * @return Batched query, nullptr if it could not be created
+     */
+    physx::PxBatchQueryExt* getQuery(physx::PxScene* scene, size_t count);
+
+    std::vector<SceneQuery> m_queries;
+    std::vector<physx::PxScene*> m_scenes;
+    std::vector<physx::PxVec3> m_origins;
+    std::vector<physx::PxVec3> m_directions;
+    std::vector<float> m_maxDistances;
+    std::vector<const physx::PxRigidActor*> m_ignoredActors;
+    std::vector<Hit> m_hits;
+    std::vector<size_t> m_pending;
+};
+
+} // namespace surface_gripper
+} // namespace robot
+} // namespace isaacsim
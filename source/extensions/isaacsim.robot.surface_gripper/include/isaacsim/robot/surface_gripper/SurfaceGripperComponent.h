@@ -19,6 +19,7 @@
 #include "isaacsim/core/includes/Component.h"
 #include "isaacsim/core/includes/UsdUtilities.h"
 #include "isaacsim/robot/schema/robot_schema.h"
+#include "isaacsim/robot/surface_gripper/GripperRaycastBatch.h"
 
 #include <extensions/PxJoint.h>
 #include <pxr/usd/usd/prim.h>
@@ -30,6 +31,8 @@
 #include <chrono>
 #include <map>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace isaacsim
@@ -130,9 +133,41 @@ public:
 
     /**
      * @brief Called each physics step to update gripper state
+     * @details Casts the rays of this gripper in a batch of its own, see the overload below to share one batch.
      */
     virtual void onPhysicsStep(double dt);
 
+    /**
+     * @brief Starts a physics step, adding the raycasts of the attachment points looking for objects to a batch
+     * @details The step is finished by onPhysicsStepComplete() once the batch has been executed, so the raycasts
+     * of all grippers run as one batched scene query.
+     * @param[in] dt Physics time step in seconds
+     * @param[in,out] raycasts Batch the raycasts are added to
+     */
+    virtual void onPhysicsStep(double dt, GripperRaycastBatch& raycasts);
+
+    /**
+     * @brief Finishes a physics step started by onPhysicsStep() with the results of the executed batch
+     * @param[in] raycasts Executed batch
+     */
+    virtual void onPhysicsStepComplete(const GripperRaycastBatch& raycasts);
+
+    /**
+     * @brief Called when one of the attachment points or the gripper changed, to refresh the cached attachment point
+     *        state at the next physics step
+     * @param[in] path Path of the changed prim or property
+     */
+    void onAttachmentPointChange(const pxr::SdfPath& path);
+
+    /**
+     * @brief Gets the paths of the attachment point joints found when the gripper started
+     * @return Paths of the D6 joints
+     */
+    const std::vector<pxr::SdfPath>& getAttachmentPaths() const
+    {
+        return m_attachmentPaths;
+    }
+
     /**
      * @brief Called before each tick to prepare sensor state
      */
@@ -193,6 +228,24 @@ private:
      */
     void updateAttachmentPoints();
 
+    /**
+     * @brief Resolves the PhysX joints, forward axes and clearance offsets of the attachment points if a change
+     * notice invalidated them
+     */
+    void updateAttachmentPointCache();
+
+    /**
+     * @brief Marks an attachment point as holding an object
+     * @param[in] index Index of the attachment point
+     */
+    void activateAttachmentPoint(size_t index);
+
+    /**
+     * @brief Marks an attachment point as free and waiting for its joint to settle
+     * @param[in] index Index of the attachment point
+     */
+    void deactivateAttachmentPoint(size_t index);
+
     /**
      * @brief Updates the list of already gripped objects from the USD relationship
      */
@@ -203,15 +256,34 @@ private:
      */
     void updateClosedGripper();
 
+    /**
+     * @brief Starts updating a closed gripper by adding its raycasts to the batch
+     * @param[in,out] raycasts Batch the raycasts are added to
+     */
+    void beginUpdateClosedGripper(GripperRaycastBatch& raycasts);
+
+    /**
+     * @brief Finishes updating a closed gripper with the results of the executed batch
+     * @param[in] raycasts Executed batch
+     */
+    void endUpdateClosedGripper(const GripperRaycastBatch& raycasts);
+
     /**
      * @brief Checks force limits on attachment joints and releases if limits are exceeded
      */
     void checkForceLimits();
 
     /**
-     * @brief Finds objects that can be gripped and attaches them
+     * @brief Adds a raycast along the forward axis of every free attachment point to the batch
+     * @param[in,out] raycasts Batch the raycasts are added to
+     */
+    void queueGripRaycasts(GripperRaycastBatch& raycasts);
+
+    /**
+     * @brief Attaches the objects hit by the raycasts added in queueGripRaycasts()
+     * @param[in] raycasts Executed batch
      */
-    void findObjectsToGrip();
+    void findObjectsToGrip(const GripperRaycastBatch& raycasts);
 
     /**
      * @brief Updates the gripper state when it's open
@@ -235,15 +307,34 @@ private:
     float m_maxGripDistance = 0.0f; ///< Maximum distance the gripper can check to grab an object
 
 
-    std::unordered_set<std::string> m_attachmentPoints; ///< List of D6 joints as attachment points
-    std::unordered_set<std::string> m_activeAttachmentPoints; ///< List of filtered bodies for gripping
-    std::unordered_set<std::string> m_inactiveAttachmentPoints; ///< List of filtered bodies for gripping
+    // Attachment point state, one entry per D6 joint in the order of the ATTACHMENT_POINTS relationship
+    std::vector<pxr::SdfPath> m_attachmentPaths; ///< Paths of the D6 joints
+    std::vector<physx::PxJoint*> m_attachmentJoints; ///< PhysX joints, nullptr if the joint has no PhysX object
+    std::vector<physx::PxVec3> m_attachmentAxes; ///< Forward axes in the joint frame
+    std::vector<float> m_attachmentClearanceOffsets; ///< Clearance offsets along the forward axes
+    std::vector<uint32_t> m_attachmentSettlingCounters; ///< Physics steps left before a joint has settled
+    std::vector<char> m_attachmentActive; ///< Whether each attachment point holds an object
+    size_t m_numActiveAttachmentPoints = 0; ///< Number of attachment points holding an object
+    std::unordered_map<pxr::SdfPath, size_t, pxr::SdfPath::Hash> m_attachmentIndices; ///< Index of each joint path
+    bool m_attachmentCacheDirty = true; ///< Whether joints, axes and offsets must be resolved again
+
+    /// Raycast queued by queueGripRaycasts()
+    struct PendingGrip
+    {
+        size_t attachment; ///< Index of the attachment point
+        size_t raycast; ///< Index of the raycast in the batch
+        physx::PxTransform worldTransform; ///< World transform of the attachment point
+        physx::PxVec3 direction; ///< Forward axis of the attachment point in world space
+    };
+    std::vector<PendingGrip> m_pendingGrips; ///< Raycasts of the current physics step
+    bool m_closeInProgress = false; ///< Whether the physics step waits for its raycasts to complete
+    GripperRaycastBatch m_localRaycasts; ///< Batch for updates outside the physics step of the manager
+
     std::unordered_set<std::string> m_grippedObjects; ///< List of currently gripped objects
     std::unordered_set<std::string> m_grippedObjectsBuffer; ///< Buffer used to check currently gripped objects at
                                                             ///< runtime
 
     uint32_t m_settlingDelay = 10; ///< Number of physics steps to wait for the joint to settle
-    std::unordered_map<std::string, uint32_t> m_jointSettlingCounters; ///< Map of joint paths to settling counters
 
 
     bool m_isInitialized = false; ///< Whether the component is initialized
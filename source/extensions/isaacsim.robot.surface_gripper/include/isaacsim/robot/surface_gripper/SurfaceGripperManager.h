@@ -19,6 +19,8 @@
 // clang-format on
 
 #include "isaacsim/core/includes/PrimManager.h"
+#include "isaacsim/core/includes/UsdNoticeListener.h"
+#include "isaacsim/robot/surface_gripper/GripperRaycastBatch.h"
 #include "isaacsim/robot/surface_gripper/SurfaceGripperComponent.h"
 
 #include <carb/Framework.h>
@@ -46,6 +48,37 @@ namespace robot
 namespace surface_gripper
 {
 
+class SurfaceGripperManager;
+
+/**
+ * @class AttachmentPointNoticeListener
+ * @brief USD notice listener forwarding stage changes to the surface gripper manager
+ * @details
+ * Grippers cache the PhysX joints, forward axes and clearance offsets of their attachment points, and refresh them
+ * when the joint prims change.
+ */
+class AttachmentPointNoticeListener
+    : public isaacsim::core::includes::UsdNoticeListener<pxr::UsdNotice::ObjectsChanged>
+{
+public:
+    /**
+     * @brief Constructs a new listener
+     * @param[in] manager Manager the changes are forwarded to
+     */
+    AttachmentPointNoticeListener(SurfaceGripperManager* manager) : m_manager(manager)
+    {
+    }
+
+    /**
+     * @brief Forwards the changed and resynced prim paths to the manager
+     * @param[in] objectsChanged The notification containing information about changed objects
+     */
+    virtual void handleNotice(const pxr::UsdNotice::ObjectsChanged& objectsChanged) override;
+
+private:
+    SurfaceGripperManager* m_manager = nullptr; ///< Manager the changes are forwarded to
+};
+
 /**
  * @class SurfaceGripperManager
  * @brief Manager class for handling surface grippers in a scene
@@ -71,6 +104,7 @@ public:
      */
     ~SurfaceGripperManager()
     {
+        m_attachmentNoticeListener.reset();
         m_components.clear();
     }
 
@@ -99,10 +133,20 @@ public:
 
     /**
      * @brief Called for each physics step to update all grippers
+     * @details The raycasts of all grippers looking for objects to grip are executed as one batched scene query.
      * @param[in] dt The time step in seconds
      */
     void onPhysicsStep(const double& dt);
 
+    /**
+     * @brief Lets the grippers refresh the cached state of attachment points affected by a stage change
+     * @details Only the grippers owning a changed attachment point or gripper prim are notified, and the status
+     *          and gripped objects written by the grippers themselves are ignored.
+     * @param[in] path Path of the changed prim or property
+     * @param[in] resynced True if the prim and its descendants were resynced
+     */
+    void onAttachmentPointChange(const pxr::SdfPath& path, bool resynced);
+
     /**
      * @brief Called when the simulation starts
      */
@@ -153,8 +197,16 @@ public:
     virtual void initialize(const pxr::UsdStageWeakPtr stage);
 
 private:
+    /**
+     * @brief Collects the attachment point and gripper prims that stage changes are forwarded for
+     */
+    void updateWatchedPaths();
+
     omni::physx::IPhysx* m_physXInterface = nullptr; ///< Pointer to the PhysX interface
     pxr::SdfLayerRefPtr m_gripperLayer; ///< The gripper layer for this gripper
+    std::unique_ptr<AttachmentPointNoticeListener> m_attachmentNoticeListener; ///< Listener for attachment changes
+    GripperRaycastBatch m_raycasts; ///< Raycasts of all grippers in the current physics step
+    std::multimap<pxr::SdfPath, pxr::SdfPath> m_watchedPaths; ///< Attachment point and gripper prims, by gripper
 };
 
 } // namespace surface_gripper
@@ -0,0 +1,170 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "isaacsim/robot/surface_gripper/GripperRaycastBatch.h"
+
+#include <extensions/PxBatchQueryExt.h>
+
+#include <PxQueryReport.h>
+#include <PxRigidActor.h>
+#include <PxScene.h>
+#include <PxSceneLock.h>
+#include <algorithm>
+#include <numeric>
+
+namespace isaacsim
+{
+namespace robot
+{
+namespace surface_gripper
+{
+
+GripperRaycastBatch::~GripperRaycastBatch()
+{
+    releaseQueries();
+}
+
+size_t GripperRaycastBatch::addRaycast(physx::PxScene* scene,
+                                       const physx::PxVec3& origin,
+                                       const physx::PxVec3& direction,
+                                       float clearanceOffset,
+                                       float maxDistance,
+                                       const physx::PxRigidActor* ignoredActor)
+{
+    m_scenes.push_back(scene);
+    m_origins.push_back(origin);
+    m_directions.push_back(direction);
+    m_maxDistances.push_back(maxDistance);
+    m_ignoredActors.push_back(ignoredActor);
+    Hit hit;
+    hit.clearanceOffset = clearanceOffset;
+    m_hits.push_back(hit);
+    return m_hits.size() - 1;
+}
+
+void GripperRaycastBatch::execute()
+{
+    m_pending.resize(m_hits.size());
+    std::iota(m_pending.begin(), m_pending.end(), 0);
+    // Raycasts of a scene are adjacent, so every scene gets a single batched query per pass
+    std::stable_sort(
+        m_pending.begin(), m_pending.end(), [this](size_t a, size_t b) { return m_scenes[a] < m_scenes[b]; });
+
+    std::vector<size_t> retry;
+    std::vector<physx::PxRaycastBuffer*> buffers;
+    while (!m_pending.empty())
+    {
+        retry.clear();
+        for (size_t begin = 0, end = 0; begin < m_pending.size(); begin = end)
+        {
+            physx::PxScene* scene = m_scenes[m_pending[begin]];
+            while (end < m_pending.size() && m_scenes[m_pending[end]] == scene)
+            {
+                end++;
+            }
+            if (!scene)
+            {
+                continue;
+            }
+
+            physx::PxBatchQueryExt* query = getQuery(scene, end - begin);
+            if (!query)
+            {
+                continue;
+            }
+            physx::PxSceneReadLock lock(*scene);
+            buffers.clear();
+            for (size_t k = begin; k < end; k++)
+            {
+                const size_t i = m_pending[k];
+                const float clearanceOffset = m_hits[i].clearanceOffset;
+                float rayLength = m_maxDistances[i] - clearanceOffset;
+                if (rayLength <= 0.0f)
+                {
+                    rayLength = 0.001f;
+                }
+                buffers.push_back(
+                    query->raycast(m_origins[i] + m_directions[i] * clearanceOffset, m_directions[i], rayLength));
+            }
+            query->execute();
+
+            for (size_t k = begin; k < end; k++)
+            {
+                const size_t i = m_pending[k];
+                const physx::PxRaycastBuffer* buffer = buffers[k - begin];
+                if (!buffer || !buffer->hasBlock)
+                {
+                    continue;
+                }
+                Hit& hit = m_hits[i];
+                if (buffer->block.actor == m_ignoredActors[i])
+                {
+                    // Hit the gripper itself, move the ray start past it and cast again
+                    hit.clearanceOffset += 0.001f;
+                    retry.push_back(i);
+                    continue;
+                }
+                hit.actor = buffer->block.actor;
+                hit.distance = buffer->block.distance;
+            }
+        }
+        m_pending.swap(retry);
+    }
+}
+
+void GripperRaycastBatch::clear()
+{
+    m_scenes.clear();
+    m_origins.clear();
+    m_directions.clear();
+    m_maxDistances.clear();
+    m_ignoredActors.clear();
+    m_hits.clear();
+    m_pending.clear();
+}
+
+void GripperRaycastBatch::releaseQueries()
+{
+    for (SceneQuery& sceneQuery : m_queries)
+    {
+        sceneQuery.query->release();
+    }
+    m_queries.clear();
+}
+
+physx::PxBatchQueryExt* GripperRaycastBatch::getQuery(physx::PxScene* scene, size_t count)
+{
+    auto it = std::find_if(m_queries.begin(), m_queries.end(),
+                           [scene](const SceneQuery& sceneQuery) { return sceneQuery.scene == scene; });
+    if (it != m_queries.end() && it->capacity >= count)
+    {
+        return it->query;
+    }
+    physx::PxBatchQueryExt* query =
+        physx::PxCreateBatchQueryExt(*scene, nullptr, static_cast<physx::PxU32>(count), 0, 0, 0, 0, 0);
+    if (it != m_queries.end())
+    {
+        it->query->release();
+        m_queries.erase(it);
+    }
+    if (query)
+    {
+        m_queries.push_back({ scene, query, count });
+    }
+    return query;
+}
+
+} // namespace surface_gripper
+} // namespace robot
+} // namespace isaacsim
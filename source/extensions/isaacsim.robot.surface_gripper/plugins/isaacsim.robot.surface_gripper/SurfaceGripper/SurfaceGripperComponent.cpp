@@ -20,7 +20,6 @@
 #include <extensions/PxJoint.h>
 #include <omni/physics/tensors/BodyTypes.h>
 #include <omni/physx/IPhysx.h>
-#include <omni/physx/IPhysxSceneQuery.h>
 #include <pxr/usd/sdf/layer.h>
 #include <pxr/usd/usdPhysics/filteredPairsAPI.h>
 
@@ -40,14 +39,6 @@ namespace robot
 namespace surface_gripper
 {
 
-inline const pxr::SdfPath& intToPath(const uint64_t& path)
-{
-    static_assert(sizeof(pxr::SdfPath) == sizeof(uint64_t), "Change to make the same size as pxr::SdfPath");
-
-    return reinterpret_cast<const pxr::SdfPath&>(path);
-}
-
-
 void SurfaceGripperComponent::initialize(const pxr::UsdPrim& prim, const pxr::UsdStageWeakPtr stage)
 {
     g_physx = carb::getCachedInterface<omni::physx::IPhysx>();
@@ -84,26 +75,33 @@ void SurfaceGripperComponent::onStart()
 
 void SurfaceGripperComponent::onPhysicsStep(double dt)
 {
+    m_localRaycasts.clear();
+    onPhysicsStep(dt, m_localRaycasts);
+    m_localRaycasts.execute();
+    onPhysicsStepComplete(m_localRaycasts);
+}
+
+void SurfaceGripperComponent::onPhysicsStep(double dt, GripperRaycastBatch& raycasts)
+{
+    m_closeInProgress = false;
     // Early return if component is not initialized
     if (!m_isInitialized)
         return;
 
-    // Use SdfChangeBlock to batch USD changes for better performance
-    // pxr::SdfChangeBlock changeBlock;
-
+    updateAttachmentPointCache();
 
     // Update joint settling counters for inactive attachment points
-    for (const auto& attachmentPath : m_inactiveAttachmentPoints)
+    for (size_t i = 0; i < m_attachmentPaths.size(); i++)
     {
-        if (m_jointSettlingCounters[attachmentPath] > 0)
+        if (!m_attachmentActive[i] && m_attachmentSettlingCounters[i] > 0)
         {
-            m_jointSettlingCounters[attachmentPath]--;
+            m_attachmentSettlingCounters[i]--;
         }
     }
 
     // Handle retry timeout for closing gripper
-    if (m_status == GripperStatus::Closing && m_retryInterval > 0 && m_retryCloseActive &&
-        !m_inactiveAttachmentPoints.empty())
+    const bool hasInactiveAttachmentPoints = m_numActiveAttachmentPoints < m_attachmentPaths.size();
+    if (m_status == GripperStatus::Closing && m_retryInterval > 0 && m_retryCloseActive && hasInactiveAttachmentPoints)
     {
         m_retryElapsed += dt;
         if (m_retryElapsed > m_retryInterval)
@@ -117,9 +115,11 @@ void SurfaceGripperComponent::onPhysicsStep(double dt)
     // Update gripper state based on current status
     if (m_status == GripperStatus::Closed || m_status == GripperStatus::Closing)
     {
-        if (m_retryCloseActive || !m_activeAttachmentPoints.empty())
+        if (m_retryCloseActive || m_numActiveAttachmentPoints > 0)
         {
-            updateClosedGripper();
+            // Finished in onPhysicsStepComplete() once the raycasts of all grippers are done
+            beginUpdateClosedGripper(raycasts);
+            m_closeInProgress = true;
         }
         else
         {
@@ -133,6 +133,38 @@ void SurfaceGripperComponent::onPhysicsStep(double dt)
     }
 }
 
+void SurfaceGripperComponent::onPhysicsStepComplete(const GripperRaycastBatch& raycasts)
+{
+    if (m_closeInProgress)
+    {
+        m_closeInProgress = false;
+        endUpdateClosedGripper(raycasts);
+    }
+}
+
+void SurfaceGripperComponent::onAttachmentPointChange(const pxr::SdfPath& path)
+{
+    if (m_attachmentCacheDirty)
+    {
+        return;
+    }
+    static const pxr::TfToken clearanceOffsetName =
+        isaacsim::robot::schema::getAttributeName(isaacsim::robot::schema::Attributes::CLEARANCE_OFFSET);
+    if (path.IsPropertyPath() && path.GetNameToken() == clearanceOffsetName)
+    {
+        // Offsets the gripper increased itself after hitting its own actor are cached already
+        auto index = m_attachmentIndices.find(path.GetPrimPath());
+        pxr::UsdAttribute clearanceOffsetAttr = m_stage->GetAttributeAtPath(path);
+        float clearanceOffset = 0.0f;
+        if (index != m_attachmentIndices.end() && clearanceOffsetAttr && clearanceOffsetAttr.Get(&clearanceOffset) &&
+            clearanceOffset == m_attachmentClearanceOffsets[index->second])
+        {
+            return;
+        }
+    }
+    m_attachmentCacheDirty = true;
+}
+
 void SurfaceGripperComponent::preTick()
 {
     // Nothing to do in preTick for now
@@ -152,9 +184,9 @@ void SurfaceGripperComponent::onStop()
     // First release all objects with physics changes
     releaseAllObjects();
 
-
-    m_activeAttachmentPoints.clear();
-    m_inactiveAttachmentPoints = m_attachmentPoints;
+    // The PhysX objects are released with the simulation
+    m_attachmentCacheDirty = true;
+    m_localRaycasts.releaseQueries();
     m_grippedObjects.clear();
     m_isInitialized = false;
     mDoStart = true;
@@ -260,26 +292,25 @@ void SurfaceGripperComponent::updateGripperProperties()
 void SurfaceGripperComponent::updateAttachmentPoints()
 {
     auto prim = m_stage->GetPrimAtPath(m_primPath);
-    m_attachmentPoints.clear();
+    m_attachmentPaths.clear();
+    m_attachmentIndices.clear();
 
     pxr::UsdRelationship attachmentPointsRel = prim.GetRelationship(
         isaacsim::robot::schema::relationNames.at(isaacsim::robot::schema::Relations::ATTACHMENT_POINTS));
-    if (!attachmentPointsRel)
-        return;
-
     std::vector<pxr::SdfPath> attachmentPaths;
-    attachmentPointsRel.GetTargets(&attachmentPaths);
+    if (attachmentPointsRel)
+    {
+        attachmentPointsRel.GetTargets(&attachmentPaths);
+    }
     // Preallocate buffers
-    m_attachmentPoints.reserve(attachmentPaths.size());
+    m_attachmentPaths.reserve(attachmentPaths.size());
     m_grippedObjectsBuffer.reserve(attachmentPaths.size());
     m_grippedObjects.reserve(attachmentPaths.size());
-    m_activeAttachmentPoints.reserve(attachmentPaths.size());
-    m_inactiveAttachmentPoints.reserve(attachmentPaths.size());
-    m_jointSettlingCounters.reserve(attachmentPaths.size());
     for (const auto& path : attachmentPaths)
     {
         pxr::UsdPrim attachmentPrim = prim.GetPrimAtPath(path);
-        if (attachmentPrim && attachmentPrim.IsA<pxr::UsdPhysicsJoint>())
+        if (attachmentPrim && attachmentPrim.IsA<pxr::UsdPhysicsJoint>() &&
+            m_attachmentIndices.find(path) == m_attachmentIndices.end())
         {
             if (!attachmentPrim.HasAPI(
                     isaacsim::robot::schema::className(isaacsim::robot::schema::Classes::ATTACHMENT_POINT_API)))
@@ -302,19 +333,102 @@ void SurfaceGripperComponent::updateAttachmentPoints()
                 continue;
             }
             px_joint->setConstraintFlag(physx::PxConstraintFlag::eDISABLE_CONSTRAINT, m_status == GripperStatus::Open);
-            m_attachmentPoints.insert(path.GetString());
-            m_jointSettlingCounters[path.GetString()] = 0;
+            m_attachmentIndices.emplace(path, m_attachmentPaths.size());
+            m_attachmentPaths.push_back(path);
         }
     }
-    m_activeAttachmentPoints.clear();
-    m_inactiveAttachmentPoints = m_attachmentPoints;
+
+    const size_t count = m_attachmentPaths.size();
+    m_attachmentJoints.assign(count, nullptr);
+    m_attachmentAxes.assign(count, physx::PxVec3(0.0f, 0.0f, 1.0f));
+    m_attachmentClearanceOffsets.assign(count, 0.0f);
+    m_attachmentSettlingCounters.assign(count, 0);
+    m_attachmentActive.assign(count, 0);
+    m_numActiveAttachmentPoints = 0;
+    m_pendingGrips.clear();
+    m_pendingGrips.reserve(count);
+    // Resolved at the next physics step, once PhysX has processed the schema and attribute changes made above
+    m_attachmentCacheDirty = true;
+}
+
+void SurfaceGripperComponent::updateAttachmentPointCache()
+{
+    if (!m_attachmentCacheDirty)
+    {
+        return;
+    }
+    m_attachmentCacheDirty = false;
+
+    static const pxr::TfToken forwardAxisName =
+        isaacsim::robot::schema::getAttributeName(isaacsim::robot::schema::Attributes::FORWARD_AXIS);
+    static const pxr::TfToken clearanceOffsetName =
+        isaacsim::robot::schema::getAttributeName(isaacsim::robot::schema::Attributes::CLEARANCE_OFFSET);
+    for (size_t i = 0; i < m_attachmentPaths.size(); i++)
+    {
+        pxr::UsdPrim jointPrim = m_stage->GetPrimAtPath(m_attachmentPaths[i]);
+        if (!jointPrim)
+        {
+            m_attachmentJoints[i] = nullptr;
+            continue;
+        }
+        m_attachmentJoints[i] = static_cast<physx::PxJoint*>(
+            g_physx->getPhysXPtr(m_attachmentPaths[i], omni::physx::PhysXType::ePTJoint));
+
+        // Get joint axis (assuming Z is default)
+        pxr::TfToken jointAxis;
+        jointPrim.GetAttribute(forwardAxisName).Get(&jointAxis);
+        switch (jointAxis.GetText()[0])
+        {
+        case 'X':
+            m_attachmentAxes[i] = physx::PxVec3(1.0f, 0.0f, 0.0f);
+            break;
+        case 'Y':
+            m_attachmentAxes[i] = physx::PxVec3(0.0f, 1.0f, 0.0f);
+            break;
+        default:
+            m_attachmentAxes[i] = physx::PxVec3(0.0f, 0.0f, 1.0f);
+            break;
+        }
+
+        float clearanceOffset = 0.0f;
+        pxr::UsdAttribute clearanceOffsetAttr = jointPrim.GetAttribute(clearanceOffsetName);
+        if (clearanceOffsetAttr)
+        {
+            clearanceOffsetAttr.Get(&clearanceOffset);
+        }
+        else
+        {
+            jointPrim.CreateAttribute(clearanceOffsetName, pxr::SdfValueTypeNames->Float, false).Set(clearanceOffset);
+        }
+        m_attachmentClearanceOffsets[i] = clearanceOffset;
+    }
+}
+
+void SurfaceGripperComponent::activateAttachmentPoint(size_t index)
+{
+    if (!m_attachmentActive[index])
+    {
+        m_attachmentActive[index] = 1;
+        m_numActiveAttachmentPoints++;
+    }
+    m_attachmentSettlingCounters[index] = m_settlingDelay;
+}
+
+void SurfaceGripperComponent::deactivateAttachmentPoint(size_t index)
+{
+    if (m_attachmentActive[index])
+    {
+        m_attachmentActive[index] = 0;
+        m_numActiveAttachmentPoints--;
+    }
+    m_attachmentSettlingCounters[index] = m_settlingDelay;
 }
 
 void SurfaceGripperComponent::updateGrippedObjectsList()
 {
     pxr::SdfPathVector objectPathsVec;
     // Early return if gripper is open - no need to track gripped objects
-    if (m_activeAttachmentPoints.empty())
+    if (m_numActiveAttachmentPoints == 0)
     {
         if (!m_grippedObjects.empty())
         {
@@ -328,7 +442,7 @@ void SurfaceGripperComponent::updateGrippedObjectsList()
             {
                 grippedObjectsRel.ClearTargets(true);
             }
-            pxr::UsdPrim jointPrim = m_stage->GetPrimAtPath(pxr::SdfPath(m_attachmentPoints.begin()->c_str()));
+            pxr::UsdPrim jointPrim = m_stage->GetPrimAtPath(m_attachmentPaths.front());
             pxr::UsdPhysicsJoint joint(jointPrim);
 
             // Get body0 targets
@@ -353,10 +467,13 @@ void SurfaceGripperComponent::updateGrippedObjectsList()
         m_grippedObjectsBuffer.clear();
 
         // Iterate through active attachment points to find gripped objects
-        for (const auto& attachmentPath : m_activeAttachmentPoints)
+        for (size_t i = 0; i < m_attachmentPaths.size(); i++)
         {
-            physx::PxJoint* px_joint = static_cast<physx::PxJoint*>(
-                g_physx->getPhysXPtr(pxr::SdfPath(attachmentPath), omni::physx::PhysXType::ePTJoint));
+            if (!m_attachmentActive[i])
+            {
+                continue;
+            }
+            physx::PxJoint* px_joint = m_attachmentJoints[i];
 
             // Skip invalid or broken joints
             if (!px_joint || (px_joint->getConstraintFlags() &
@@ -396,7 +513,7 @@ void SurfaceGripperComponent::updateGrippedObjectsList()
             objectPathsVec.push_back(pxr::SdfPath(objectPath));
         }
         // Get the first joint to find the body to apply filtered pairs to
-        pxr::UsdPrim jointPrim = m_stage->GetPrimAtPath(pxr::SdfPath(m_attachmentPoints.begin()->c_str()));
+        pxr::UsdPrim jointPrim = m_stage->GetPrimAtPath(m_attachmentPaths.front());
         pxr::UsdPhysicsJoint joint(jointPrim);
 
         // Get body0 targets
@@ -425,20 +542,38 @@ void SurfaceGripperComponent::updateGrippedObjectsList()
 
 void SurfaceGripperComponent::updateClosedGripper()
 {
+    m_localRaycasts.clear();
+    beginUpdateClosedGripper(m_localRaycasts);
+    m_localRaycasts.execute();
+    endUpdateClosedGripper(m_localRaycasts);
+}
+
+void SurfaceGripperComponent::beginUpdateClosedGripper(GripperRaycastBatch& raycasts)
+{
+    m_pendingGrips.clear();
     // If we have no attachment points, we can't do anything
-    if (m_attachmentPoints.empty())
+    if (m_attachmentPaths.empty())
     {
         return;
     }
 
-    // Get status attribute once for efficiency
-    pxr::UsdAttribute gripperStatusAttr =
-        m_stage->GetPrimAtPath(m_primPath)
-            .GetAttribute(isaacsim::robot::schema::getAttributeName(isaacsim::robot::schema::Attributes::STATUS));
-    if (!m_inactiveAttachmentPoints.empty() && (m_status == GripperStatus::Closing || m_retryCloseActive))
+    updateAttachmentPointCache();
+    if (m_numActiveAttachmentPoints < m_attachmentPaths.size() &&
+        (m_status == GripperStatus::Closing || m_retryCloseActive))
     {
-        findObjectsToGrip();
+        queueGripRaycasts(raycasts);
     }
+}
+
+void SurfaceGripperComponent::endUpdateClosedGripper(const GripperRaycastBatch& raycasts)
+{
+    // If we have no attachment points, we can't do anything
+    if (m_attachmentPaths.empty())
+    {
+        return;
+    }
+
+    findObjectsToGrip(raycasts);
 
     checkForceLimits();
 
@@ -446,7 +581,7 @@ void SurfaceGripperComponent::updateClosedGripper()
 
     GripperStatus newStatus = m_status;
 
-    if (m_inactiveAttachmentPoints.empty())
+    if (m_numActiveAttachmentPoints == m_attachmentPaths.size())
     {
         newStatus = GripperStatus::Closed;
     }
@@ -454,7 +589,7 @@ void SurfaceGripperComponent::updateClosedGripper()
     {
         newStatus = GripperStatus::Closing;
     }
-    else if (m_activeAttachmentPoints.empty())
+    else if (m_numActiveAttachmentPoints == 0)
     {
         newStatus = GripperStatus::Open;
     }
@@ -463,7 +598,9 @@ void SurfaceGripperComponent::updateClosedGripper()
     if (newStatus != m_status)
     {
         m_status = newStatus;
-        gripperStatusAttr.Set(GripperStatusToToken(newStatus));
+        m_stage->GetPrimAtPath(m_primPath)
+            .GetAttribute(isaacsim::robot::schema::getAttributeName(isaacsim::robot::schema::Attributes::STATUS))
+            .Set(GripperStatusToToken(newStatus));
 
         // Reset retry elapsed time if we've finished closing
         if (newStatus == GripperStatus::Closed)
@@ -475,29 +612,26 @@ void SurfaceGripperComponent::updateClosedGripper()
 
 void SurfaceGripperComponent::checkForceLimits()
 {
-    // Pre-allocate the vector to avoid resizing
-    std::vector<std::string> ap_to_remove;
-    ap_to_remove.reserve(m_activeAttachmentPoints.size());
-
     // Only check force limits if they are set
     const bool checkShearForce = m_shearForceLimit > 0.0f;
     const bool checkCoaxialForce = m_coaxialForceLimit > 0.0f;
     const bool checkForces = checkShearForce || checkCoaxialForce;
 
-    for (const auto& attachmentPath : m_activeAttachmentPoints)
+    for (size_t i = 0; i < m_attachmentPaths.size(); i++)
     {
-        // Skip joints that are still settling
-        if (m_jointSettlingCounters[attachmentPath] > 0)
+        if (!m_attachmentActive[i])
         {
-            m_jointSettlingCounters[attachmentPath]--;
             continue;
         }
 
-        // Get the joint prim and PhysX joint
-        pxr::UsdPrim jointPrim = m_stage->GetPrimAtPath(pxr::SdfPath(attachmentPath));
-        physx::PxJoint* px_joint =
-            (physx::PxJoint*)g_physx->getPhysXPtr(jointPrim.GetPath(), omni::physx::PhysXType::ePTJoint);
+        // Skip joints that are still settling
+        if (m_attachmentSettlingCounters[i] > 0)
+        {
+            m_attachmentSettlingCounters[i]--;
+            continue;
+        }
 
+        physx::PxJoint* px_joint = m_attachmentJoints[i];
         if (!px_joint)
             continue;
 
@@ -505,7 +639,7 @@ void SurfaceGripperComponent::checkForceLimits()
         auto flags = px_joint->getConstraintFlags();
         if (flags & (physx::PxConstraintFlag::eDISABLE_CONSTRAINT | physx::PxConstraintFlag::eBROKEN))
         {
-            ap_to_remove.push_back(attachmentPath);
+            deactivateAttachmentPoint(i);
             continue;
         }
 
@@ -519,28 +653,11 @@ void SurfaceGripperComponent::checkForceLimits()
         px_joint->getActors(px_actor0, px_actor1);
         px_joint->getConstraint()->getForce(force, torque);
 
-
-        // Get joint axis direction
-        pxr::TfToken jointAxis;
-        jointPrim
-            .GetAttribute(isaacsim::robot::schema::getAttributeName(isaacsim::robot::schema::Attributes::FORWARD_AXIS))
-            .Get(&jointAxis);
-
-        // Create direction vector based on joint axis
-        physx::PxVec3 direction(0.0f, 0.0f, 0.0f);
-        char axis = jointAxis.GetText()[0];
-        if (axis == 'X')
-            direction.x = 1.0f;
-        else if (axis == 'Y')
-            direction.y = 1.0f;
-        else
-            direction.z = 1.0f;
-
         // Transform direction to world space
         physx::PxTransform localPose0 = px_joint->getLocalPose(physx::PxJointActorIndex::eACTOR0);
         physx::PxTransform actorPose = px_actor0->getGlobalPose();
         physx::PxTransform worldTransform = actorPose * localPose0;
-        direction = worldTransform.q.rotate(direction);
+        physx::PxVec3 direction = worldTransform.q.rotate(m_attachmentAxes[i]);
         direction.normalize();
 
         // Calculate force components
@@ -563,47 +680,30 @@ void SurfaceGripperComponent::checkForceLimits()
 
         if (shouldRelease)
         {
-            ap_to_remove.push_back(attachmentPath);
+            deactivateAttachmentPoint(i);
             px_joint->setConstraintFlag(physx::PxConstraintFlag::eDISABLE_CONSTRAINT, true);
             px_joint->setConstraintFlag(physx::PxConstraintFlag::eCOLLISION_ENABLED, true);
         }
     }
-
-    // Process all joints to be removed
-    for (const auto& ap : ap_to_remove)
-    {
-        m_activeAttachmentPoints.erase(ap);
-        m_inactiveAttachmentPoints.insert(ap);
-        m_jointSettlingCounters[ap] = m_settlingDelay;
-    }
 }
 
-void SurfaceGripperComponent::findObjectsToGrip()
+void SurfaceGripperComponent::queueGripRaycasts(GripperRaycastBatch& raycasts)
 {
-    // Get physics query interface
-    auto physxQuery = carb::getCachedInterface<omni::physx::IPhysxSceneQuery>();
-    if (!physxQuery)
-        return;
-
-    std::set<pxr::SdfPath> targetSet(m_grippedObjects.begin(), m_grippedObjects.end());
-
-    // Iterate through each attachment point
-    std::vector<std::string> ap_to_remove;
+    m_pendingGrips.clear();
     physx::PxRigidActor *actor0, *actor1;
-    for (const auto& attachmentPath : m_inactiveAttachmentPoints)
+    for (size_t i = 0; i < m_attachmentPaths.size(); i++)
     {
-        if (m_jointSettlingCounters[attachmentPath] > 0)
+        if (m_attachmentActive[i])
         {
-            m_jointSettlingCounters[attachmentPath]--;
             continue;
         }
-        pxr::UsdPrim jointPrim = m_stage->GetPrimAtPath(pxr::SdfPath(attachmentPath));
-
-        pxr::UsdPhysicsJoint joint(jointPrim);
+        if (m_attachmentSettlingCounters[i] > 0)
+        {
+            m_attachmentSettlingCounters[i]--;
+            continue;
+        }
 
-        // Get PhysX joint pointer
-        physx::PxJoint* px_joint =
-            (physx::PxJoint*)g_physx->getPhysXPtr(pxr::SdfPath(attachmentPath), omni::physx::PhysXType::ePTJoint);
+        physx::PxJoint* px_joint = m_attachmentJoints[i];
         if (!px_joint)
             continue;
 
@@ -612,148 +712,72 @@ void SurfaceGripperComponent::findObjectsToGrip()
         if (!actor0)
             continue;
 
-        // Get joint's local poses
-        physx::PxTransform localPose0 = px_joint->getLocalPose(physx::PxJointActorIndex::eACTOR0);
-
-        // Get actor's global pose
-        physx::PxTransform actorPose = actor0->getGlobalPose();
-
-        // Calculate world transform
-        physx::PxTransform worldTransform = actorPose * localPose0;
-
-        // Get joint axis (assuming Z is default)
-        pxr::GfVec3f direction(0.0, 0.0, 1.0);
-
-        pxr::TfToken jointAxis;
-        jointPrim
-            .GetAttribute(isaacsim::robot::schema::getAttributeName(isaacsim::robot::schema::Attributes::FORWARD_AXIS))
-            .Get(&jointAxis);
-        switch (jointAxis.GetText()[0])
-        {
-        case 'X':
-            direction = pxr::GfVec3f(1.0, 0.0, 0.0);
-            break;
-        case 'Y':
-            direction = pxr::GfVec3f(0.0, 1.0, 0.0);
-            break;
-        default:
-            direction = pxr::GfVec3f(0.0, 0.0, 1.0);
-            break;
-        }
+        // Calculate world transform of the joint
+        physx::PxTransform worldTransform =
+            actor0->getGlobalPose() * px_joint->getLocalPose(physx::PxJointActorIndex::eACTOR0);
 
         // Transform direction to world space
-        auto rotated = worldTransform.q.rotate(physx::PxVec3(direction[0], direction[1], direction[2]));
-        direction = pxr::GfVec3f(rotated.x, rotated.y, rotated.z);
-        direction.Normalize();
+        physx::PxVec3 direction = worldTransform.q.rotate(m_attachmentAxes[i]);
+        direction.normalize();
 
-        // Get world position
-        pxr::GfVec3f worldPos(worldTransform.p.x, worldTransform.p.y, worldTransform.p.z);
-        float clearanceOffset = 0.0f;
-        pxr::UsdAttribute clearanceOffsetAttr = jointPrim.GetAttribute(
-            isaacsim::robot::schema::getAttributeName(isaacsim::robot::schema::Attributes::CLEARANCE_OFFSET));
-        if (clearanceOffsetAttr)
+        size_t raycast = raycasts.addRaycast(actor0->getScene(), worldTransform.p, direction,
+                                             m_attachmentClearanceOffsets[i], m_maxGripDistance, actor0);
+        m_pendingGrips.push_back({ i, raycast, worldTransform, direction });
+    }
+}
+
+void SurfaceGripperComponent::findObjectsToGrip(const GripperRaycastBatch& raycasts)
+{
+    physx::PxRigidActor *actor0, *actor1;
+    for (const PendingGrip& grip : m_pendingGrips)
+    {
+        const GripperRaycastBatch::Hit& hit = raycasts.getHit(grip.raycast);
+        if (!hit.actor)
         {
-            clearanceOffsetAttr.Get(&clearanceOffset);
+            continue;
         }
-        else
+        const size_t i = grip.attachment;
+        const float clearanceOffset = hit.clearanceOffset;
+        if (clearanceOffset > 0.0f && clearanceOffset != m_attachmentClearanceOffsets[i])
         {
-            jointPrim
-                .CreateAttribute(
-                    isaacsim::robot::schema::getAttributeName(isaacsim::robot::schema::Attributes::CLEARANCE_OFFSET),
-                    pxr::SdfValueTypeNames->Float, false)
+            CARB_LOG_WARN("   Gripper Attachment %s hit itself, adjust Clearance Offset at the joint to %f",
+                          m_attachmentPaths[i].GetText(), clearanceOffset);
+            m_stage->GetPrimAtPath(m_attachmentPaths[i])
+                .GetAttribute(
+                    isaacsim::robot::schema::getAttributeName(isaacsim::robot::schema::Attributes::CLEARANCE_OFFSET))
                 .Set(clearanceOffset);
+            m_attachmentClearanceOffsets[i] = clearanceOffset;
         }
-        bool selfCollision = true;
-        while (selfCollision)
-        {
-            pxr::GfVec3f rayStart = worldPos + direction * static_cast<float>(clearanceOffset);
 
-            // Convert to carb types for raycast
-            carb::Float3 _rayStart{ static_cast<float>(rayStart[0]), static_cast<float>(rayStart[1]),
-                                    static_cast<float>(rayStart[2]) };
+        physx::PxJoint* px_joint = m_attachmentJoints[i];
+        px_joint->getActors(actor0, actor1);
 
-            // Scale distance before adding to start to get the correct starting point.
-            carb::Float3 _rayDir{ static_cast<float>(direction[0]), static_cast<float>(direction[1]),
-                                  static_cast<float>(direction[2]) };
+        // Calculate the relative transform for the joint connection
+        physx::PxTransform hitWorldTransform = hit.actor->getGlobalPose();
 
-            // Perform raycast
-            omni::physx::RaycastHit result;
-            float rayLength = static_cast<float>(m_maxGripDistance) - clearanceOffset;
-            if (rayLength <= 0.0f)
-            {
-                rayLength = 0.001f;
-            }
-            bool hit = physxQuery->raycastClosest(_rayStart, _rayDir, rayLength, result, false);
+        // Calculate offset transform to place object at grip distance
+        physx::PxVec3 offsetTranslation = -grip.direction * (hit.distance - clearanceOffset);
+        physx::PxTransform offsetTransform(offsetTranslation, physx::PxQuat(physx::PxIdentity));
 
-            if (hit)
-            {
-                // Get the hit object's prim path
-                pxr::SdfPath hitPath = pxr::SdfPath(intToPath(result.rigidBody).GetString());
-                // Skip if we hit the gripper itself or its parent
-                if (hitPath == pxr::SdfPath(actor0->getName()))
-                {
-                    selfCollision = true;
-                    clearanceOffset += 0.001f;
-                    continue;
-                }
-                selfCollision = false;
-                if (clearanceOffset > 0.0f)
-                {
-                    float originalOffset;
-                    clearanceOffsetAttr.Get(&originalOffset);
-                    if (originalOffset != clearanceOffset)
-                    {
-                        CARB_LOG_WARN("   Gripper Attachment %s hit itself, adjust Clearance Offset at the joint to %f",
-                                      attachmentPath.c_str(), clearanceOffset);
-                    }
-                    clearanceOffsetAttr.Set(clearanceOffset);
-                }
-                // Calculate the relative transform for the joint connection
-                physx::PxRigidActor* hitActor =
-                    (physx::PxRigidActor*)g_physx->getPhysXPtr(hitPath, omni::physx::PhysXType::ePTActor);
-                if (!hitActor)
-                    continue;
-                // Calculate the relative transform for the joint connection
-                physx::PxTransform hitWorldTransform = hitActor->getGlobalPose();
-
-                // Calculate offset transform to place object at grip distance
-
-                physx::PxVec3 offsetTranslation =
-                    -physx::PxVec3(direction[0], direction[1], direction[2]) * (result.distance - clearanceOffset);
-                physx::PxTransform offsetTransform(offsetTranslation, physx::PxQuat(physx::PxIdentity));
-
-                // Apply offset to get the desired world transform
-                physx::PxTransform adjustedWorldTransform = offsetTransform * worldTransform;
-
-                // Calculate the local transform for body1 (relative to hit actor)
-                physx::PxTransform hitLocalTransform = hitWorldTransform.transformInv(adjustedWorldTransform);
-
-                // Update joint's Body1 actor and transform
-                px_joint->setActors(actor0, hitActor);
-                px_joint->setLocalPose(physx::PxJointActorIndex::eACTOR1, hitLocalTransform);
-                auto constraintFlags = px_joint->getConstraintFlags();
-                px_joint->setConstraintFlags(constraintFlags);
-                // Enable the joint
-                px_joint->setConstraintFlag(physx::PxConstraintFlag::eDISABLE_CONSTRAINT, false);
-                // This should be the way to disable collision, but it doesn't work
-                px_joint->setConstraintFlag(physx::PxConstraintFlag::eCOLLISION_ENABLED, false);
-
-
-                ap_to_remove.push_back(attachmentPath);
-            }
-            else
-            {
-                break;
-            }
-        }
-    }
-    for (const auto& ap : ap_to_remove)
-    {
-        m_inactiveAttachmentPoints.erase(ap);
-        m_activeAttachmentPoints.insert(ap);
+        // Apply offset to get the desired world transform
+        physx::PxTransform adjustedWorldTransform = offsetTransform * grip.worldTransform;
+
+        // Calculate the local transform for body1 (relative to hit actor)
+        physx::PxTransform hitLocalTransform = hitWorldTransform.transformInv(adjustedWorldTransform);
 
-        m_jointSettlingCounters[ap] = m_settlingDelay; // Initialize settling counter
+        // Update joint's Body1 actor and transform
+        px_joint->setActors(actor0, hit.actor);
+        px_joint->setLocalPose(physx::PxJointActorIndex::eACTOR1, hitLocalTransform);
+        auto constraintFlags = px_joint->getConstraintFlags();
+        px_joint->setConstraintFlags(constraintFlags);
+        // Enable the joint
+        px_joint->setConstraintFlag(physx::PxConstraintFlag::eDISABLE_CONSTRAINT, false);
+        // This should be the way to disable collision, but it doesn't work
+        px_joint->setConstraintFlag(physx::PxConstraintFlag::eCOLLISION_ENABLED, false);
+
+        activateAttachmentPoint(i); // Initialize settling counter
     }
+    m_pendingGrips.clear();
 }
 
 void SurfaceGripperComponent::updateOpenGripper()
@@ -764,7 +788,6 @@ void SurfaceGripperComponent::updateOpenGripper()
     {
         releaseAllObjects();
         updateGrippedObjectsList();
-        m_activeAttachmentPoints.clear();
     }
     if (m_status != GripperStatus::Open)
     {
@@ -778,17 +801,18 @@ void SurfaceGripperComponent::updateOpenGripper()
 void SurfaceGripperComponent::releaseAllObjects()
 {
     // Early return if no attachment points exist
-    if (m_attachmentPoints.empty())
+    if (m_attachmentPaths.empty())
     {
         return;
     }
 
-    // Release all objects by disabling constraints on all attachment points
-    for (const auto& attachmentPath : m_attachmentPoints)
+    // Release all objects by disabling constraints on all attachment points. The joints are looked up rather than
+    // taken from the cache, as this also runs when the simulation stops and its PhysX objects may be gone.
+    for (const auto& attachmentPath : m_attachmentPaths)
     {
         // Get the PhysX joint directly
         physx::PxJoint* px_joint =
-            (physx::PxJoint*)g_physx->getPhysXPtr(pxr::SdfPath(attachmentPath), omni::physx::PhysXType::ePTJoint);
+            (physx::PxJoint*)g_physx->getPhysXPtr(attachmentPath, omni::physx::PhysXType::ePTJoint);
 
         if (px_joint)
         {
@@ -797,14 +821,11 @@ void SurfaceGripperComponent::releaseAllObjects()
             px_joint->setConstraintFlag(physx::PxConstraintFlag::eCOLLISION_ENABLED, true);
         }
     }
-    m_activeAttachmentPoints.clear();
-    m_inactiveAttachmentPoints = m_attachmentPoints;
-
 
     // Reset settling counters for all attachment points
-    for (const auto& ap : m_attachmentPoints)
+    for (size_t i = 0; i < m_attachmentPaths.size(); i++)
     {
-        m_jointSettlingCounters[ap] = m_settlingDelay;
+        deactivateAttachmentPoint(i);
     }
 }
 
@@ -24,6 +24,22 @@ namespace robot
 namespace surface_gripper
 {
 
+void AttachmentPointNoticeListener::handleNotice(const pxr::UsdNotice::ObjectsChanged& objectsChanged)
+{
+    if (m_manager->getStage() != objectsChanged.GetStage())
+    {
+        return;
+    }
+    for (const auto& path : objectsChanged.GetResyncedPaths())
+    {
+        m_manager->onAttachmentPointChange(path, true);
+    }
+    for (const auto& path : objectsChanged.GetChangedInfoOnlyPaths())
+    {
+        m_manager->onAttachmentPointChange(path, false);
+    }
+}
+
 std::vector<std::string> SurfaceGripperManager::getComponentIsAVector() const
 {
     return { isaacsim::robot::schema::className(isaacsim::robot::schema::Classes::SURFACE_GRIPPER).GetString() };
@@ -41,6 +57,9 @@ void SurfaceGripperManager::onStop()
         m_gripperLayer->Clear();
     }
 
+    // The physics scenes are released with the simulation
+    m_raycasts.releaseQueries();
+
     // Reset timers when stopped
     this->m_timeSeconds = 0;
     this->m_timeNanoSeconds = 0;
@@ -57,6 +76,7 @@ void SurfaceGripperManager::onComponentAdd(const pxr::UsdPrim& prim)
         component->initialize(prim, m_stage);
 
         m_components[prim.GetPath().GetString()] = std::move(component);
+        updateWatchedPaths();
     }
     if (m_components.size() > 0)
     {
@@ -85,6 +105,8 @@ void SurfaceGripperManager::initialize(const pxr::UsdStageWeakPtr stage)
     isaacsim::core::includes::PrimManagerBase<SurfaceGripperComponent>::initialize(stage);
     m_stage = stage;
     m_gripperLayer = nullptr;
+    m_attachmentNoticeListener = std::make_unique<AttachmentPointNoticeListener>(this);
+    m_attachmentNoticeListener->registerListener();
 }
 
 void SurfaceGripperManager::onComponentChange(const pxr::UsdPrim& prim)
@@ -104,6 +126,7 @@ void SurfaceGripperManager::onPhysicsStep(const double& dt)
     auto layer = m_stage->GetRootLayer();
     pxr::SdfLayerRefPtr refPtr(layer.operator->());
     pxr::UsdEditContext context(m_stage, m_gripperLayer ? m_gripperLayer : refPtr);
+    m_raycasts.clear();
     for (auto& component : m_components)
     {
         // First run initialization for all components
@@ -112,8 +135,57 @@ void SurfaceGripperManager::onPhysicsStep(const double& dt)
             component.second->mDoStart = false;
         }
 
-        // Process physics update for all components
-        component.second->onPhysicsStep(dt);
+        // Process physics update for all components, collecting the raycasts of closing grippers
+        component.second->onPhysicsStep(dt, m_raycasts);
+    }
+
+    // Cast the rays of all grippers at once, then let the grippers attach what they hit
+    m_raycasts.execute();
+    for (auto& component : m_components)
+    {
+        component.second->onPhysicsStepComplete(m_raycasts);
+    }
+}
+
+void SurfaceGripperManager::onAttachmentPointChange(const pxr::SdfPath& path, bool resynced)
+{
+    static const pxr::TfToken statusName =
+        isaacsim::robot::schema::getAttributeName(isaacsim::robot::schema::Attributes::STATUS);
+    static const pxr::TfToken grippedObjectsName =
+        isaacsim::robot::schema::relationNames.at(isaacsim::robot::schema::Relations::GRIPPED_OBJECTS);
+    if (path.IsPropertyPath() && (path.GetNameToken() == statusName || path.GetNameToken() == grippedObjectsName))
+    {
+        // Written by the grippers themselves as they open and close
+        return;
+    }
+    auto range = m_watchedPaths.equal_range(path.GetPrimPath());
+    if (resynced && path.IsAbsoluteRootOrPrimPath())
+    {
+        // Every watched prim at or below the resynced prim
+        range = pxr::SdfPathFindPrefixedRange(m_watchedPaths.begin(), m_watchedPaths.end(), path,
+                                              [](const auto& watched) -> const pxr::SdfPath& { return watched.first; });
+    }
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        auto component = m_components.find(it->second.GetString());
+        if (component != m_components.end())
+        {
+            component->second->onAttachmentPointChange(path);
+        }
+    }
+}
+
+void SurfaceGripperManager::updateWatchedPaths()
+{
+    m_watchedPaths.clear();
+    for (const auto& component : m_components)
+    {
+        const pxr::SdfPath gripperPath(component.first);
+        m_watchedPaths.emplace(gripperPath, gripperPath);
+        for (const pxr::SdfPath& attachmentPath : component.second->getAttachmentPaths())
+        {
+            m_watchedPaths.emplace(attachmentPath, gripperPath);
+        }
     }
 }
 
@@ -131,6 +203,7 @@ void SurfaceGripperManager::onStart()
             component.second->mDoStart = false;
         }
     }
+    updateWatchedPaths();
 }
 void SurfaceGripperManager::tick(double dt)
 {
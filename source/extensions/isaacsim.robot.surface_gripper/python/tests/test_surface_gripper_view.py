@@ -250,3 +250,62 @@ class TestSurfaceGripperView(omni.kit.test.AsyncTestCase):
         self.assertAlmostEqual(retry_interval[1], retry_interval_new_exp[1])
 
         pass
+
+    async def test_batched_raycasts_with_self_hit(self):
+        # Several grippers whose attachment points sit inside their own body, so every ray first hits the gripper
+        # itself and is cast again past it before reaching the box below
+        gripper_count = 3
+        await self.setup_physics()
+        floor = UsdGeom.Cube.Define(self.stage, "/floor")
+        floor.CreateSizeAttr(1.0)
+        floor.AddTranslateOp().Set(Gf.Vec3f(0.0, 2.0, 0.4))
+        floor.AddScaleOp().Set(Gf.Vec3f(2.0, 8.0, 0.1))
+        UsdPhysics.CollisionAPI.Apply(floor.GetPrim())
+
+        clearance_offset_name = robot_schema.Attributes.CLEARANCE_OFFSET.name
+        joint_paths = []
+        for i in range(gripper_count):
+            env_path = "/env" + str(i)
+            body_path = env_path + "/body"
+            box_path = env_path + "/box"
+            await self.createRigidCube(body_path, 0.0, [0.1, 0.1, 0.1], [0, 2.0 * i, 0.61], [0, 0, 0, 1], [80, 80, 255])
+            await self.createRigidCube(box_path, 0.1, [0.1, 0.1, 0.1], [0, 2.0 * i, 0.5], [0, 0, 0, 1], [255, 80, 80])
+
+            omni.kit.commands.execute("CreateSurfaceGripper", prim_path=env_path)
+            gripper_joints = []
+            for j, x in enumerate([-0.02, 0.02]):
+                joint = UsdPhysics.Joint.Define(self.stage, Sdf.Path(body_path + "/attachment_" + str(j)))
+                joint.CreateBody0Rel().SetTargets([body_path])
+                joint.CreateLocalPos0Attr().Set(Gf.Vec3f(x, 0.0, 0.0))
+                # Forward axis +Z of the joint frame points down
+                joint.CreateLocalRot0Attr().Set(Gf.Quatf(0.0, 1.0, 0.0, 0.0))
+                joint.GetPrim().CreateAttribute(clearance_offset_name, Sdf.ValueTypeNames.Float).Set(0.0)
+                gripper_joints.append(joint.GetPath())
+            gripper_prim = self.stage.GetPrimAtPath(env_path + "/SurfaceGripper")
+            gripper_prim.GetRelationship(robot_schema.Relations.ATTACHMENT_POINTS.name).SetTargets(gripper_joints)
+            joint_paths.append(gripper_joints)
+
+        self.gripper_view = GripperView(paths="/env*/SurfaceGripper")
+        self.gripper_view.set_surface_gripper_properties(
+            max_grip_distance=[0.1] * gripper_count,
+            coaxial_force_limit=[1000.0] * gripper_count,
+            shear_force_limit=[1000.0] * gripper_count,
+            retry_interval=[1.0] * gripper_count,
+        )
+        self._timeline.play()
+        await simulate_async(0.25)
+
+        self.gripper_view.apply_gripper_action([0.5] * gripper_count)
+        await simulate_async(0.5)
+        self.assertEqual(self.gripper_view.get_surface_gripper_status(), ["Closed"] * gripper_count)
+        for i in range(gripper_count):
+            gripped_objects = (
+                self.gripper_view.prims[i].GetRelationship(robot_schema.Relations.GRIPPED_OBJECTS.name).GetTargets()
+            )
+            self.assertEqual(gripped_objects, [Sdf.Path("/env" + str(i) + "/box")])
+            # The retried rays moved the clearance offset past the bottom of the gripper body
+            for joint_path in joint_paths[i]:
+                clearance_offset = self.stage.GetPrimAtPath(joint_path).GetAttribute(clearance_offset_name).Get()
+                self.assertGreater(clearance_offset, 0.045)
+                self.assertLess(clearance_offset, 0.06)
+        self._timeline.stop()
@@ -0,0 +1,125 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/** @file
+ * @brief Encoders for publishing `sensor_msgs/msg/CompressedImage` messages
+ * @details
+ * This file provides a dependency-free baseline JPEG and QOI encoder for 8-bit images in the
+ * ROS image encodings used by the bridge, writing into a caller-owned output buffer that is reused
+ * between frames.
+ */
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace isaacsim
+{
+namespace ros2
+{
+namespace bridge
+{
+
+/**
+ * @enum ImageCompression
+ * @brief Compressed image formats supported by ImageEncoder.
+ */
+enum class ImageCompression
+{
+    eJpeg, ///< Lossy baseline JPEG (JFIF), 4:4:4 sampling
+    eQoi, ///< Lossless "Quite OK Image" format
+};
+
+/**
+ * @class ImageEncoder
+ * @brief Encodes 8-bit images to JPEG or QOI.
+ * @details
+ * Accepts images in the `mono8`, `rgb8`, `rgba8`, `bgr8` and `bgra8` ROS encodings. The encoder keeps the
+ * quantization tables of the last JPEG quality it was used with, so an instance should be kept per image
+ * stream rather than created for each frame. An instance must not be used from several threads at once.
+ */
+class ImageEncoder
+{
+public:
+    ImageEncoder();
+
+    /**
+     * @brief Gets the number of channels of a ROS encoding that can be compressed.
+     * @param[in] encoding ROS image encoding of the pixels.
+     * @return Number of 8-bit channels of a pixel, 0 if the encoding is not supported.
+     */
+    static int getNumChannels(const std::string& encoding);
+
+    /**
+     * @brief Gets the `format` field of a `sensor_msgs/msg/CompressedImage` holding an image encoded by this class.
+     * @details
+     * Follows the `<encoding>; <compression> compressed <decoded encoding>` convention of `image_transport`,
+     * so subscribers know the encoding of the source image.
+     *
+     * @param[in] encoding ROS image encoding of the source pixels.
+     * @param[in] compression Compressed image format.
+     * @return Format string.
+     */
+    static std::string getFormat(const std::string& encoding, ImageCompression compression);
+
+    /**
+     * @brief Compresses an image.
+     * @details
+     * The output buffer is cleared first, keeping its capacity so that encoding frames of a stream stops allocating
+     * once the buffer is large enough.
+     *
+     * @param[in] pixels Tightly packed rows of pixels.
+     * @param[in] width Image width.
+     * @param[in] height Image height.
+     * @param[in] encoding ROS image encoding of the pixels.
+     * @param[in] compression Compressed image format.
+     * @param[in] quality JPEG quality in [1, 100], ignored for lossless formats.
+     * @param[out] output Compressed image.
+     * @return True if the image was compressed, false if the encoding is not supported or the image is empty.
+     */
+    bool encode(const uint8_t* pixels,
+                uint32_t width,
+                uint32_t height,
+                const std::string& encoding,
+                ImageCompression compression,
+                int quality,
+                std::vector<uint8_t>& output);
+
+private:
+    void encodeJpeg(const uint8_t* pixels,
+                    uint32_t width,
+                    uint32_t height,
+                    int channels,
+                    bool bgr,
+                    int quality,
+                    std::vector<uint8_t>& output);
+    void encodeQoi(
+        const uint8_t* pixels, uint32_t width, uint32_t height, int channels, bool bgr, std::vector<uint8_t>& output);
+    void setJpegQuality(int quality);
+
+    /** @brief JPEG quality the quantization tables were computed for */
+    int m_quality = -1;
+
+    /** @brief Luminance and chrominance quantization tables, in zigzag order as written to the file */
+    uint8_t m_quantTables[2][64];
+
+    /** @brief Scale factors applied to DCT coefficients, combining the quantization and the DCT normalization */
+    float m_dctScales[2][64];
+};
+
+} // namespace bridge
+} // namespace ros2
+} // namespace isaacsim
@@ -347,6 +347,15 @@ public:
      * @return True if the node name is valid, false otherwise.
      */
     virtual bool validateNodeName(const std::string& nodeName) = 0;
+
+    /**
+     * @brief Create a ROS 2 `sensor_msgs/msg/CompressedImage` message.
+     * @details
+     * Creates a message that can be used to publish compressed (e.g. JPEG) image data.
+     *
+     * @return Shared pointer to the created compressed image message.
+     */
+    virtual std::shared_ptr<Ros2CompressedImageMessage> createCompressedImageMessage() = 0;
 };
 
 } // namespace bridge
@@ -172,6 +172,12 @@ public:
      * @return bool True if the node name is valid
      */
     virtual bool validateNodeName(const std::string& nodeName);
+
+    /**
+     * @brief Creates a Compressed Image message
+     * @return std::shared_ptr<Ros2CompressedImageMessage> Pointer to the created message
+     */
+    virtual std::shared_ptr<Ros2CompressedImageMessage> createCompressedImageMessage();
 };
 
 } // namespace bridge
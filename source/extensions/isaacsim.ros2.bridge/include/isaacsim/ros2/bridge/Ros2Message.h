@@ -261,6 +261,52 @@ protected:
     size_t m_totalBytes = 0;
 };
 
+/**
+ * @class Ros2CompressedImageMessage
+ * @brief Class implementing a `sensor_msgs/msg/CompressedImage` message.
+ * @details
+ * Provides functionality to write ROS 2 CompressedImage messages. The compressed image is written into a buffer
+ * owned by the message, which keeps its capacity between publishes.
+ */
+class Ros2CompressedImageMessage : public Ros2Message
+{
+public:
+    /**
+     * @brief Write the message header.
+     * @details
+     * Sets the header fields in a ROS 2 CompressedImage message.
+     *
+     * @param[in] timeStamp Time (seconds).
+     * @param[in] frameId Transform frame with which this data is associated.
+     */
+    virtual void writeHeader(const double timeStamp, const std::string& frameId) = 0;
+
+    /**
+     * @brief Write the format and set the `data` field to the compressed image in the buffer.
+     * @details
+     * Must be called after the buffer returned by getBuffer() is filled, and before publishing.
+     *
+     * @param[in] format Format of the compressed image (e.g. `rgb8; jpeg compressed bgr8`).
+     */
+    virtual void writeData(const std::string& format) = 0;
+
+    /**
+     * @brief Get the buffer the compressed image is written to.
+     *
+     * @return Buffer.
+     */
+    std::vector<uint8_t>& getBuffer()
+    {
+        return m_buffer;
+    }
+
+protected:
+    /**
+     * @brief Buffer (compressed image data).
+     */
+    std::vector<uint8_t> m_buffer;
+};
+
 /**
  * @class Ros2NitrosBridgeImageMessage
  * @brief Class implementing a `isaac_ros_nitros_bridge_interfaces/msg/NitrosBridgeImage` message.
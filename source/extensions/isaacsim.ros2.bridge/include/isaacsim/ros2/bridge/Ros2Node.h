@@ -106,6 +106,7 @@ public:
             // m_nodeHandle->getContextHandle()->shutdown();
             m_nodeHandle.reset();
         }
+        m_drainingSubscriber = false;
     }
 
     /**
@@ -277,6 +278,57 @@ public:
         return namespaceString;
     }
 
+    /**
+     * @brief Takes messages from a subscriber according to a message mode
+     * @details
+     * With "next" the oldest pending message is taken. With "latest" the whole queue is drained
+     * and only the newest message is kept in msg, which bounds the latency when the publisher is
+     * faster than the simulation. With "all" the oldest pending message is taken and the node is
+     * left draining, so later calls in the same tick keep taking the queued messages in order until
+     * none remain (see isDrainingSubscriber()).
+     *
+     * @param[in] subscriber Subscriber to take messages from
+     * @param[out] msg Pointer to store the received message
+     * @param[in] messageMode One of "next", "latest" or "all"
+     * @return bool True if a message was stored in msg
+     */
+    bool takeMessage(Ros2Subscriber& subscriber, void* msg, const std::string& messageMode)
+    {
+        if (m_drainingSubscriber)
+        {
+            m_drainingSubscriber = messageMode == "all" && subscriber.takeNext(msg);
+            return m_drainingSubscriber;
+        }
+        if (!subscriber.spin(msg))
+        {
+            return false;
+        }
+        if (messageMode == "latest")
+        {
+            while (subscriber.takeNext(msg))
+            {
+            }
+        }
+        else if (messageMode == "all")
+        {
+            m_drainingSubscriber = true;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Checks whether the subscriber is being drained in "all" message mode
+     * @details
+     * Subscriber nodes use this to re-trigger their execution output with a push, so that
+     * downstream nodes run once per message before the next queued message is taken.
+     *
+     * @return bool True if more queued messages may be pending
+     */
+    bool isDrainingSubscriber() const
+    {
+        return m_drainingSubscriber;
+    }
+
 private:
     /**
      * @brief Sanitizes a name for ROS 2 use
@@ -336,6 +388,7 @@ protected:
     Ros2Factory* m_factory = nullptr; //!< Factory instance for creating ROS 2 related objects according to the sourced
                                       //!< ROS 2 distribution.
     std::string m_namespaceName; //!< Namespace name.
+    bool m_drainingSubscriber = false; //!< Whether queued messages are being taken one per compute ("all" mode).
 };
 
 } // namespace bridge
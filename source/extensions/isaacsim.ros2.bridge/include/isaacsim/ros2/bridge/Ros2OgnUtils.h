@@ -414,9 +414,9 @@ inline bool createOgAttributesForMessage(OgnROS2DatabaseDerivedType& db,
 /**
  * @brief Reads attribute data from an OmniGraph node and writes it to a ROS 2 message
  * @details
- * Transfers data from OmniGraph node attributes to a ROS 2 message. This function handles
- * various data types and their conversion between OmniGraph and ROS 2 representations.
- * It supports both scalar and array attributes of different primitive types.
+ * Transfers data from OmniGraph node attributes to a ROS 2 message. Numeric and boolean fields are
+ * copied directly from the attribute memory into the message using the message's precomputed field
+ * offsets. String and embedded message array fields go through the message's vector container.
  *
  * @param[in] db OmniGraph database instance
  * @param[in,out] message ROS 2 message to be populated with node data
@@ -429,286 +429,94 @@ inline bool writeMessageDataFromNode(OmniGraphDatabase& db,
                                      std::string prependStr,
                                      bool isOutput)
 {
-    auto messageFields = std::static_pointer_cast<Ros2DynamicMessage>(message)->getMessageFields();
-    std::vector<std::shared_ptr<void>> messageData;
+    auto dynamicMessage = std::static_pointer_cast<Ros2DynamicMessage>(message);
+    const auto& messageFields = dynamicMessage->getMessageFields();
+    const auto& messageData = dynamicMessage->getVectorContainer(true);
+    const std::string prefix = inputOutput(isOutput) + ":" + prependStr;
     for (size_t i = 0; i < messageFields.size(); ++i)
     {
-        auto messageField = messageFields.at(i);
+        const auto& messageField = messageFields[i];
+        const std::string attrName = prefix + messageField.name;
         switch (messageField.dataType)
         {
-        case omni::fabric::BaseDataType::eBool:
-        {
-            if (messageField.isArray)
-            {
-                size_t inputSize;
-                auto inputValue = getAttributeReadableArrayData<bool*>(
-                    db.abi_node(), inputOutput(isOutput) + ":" + prependStr + messageField.name, inputSize);
-                std::vector<bool> data(inputSize);
-                if (checkCondition(inputValue, "Unable to read bool array"))
-                {
-                    // std::vector<bool> is a specialization that has no ::data
-                    for (size_t j = 0; j < data.size(); ++j)
-                    {
-                        data[j] = *(*inputValue + j);
-                    }
-                }
-                messageData.push_back(std::make_shared<std::vector<bool>>(data));
-            }
-            else
-            {
-                auto inputValue = getAttributeReadableData<bool>(
-                    db.abi_node(), inputOutput(isOutput) + ":" + prependStr + messageField.name);
-                if (checkCondition(inputValue, "Unable to read bool value"))
-                {
-                    messageData.push_back(std::make_shared<bool>(inputValue ? *inputValue : false));
-                }
-            }
-            break;
-        }
-        case omni::fabric::BaseDataType::eUChar:
-        {
-            if (messageField.isArray)
-            {
-                size_t inputSize;
-                auto inputValue = getAttributeReadableArrayData<uint8_t*>(
-                    db.abi_node(), inputOutput(isOutput) + ":" + prependStr + messageField.name, inputSize);
-                std::vector<uint8_t> data(inputSize);
-                if (checkCondition(inputValue, "Unable to read uchar array"))
-                {
-                    std::memcpy(data.data(), *inputValue, inputSize * sizeof(uint8_t));
-                }
-                messageData.push_back(std::make_shared<std::vector<uint8_t>>(data));
-            }
-            else
-            {
-                auto inputValue = getAttributeReadableData<uint8_t>(
-                    db.abi_node(), inputOutput(isOutput) + ":" + prependStr + messageField.name);
-                if (checkCondition(inputValue, "Unable to read uchar value"))
-                {
-                    messageData.push_back(std::make_shared<uint8_t>(inputValue ? *inputValue : 0));
-                }
-            }
-            break;
-        }
-        case omni::fabric::BaseDataType::eInt:
-        {
-            if (messageField.isArray)
-            {
-                size_t inputSize;
-                auto inputValue = getAttributeReadableArrayData<int32_t*>(
-                    db.abi_node(), inputOutput(isOutput) + ":" + prependStr + messageField.name, inputSize);
-                std::vector<int32_t> data(inputSize);
-                if (checkCondition(inputValue, "Unable to read int32 array"))
-                {
-                    std::memcpy(data.data(), *inputValue, inputSize * sizeof(int32_t));
-                }
-                messageData.push_back(std::make_shared<std::vector<int32_t>>(data));
-            }
-            else
-            {
-                auto inputValue = getAttributeReadableData<int32_t>(
-                    db.abi_node(), inputOutput(isOutput) + ":" + prependStr + messageField.name);
-                if (checkCondition(inputValue, "Unable to read int32 value"))
-                {
-                    messageData.push_back(std::make_shared<int32_t>(inputValue ? *inputValue : 0));
-                }
-            }
-            break;
-        }
-        case omni::fabric::BaseDataType::eUInt:
-        {
-            if (messageField.isArray)
-            {
-                size_t inputSize;
-                auto inputValue = getAttributeReadableArrayData<uint32_t*>(
-                    db.abi_node(), inputOutput(isOutput) + ":" + prependStr + messageField.name, inputSize);
-                std::vector<uint32_t> data(inputSize);
-                if (checkCondition(inputValue, "Unable to read uint32 array"))
-                {
-                    std::memcpy(data.data(), *inputValue, inputSize * sizeof(uint32_t));
-                }
-                messageData.push_back(std::make_shared<std::vector<uint32_t>>(data));
-            }
-            else
-            {
-                auto inputValue = getAttributeReadableData<uint32_t>(
-                    db.abi_node(), inputOutput(isOutput) + ":" + prependStr + messageField.name);
-                if (checkCondition(inputValue, "Unable to read uint32 value"))
-                {
-                    messageData.push_back(std::make_shared<uint32_t>(inputValue ? *inputValue : 0));
-                }
-            }
-            break;
-        }
-        case omni::fabric::BaseDataType::eInt64:
-        {
-            if (messageField.isArray)
-            {
-                size_t inputSize;
-                auto inputValue = getAttributeReadableArrayData<int64_t*>(
-                    db.abi_node(), inputOutput(isOutput) + ":" + prependStr + messageField.name, inputSize);
-                std::vector<int64_t> data(inputSize);
-                if (checkCondition(inputValue, "Unable to read int64 array"))
-                {
-                    std::memcpy(data.data(), *inputValue, inputSize * sizeof(int64_t));
-                }
-                messageData.push_back(std::make_shared<std::vector<int64_t>>(data));
-            }
-            else
-            {
-                auto inputValue = getAttributeReadableData<int64_t>(
-                    db.abi_node(), inputOutput(isOutput) + ":" + prependStr + messageField.name);
-                if (checkCondition(inputValue, "Unable to read int64 value"))
-                {
-                    messageData.push_back(std::make_shared<int64_t>(inputValue ? *inputValue : 0));
-                }
-            }
-            break;
-        }
-        case omni::fabric::BaseDataType::eUInt64:
-        {
-            if (messageField.isArray)
-            {
-                size_t inputSize;
-                auto inputValue = getAttributeReadableArrayData<uint64_t*>(
-                    db.abi_node(), inputOutput(isOutput) + ":" + prependStr + messageField.name, inputSize);
-                std::vector<uint64_t> data(inputSize);
-                if (checkCondition(inputValue, "Unable to read uint64 array"))
-                {
-                    std::memcpy(data.data(), *inputValue, inputSize * sizeof(uint64_t));
-                }
-                messageData.push_back(std::make_shared<std::vector<uint64_t>>(data));
-            }
-            else
-            {
-                auto inputValue = getAttributeReadableData<uint64_t>(
-                    db.abi_node(), inputOutput(isOutput) + ":" + prependStr + messageField.name);
-                if (checkCondition(inputValue, "Unable to read uint64 value"))
-                {
-                    messageData.push_back(std::make_shared<uint64_t>(inputValue ? *inputValue : 0));
-                }
-            }
-            break;
-        }
-        case omni::fabric::BaseDataType::eFloat:
+        case omni::fabric::BaseDataType::eToken:
         {
             if (messageField.isArray)
             {
-                size_t inputSize;
-                auto inputValue = getAttributeReadableArrayData<float*>(
-                    db.abi_node(), inputOutput(isOutput) + ":" + prependStr + messageField.name, inputSize);
-                std::vector<float> data(inputSize);
-                if (checkCondition(inputValue, "Unable to read float array"))
+                size_t inputSize = 0;
+                auto inputValue = getAttributeReadableArrayData<NameToken*>(db.abi_node(), attrName, inputSize);
+                auto data = std::static_pointer_cast<std::vector<std::string>>(messageData[i]);
+                data->resize(checkCondition(inputValue, "Unable to read token array") ? inputSize : 0);
+                for (size_t j = 0; j < data->size(); ++j)
                 {
-                    std::memcpy(data.data(), *inputValue, inputSize * sizeof(float));
+                    (*data)[j] = db.tokenToString(*(*inputValue + j));
                 }
-                messageData.push_back(std::make_shared<std::vector<float>>(data));
             }
             else
             {
-                auto inputValue = getAttributeReadableData<float>(
-                    db.abi_node(), inputOutput(isOutput) + ":" + prependStr + messageField.name);
-                if (checkCondition(inputValue, "Unable to read float value"))
-                {
-                    messageData.push_back(std::make_shared<float>(inputValue ? *inputValue : 0.0));
-                }
+                auto inputValue = getAttributeReadableData<NameToken>(db.abi_node(), attrName);
+                *std::static_pointer_cast<std::string>(messageData[i]) =
+                    checkCondition(inputValue, "Unable to read token value") ? db.tokenToString(*inputValue) : "";
             }
+            dynamicMessage->writeFieldValue(i, messageData[i], true);
             break;
         }
-        case omni::fabric::BaseDataType::eDouble:
+        case omni::fabric::BaseDataType::eUnknown:
         {
-            if (messageField.isArray)
-            {
-                size_t inputSize;
-                auto inputValue = getAttributeReadableArrayData<double*>(
-                    db.abi_node(), inputOutput(isOutput) + ":" + prependStr + messageField.name, inputSize);
-                std::vector<double> data(inputSize);
-                if (checkCondition(inputValue, "Unable to read double array"))
-                {
-                    std::memcpy(data.data(), *inputValue, inputSize * sizeof(double));
-                }
-                messageData.push_back(std::make_shared<std::vector<double>>(data));
-            }
-            else
+            if (messageField.isArray && messageData[i])
             {
-                auto inputValue = getAttributeReadableData<double>(
-                    db.abi_node(), inputOutput(isOutput) + ":" + prependStr + messageField.name);
-                if (checkCondition(inputValue, "Unable to read double value"))
+                size_t inputSize = 0;
+                auto inputValue = getAttributeReadableArrayData<NameToken*>(db.abi_node(), attrName, inputSize);
+                auto data = std::static_pointer_cast<std::vector<nlohmann::json>>(messageData[i]);
+                data->resize(checkCondition(inputValue, "Unable to read message array") ? inputSize : 0);
+                for (size_t j = 0; j < data->size(); ++j)
                 {
-                    messageData.push_back(std::make_shared<double>(inputValue ? *inputValue : 0.0));
+                    (*data)[j] = nlohmann::json::parse(db.tokenToString(*(*inputValue + j)), nullptr, false);
+                    if ((*data)[j].is_discarded())
+                    {
+                        CARB_LOG_ERROR("Unable to parse %s[%zu] as a JSON message", attrName.c_str(), j);
+                        return false;
+                    }
                 }
+                dynamicMessage->writeFieldValue(i, messageData[i], true);
             }
             break;
         }
-        case omni::fabric::BaseDataType::eToken:
+        default:
         {
+            bool status = false;
             if (messageField.isArray)
             {
-                size_t inputSize;
-                auto inputValue = getAttributeReadableArrayData<NameToken*>(
-                    db.abi_node(), inputOutput(isOutput) + ":" + prependStr + messageField.name, inputSize);
-                std::vector<std::string> data(inputSize);
-                if (checkCondition(inputValue, "Unable to read token array"))
-                {
-                    for (size_t j = 0; j < data.size(); ++j)
-                    {
-                        data[j] = db.tokenToString(*(*inputValue + j));
-                    }
-                }
-                messageData.push_back(std::make_shared<std::vector<std::string>>(data));
+                size_t inputSize = 0;
+                auto inputValue = getAttributeReadableArrayData<uint8_t*>(db.abi_node(), attrName, inputSize);
+                status = checkCondition(inputValue, "Unable to read array") &&
+                         dynamicMessage->writeField(i, *inputValue, inputSize);
             }
             else
             {
-                auto inputValue = getAttributeReadableData<NameToken>(
-                    db.abi_node(), inputOutput(isOutput) + ":" + prependStr + messageField.name);
-                std::string str = inputValue ? db.tokenToString(*inputValue) : "";
-                if (checkCondition(inputValue, "Unable to read token value"))
-                {
-                    messageData.push_back(std::make_shared<std::string>(str));
-                }
+                auto inputValue = getAttributeReadableData<uint8_t>(db.abi_node(), attrName);
+                status =
+                    checkCondition(inputValue, "Unable to read value") && dynamicMessage->writeField(i, inputValue, 1);
             }
-            break;
-        }
-        case omni::fabric::BaseDataType::eUnknown:
-        {
-            if (messageField.isArray)
+            if (!status)
             {
-                size_t inputSize;
-                auto inputValue = getAttributeReadableArrayData<NameToken*>(
-                    db.abi_node(), inputOutput(isOutput) + ":" + prependStr + messageField.name, inputSize);
-                std::vector<nlohmann::json> data(inputSize);
-                if (checkCondition(inputValue, "Unable to read message array"))
-                {
-                    for (size_t j = 0; j < data.size(); ++j)
-                    {
-                        data[j] = db.tokenToString(*(*inputValue + j));
-                    }
-                }
-                messageData.push_back(std::make_shared<std::vector<nlohmann::json>>(data));
+                CARB_LOG_ERROR("writeMessageDataFromNode unable to write %s (data type %d)", attrName.c_str(),
+                               int(messageField.dataType));
+                return false;
             }
             break;
         }
-
-        default:
-        {
-            CARB_LOG_ERROR("writeMessageDataFromNode data type %d didn't match any of the implemented type.",
-                           int(messageField.dataType));
-            return false;
-            break;
-        }
         }
     }
-
-    std::static_pointer_cast<Ros2DynamicMessage>(message)->writeData(messageData, true);
     return true;
 }
 
 /**
  * @brief Reads data from a ROS 2 message and writes it to OmniGraph node attributes
  * @details
- * Transfers data from a ROS 2 message to OmniGraph node attributes. This function handles
- * various data types and their conversion between ROS 2 and OmniGraph representations.
- * It supports both scalar and array values of different primitive types.
+ * Transfers data from a ROS 2 message to OmniGraph node attributes. Numeric and boolean fields are
+ * copied directly from the message into the attribute memory using the message's precomputed field
+ * offsets. String and embedded message array fields go through the message's vector container.
  *
  * @param[in] db OmniGraph database instance
  * @param[in] message ROS 2 message to read data from
@@ -721,260 +529,87 @@ inline bool writeNodeAttributeFromMessage(OmniGraphDatabase& db,
                                           std::string prependStr,
                                           bool isOutput)
 {
-    const std::vector<std::shared_ptr<void>> messageData =
-        std::static_pointer_cast<Ros2DynamicMessage>(message)->readData(true);
-    auto messageFields = std::static_pointer_cast<Ros2DynamicMessage>(message)->getMessageFields();
-    CARB_ASSERT(messageFields.size() == messageData.size());
-
+    auto dynamicMessage = std::static_pointer_cast<Ros2DynamicMessage>(message);
+    const auto& messageFields = dynamicMessage->getMessageFields();
+    const std::string prefix = inputOutput(isOutput) + ":" + prependStr;
     for (size_t i = 0; i < messageFields.size(); ++i)
     {
-        if (!messageData.at(i))
-        {
-            continue;
-        }
-        auto messageField = messageFields.at(i);
+        const auto& messageField = messageFields[i];
+        const std::string attrName = prefix + messageField.name;
         switch (messageField.dataType)
         {
-        case omni::fabric::BaseDataType::eBool:
+        case omni::fabric::BaseDataType::eToken:
         {
+            const auto& value = dynamicMessage->readFieldValue(i, true);
             if (messageField.isArray)
             {
-                auto data = *std::static_pointer_cast<std::vector<bool>>(messageData.at(i));
-                auto outputValue = getAttributeWritableArrayData<bool*>(
-                    db.abi_node(), inputOutput(isOutput) + ":" + prependStr + messageField.name, data.size());
-                if (checkCondition(outputValue, "Unable to write bool array"))
+                const auto& stringValues = *std::static_pointer_cast<const std::vector<std::string>>(value);
+                auto outputValue =
+                    getAttributeWritableArrayData<NameToken*>(db.abi_node(), attrName, stringValues.size());
+                if (checkCondition(outputValue, "Unable to write token array"))
                 {
-                    // std::vector<bool> is a specialization that has no ::data
-                    for (size_t j = 0; j < data.size(); ++j)
+                    for (size_t j = 0; j < stringValues.size(); ++j)
                     {
-                        *((*outputValue) + j) = data.at(j);
+                        *((*outputValue) + j) = db.stringToToken(stringValues[j].c_str());
                     }
                 }
             }
             else
             {
-                auto outputValue = getAttributeWritableData<bool>(
-                    db.abi_node(), inputOutput(isOutput) + ":" + prependStr + messageField.name);
-                if (checkCondition(outputValue, "Unable to write bool value"))
-                {
-                    *outputValue = *std::static_pointer_cast<bool>(messageData.at(i));
-                }
-            }
-            break;
-        }
-        case omni::fabric::BaseDataType::eUChar:
-        {
-            if (messageField.isArray)
-            {
-
-                auto data = *std::static_pointer_cast<std::vector<uint8_t>>(messageData.at(i));
-                auto outputValue = getAttributeWritableArrayData<uint8_t*>(
-                    db.abi_node(), inputOutput(isOutput) + ":" + prependStr + messageField.name, data.size());
-                if (checkCondition(outputValue, "Unable to write uchar array"))
-                {
-                    std::memcpy(*outputValue, data.data(), data.size() * sizeof(uint8_t));
-                }
-            }
-            else
-            {
-                auto outputValue = getAttributeWritableData<uint8_t>(
-                    db.abi_node(), inputOutput(isOutput) + ":" + prependStr + messageField.name);
-                if (checkCondition(outputValue, "Unable to write uchar value"))
-                {
-                    *outputValue = *std::static_pointer_cast<uint8_t>(messageData.at(i));
-                }
-            }
-            break;
-        }
-        case omni::fabric::BaseDataType::eInt:
-        {
-            if (messageField.isArray)
-            {
-                auto data = *std::static_pointer_cast<std::vector<int32_t>>(messageData.at(i));
-                auto outputValue = getAttributeWritableArrayData<int32_t*>(
-                    db.abi_node(), inputOutput(isOutput) + ":" + prependStr + messageField.name, data.size());
-                if (checkCondition(outputValue, "Unable to write int array"))
-                {
-                    std::memcpy(*outputValue, data.data(), data.size() * sizeof(int32_t));
-                }
-            }
-            else
-            {
-                auto outputValue = getAttributeWritableData<int32_t>(
-                    db.abi_node(), inputOutput(isOutput) + ":" + prependStr + messageField.name);
-                if (checkCondition(outputValue, "Unable to write int value"))
-                {
-                    *outputValue = *std::static_pointer_cast<int32_t>(messageData.at(i));
-                }
-            }
-            break;
-        }
-        case omni::fabric::BaseDataType::eUInt:
-        {
-            if (messageField.isArray)
-            {
-                auto data = *std::static_pointer_cast<std::vector<uint32_t>>(messageData.at(i));
-                auto outputValue = getAttributeWritableArrayData<uint32_t*>(
-                    db.abi_node(), inputOutput(isOutput) + ":" + prependStr + messageField.name, data.size());
-                if (checkCondition(outputValue, "unable to write uint array"))
-                {
-                    std::memcpy(*outputValue, data.data(), data.size() * sizeof(uint32_t));
-                }
-            }
-            else
-            {
-                auto outputValue = getAttributeWritableData<uint32_t>(
-                    db.abi_node(), inputOutput(isOutput) + ":" + prependStr + messageField.name);
-                if (checkCondition(outputValue, "unable to write uint value"))
-                {
-                    *outputValue = *std::static_pointer_cast<uint32_t>(messageData.at(i));
-                }
-            }
-            break;
-        }
-        case omni::fabric::BaseDataType::eInt64:
-        {
-            if (messageField.isArray)
-            {
-                auto data = *std::static_pointer_cast<std::vector<int64_t>>(messageData.at(i));
-                auto outputValue = getAttributeWritableArrayData<int64_t*>(
-                    db.abi_node(), inputOutput(isOutput) + ":" + prependStr + messageField.name, data.size());
-                if (checkCondition(outputValue, "Unable to write int64 array"))
-                {
-                    std::memcpy(*outputValue, data.data(), data.size() * sizeof(int64_t));
-                }
-            }
-            else
-            {
-                auto outputValue = getAttributeWritableData<int64_t>(
-                    db.abi_node(), inputOutput(isOutput) + ":" + prependStr + messageField.name);
-                if (checkCondition(outputValue, "Unable to write int64 value"))
-                {
-                    *outputValue = *std::static_pointer_cast<int64_t>(messageData.at(i));
-                }
-            }
-            break;
-        }
-        case omni::fabric::BaseDataType::eUInt64:
-        {
-            if (messageField.isArray)
-            {
-                auto data = *std::static_pointer_cast<std::vector<uint64_t>>(messageData.at(i));
-                auto outputValue = getAttributeWritableArrayData<uint64_t*>(
-                    db.abi_node(), inputOutput(isOutput) + ":" + prependStr + messageField.name, data.size());
-                if (checkCondition(outputValue, "Unable to write uint64 array"))
-                {
-                    std::memcpy(*outputValue, data.data(), data.size() * sizeof(uint64_t));
-                }
-            }
-            else
-            {
-                auto outputValue = getAttributeWritableData<uint64_t>(
-                    db.abi_node(), inputOutput(isOutput) + ":" + prependStr + messageField.name);
-                if (checkCondition(outputValue, "Unable to write uint64 value"))
+                auto outputValue = getAttributeWritableData<NameToken>(db.abi_node(), attrName);
+                if (checkCondition(outputValue, "Unable to write token value"))
                 {
-                    *outputValue = *std::static_pointer_cast<uint64_t>(messageData.at(i));
+                    *outputValue = db.stringToToken(std::static_pointer_cast<const std::string>(value)->c_str());
                 }
             }
             break;
         }
-        case omni::fabric::BaseDataType::eFloat:
+        case omni::fabric::BaseDataType::eUnknown:
         {
-            if (messageField.isArray)
+            if (!messageField.isArray)
             {
-                auto data = *std::static_pointer_cast<std::vector<float>>(messageData.at(i));
-                auto outputValue =
-                    getAttributeWritableArrayData<float*>(db.abi_node(), "outputs:" + messageField.name, data.size());
-                if (checkCondition(outputValue, "Unable to write float array"))
-                {
-                    std::memcpy(*outputValue, data.data(), data.size() * sizeof(float));
-                }
+                break;
             }
-            else
+            const auto& value = dynamicMessage->readFieldValue(i, true);
+            if (!value)
             {
-                auto outputValue = getAttributeWritableData<float>(db.abi_node(), "outputs:" + messageField.name);
-                if (checkCondition(outputValue, "Unable to write float value"))
-                {
-                    *outputValue = *std::static_pointer_cast<float>(messageData.at(i));
-                }
-            }
-            break;
-        }
-        case omni::fabric::BaseDataType::eDouble:
-        {
-            if (messageField.isArray)
-            {
-
-                auto data = *std::static_pointer_cast<std::vector<double>>(messageData.at(i));
-                auto outputValue = getAttributeWritableArrayData<double*>(
-                    db.abi_node(), inputOutput(isOutput) + ":" + prependStr + messageField.name, data.size());
-                if (checkCondition(outputValue, "Unable to write double array"))
-                {
-                    std::memcpy(*outputValue, data.data(), data.size() * sizeof(double));
-                }
+                break;
             }
-            else
+            const auto& array = *std::static_pointer_cast<const std::vector<nlohmann::json>>(value);
+            auto outputValue = getAttributeWritableArrayData<NameToken*>(db.abi_node(), attrName, array.size());
+            if (checkCondition(outputValue, "Unable to write message array"))
             {
-                auto outputValue = getAttributeWritableData<double>(
-                    db.abi_node(), inputOutput(isOutput) + ":" + prependStr + messageField.name);
-                if (checkCondition(outputValue, "Unable to write double value"))
+                for (size_t j = 0; j < array.size(); ++j)
                 {
-                    *outputValue = *std::static_pointer_cast<double>(messageData.at(i));
+                    *((*outputValue) + j) = db.stringToToken(array[j].dump().c_str());
                 }
             }
             break;
         }
-        case omni::fabric::BaseDataType::eToken:
+        default:
         {
+            bool status = false;
             if (messageField.isArray)
             {
-                auto stringValues = *std::static_pointer_cast<std::vector<std::string>>(messageData.at(i));
-                auto outputValue = getAttributeWritableArrayData<NameToken*>(
-                    db.abi_node(), inputOutput(isOutput) + ":" + prependStr + messageField.name, stringValues.size());
-                if (checkCondition(outputValue, "Unable to write token array"))
-                {
-                    for (size_t j = 0; j < stringValues.size(); ++j)
-                    {
-                        *((*outputValue) + j) = db.stringToToken(stringValues.at(j).c_str());
-                    }
-                }
+                size_t size = dynamicMessage->getFieldSize(i);
+                auto outputValue = getAttributeWritableArrayData<uint8_t*>(db.abi_node(), attrName, size);
+                status = checkCondition(outputValue, "Unable to write array") &&
+                         dynamicMessage->readField(i, *outputValue, size);
             }
             else
             {
-                auto stringValue = *std::static_pointer_cast<std::string>(messageData.at(i));
-                auto outputValue = getAttributeWritableData<NameToken>(
-                    db.abi_node(), inputOutput(isOutput) + ":" + prependStr + messageField.name);
-                if (checkCondition(outputValue, "Unable to write token value"))
-                {
-                    *outputValue = db.stringToToken(stringValue.c_str());
-                }
+                auto outputValue = getAttributeWritableData<uint8_t>(db.abi_node(), attrName);
+                status =
+                    checkCondition(outputValue, "Unable to write value") && dynamicMessage->readField(i, outputValue, 1);
             }
-            break;
-        }
-        case omni::fabric::BaseDataType::eUnknown:
-        {
-            if (messageField.isArray)
+            if (!status)
             {
-                auto array = *std::static_pointer_cast<const std::vector<nlohmann::json>>(messageData.at(i));
-                auto outputValue = getAttributeWritableArrayData<NameToken*>(
-                    db.abi_node(), "outputs:" + messageField.name, array.size());
-                if (checkCondition(outputValue, "Unable to write message array"))
-                {
-                    for (size_t j = 0; j < array.size(); ++j)
-                    {
-                        *((*outputValue) + j) = db.stringToToken(array.at(j).dump().c_str());
-                    }
-                }
+                CARB_LOG_ERROR("writeNodeAttributeFromMessage unable to read %s (data type %d)", attrName.c_str(),
+                               int(messageField.dataType));
+                return false;
             }
             break;
         }
-        default:
-        {
-            CARB_LOG_ERROR("writeNodeAttributeFromMessage data type %d didn't match any of the implemented type.",
-                           int(messageField.dataType));
-            return false;
-            break;
-        }
         }
     }
     return true;
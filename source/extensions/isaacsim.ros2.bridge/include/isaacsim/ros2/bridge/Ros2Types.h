@@ -287,6 +287,69 @@ public:
         return m_msg != nullptr;
     }
 
+    /**
+     * @brief Gets the number of elements of a message field.
+     * @details
+     * Returns the current length of array fields (sequence size or fixed array size), or 1 for non-array fields.
+     *
+     * @param[in] index Index of the field in getMessageFields().
+     * @return Number of elements, or 0 if the index is out of range.
+     */
+    virtual size_t getFieldSize(size_t index) = 0;
+
+    /**
+     * @brief Copies a message field directly into OmniGraph typed memory.
+     * @details
+     * Uses the field offsets precomputed for the message type, converting each element to the
+     * field's OmniGraph type (see DynamicMessageField::dataType) without intermediate containers.
+     * At most count elements are copied.
+     *
+     * @param[in] index Index of the field in getMessageFields().
+     * @param[out] dst Destination memory for the field elements.
+     * @param[in] count Number of elements available at dst.
+     * @return True if the field was copied, false for string and embedded message array fields.
+     *
+     * @note String and embedded message array fields must be read through readFieldValue().
+     */
+    virtual bool readField(size_t index, void* dst, size_t count) = 0;
+
+    /**
+     * @brief Copies a message field directly from OmniGraph typed memory.
+     * @details
+     * Counterpart of readField(). Non-fixed size array fields are resized to count elements,
+     * reusing the allocated capacity when possible.
+     *
+     * @param[in] index Index of the field in getMessageFields().
+     * @param[in] src Source memory holding the field elements as OmniGraph types.
+     * @param[in] count Number of elements at src.
+     * @return True if the field was copied, false for string and embedded message array fields.
+     *
+     * @note String and embedded message array fields must be written through writeFieldValue().
+     */
+    virtual bool writeField(size_t index, const void* src, size_t count) = 0;
+
+    /**
+     * @brief Reads a single message field into its vector container entry.
+     * @details
+     * Same conversion as readData(bool) but for one field only.
+     *
+     * @param[in] index Index of the field in getMessageFields().
+     * @param[in] asOgnType Whether to return OmniGraph or ROS 2 data types.
+     * @return The updated container entry of the field.
+     */
+    virtual const std::shared_ptr<void>& readFieldValue(size_t index, bool asOgnType) = 0;
+
+    /**
+     * @brief Writes a single message field from vector container data.
+     * @details
+     * Same conversion as writeData(const std::vector<std::shared_ptr<void>>&, bool) but for one field only.
+     *
+     * @param[in] index Index of the field in getMessageFields().
+     * @param[in] value Field data.
+     * @param[in] fromOgnType Whether input data uses OmniGraph types.
+     */
+    virtual void writeFieldValue(size_t index, const std::shared_ptr<void>& value, bool fromOgnType) = 0;
+
 protected:
     std::vector<DynamicMessageField> m_messagesFields; /**< Message fields description. */
     nlohmann::json m_messageJsonContainer; /**< JSON message container. */
@@ -476,6 +539,21 @@ public:
      * @note A subscriber may become invalid if its associated node or context is destroyed.
      */
     virtual bool isValid() = 0;
+
+    /**
+     * @brief Takes the next message already queued on the subscription.
+     * @details
+     * Unlike spin(), this does not wait on the subscription first, so it can be called
+     * repeatedly after a successful spin() to drain the remaining queued messages
+     * within the same tick.
+     *
+     * @param[out] msg Pointer to store the received message.
+     * @return True if a message was taken, false if the queue is empty.
+     *
+     * @pre The msg pointer must point to a valid message structure of the correct type.
+     * @pre The subscriber must be valid (check with isValid()).
+     */
+    virtual bool takeNext(void* msg) = 0;
 };
 
 /**
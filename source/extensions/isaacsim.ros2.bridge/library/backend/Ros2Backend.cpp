@@ -19,6 +19,7 @@
 #include <isaacsim/ros2/bridge/Ros2Macros.h>
 #include <rcl/rcl.h>
 
+#include <cstring>
 #include <inttypes.h>
 
 namespace isaacsim
@@ -55,6 +56,11 @@ void Ros2MessageInterfaceImpl::writeRosTime(const int64_t nanoseconds, builtin_i
 
 void Ros2MessageInterfaceImpl::writeRosString(const std::string& input, rosidl_runtime_c__String& output)
 {
+    // Frame ids and names rarely change between publishes, so skip reallocating the string when it is unchanged
+    if (output.data && output.size == input.size() && std::memcmp(output.data, input.data(), input.size()) == 0)
+    {
+        return;
+    }
     rosidl_runtime_c__String__assign(&output, input.c_str());
 }
 
@@ -62,7 +68,7 @@ void Ros2MessageInterfaceImpl::writeRosHeader(const std::string& frameId,
                                               const int64_t nanoseconds,
                                               std_msgs__msg__Header& header)
 {
-    writeRosString(frameId.c_str(), header.frame_id);
+    writeRosString(frameId, header.frame_id);
     if (nanoseconds > 0)
     {
         writeRosTime(nanoseconds, header.stamp);
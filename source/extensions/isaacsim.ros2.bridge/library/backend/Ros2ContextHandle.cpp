@@ -47,12 +47,14 @@ void Ros2ContextHandleImpl::init(int argc, char const* const* argv, bool setDoma
     }
 
     m_context = std::shared_ptr<rcl_context_t>(new rcl_context_t,
-                                               [this](rcl_context_t* context)
+                                               [](rcl_context_t* context)
                                                {
+                                                   // The last owner may outlive this handle, such as the
+                                                   // subscription wait set, so only the context is used
                                                    if (nullptr != context->impl)
                                                    {
                                                        rcl_ret_t ret;
-                                                       if (this->isValid())
+                                                       if (rcl_context_is_valid(context))
                                                        {
                                                            // shutdown first, if still valid
                                                            ret = rcl_shutdown(context);
@@ -90,6 +92,16 @@ bool Ros2ContextHandleImpl::isValid()
     return false;
 }
 
+std::shared_ptr<Ros2SubscriptionWaitSet> Ros2ContextHandleImpl::getSubscriptionWaitSet()
+{
+    std::lock_guard<std::mutex> lock(m_subscriptionWaitSetMutex);
+    if (!m_subscriptionWaitSet && m_context)
+    {
+        m_subscriptionWaitSet = std::make_shared<Ros2SubscriptionWaitSet>(m_context);
+    }
+    return m_subscriptionWaitSet;
+}
+
 bool Ros2ContextHandleImpl::shutdown(const char* shutdownReason)
 {
     // If the context is not valid, no need to do cleanup
@@ -97,6 +109,10 @@ bool Ros2ContextHandleImpl::shutdown(const char* shutdownReason)
     {
         return true;
     }
+    {
+        std::lock_guard<std::mutex> lock(m_subscriptionWaitSetMutex);
+        m_subscriptionWaitSet.reset();
+    }
     m_context.reset();
     // Finalize RCL options
     rcl_ret_t rc = rcl_init_options_fini(&m_initOptions);
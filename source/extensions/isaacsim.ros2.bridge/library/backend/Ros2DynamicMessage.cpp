@@ -20,7 +20,10 @@
 
 #include <nlohmann/json.hpp>
 
+#include <algorithm>
+#include <cstring>
 #include <iomanip>
+#include <type_traits>
 
 namespace isaacsim
 {
@@ -41,6 +44,7 @@ Ros2DynamicMessageImpl::Ros2DynamicMessageImpl(std::string pkgName,
     m_messagesFields.clear();
     m_messageVectorRosContainer.clear();
     m_messageVectorOgnContainer.clear();
+    m_fieldAccessPlan.clear();
     m_messageJsonContainer = nlohmann::json::object();
     // get message fields
     const void* members = getIntrospectionMembers();
@@ -76,14 +80,12 @@ const nlohmann::json& Ros2DynamicMessageImpl::readData()
 
 const std::vector<std::shared_ptr<void>>& Ros2DynamicMessageImpl::readData(bool asOgnType)
 {
-    size_t index = 0;
-    const void* members = getIntrospectionMembers();
-    if (members)
+    auto& container = asOgnType ? m_messageVectorOgnContainer : m_messageVectorRosContainer;
+    for (size_t i = 0; i < m_fieldAccessPlan.size(); ++i)
     {
-        getMessageValues(members, reinterpret_cast<uint8_t*>(m_msg),
-                         asOgnType ? m_messageVectorOgnContainer : m_messageVectorRosContainer, index, asOgnType);
+        getFieldValue(m_fieldAccessPlan[i], container[i], asOgnType);
     }
-    return asOgnType ? m_messageVectorOgnContainer : m_messageVectorRosContainer;
+    return container;
 }
 
 void Ros2DynamicMessageImpl::writeData(const nlohmann::json& data)
@@ -97,14 +99,130 @@ void Ros2DynamicMessageImpl::writeData(const nlohmann::json& data)
 
 void Ros2DynamicMessageImpl::writeData(const std::vector<std::shared_ptr<void>>& data, bool fromOgnType)
 {
-    size_t index = 0;
-    const void* members = getIntrospectionMembers();
-    if (members)
+    for (size_t i = 0; i < m_fieldAccessPlan.size() && i < data.size(); ++i)
+    {
+        setFieldValue(m_fieldAccessPlan[i], data[i], fromOgnType);
+    }
+}
+
+size_t Ros2DynamicMessageImpl::getFieldSize(size_t index)
+{
+    if (index >= m_fieldAccessPlan.size())
+    {
+        return 0;
+    }
+    const FieldAccess& field = m_fieldAccessPlan[index];
+    const rosidl_typesupport_introspection_c__MessageMember* member = field.member;
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(m_msg) + field.offset;
+    if (!member->is_array_)
+    {
+        return 1;
+    }
+    // non-fixed size array (all rosidl sequences share the data/size/capacity layout)
+    if (member->is_upper_bound_ || !member->array_size_)
+    {
+        return reinterpret_cast<const rosidl_runtime_c__uint8__Sequence*>(data)->size;
+    }
+    return member->array_size_;
+}
+
+bool Ros2DynamicMessageImpl::readField(size_t index, void* dst, size_t count)
+{
+    if (index >= m_fieldAccessPlan.size() || (!dst && count))
+    {
+        return false;
+    }
+    const FieldAccess& field = m_fieldAccessPlan[index];
+    switch (field.member->type_id_)
+    {
+    case rosidl_typesupport_introspection_c__ROS_TYPE_FLOAT:
+        return copyFieldElements<float, float, false>(field, dst, count);
+    case rosidl_typesupport_introspection_c__ROS_TYPE_DOUBLE:
+        return copyFieldElements<double, double, false>(field, dst, count);
+    case rosidl_typesupport_introspection_c__ROS_TYPE_LONG_DOUBLE:
+        return copyFieldElements<long double, double, false>(field, dst, count);
+    case rosidl_typesupport_introspection_c__ROS_TYPE_CHAR:
+    case rosidl_typesupport_introspection_c__ROS_TYPE_OCTET:
+        return copyFieldElements<uint8_t, uint8_t, false>(field, dst, count);
+    case rosidl_typesupport_introspection_c__ROS_TYPE_WCHAR:
+    case rosidl_typesupport_introspection_c__ROS_TYPE_UINT16:
+        return copyFieldElements<uint16_t, uint32_t, false>(field, dst, count);
+    case rosidl_typesupport_introspection_c__ROS_TYPE_BOOLEAN:
+        return copyFieldElements<bool, bool, false>(field, dst, count);
+    case rosidl_typesupport_introspection_c__ROS_TYPE_UINT8:
+        return copyFieldElements<uint8_t, uint32_t, false>(field, dst, count);
+    case rosidl_typesupport_introspection_c__ROS_TYPE_INT8:
+        return copyFieldElements<int8_t, int32_t, false>(field, dst, count);
+    case rosidl_typesupport_introspection_c__ROS_TYPE_INT16:
+        return copyFieldElements<int16_t, int32_t, false>(field, dst, count);
+    case rosidl_typesupport_introspection_c__ROS_TYPE_UINT32:
+        return copyFieldElements<uint32_t, uint32_t, false>(field, dst, count);
+    case rosidl_typesupport_introspection_c__ROS_TYPE_INT32:
+        return copyFieldElements<int32_t, int32_t, false>(field, dst, count);
+    case rosidl_typesupport_introspection_c__ROS_TYPE_UINT64:
+        return copyFieldElements<uint64_t, uint64_t, false>(field, dst, count);
+    case rosidl_typesupport_introspection_c__ROS_TYPE_INT64:
+        return copyFieldElements<int64_t, int64_t, false>(field, dst, count);
+    default:
+        return false;
+    }
+}
+
+bool Ros2DynamicMessageImpl::writeField(size_t index, const void* src, size_t count)
+{
+    if (index >= m_fieldAccessPlan.size() || (!src && count))
+    {
+        return false;
+    }
+    const FieldAccess& field = m_fieldAccessPlan[index];
+    void* source = const_cast<void*>(src);
+    switch (field.member->type_id_)
     {
-        setMessageValues(members, reinterpret_cast<uint8_t*>(m_msg), data, index, fromOgnType);
+    case rosidl_typesupport_introspection_c__ROS_TYPE_FLOAT:
+        return copyFieldElements<float, float, true>(field, source, count);
+    case rosidl_typesupport_introspection_c__ROS_TYPE_DOUBLE:
+        return copyFieldElements<double, double, true>(field, source, count);
+    case rosidl_typesupport_introspection_c__ROS_TYPE_LONG_DOUBLE:
+        return copyFieldElements<long double, double, true>(field, source, count);
+    case rosidl_typesupport_introspection_c__ROS_TYPE_CHAR:
+    case rosidl_typesupport_introspection_c__ROS_TYPE_OCTET:
+        return copyFieldElements<uint8_t, uint8_t, true>(field, source, count);
+    case rosidl_typesupport_introspection_c__ROS_TYPE_WCHAR:
+    case rosidl_typesupport_introspection_c__ROS_TYPE_UINT16:
+        return copyFieldElements<uint16_t, uint32_t, true>(field, source, count);
+    case rosidl_typesupport_introspection_c__ROS_TYPE_BOOLEAN:
+        return copyFieldElements<bool, bool, true>(field, source, count);
+    case rosidl_typesupport_introspection_c__ROS_TYPE_UINT8:
+        return copyFieldElements<uint8_t, uint32_t, true>(field, source, count);
+    case rosidl_typesupport_introspection_c__ROS_TYPE_INT8:
+        return copyFieldElements<int8_t, int32_t, true>(field, source, count);
+    case rosidl_typesupport_introspection_c__ROS_TYPE_INT16:
+        return copyFieldElements<int16_t, int32_t, true>(field, source, count);
+    case rosidl_typesupport_introspection_c__ROS_TYPE_UINT32:
+        return copyFieldElements<uint32_t, uint32_t, true>(field, source, count);
+    case rosidl_typesupport_introspection_c__ROS_TYPE_INT32:
+        return copyFieldElements<int32_t, int32_t, true>(field, source, count);
+    case rosidl_typesupport_introspection_c__ROS_TYPE_UINT64:
+        return copyFieldElements<uint64_t, uint64_t, true>(field, source, count);
+    case rosidl_typesupport_introspection_c__ROS_TYPE_INT64:
+        return copyFieldElements<int64_t, int64_t, true>(field, source, count);
+    default:
+        return false;
     }
 }
 
+const std::shared_ptr<void>& Ros2DynamicMessageImpl::readFieldValue(size_t index, bool asOgnType)
+{
+    auto& container = asOgnType ? m_messageVectorOgnContainer : m_messageVectorRosContainer;
+    getFieldValue(m_fieldAccessPlan.at(index), container.at(index), asOgnType);
+    return container.at(index);
+}
+
+void Ros2DynamicMessageImpl::writeFieldValue(size_t index, const std::shared_ptr<void>& value, bool fromOgnType)
+{
+    setFieldValue(m_fieldAccessPlan.at(index), value, fromOgnType);
+}
+
 const void* Ros2DynamicMessageImpl::getIntrospectionMembers()
 {
     void* typeSupportHandle = getTypeSupportIntrospectionHandleDynamic();
@@ -211,7 +329,7 @@ std::string Ros2DynamicMessageImpl::generateSummary(bool print)
     return stream.str();
 }
 
-void Ros2DynamicMessageImpl::parseMessageFields(const std::string& parentName, const void* members)
+void Ros2DynamicMessageImpl::parseMessageFields(const std::string& parentName, const void* members, size_t parentOffset)
 {
     auto messageMembers = reinterpret_cast<const rosidl_typesupport_introspection_c__MessageMembers*>(members);
     for (size_t i = 0; i < messageMembers->member_count_; ++i)
@@ -452,7 +570,7 @@ void Ros2DynamicMessageImpl::parseMessageFields(const std::string& parentName, c
                 break;
             }
             // unroll only if not an array
-            parseMessageFields(name, member->members_->data);
+            parseMessageFields(name, member->members_->data, parentOffset + member->offset_);
             continue;
         default:
             break;
@@ -460,8 +578,9 @@ void Ros2DynamicMessageImpl::parseMessageFields(const std::string& parentName, c
         // preallocate message containers
         m_messageVectorRosContainer.push_back(rosValue);
         m_messageVectorOgnContainer.push_back(ognValue);
-        // define message field
+        // define message field and how to access it
         m_messagesFields.push_back({ name, member->type_id_, member->is_array_, type, dataType });
+        m_fieldAccessPlan.push_back({ parentOffset + member->offset_, member });
     }
 }
 
@@ -731,6 +850,77 @@ void Ros2DynamicMessageImpl::setArray(const rosidl_typesupport_introspection_c__
     }
 }
 
+template <typename RosType, typename OgnType, bool toRos>
+bool Ros2DynamicMessageImpl::copyFieldElements(const FieldAccess& field, void* ognData, size_t count)
+{
+    const rosidl_typesupport_introspection_c__MessageMember* member = field.member;
+    uint8_t* data = reinterpret_cast<uint8_t*>(m_msg) + field.offset;
+    RosType* rosData = reinterpret_cast<RosType*>(data);
+    size_t size = 1;
+    if (member->is_array_)
+    {
+        // non-fixed size array (all rosidl sequences share the data/size/capacity layout)
+        if (member->is_upper_bound_ || !member->array_size_)
+        {
+            auto sequence = reinterpret_cast<rosidl_runtime_c__uint8__Sequence*>(data);
+            if constexpr (toRos)
+            {
+                // grow or shrink in place when the capacity allows it, so that publishing does not reallocate
+                if (sequence->size != count)
+                {
+                    if (count <= sequence->capacity && sequence->data)
+                    {
+                        sequence->size = count;
+                    }
+                    else if (!member->resize_function || !member->resize_function(data, count))
+                    {
+                        return false;
+                    }
+                }
+            }
+            rosData = reinterpret_cast<RosType*>(sequence->data);
+            size = sequence->size;
+        }
+        // fixed size array
+        else
+        {
+            size = member->array_size_;
+        }
+    }
+    size = std::min(size, count);
+    OgnType* values = reinterpret_cast<OgnType*>(ognData);
+    if (!size)
+    {
+        return true;
+    }
+    if constexpr (std::is_same_v<RosType, OgnType>)
+    {
+        if constexpr (toRos)
+        {
+            std::memcpy(rosData, values, size * sizeof(RosType));
+        }
+        else
+        {
+            std::memcpy(values, rosData, size * sizeof(RosType));
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            if constexpr (toRos)
+            {
+                rosData[i] = static_cast<RosType>(values[i]);
+            }
+            else
+            {
+                values[i] = static_cast<OgnType>(rosData[i]);
+            }
+        }
+    }
+    return true;
+}
+
 template <typename RosType, typename OgnType>
 void Ros2DynamicMessageImpl::getSingleValue(uint8_t* data, std::shared_ptr<void>& valuePtr, bool asOgnType)
 {
@@ -1015,29 +1205,274 @@ void Ros2DynamicMessageImpl::getMessageValues(const void* members, uint8_t* mess
     }
 }
 
-void Ros2DynamicMessageImpl::getMessageValues(const void* members,
-                                              uint8_t* messageData,
-                                              std::vector<std::shared_ptr<void>>& container,
-                                              size_t& index,
-                                              bool asOgnType)
+void Ros2DynamicMessageImpl::getFieldValue(const FieldAccess& field, std::shared_ptr<void>& valuePtr, bool asOgnType)
+{
+    const rosidl_typesupport_introspection_c__MessageMember* member = field.member;
+    auto data = reinterpret_cast<uint8_t*>(m_msg) + field.offset;
+    switch (member->type_id_)
+    {
+    case rosidl_typesupport_introspection_c__ROS_TYPE_FLOAT:
+    {
+        if (member->is_array_)
+        {
+            getArray<rosidl_runtime_c__float__Sequence, float, float>(member, data, valuePtr, false);
+        }
+        else
+        {
+            getSingleValue<float, float>(data, valuePtr, false);
+        }
+        break;
+    }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_DOUBLE:
+    {
+        if (member->is_array_)
+        {
+            getArray<rosidl_runtime_c__double__Sequence, double, double>(member, data, valuePtr, false);
+        }
+        else
+        {
+            getSingleValue<double, double>(data, valuePtr, false);
+        }
+        break;
+    }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_LONG_DOUBLE:
+    {
+        if (member->is_array_)
+        {
+            getArray<rosidl_runtime_c__long_double__Sequence, long double, double>(member, data, valuePtr, asOgnType);
+        }
+        else
+        {
+            getSingleValue<long double, double>(data, valuePtr, asOgnType);
+        }
+        break;
+    }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_CHAR:
+    {
+        if (member->is_array_)
+        {
+            getArray<rosidl_runtime_c__char__Sequence, uint8_t, uint8_t>(member, data, valuePtr, false);
+        }
+        else
+        {
+            getSingleValue<uint8_t, uint8_t>(data, valuePtr, false);
+        }
+        break;
+    }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_WCHAR:
+    {
+        if (member->is_array_)
+        {
+            getArray<rosidl_runtime_c__wchar__Sequence, uint16_t, uint32_t>(member, data, valuePtr, asOgnType);
+        }
+        else
+        {
+            getSingleValue<uint16_t, uint32_t>(data, valuePtr, asOgnType);
+        }
+        break;
+    }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_BOOLEAN:
+    {
+        if (member->is_array_)
+        {
+            getArray<rosidl_runtime_c__boolean__Sequence, bool, bool>(member, data, valuePtr, false);
+        }
+        else
+        {
+            getSingleValue<bool, bool>(data, valuePtr, false);
+        }
+        break;
+    }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_OCTET:
+    {
+        if (member->is_array_)
+        {
+            getArray<rosidl_runtime_c__octet__Sequence, uint8_t, uint8_t>(member, data, valuePtr, false);
+        }
+        else
+        {
+            getSingleValue<uint8_t, uint8_t>(data, valuePtr, false);
+        }
+        break;
+    }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_UINT8:
+    {
+        if (member->is_array_)
+        {
+            getArray<rosidl_runtime_c__uint8__Sequence, uint8_t, uint32_t>(member, data, valuePtr, asOgnType);
+        }
+        else
+        {
+            getSingleValue<uint8_t, uint32_t>(data, valuePtr, asOgnType);
+        }
+        break;
+    }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_INT8:
+    {
+        if (member->is_array_)
+        {
+            getArray<rosidl_runtime_c__int8__Sequence, int8_t, int32_t>(member, data, valuePtr, asOgnType);
+        }
+        else
+        {
+            getSingleValue<int8_t, int32_t>(data, valuePtr, asOgnType);
+        }
+        break;
+    }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_UINT16:
+    {
+        if (member->is_array_)
+        {
+            getArray<rosidl_runtime_c__uint16__Sequence, uint16_t, uint32_t>(member, data, valuePtr, asOgnType);
+        }
+        else
+        {
+            getSingleValue<uint16_t, uint32_t>(data, valuePtr, asOgnType);
+        }
+        break;
+    }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_INT16:
+    {
+        if (member->is_array_)
+        {
+            getArray<rosidl_runtime_c__int16__Sequence, int16_t, int32_t>(member, data, valuePtr, asOgnType);
+        }
+        else
+        {
+            getSingleValue<int16_t, int32_t>(data, valuePtr, asOgnType);
+        }
+        break;
+    }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_UINT32:
+    {
+        if (member->is_array_)
+        {
+            getArray<rosidl_runtime_c__uint32__Sequence, uint32_t, uint32_t>(member, data, valuePtr, false);
+        }
+        else
+        {
+            getSingleValue<uint32_t, uint32_t>(data, valuePtr, false);
+        }
+        break;
+    }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_INT32:
+    {
+        if (member->is_array_)
+        {
+            getArray<rosidl_runtime_c__int32__Sequence, int32_t, int32_t>(member, data, valuePtr, false);
+        }
+        else
+        {
+            getSingleValue<int32_t, int32_t>(data, valuePtr, false);
+        }
+        break;
+    }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_UINT64:
+    {
+        if (member->is_array_)
+        {
+            getArray<rosidl_runtime_c__uint64__Sequence, uint64_t, uint64_t>(member, data, valuePtr, false);
+        }
+        else
+        {
+            getSingleValue<uint64_t, uint64_t>(data, valuePtr, false);
+        }
+        break;
+    }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_INT64:
+    {
+        if (member->is_array_)
+        {
+            getArray<rosidl_runtime_c__int64__Sequence, int64_t, int64_t>(member, data, valuePtr, false);
+        }
+        else
+        {
+            getSingleValue<int64_t, int64_t>(data, valuePtr, false);
+        }
+        break;
+    }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_STRING:
+    {
+        if (member->is_array_)
+        {
+            std::vector<rosidl_runtime_c__String> rosArray;
+            getArray<rosidl_runtime_c__String__Sequence, rosidl_runtime_c__String>(member, data, rosArray);
+            auto array = std::static_pointer_cast<std::vector<std::string>>(valuePtr);
+            array->clear();
+            array->reserve(rosArray.size());
+            for (auto const& item : rosArray)
+            {
+                array->push_back(std::string(item.data));
+            }
+        }
+        else
+        {
+            auto value = reinterpret_cast<const rosidl_runtime_c__String*>(data);
+            *std::static_pointer_cast<std::string>(valuePtr) = std::string(value->data);
+        }
+        break;
+    }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_WSTRING:
+    {
+        // TODO: proccess WSTRING (no messages with 'path:*/msgs/*.msg "wstring"')
+        if (member->is_array_)
+        {
+            std::static_pointer_cast<std::vector<std::string>>(valuePtr)->clear();
+        }
+        else
+        {
+            *std::static_pointer_cast<std::string>(valuePtr) = std::string();
+        }
+        break;
+    }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_MESSAGE:
+    {
+        if (member->is_array_)
+        {
+            auto jsonArray = nlohmann::json::array();
+            getArrayEmbeddedMessage(member, data, jsonArray);
+            std::static_pointer_cast<std::vector<nlohmann::json>>(valuePtr)->clear();
+            for (size_t j = 0; j < jsonArray.size(); ++j)
+            {
+                std::static_pointer_cast<std::vector<nlohmann::json>>(valuePtr)->push_back(jsonArray.at(j));
+            }
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+
+void Ros2DynamicMessageImpl::setMessageValues(const void* members, uint8_t* messageData, const nlohmann::json& container)
 {
+    if (!container.is_object())
+    {
+        return;
+    }
     auto messageMembers = reinterpret_cast<const rosidl_typesupport_introspection_c__MessageMembers*>(members);
     for (size_t i = 0; i < messageMembers->member_count_; ++i)
     {
-        auto valuePtr = container.at(index++);
         const rosidl_typesupport_introspection_c__MessageMember* member = messageMembers->members_ + i;
         auto data = &messageData[member->offset_];
+        if (!container.contains(member->name_))
+        {
+            continue;
+        }
+        auto value = container[member->name_];
         switch (member->type_id_)
         {
         case rosidl_typesupport_introspection_c__ROS_TYPE_FLOAT:
         {
             if (member->is_array_)
             {
-                getArray<rosidl_runtime_c__float__Sequence, float, float>(member, data, valuePtr, false);
+                setArray<rosidl_runtime_c__float__Sequence, rosidl_runtime_c__float__Sequence__init, float>(
+                    member, data, value);
             }
             else
             {
-                getSingleValue<float, float>(data, valuePtr, false);
+                *reinterpret_cast<float*>(data) = value.get<float>();
             }
             break;
         }
@@ -1045,11 +1480,12 @@ void Ros2DynamicMessageImpl::getMessageValues(const void* members,
         {
             if (member->is_array_)
             {
-                getArray<rosidl_runtime_c__double__Sequence, double, double>(member, data, valuePtr, false);
+                setArray<rosidl_runtime_c__double__Sequence, rosidl_runtime_c__double__Sequence__init, double>(
+                    member, data, value);
             }
             else
             {
-                getSingleValue<double, double>(data, valuePtr, false);
+                *reinterpret_cast<double*>(data) = value.get<double>();
             }
             break;
         }
@@ -1057,11 +1493,12 @@ void Ros2DynamicMessageImpl::getMessageValues(const void* members,
         {
             if (member->is_array_)
             {
-                getArray<rosidl_runtime_c__long_double__Sequence, long double, double>(member, data, valuePtr, asOgnType);
+                setArray<rosidl_runtime_c__long_double__Sequence, rosidl_runtime_c__long_double__Sequence__init, long double>(
+                    member, data, value);
             }
             else
             {
-                getSingleValue<long double, double>(data, valuePtr, asOgnType);
+                *reinterpret_cast<long double*>(data) = value.get<long double>();
             }
             break;
         }
@@ -1069,11 +1506,12 @@ void Ros2DynamicMessageImpl::getMessageValues(const void* members,
         {
             if (member->is_array_)
             {
-                getArray<rosidl_runtime_c__char__Sequence, uint8_t, uint8_t>(member, data, valuePtr, false);
+                setArray<rosidl_runtime_c__char__Sequence, rosidl_runtime_c__char__Sequence__init, uint8_t>(
+                    member, data, value);
             }
             else
             {
-                getSingleValue<uint8_t, uint8_t>(data, valuePtr, false);
+                *reinterpret_cast<uint8_t*>(data) = value.get<uint8_t>();
             }
             break;
         }
@@ -1081,11 +1519,12 @@ void Ros2DynamicMessageImpl::getMessageValues(const void* members,
         {
             if (member->is_array_)
             {
-                getArray<rosidl_runtime_c__wchar__Sequence, uint16_t, uint32_t>(member, data, valuePtr, asOgnType);
+                setArray<rosidl_runtime_c__wchar__Sequence, rosidl_runtime_c__wchar__Sequence__init, uint16_t>(
+                    member, data, value);
             }
             else
             {
-                getSingleValue<uint16_t, uint32_t>(data, valuePtr, asOgnType);
+                *reinterpret_cast<uint16_t*>(data) = value.get<uint16_t>();
             }
             break;
         }
@@ -1093,11 +1532,12 @@ void Ros2DynamicMessageImpl::getMessageValues(const void* members,
         {
             if (member->is_array_)
             {
-                getArray<rosidl_runtime_c__boolean__Sequence, bool, bool>(member, data, valuePtr, false);
+                setArray<rosidl_runtime_c__boolean__Sequence, rosidl_runtime_c__bool__Sequence__init, bool>(
+                    member, data, value);
             }
             else
             {
-                getSingleValue<bool, bool>(data, valuePtr, false);
+                *reinterpret_cast<bool*>(data) = value.get<bool>();
             }
             break;
         }
@@ -1105,11 +1545,12 @@ void Ros2DynamicMessageImpl::getMessageValues(const void* members,
         {
             if (member->is_array_)
             {
-                getArray<rosidl_runtime_c__octet__Sequence, uint8_t, uint8_t>(member, data, valuePtr, false);
+                setArray<rosidl_runtime_c__octet__Sequence, rosidl_runtime_c__octet__Sequence__init, uint8_t>(
+                    member, data, value);
             }
             else
             {
-                getSingleValue<uint8_t, uint8_t>(data, valuePtr, false);
+                *reinterpret_cast<uint8_t*>(data) = value.get<uint8_t>();
             }
             break;
         }
@@ -1117,11 +1558,12 @@ void Ros2DynamicMessageImpl::getMessageValues(const void* members,
         {
             if (member->is_array_)
             {
-                getArray<rosidl_runtime_c__uint8__Sequence, uint8_t, uint32_t>(member, data, valuePtr, asOgnType);
+                setArray<rosidl_runtime_c__uint8__Sequence, rosidl_runtime_c__uint8__Sequence__init, uint8_t>(
+                    member, data, value);
             }
             else
             {
-                getSingleValue<uint8_t, uint32_t>(data, valuePtr, asOgnType);
+                *reinterpret_cast<uint8_t*>(data) = value.get<uint8_t>();
             }
             break;
         }
@@ -1129,11 +1571,12 @@ void Ros2DynamicMessageImpl::getMessageValues(const void* members,
         {
             if (member->is_array_)
             {
-                getArray<rosidl_runtime_c__int8__Sequence, int8_t, int32_t>(member, data, valuePtr, asOgnType);
+                setArray<rosidl_runtime_c__int8__Sequence, rosidl_runtime_c__int8__Sequence__init, int8_t>(
+                    member, data, value);
             }
             else
             {
-                getSingleValue<int8_t, int32_t>(data, valuePtr, asOgnType);
+                *reinterpret_cast<int8_t*>(data) = value.get<int8_t>();
             }
             break;
         }
@@ -1141,11 +1584,12 @@ void Ros2DynamicMessageImpl::getMessageValues(const void* members,
         {
             if (member->is_array_)
             {
-                getArray<rosidl_runtime_c__uint16__Sequence, uint16_t, uint32_t>(member, data, valuePtr, asOgnType);
+                setArray<rosidl_runtime_c__uint16__Sequence, rosidl_runtime_c__uint16__Sequence__init, uint16_t>(
+                    member, data, value);
             }
             else
             {
-                getSingleValue<uint16_t, uint32_t>(data, valuePtr, asOgnType);
+                *reinterpret_cast<uint16_t*>(data) = value.get<uint16_t>();
             }
             break;
         }
@@ -1153,11 +1597,12 @@ void Ros2DynamicMessageImpl::getMessageValues(const void* members,
         {
             if (member->is_array_)
             {
-                getArray<rosidl_runtime_c__int16__Sequence, int16_t, int32_t>(member, data, valuePtr, asOgnType);
+                setArray<rosidl_runtime_c__int16__Sequence, rosidl_runtime_c__int16__Sequence__init, int16_t>(
+                    member, data, value);
             }
             else
             {
-                getSingleValue<int16_t, int32_t>(data, valuePtr, asOgnType);
+                *reinterpret_cast<int16_t*>(data) = value.get<int16_t>();
             }
             break;
         }
@@ -1165,11 +1610,12 @@ void Ros2DynamicMessageImpl::getMessageValues(const void* members,
         {
             if (member->is_array_)
             {
-                getArray<rosidl_runtime_c__uint32__Sequence, uint32_t, uint32_t>(member, data, valuePtr, false);
+                setArray<rosidl_runtime_c__uint32__Sequence, rosidl_runtime_c__uint32__Sequence__init, uint32_t>(
+                    member, data, value);
             }
             else
             {
-                getSingleValue<uint32_t, uint32_t>(data, valuePtr, false);
+                *reinterpret_cast<uint32_t*>(data) = value.get<uint32_t>();
             }
             break;
         }
@@ -1177,11 +1623,12 @@ void Ros2DynamicMessageImpl::getMessageValues(const void* members,
         {
             if (member->is_array_)
             {
-                getArray<rosidl_runtime_c__int32__Sequence, int32_t, int32_t>(member, data, valuePtr, false);
+                setArray<rosidl_runtime_c__int32__Sequence, rosidl_runtime_c__int32__Sequence__init, int32_t>(
+                    member, data, value);
             }
             else
             {
-                getSingleValue<int32_t, int32_t>(data, valuePtr, false);
+                *reinterpret_cast<int32_t*>(data) = value.get<int32_t>();
             }
             break;
         }
@@ -1189,11 +1636,12 @@ void Ros2DynamicMessageImpl::getMessageValues(const void* members,
         {
             if (member->is_array_)
             {
-                getArray<rosidl_runtime_c__uint64__Sequence, uint64_t, uint64_t>(member, data, valuePtr, false);
+                setArray<rosidl_runtime_c__uint64__Sequence, rosidl_runtime_c__uint64__Sequence__init, uint64_t>(
+                    member, data, value);
             }
             else
             {
-                getSingleValue<uint64_t, uint64_t>(data, valuePtr, false);
+                *reinterpret_cast<uint64_t*>(data) = value.get<uint64_t>();
             }
             break;
         }
@@ -1201,11 +1649,12 @@ void Ros2DynamicMessageImpl::getMessageValues(const void* members,
         {
             if (member->is_array_)
             {
-                getArray<rosidl_runtime_c__int64__Sequence, int64_t, int64_t>(member, data, valuePtr, false);
+                setArray<rosidl_runtime_c__int64__Sequence, rosidl_runtime_c__int64__Sequence__init, int64_t>(
+                    member, data, value);
             }
             else
             {
-                getSingleValue<int64_t, int64_t>(data, valuePtr, false);
+                *reinterpret_cast<int64_t*>(data) = value.get<int64_t>();
             }
             break;
         }
@@ -1213,52 +1662,35 @@ void Ros2DynamicMessageImpl::getMessageValues(const void* members,
         {
             if (member->is_array_)
             {
-                std::vector<rosidl_runtime_c__String> rosArray;
-                getArray<rosidl_runtime_c__String__Sequence, rosidl_runtime_c__String>(member, data, rosArray);
-                auto array = std::static_pointer_cast<std::vector<std::string>>(valuePtr);
-                array->clear();
-                array->reserve(rosArray.size());
-                for (auto const& item : rosArray)
+                std::vector<std::string> array = value;
+                std::vector<rosidl_runtime_c__String> rosArray(array.size());
+                for (size_t j = 0; j < array.size(); ++j)
                 {
-                    array->push_back(std::string(item.data));
+                    rosidl_runtime_c__String__assign(&rosArray.at(j), array.at(j).c_str());
                 }
+                setArray<rosidl_runtime_c__String__Sequence, rosidl_runtime_c__String__Sequence__init,
+                         rosidl_runtime_c__String>(member, data, rosArray);
             }
             else
             {
-                auto value = reinterpret_cast<const rosidl_runtime_c__String*>(data);
-                *std::static_pointer_cast<std::string>(valuePtr) = std::string(value->data);
+                rosidl_runtime_c__String__assign(
+                    reinterpret_cast<rosidl_runtime_c__String*>(data), value.get<std::string>().c_str());
             }
             break;
         }
         case rosidl_typesupport_introspection_c__ROS_TYPE_WSTRING:
         {
             // TODO: proccess WSTRING (no messages with 'path:*/msgs/*.msg "wstring"')
-            if (member->is_array_)
-            {
-                std::static_pointer_cast<std::vector<std::string>>(valuePtr)->clear();
-            }
-            else
-            {
-                *std::static_pointer_cast<std::string>(valuePtr) = std::string();
-            }
-            break;
         }
         case rosidl_typesupport_introspection_c__ROS_TYPE_MESSAGE:
         {
             if (member->is_array_)
             {
-                auto jsonArray = nlohmann::json::array();
-                getArrayEmbeddedMessage(member, data, jsonArray);
-                std::static_pointer_cast<std::vector<nlohmann::json>>(valuePtr)->clear();
-                for (size_t j = 0; j < jsonArray.size(); ++j)
-                {
-                    std::static_pointer_cast<std::vector<nlohmann::json>>(valuePtr)->push_back(jsonArray.at(j));
-                }
+                setArrayEmbeddedMessage(member, data, value);
             }
             else
             {
-                getMessageValues(member->members_->data, data, container, --index, asOgnType);
-                continue;
+                setMessageValues(member->members_->data, data, value);
             }
             break;
         }
@@ -1268,512 +1700,256 @@ void Ros2DynamicMessageImpl::getMessageValues(const void* members,
     }
 }
 
-
-void Ros2DynamicMessageImpl::setMessageValues(const void* members, uint8_t* messageData, const nlohmann::json& container)
+void Ros2DynamicMessageImpl::setFieldValue(const FieldAccess& field,
+                                           const std::shared_ptr<void>& valuePtr,
+                                           bool fromOgnType)
 {
-    if (!container.is_object())
+    const rosidl_typesupport_introspection_c__MessageMember* member = field.member;
+    auto data = reinterpret_cast<uint8_t*>(m_msg) + field.offset;
+    switch (member->type_id_)
     {
-        return;
-    }
-    auto messageMembers = reinterpret_cast<const rosidl_typesupport_introspection_c__MessageMembers*>(members);
-    for (size_t i = 0; i < messageMembers->member_count_; ++i)
+    case rosidl_typesupport_introspection_c__ROS_TYPE_FLOAT:
     {
-        const rosidl_typesupport_introspection_c__MessageMember* member = messageMembers->members_ + i;
-        auto data = &messageData[member->offset_];
-        if (!container.contains(member->name_))
-        {
-            continue;
-        }
-        auto value = container[member->name_];
-        switch (member->type_id_)
-        {
-        case rosidl_typesupport_introspection_c__ROS_TYPE_FLOAT:
+        if (member->is_array_)
         {
-            if (member->is_array_)
-            {
-                setArray<rosidl_runtime_c__float__Sequence, rosidl_runtime_c__float__Sequence__init, float>(
-                    member, data, value);
-            }
-            else
-            {
-                *reinterpret_cast<float*>(data) = value.get<float>();
-            }
-            break;
-        }
-        case rosidl_typesupport_introspection_c__ROS_TYPE_DOUBLE:
-        {
-            if (member->is_array_)
-            {
-                setArray<rosidl_runtime_c__double__Sequence, rosidl_runtime_c__double__Sequence__init, double>(
-                    member, data, value);
-            }
-            else
-            {
-                *reinterpret_cast<double*>(data) = value.get<double>();
-            }
-            break;
+            setArray<rosidl_runtime_c__float__Sequence, rosidl_runtime_c__float__Sequence__init, float, float>(
+                member, data, valuePtr, false);
         }
-        case rosidl_typesupport_introspection_c__ROS_TYPE_LONG_DOUBLE:
+        else
         {
-            if (member->is_array_)
-            {
-                setArray<rosidl_runtime_c__long_double__Sequence, rosidl_runtime_c__long_double__Sequence__init, long double>(
-                    member, data, value);
-            }
-            else
-            {
-                *reinterpret_cast<long double*>(data) = value.get<long double>();
-            }
-            break;
+            setSingleValue<float, float>(data, valuePtr, false);
         }
-        case rosidl_typesupport_introspection_c__ROS_TYPE_CHAR:
+        break;
+    }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_DOUBLE:
+    {
+        if (member->is_array_)
         {
-            if (member->is_array_)
-            {
-                setArray<rosidl_runtime_c__char__Sequence, rosidl_runtime_c__char__Sequence__init, uint8_t>(
-                    member, data, value);
-            }
-            else
-            {
-                *reinterpret_cast<uint8_t*>(data) = value.get<uint8_t>();
-            }
-            break;
+            setArray<rosidl_runtime_c__double__Sequence, rosidl_runtime_c__double__Sequence__init, double, double>(
+                member, data, valuePtr, false);
         }
-        case rosidl_typesupport_introspection_c__ROS_TYPE_WCHAR:
+        else
         {
-            if (member->is_array_)
-            {
-                setArray<rosidl_runtime_c__wchar__Sequence, rosidl_runtime_c__wchar__Sequence__init, uint16_t>(
-                    member, data, value);
-            }
-            else
-            {
-                *reinterpret_cast<uint16_t*>(data) = value.get<uint16_t>();
-            }
-            break;
+            setSingleValue<double, double>(data, valuePtr, false);
         }
-        case rosidl_typesupport_introspection_c__ROS_TYPE_BOOLEAN:
-        {
-            if (member->is_array_)
-            {
-                setArray<rosidl_runtime_c__boolean__Sequence, rosidl_runtime_c__bool__Sequence__init, bool>(
-                    member, data, value);
-            }
-            else
-            {
-                *reinterpret_cast<bool*>(data) = value.get<bool>();
-            }
-            break;
-        }
-        case rosidl_typesupport_introspection_c__ROS_TYPE_OCTET:
+        break;
+    }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_LONG_DOUBLE:
+    {
+        if (member->is_array_)
         {
-            if (member->is_array_)
-            {
-                setArray<rosidl_runtime_c__octet__Sequence, rosidl_runtime_c__octet__Sequence__init, uint8_t>(
-                    member, data, value);
-            }
-            else
-            {
-                *reinterpret_cast<uint8_t*>(data) = value.get<uint8_t>();
-            }
-            break;
+            setArray<rosidl_runtime_c__long_double__Sequence, rosidl_runtime_c__long_double__Sequence__init,
+                     long double, double>(member, data, valuePtr, fromOgnType);
         }
-        case rosidl_typesupport_introspection_c__ROS_TYPE_UINT8:
+        else
         {
-            if (member->is_array_)
-            {
-                setArray<rosidl_runtime_c__uint8__Sequence, rosidl_runtime_c__uint8__Sequence__init, uint8_t>(
-                    member, data, value);
-            }
-            else
-            {
-                *reinterpret_cast<uint8_t*>(data) = value.get<uint8_t>();
-            }
-            break;
+            setSingleValue<long double, double>(data, valuePtr, fromOgnType);
         }
-        case rosidl_typesupport_introspection_c__ROS_TYPE_INT8:
+        break;
+    }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_CHAR:
+    {
+        if (member->is_array_)
         {
-            if (member->is_array_)
-            {
-                setArray<rosidl_runtime_c__int8__Sequence, rosidl_runtime_c__int8__Sequence__init, int8_t>(
-                    member, data, value);
-            }
-            else
-            {
-                *reinterpret_cast<int8_t*>(data) = value.get<int8_t>();
-            }
-            break;
+            setArray<rosidl_runtime_c__char__Sequence, rosidl_runtime_c__char__Sequence__init, uint8_t, uint8_t>(
+                member, data, valuePtr, false);
         }
-        case rosidl_typesupport_introspection_c__ROS_TYPE_UINT16:
+        else
         {
-            if (member->is_array_)
-            {
-                setArray<rosidl_runtime_c__uint16__Sequence, rosidl_runtime_c__uint16__Sequence__init, uint16_t>(
-                    member, data, value);
-            }
-            else
-            {
-                *reinterpret_cast<uint16_t*>(data) = value.get<uint16_t>();
-            }
-            break;
+            setSingleValue<uint8_t, uint8_t>(data, valuePtr, false);
         }
-        case rosidl_typesupport_introspection_c__ROS_TYPE_INT16:
+        break;
+    }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_WCHAR:
+    {
+        if (member->is_array_)
         {
-            if (member->is_array_)
-            {
-                setArray<rosidl_runtime_c__int16__Sequence, rosidl_runtime_c__int16__Sequence__init, int16_t>(
-                    member, data, value);
-            }
-            else
-            {
-                *reinterpret_cast<int16_t*>(data) = value.get<int16_t>();
-            }
-            break;
+            setArray<rosidl_runtime_c__wchar__Sequence, rosidl_runtime_c__wchar__Sequence__init, uint16_t, uint32_t>(
+                member, data, valuePtr, fromOgnType);
         }
-        case rosidl_typesupport_introspection_c__ROS_TYPE_UINT32:
+        else
         {
-            if (member->is_array_)
-            {
-                setArray<rosidl_runtime_c__uint32__Sequence, rosidl_runtime_c__uint32__Sequence__init, uint32_t>(
-                    member, data, value);
-            }
-            else
-            {
-                *reinterpret_cast<uint32_t*>(data) = value.get<uint32_t>();
-            }
-            break;
+            setSingleValue<uint16_t, uint32_t>(data, valuePtr, fromOgnType);
         }
-        case rosidl_typesupport_introspection_c__ROS_TYPE_INT32:
+        break;
+    }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_BOOLEAN:
+    {
+        if (member->is_array_)
         {
-            if (member->is_array_)
-            {
-                setArray<rosidl_runtime_c__int32__Sequence, rosidl_runtime_c__int32__Sequence__init, int32_t>(
-                    member, data, value);
-            }
-            else
-            {
-                *reinterpret_cast<int32_t*>(data) = value.get<int32_t>();
-            }
-            break;
+            setArray<rosidl_runtime_c__boolean__Sequence, rosidl_runtime_c__bool__Sequence__init, bool, bool>(
+                member, data, valuePtr, false);
         }
-        case rosidl_typesupport_introspection_c__ROS_TYPE_UINT64:
+        else
         {
-            if (member->is_array_)
-            {
-                setArray<rosidl_runtime_c__uint64__Sequence, rosidl_runtime_c__uint64__Sequence__init, uint64_t>(
-                    member, data, value);
-            }
-            else
-            {
-                *reinterpret_cast<uint64_t*>(data) = value.get<uint64_t>();
-            }
-            break;
+            setSingleValue<bool, bool>(data, valuePtr, false);
         }
-        case rosidl_typesupport_introspection_c__ROS_TYPE_INT64:
+        break;
+    }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_OCTET:
+    {
+        if (member->is_array_)
         {
-            if (member->is_array_)
-            {
-                setArray<rosidl_runtime_c__int64__Sequence, rosidl_runtime_c__int64__Sequence__init, int64_t>(
-                    member, data, value);
-            }
-            else
-            {
-                *reinterpret_cast<int64_t*>(data) = value.get<int64_t>();
-            }
-            break;
+            setArray<rosidl_runtime_c__octet__Sequence, rosidl_runtime_c__octet__Sequence__init, uint8_t, uint8_t>(
+                member, data, valuePtr, false);
         }
-        case rosidl_typesupport_introspection_c__ROS_TYPE_STRING:
+        else
         {
-            if (member->is_array_)
-            {
-                std::vector<std::string> array = value;
-                std::vector<rosidl_runtime_c__String> rosArray(array.size());
-                for (size_t j = 0; j < array.size(); ++j)
-                {
-                    rosidl_runtime_c__String__assign(&rosArray.at(j), array.at(j).c_str());
-                }
-                setArray<rosidl_runtime_c__String__Sequence, rosidl_runtime_c__String__Sequence__init,
-                         rosidl_runtime_c__String>(member, data, rosArray);
-            }
-            else
-            {
-                rosidl_runtime_c__String__assign(
-                    reinterpret_cast<rosidl_runtime_c__String*>(data), value.get<std::string>().c_str());
-            }
-            break;
+            setSingleValue<uint8_t, uint8_t>(data, valuePtr, false);
         }
-        case rosidl_typesupport_introspection_c__ROS_TYPE_WSTRING:
+        break;
+    }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_UINT8:
+    {
+        if (member->is_array_)
         {
-            // TODO: proccess WSTRING (no messages with 'path:*/msgs/*.msg "wstring"')
+            setArray<rosidl_runtime_c__uint8__Sequence, rosidl_runtime_c__uint8__Sequence__init, uint8_t, uint32_t>(
+                member, data, valuePtr, fromOgnType);
         }
-        case rosidl_typesupport_introspection_c__ROS_TYPE_MESSAGE:
+        else
         {
-            if (member->is_array_)
-            {
-                setArrayEmbeddedMessage(member, data, value);
-            }
-            else
-            {
-                setMessageValues(member->members_->data, data, value);
-            }
-            break;
-        }
-        default:
-            break;
+            setSingleValue<uint8_t, uint32_t>(data, valuePtr, fromOgnType);
         }
+        break;
     }
-}
-
-void Ros2DynamicMessageImpl::setMessageValues(const void* members,
-                                              uint8_t* messageData,
-                                              const std::vector<std::shared_ptr<void>>& container,
-                                              size_t& index,
-                                              bool fromOgnType)
-{
-    auto messageMembers = reinterpret_cast<const rosidl_typesupport_introspection_c__MessageMembers*>(members);
-    for (size_t i = 0; i < messageMembers->member_count_; ++i)
+    case rosidl_typesupport_introspection_c__ROS_TYPE_INT8:
     {
-        const rosidl_typesupport_introspection_c__MessageMember* member = messageMembers->members_ + i;
-        auto data = &messageData[member->offset_];
-        auto valuePtr = container.at(index++);
-        switch (member->type_id_)
-        {
-        case rosidl_typesupport_introspection_c__ROS_TYPE_FLOAT:
+        if (member->is_array_)
         {
-            if (member->is_array_)
-            {
-                setArray<rosidl_runtime_c__float__Sequence, rosidl_runtime_c__float__Sequence__init, float, float>(
-                    member, data, valuePtr, false);
-            }
-            else
-            {
-                setSingleValue<float, float>(data, valuePtr, false);
-            }
-            break;
+            setArray<rosidl_runtime_c__int8__Sequence, rosidl_runtime_c__int8__Sequence__init, int8_t, int32_t>(
+                member, data, valuePtr, fromOgnType);
         }
-        case rosidl_typesupport_introspection_c__ROS_TYPE_DOUBLE:
+        else
         {
-            if (member->is_array_)
-            {
-                setArray<rosidl_runtime_c__double__Sequence, rosidl_runtime_c__double__Sequence__init, double, double>(
-                    member, data, valuePtr, false);
-            }
-            else
-            {
-                setSingleValue<double, double>(data, valuePtr, false);
-            }
-            break;
+            setSingleValue<int8_t, int32_t>(data, valuePtr, fromOgnType);
         }
-        case rosidl_typesupport_introspection_c__ROS_TYPE_LONG_DOUBLE:
+        break;
+    }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_UINT16:
+    {
+        if (member->is_array_)
         {
-            if (member->is_array_)
-            {
-                setArray<rosidl_runtime_c__long_double__Sequence, rosidl_runtime_c__long_double__Sequence__init,
-                         long double, double>(member, data, valuePtr, fromOgnType);
-            }
-            else
-            {
-                setSingleValue<long double, double>(data, valuePtr, fromOgnType);
-            }
-            break;
+            setArray<rosidl_runtime_c__uint16__Sequence, rosidl_runtime_c__uint16__Sequence__init, uint16_t, uint32_t>(
+                member, data, valuePtr, fromOgnType);
         }
-        case rosidl_typesupport_introspection_c__ROS_TYPE_CHAR:
+        else
         {
-            if (member->is_array_)
-            {
-                setArray<rosidl_runtime_c__char__Sequence, rosidl_runtime_c__char__Sequence__init, uint8_t, uint8_t>(
-                    member, data, valuePtr, false);
-            }
-            else
-            {
-                setSingleValue<uint8_t, uint8_t>(data, valuePtr, false);
-            }
-            break;
+            setSingleValue<uint16_t, uint32_t>(data, valuePtr, fromOgnType);
         }
-        case rosidl_typesupport_introspection_c__ROS_TYPE_WCHAR:
+        break;
+    }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_INT16:
+    {
+        if (member->is_array_)
         {
-            if (member->is_array_)
-            {
-                setArray<rosidl_runtime_c__wchar__Sequence, rosidl_runtime_c__wchar__Sequence__init, uint16_t, uint32_t>(
-                    member, data, valuePtr, fromOgnType);
-            }
-            else
-            {
-                setSingleValue<uint16_t, uint32_t>(data, valuePtr, fromOgnType);
-            }
-            break;
+            setArray<rosidl_runtime_c__int16__Sequence, rosidl_runtime_c__int16__Sequence__init, int16_t, int32_t>(
+                member, data, valuePtr, fromOgnType);
         }
-        case rosidl_typesupport_introspection_c__ROS_TYPE_BOOLEAN:
+        else
         {
-            if (member->is_array_)
-            {
-                setArray<rosidl_runtime_c__boolean__Sequence, rosidl_runtime_c__bool__Sequence__init, bool, bool>(
-                    member, data, valuePtr, false);
-            }
-            else
-            {
-                setSingleValue<bool, bool>(data, valuePtr, false);
-            }
-            break;
+            setSingleValue<int16_t, int32_t>(data, valuePtr, fromOgnType);
         }
-        case rosidl_typesupport_introspection_c__ROS_TYPE_OCTET:
-        {
-            if (member->is_array_)
-            {
-                setArray<rosidl_runtime_c__octet__Sequence, rosidl_runtime_c__octet__Sequence__init, uint8_t, uint8_t>(
-                    member, data, valuePtr, false);
-            }
-            else
-            {
-                setSingleValue<uint8_t, uint8_t>(data, valuePtr, false);
-            }
-            break;
-        }
-        case rosidl_typesupport_introspection_c__ROS_TYPE_UINT8:
+        break;
+    }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_UINT32:
+    {
+        if (member->is_array_)
         {
-            if (member->is_array_)
-            {
-                setArray<rosidl_runtime_c__uint8__Sequence, rosidl_runtime_c__uint8__Sequence__init, uint8_t, uint32_t>(
-                    member, data, valuePtr, fromOgnType);
-            }
-            else
-            {
-                setSingleValue<uint8_t, uint32_t>(data, valuePtr, fromOgnType);
-            }
-            break;
+            setArray<rosidl_runtime_c__uint32__Sequence, rosidl_runtime_c__uint32__Sequence__init, uint32_t, uint32_t>(
+                member, data, valuePtr, false);
         }
-        case rosidl_typesupport_introspection_c__ROS_TYPE_INT8:
+        else
         {
-            if (member->is_array_)
-            {
-                setArray<rosidl_runtime_c__int8__Sequence, rosidl_runtime_c__int8__Sequence__init, int8_t, int32_t>(
-                    member, data, valuePtr, fromOgnType);
-            }
-            else
-            {
-                setSingleValue<int8_t, int32_t>(data, valuePtr, fromOgnType);
-            }
-            break;
+            setSingleValue<uint32_t, uint32_t>(data, valuePtr, false);
         }
-        case rosidl_typesupport_introspection_c__ROS_TYPE_UINT16:
+        break;
+    }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_INT32:
+    {
+        if (member->is_array_)
         {
-            if (member->is_array_)
-            {
-                setArray<rosidl_runtime_c__uint16__Sequence, rosidl_runtime_c__uint16__Sequence__init, uint16_t, uint32_t>(
-                    member, data, valuePtr, fromOgnType);
-            }
-            else
-            {
-                setSingleValue<uint16_t, uint32_t>(data, valuePtr, fromOgnType);
-            }
-            break;
+            setArray<rosidl_runtime_c__int32__Sequence, rosidl_runtime_c__int32__Sequence__init, int32_t, int32_t>(
+                member, data, valuePtr, false);
         }
-        case rosidl_typesupport_introspection_c__ROS_TYPE_INT16:
+        else
         {
-            if (member->is_array_)
-            {
-                setArray<rosidl_runtime_c__int16__Sequence, rosidl_runtime_c__int16__Sequence__init, int16_t, int32_t>(
-                    member, data, valuePtr, fromOgnType);
-            }
-            else
-            {
-                setSingleValue<int16_t, int32_t>(data, valuePtr, fromOgnType);
-            }
-            break;
+            setSingleValue<int32_t, int32_t>(data, valuePtr, false);
         }
-        case rosidl_typesupport_introspection_c__ROS_TYPE_UINT32:
+        break;
+    }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_UINT64:
+    {
+        if (member->is_array_)
         {
-            if (member->is_array_)
-            {
-                setArray<rosidl_runtime_c__uint32__Sequence, rosidl_runtime_c__uint32__Sequence__init, uint32_t, uint32_t>(
-                    member, data, valuePtr, false);
-            }
-            else
-            {
-                setSingleValue<uint32_t, uint32_t>(data, valuePtr, false);
-            }
-            break;
+            setArray<rosidl_runtime_c__uint64__Sequence, rosidl_runtime_c__uint64__Sequence__init, uint64_t, uint64_t>(
+                member, data, valuePtr, false);
         }
-        case rosidl_typesupport_introspection_c__ROS_TYPE_INT32:
+        else
         {
-            if (member->is_array_)
-            {
-                setArray<rosidl_runtime_c__int32__Sequence, rosidl_runtime_c__int32__Sequence__init, int32_t, int32_t>(
-                    member, data, valuePtr, false);
-            }
-            else
-            {
-                setSingleValue<int32_t, int32_t>(data, valuePtr, false);
-            }
-            break;
+            setSingleValue<uint64_t, uint64_t>(data, valuePtr, false);
         }
-        case rosidl_typesupport_introspection_c__ROS_TYPE_UINT64:
+        break;
+    }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_INT64:
+    {
+        if (member->is_array_)
         {
-            if (member->is_array_)
-            {
-                setArray<rosidl_runtime_c__uint64__Sequence, rosidl_runtime_c__uint64__Sequence__init, uint64_t, uint64_t>(
-                    member, data, valuePtr, false);
-            }
-            else
-            {
-                setSingleValue<uint64_t, uint64_t>(data, valuePtr, false);
-            }
-            break;
+            setArray<rosidl_runtime_c__int64__Sequence, rosidl_runtime_c__int64__Sequence__init, int64_t, int64_t>(
+                member, data, valuePtr, false);
         }
-        case rosidl_typesupport_introspection_c__ROS_TYPE_INT64:
+        else
         {
-            if (member->is_array_)
-            {
-                setArray<rosidl_runtime_c__int64__Sequence, rosidl_runtime_c__int64__Sequence__init, int64_t, int64_t>(
-                    member, data, valuePtr, false);
-            }
-            else
-            {
-                setSingleValue<int64_t, int64_t>(data, valuePtr, false);
-            }
-            break;
+            setSingleValue<int64_t, int64_t>(data, valuePtr, false);
         }
-        case rosidl_typesupport_introspection_c__ROS_TYPE_STRING:
+        break;
+    }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_STRING:
+    {
+        if (member->is_array_)
         {
-            if (member->is_array_)
+            auto array = std::static_pointer_cast<std::vector<std::string>>(valuePtr);
+            rosidl_runtime_c__String* strings = reinterpret_cast<rosidl_runtime_c__String*>(data);
+            size_t size = std::min(array->size(), member->array_size_);
+            // non-fixed size array: reuse the existing strings when the size is unchanged
+            if (member->is_upper_bound_ || !member->array_size_)
             {
-                auto array = std::static_pointer_cast<std::vector<std::string>>(valuePtr);
-                std::vector<rosidl_runtime_c__String> rosArray(array->size());
-                for (size_t j = 0; j < array->size(); ++j)
+                auto dest = reinterpret_cast<rosidl_runtime_c__String__Sequence*>(data);
+                if (dest->size != array->size())
                 {
-                    rosidl_runtime_c__String__assign(&rosArray.at(j), array->at(j).c_str());
+                    rosidl_runtime_c__String__Sequence__fini(dest);
+                    rosidl_runtime_c__String__Sequence__init(dest, array->size());
                 }
-                setArray<rosidl_runtime_c__String__Sequence, rosidl_runtime_c__String__Sequence__init,
-                         rosidl_runtime_c__String>(member, data, rosArray);
+                strings = dest->data;
+                size = dest->size;
             }
-            else
+            for (size_t j = 0; j < size; ++j)
             {
-                rosidl_runtime_c__String__assign(reinterpret_cast<rosidl_runtime_c__String*>(data),
-                                                 std::static_pointer_cast<const std::string>(valuePtr)->c_str());
+                rosidl_runtime_c__String__assign(&strings[j], array->at(j).c_str());
             }
-            break;
         }
-        case rosidl_typesupport_introspection_c__ROS_TYPE_WSTRING:
+        else
         {
-            // TODO: proccess WSTRING (no messages with 'path:*/msgs/*.msg "wstring"')
+            rosidl_runtime_c__String__assign(reinterpret_cast<rosidl_runtime_c__String*>(data),
+                                             std::static_pointer_cast<const std::string>(valuePtr)->c_str());
         }
-        case rosidl_typesupport_introspection_c__ROS_TYPE_MESSAGE:
+        break;
+    }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_WSTRING:
+    {
+        // TODO: proccess WSTRING (no messages with 'path:*/msgs/*.msg "wstring"')
+        break;
+    }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_MESSAGE:
+    {
+        if (member->is_array_)
         {
-            if (member->is_array_)
-            {
-                auto jsonArrayPtr = std::static_pointer_cast<std::vector<nlohmann::json>>(valuePtr);
-                setArrayEmbeddedMessage(member, data, *jsonArrayPtr);
-            }
-            else
-            {
-                setMessageValues(member->members_->data, data, container, --index, fromOgnType);
-                continue;
-            }
-            break;
-        }
-        default:
-            break;
+            auto jsonArrayPtr = std::static_pointer_cast<std::vector<nlohmann::json>>(valuePtr);
+            setArrayEmbeddedMessage(member, data, *jsonArrayPtr);
         }
+        break;
+    }
+    default:
+        break;
     }
 }
 
@@ -214,6 +214,11 @@ bool Ros2FactoryImpl::validateNodeName(const std::string& nodeName)
     return true;
 }
 
+std::shared_ptr<Ros2CompressedImageMessage> Ros2FactoryImpl::createCompressedImageMessage()
+{
+    return std::make_shared<Ros2CompressedImageMessageImpl>();
+}
+
 } // namespace bridge
 } // namespace ros2
 } // namespace isaacsim
@@ -38,6 +38,7 @@
 #include "rosidl_typesupport_introspection_c/field_types.h"
 #include "rosidl_typesupport_introspection_c/message_introspection.h"
 #include "rosidl_typesupport_introspection_c/service_introspection.h"
+#include "sensor_msgs/msg/compressed_image.h"
 #include "sensor_msgs/msg/image.h"
 #include "sensor_msgs/msg/imu.h"
 #include "sensor_msgs/msg/joint_state.h"
@@ -59,6 +60,8 @@
 #include <rosgraph_msgs/msg/clock.h>
 #include <std_msgs/msg/header.h>
 #include <std_msgs/msg/string.h>
+
+#include <mutex>
 namespace isaacsim
 {
 namespace ros2
@@ -97,7 +100,7 @@ public:
      */
     void writeRosTime(const int64_t nanoseconds, builtin_interfaces__msg__Time& time);
     /**
-     * @brief Writes a ROS 2 string field
+     * @brief Writes a ROS 2 string field, leaving it untouched if it already holds the same value
      * @param[in] input String to write
      * @param[out] output ROS 2 string structure to fill
      */
@@ -235,6 +238,34 @@ public:
     virtual void generateBuffer(const uint32_t height, const uint32_t width, const std::string& encoding);
 };
 
+/**
+ * @class Ros2CompressedImageMessageImpl
+ * @brief Implementation of ROS 2 CompressedImage message
+ * @details
+ * Handles the creation and manipulation of sensor_msgs/msg/CompressedImage messages,
+ * whose data field points at the buffer the image was compressed into.
+ */
+class Ros2CompressedImageMessageImpl : public Ros2CompressedImageMessage, Ros2MessageInterfaceImpl
+{
+public:
+    Ros2CompressedImageMessageImpl();
+    virtual ~Ros2CompressedImageMessageImpl();
+    virtual const void* getTypeSupportHandle();
+
+    /**
+     * @brief Writes the message header
+     * @param[in] timeStamp Time in seconds
+     * @param[in] frameId Frame ID for the image
+     */
+    virtual void writeHeader(const double timeStamp, const std::string& frameId);
+
+    /**
+     * @brief Writes the format and points the data field at the compressed image buffer
+     * @param[in] format Format of the compressed image
+     */
+    virtual void writeData(const std::string& format);
+};
+
 /**
  * @class Ros2NitrosBridgeImageMessageImpl
  * @brief Implementation of NITROS Bridge Image message
@@ -485,6 +516,10 @@ public:
      * @return bool True if the message is valid
      */
     virtual bool checkValid();
+
+private:
+    /** @brief USD path of the joint each name in the message was written for */
+    std::vector<std::string> m_jointPaths;
 };
 
 /**
@@ -656,6 +691,85 @@ public:
                            const double& jerk);
 };
 
+/**
+ * @class Ros2SubscriptionWaitSet
+ * @brief Wait set shared by all the subscriptions of a ROS 2 context
+ * @details
+ * Registers every subscription of a context in a single `rcl_wait_set_t`, so that one
+ * `rcl_wait` call reports the readiness of all subscriptions. A new wait is performed
+ * only when a subscription asks for its readiness a second time since the last wait,
+ * which amounts to one wait per simulation frame when every subscriber spins once per frame.
+ * Waits and takes are serialized, as rcl does not allow taking from a subscription while it is
+ * being waited on. The wait set keeps the context alive until it is finalized.
+ */
+class Ros2SubscriptionWaitSet
+{
+public:
+    /**
+     * @brief Constructor for the shared subscription wait set.
+     * @param[in] context ROS 2 context the subscriptions belong to.
+     */
+    explicit Ros2SubscriptionWaitSet(std::shared_ptr<rcl_context_t> context);
+    ~Ros2SubscriptionWaitSet();
+
+    /**
+     * @brief Registers a subscription in the wait set
+     * @param[in] subscription Subscription to register, must stay valid until removed
+     * @return size_t Slot of the subscription, used to query its readiness and remove it
+     */
+    size_t add(rcl_subscription_t* subscription);
+
+    /**
+     * @brief Removes a subscription from the wait set
+     * @param[in] slot Slot returned by add()
+     */
+    void remove(size_t slot);
+
+    /**
+     * @brief Takes a message from a subscription
+     * @details
+     * When only taking ready messages, consumes the readiness reported by the last wait for this
+     * subscription. If the subscription already consumed it, all the subscriptions are waited on
+     * again first.
+     *
+     * @param[in] slot Slot returned by add()
+     * @param[out] msg Message to take into
+     * @param[in] onlyIfReady Whether to take only if the last wait reported a message for this subscription
+     * @return rcl_ret_t Result of `rcl_take`, RCL_RET_SUBSCRIPTION_TAKE_FAILED if no message was ready
+     */
+    rcl_ret_t take(size_t slot, void* msg, bool onlyIfReady);
+
+private:
+    /**
+     * @brief Checks whether a subscription has a message ready to be taken, with the mutex held
+     * @param[in] slot Slot returned by add()
+     * @return bool True if a message is ready to be taken
+     */
+    bool isReady(size_t slot);
+
+    /**
+     * @brief Waits on all the registered subscriptions without blocking
+     * @return bool True if the wait succeeded
+     */
+    bool wait();
+
+    struct Entry
+    {
+        rcl_subscription_t* subscription = nullptr;
+        bool ready = false;
+        bool polled = true;
+    };
+
+    std::mutex m_mutex;
+    std::shared_ptr<rcl_context_t> m_context;
+    rcl_wait_set_t m_waitSet;
+    bool m_waitSetInitialized = false;
+    size_t m_waitSetCapacity = 0;
+    std::vector<Entry> m_entries;
+    std::vector<size_t> m_freeSlots;
+    std::vector<size_t> m_waitSetSlots;
+};
+
 /**
  * @class Ros2ContextHandleImpl
  * @brief Implementation of ROS 2 Context Handle
@@ -675,9 +789,18 @@ public:
     virtual bool isValid();
     virtual bool shutdown(const char* shutdownReason = nullptr);
 
+    /**
+     * @brief Gets the wait set shared by the subscriptions of this context
+     * @details The wait set is created on first use and released when the context is shut down.
+     * @return std::shared_ptr<Ros2SubscriptionWaitSet> Shared wait set, nullptr if the context is not initialized
+     */
+    std::shared_ptr<Ros2SubscriptionWaitSet> getSubscriptionWaitSet();
+
 private:
     rcl_init_options_t m_initOptions;
     std::shared_ptr<rcl_context_t> m_context;
+    std::mutex m_subscriptionWaitSetMutex;
+    std::shared_ptr<Ros2SubscriptionWaitSet> m_subscriptionWaitSet;
 };
 
 /**
@@ -776,11 +899,18 @@ public:
         return m_subscription != nullptr;
     }
 
+    /**
+     * @brief Takes the next queued message without waiting
+     * @param[out] msg Pointer to store the received message
+     * @return bool True if a message was taken
+     */
+    virtual bool takeNext(void* msg);
+
 private:
     Ros2NodeHandle* m_nodeHandle;
     std::shared_ptr<rcl_subscription_t> m_subscription = nullptr;
-    rcl_wait_set_t m_waitSet;
-    bool m_waitSetInitialized = false;
+    std::shared_ptr<Ros2SubscriptionWaitSet> m_waitSet;
+    size_t m_waitSetSlot = 0;
 };
 
 /**
@@ -943,7 +1073,61 @@ public:
      */
     virtual void writeData(const std::vector<std::shared_ptr<void>>& data, bool fromOgnType);
 
+    /**
+     * @brief Gets the number of elements of a field
+     * @param[in] index Field index
+     * @return size_t Number of elements (1 for non-array fields)
+     */
+    virtual size_t getFieldSize(size_t index);
+
+    /**
+     * @brief Copies a field into OmniGraph typed memory
+     * @param[in] index Field index
+     * @param[out] dst Destination memory
+     * @param[in] count Number of elements available at dst
+     * @return bool True if the field was copied
+     */
+    virtual bool readField(size_t index, void* dst, size_t count);
+
+    /**
+     * @brief Copies a field from OmniGraph typed memory
+     * @param[in] index Field index
+     * @param[in] src Source memory
+     * @param[in] count Number of elements at src
+     * @return bool True if the field was copied
+     */
+    virtual bool writeField(size_t index, const void* src, size_t count);
+
+    /**
+     * @brief Reads a single field into its vector container entry
+     * @param[in] index Field index
+     * @param[in] asOgnType Whether to convert to OmniGraph types
+     * @return const std::shared_ptr<void>& Field data
+     */
+    virtual const std::shared_ptr<void>& readFieldValue(size_t index, bool asOgnType);
+
+    /**
+     * @brief Writes a single field from vector container data
+     * @param[in] index Field index
+     * @param[in] value Field data
+     * @param[in] fromOgnType Whether data is in OmniGraph types
+     */
+    virtual void writeFieldValue(size_t index, const std::shared_ptr<void>& value, bool fromOgnType);
+
 protected:
+    /**
+     * @struct FieldAccess
+     * @brief Precomputed access to a flattened message field
+     * @details
+     * Built once per message type while parsing the message fields, so that reading and writing
+     * the fields does not walk the introspection members on every message.
+     */
+    struct FieldAccess
+    {
+        size_t offset; //!< Byte offset of the field from the start of the message.
+        const rosidl_typesupport_introspection_c__MessageMember* member; //!< Introspection member of the field.
+    };
+
     /**
      * @brief Gets the introspection members of the ROS2 message type.
      * @details
@@ -958,8 +1142,9 @@ protected:
      * @brief Parses message field definitions
      * @param[in] parentName Name of the parent field
      * @param[in] members Pointer to message members definition
+     * @param[in] parentOffset Byte offset of the parent field from the start of the message
      */
-    virtual void parseMessageFields(const std::string& parentName, const void* members);
+    virtual void parseMessageFields(const std::string& parentName, const void* members, size_t parentOffset = 0);
 
     /**
      * @brief Gets message field values as JSON
@@ -970,18 +1155,12 @@ protected:
     virtual void getMessageValues(const void* members, uint8_t* messageData, nlohmann::json& container);
 
     /**
-     * @brief Gets message field values as vector
-     * @param[in] members Pointer to message members definition
-     * @param[in] messageData Pointer to message data
-     * @param[out] container Vector container to fill
-     * @param[in,out] index Current field index
+     * @brief Gets a field value into a vector container entry
+     * @param[in] field Field access plan entry
+     * @param[out] valuePtr Container entry to fill
      * @param[in] asOgnType Whether to convert to OmniGraph types
      */
-    virtual void getMessageValues(const void* members,
-                                  uint8_t* messageData,
-                                  std::vector<std::shared_ptr<void>>& container,
-                                  size_t& index,
-                                  bool asOgnType);
+    void getFieldValue(const FieldAccess& field, std::shared_ptr<void>& valuePtr, bool asOgnType);
 
     /**
      * @brief Sets message field values from JSON
@@ -992,18 +1171,29 @@ protected:
     virtual void setMessageValues(const void* members, uint8_t* messageData, const nlohmann::json& container);
 
     /**
-     * @brief Sets message field values from vector
-     * @param[in] members Pointer to message members definition
-     * @param[out] messageData Pointer to message data
-     * @param[in] container Vector container with field values
-     * @param[in,out] index Current field index
+     * @brief Sets a field value from a vector container entry
+     * @param[in] field Field access plan entry
+     * @param[in] valuePtr Container entry with the field value
      * @param[in] fromOgnType Whether data is in OmniGraph types
      */
-    virtual void setMessageValues(const void* members,
-                                  uint8_t* messageData,
-                                  const std::vector<std::shared_ptr<void>>& container,
-                                  size_t& index,
-                                  bool fromOgnType);
+    void setFieldValue(const FieldAccess& field, const std::shared_ptr<void>& valuePtr, bool fromOgnType);
+
+    /**
+     * @brief Copies the elements of a numeric or boolean field to or from OmniGraph typed memory
+     * @details
+     * Sequences are resized to count when writing, reusing their capacity when possible.
+     *
+     * @tparam RosType The ROS data type
+     * @tparam OgnType The OmniGraph data type
+     * @tparam toRos Whether to copy from ognData into the message
+     *
+     * @param[in] field Field access plan entry
+     * @param[in,out] ognData OmniGraph typed memory
+     * @param[in] count Number of elements at ognData
+     * @return bool True if the elements were copied
+     */
+    template <typename RosType, typename OgnType, bool toRos>
+    bool copyFieldElements(const FieldAccess& field, void* ognData, size_t count);
 
     /**
      * @brief Gets array values from ROS message and converts them to JSON format
@@ -1173,6 +1363,8 @@ protected:
     void setArrayEmbeddedMessage(const rosidl_typesupport_introspection_c__MessageMember* member,
                                  uint8_t* data,
                                  const nlohmann::json& array);
+
+    std::vector<FieldAccess> m_fieldAccessPlan; //!< Flattened fields, in the same order as the message fields.
 };
 
 /**
@@ -26,6 +26,8 @@
 #include <rcl/rcl.h>
 #include <sensor_msgs/msg/camera_info.h>
 
+#include <algorithm>
+
 namespace isaacsim
 {
 namespace ros2
@@ -33,6 +35,26 @@ namespace ros2
 namespace bridge
 {
 
+/**
+ * @brief Sets the number of elements of a rosidl sequence, keeping its storage when it is large enough.
+ * @details Elements past the size stay initialized, so they can be reused when the sequence grows back.
+ * @param[in,out] sequence Sequence to resize
+ * @param[in] size Number of elements
+ * @return True if the sequence was reallocated, in which case all elements are default initialized
+ */
+template <typename SequenceT, bool (*Init)(SequenceT*, size_t), void (*Fini)(SequenceT*)>
+static bool resizeRosSequence(SequenceT* sequence, size_t size)
+{
+    if (sequence->data && size <= sequence->capacity)
+    {
+        sequence->size = size;
+        return false;
+    }
+    Fini(sequence);
+    Init(sequence, size);
+    return true;
+}
+
 // Clock message
 Ros2ClockMessageImpl::Ros2ClockMessageImpl() : Ros2MessageInterfaceImpl("rosgraph_msgs", "msg", "Clock")
 {
@@ -328,6 +350,55 @@ Ros2ImageMessageImpl::~Ros2ImageMessageImpl()
     sensor_msgs__msg__Image__destroy(imageMsg);
 }
 
+// CompressedImage message
+Ros2CompressedImageMessageImpl::Ros2CompressedImageMessageImpl()
+    : Ros2MessageInterfaceImpl("sensor_msgs", "msg", "CompressedImage")
+{
+    m_msg = sensor_msgs__msg__CompressedImage__create();
+}
+
+const void* Ros2CompressedImageMessageImpl::getTypeSupportHandle()
+{
+    return ROSIDL_GET_MSG_TYPE_SUPPORT(sensor_msgs, msg, CompressedImage);
+}
+
+void Ros2CompressedImageMessageImpl::writeHeader(const double timeStamp, const std::string& frameId)
+{
+    if (!m_msg)
+    {
+        return;
+    }
+    sensor_msgs__msg__CompressedImage* imageMsg = static_cast<sensor_msgs__msg__CompressedImage*>(m_msg);
+    Ros2MessageInterfaceImpl::writeRosHeader(frameId, static_cast<int64_t>(timeStamp * 1e9), imageMsg->header);
+}
+
+void Ros2CompressedImageMessageImpl::writeData(const std::string& format)
+{
+    if (!m_msg)
+    {
+        return;
+    }
+    sensor_msgs__msg__CompressedImage* imageMsg = static_cast<sensor_msgs__msg__CompressedImage*>(m_msg);
+    Ros2MessageInterfaceImpl::writeRosString(format, imageMsg->format);
+    imageMsg->data.size = m_buffer.size();
+    imageMsg->data.capacity = m_buffer.size();
+    imageMsg->data.data = m_buffer.data();
+}
+
+Ros2CompressedImageMessageImpl::~Ros2CompressedImageMessageImpl()
+{
+    if (!m_msg)
+    {
+        return;
+    }
+    sensor_msgs__msg__CompressedImage* imageMsg = static_cast<sensor_msgs__msg__CompressedImage*>(m_msg);
+    // Lifetime of memory is not managed by the message as we use a std vector
+    imageMsg->data.size = 0;
+    imageMsg->data.capacity = 0;
+    imageMsg->data.data = nullptr;
+    sensor_msgs__msg__CompressedImage__destroy(imageMsg);
+}
+
 // NitrosBridgeImage message
 // For this specific message we disable logging when loading the message library to prevent spam
 Ros2NitrosBridgeImageMessageImpl::Ros2NitrosBridgeImageMessageImpl()
@@ -706,7 +777,9 @@ void Ros2RawTfTreeMessageImpl::writeData(const double timeStamp,
         return;
     }
     tf2_msgs__msg__TFMessage* tfMsg = static_cast<tf2_msgs__msg__TFMessage*>(m_msg);
-    geometry_msgs__msg__TransformStamped__Sequence__init(&tfMsg->transforms, 1);
+    resizeRosSequence<geometry_msgs__msg__TransformStamped__Sequence,
+                      geometry_msgs__msg__TransformStamped__Sequence__init,
+                      geometry_msgs__msg__TransformStamped__Sequence__fini>(&tfMsg->transforms, 1);
 
     Ros2MessageInterfaceImpl::writeRosHeader(
         frameId, static_cast<int64_t>(timeStamp * 1e9), tfMsg->transforms.data->header);
@@ -834,18 +907,35 @@ void Ros2JointStateMessageImpl::writeData(const double& timeStamp,
         hasDofStates = false;
     }
 
-    rosidl_runtime_c__String__Sequence__init(&jointStateMsg->name, numDofs);
-    rosidl_runtime_c__double__Sequence__init(&jointStateMsg->position, numDofs);
-    rosidl_runtime_c__double__Sequence__init(&jointStateMsg->velocity, numDofs);
-    rosidl_runtime_c__double__Sequence__init(&jointStateMsg->effort, numDofs);
+    // The sequences keep their storage between publishes and only grow
+    if (resizeRosSequence<rosidl_runtime_c__String__Sequence, rosidl_runtime_c__String__Sequence__init,
+                          rosidl_runtime_c__String__Sequence__fini>(&jointStateMsg->name, numDofs))
+    {
+        m_jointPaths.clear();
+    }
+    m_jointPaths.resize(numDofs);
+    resizeRosSequence<rosidl_runtime_c__double__Sequence, rosidl_runtime_c__double__Sequence__init,
+                      rosidl_runtime_c__double__Sequence__fini>(&jointStateMsg->position, numDofs);
+    resizeRosSequence<rosidl_runtime_c__double__Sequence, rosidl_runtime_c__double__Sequence__init,
+                      rosidl_runtime_c__double__Sequence__fini>(&jointStateMsg->velocity, numDofs);
+    resizeRosSequence<rosidl_runtime_c__double__Sequence, rosidl_runtime_c__double__Sequence__init,
+                      rosidl_runtime_c__double__Sequence__fini>(&jointStateMsg->effort, numDofs);
 
-    if (hasDofStates)
+    if (!hasDofStates)
+    {
+        std::fill(jointStateMsg->position.data, jointStateMsg->position.data + numDofs, 0.0);
+        std::fill(jointStateMsg->velocity.data, jointStateMsg->velocity.data + numDofs, 0.0);
+        std::fill(jointStateMsg->effort.data, jointStateMsg->effort.data + numDofs, 0.0);
+    }
+    else
     {
         for (uint32_t j = 0; j < numDofs; j++)
         {
+            // Joint names are only looked up on the stage when the joint at this index changes
             const char* jointPath = articulation->getUsdDofPath(0, j);
-            if (jointPath)
+            if (jointPath && m_jointPaths[j] != jointPath)
             {
+                m_jointPaths[j] = jointPath;
                 Ros2MessageInterfaceImpl::writeRosString(
                     isaacsim::core::includes::getName(stage->GetPrimAtPath(pxr::SdfPath(jointPath))),
                     jointStateMsg->name.data[j]);
@@ -1009,7 +1099,8 @@ void Ros2PointCloudMessageImpl::generateBuffer(const double& timeStamp,
     m_buffer.resize(totalBytes);
     pointCloudMsg->data.data = &m_buffer[0];
 
-    sensor_msgs__msg__PointField__Sequence__init(&pointCloudMsg->fields, 3);
+    resizeRosSequence<sensor_msgs__msg__PointField__Sequence, sensor_msgs__msg__PointField__Sequence__init,
+                      sensor_msgs__msg__PointField__Sequence__fini>(&pointCloudMsg->fields, 3);
 
     Ros2MessageInterfaceImpl::writeRosString("x", pointCloudMsg->fields.data[0].name);
     Ros2MessageInterfaceImpl::writeRosString("y", pointCloudMsg->fields.data[1].name);
@@ -1150,7 +1241,9 @@ void Ros2TfTreeMessageImpl::writeData(const double& timeStamp, std::vector<TfTra
         return;
     }
     tf2_msgs__msg__TFMessage* tfMsg = static_cast<tf2_msgs__msg__TFMessage*>(m_msg);
-    geometry_msgs__msg__TransformStamped__Sequence__init(&tfMsg->transforms, transforms.size());
+    resizeRosSequence<geometry_msgs__msg__TransformStamped__Sequence,
+                      geometry_msgs__msg__TransformStamped__Sequence__init,
+                      geometry_msgs__msg__TransformStamped__Sequence__fini>(&tfMsg->transforms, transforms.size());
 
     for (size_t i = 0; i < transforms.size(); i++)
     {
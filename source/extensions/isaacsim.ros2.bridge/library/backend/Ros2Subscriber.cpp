@@ -25,11 +25,160 @@ namespace ros2
 namespace bridge
 {
 
+Ros2SubscriptionWaitSet::Ros2SubscriptionWaitSet(std::shared_ptr<rcl_context_t> context)
+    : m_context(std::move(context))
+{
+}
+
+Ros2SubscriptionWaitSet::~Ros2SubscriptionWaitSet()
+{
+    if (m_waitSetInitialized)
+    {
+        rcl_ret_t rc = rcl_wait_set_fini(&m_waitSet);
+        if (rc != RCL_RET_OK)
+        {
+            RCL_ERROR_MSG(~Ros2SubscriptionWaitSet, rcl_wait_set_fini);
+        }
+        m_waitSetInitialized = false;
+    }
+}
+
+size_t Ros2SubscriptionWaitSet::add(rcl_subscription_t* subscription)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t slot;
+    if (!m_freeSlots.empty())
+    {
+        slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    }
+    else
+    {
+        slot = m_entries.size();
+        m_entries.emplace_back();
+    }
+    m_entries[slot] = Entry();
+    m_entries[slot].subscription = subscription;
+    return slot;
+}
+
+void Ros2SubscriptionWaitSet::remove(size_t slot)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (slot < m_entries.size() && m_entries[slot].subscription)
+    {
+        m_entries[slot] = Entry();
+        m_freeSlots.push_back(slot);
+    }
+}
+
+rcl_ret_t Ros2SubscriptionWaitSet::take(size_t slot, void* msg, bool onlyIfReady)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (onlyIfReady && !isReady(slot))
+    {
+        return RCL_RET_SUBSCRIPTION_TAKE_FAILED;
+    }
+    rmw_message_info_t messageInfo;
+    return rcl_take(m_entries[slot].subscription, msg, &messageInfo, nullptr);
+}
+
+bool Ros2SubscriptionWaitSet::isReady(size_t slot)
+{
+    Entry& entry = m_entries[slot];
+    if (entry.polled)
+    {
+        // This subscription already consumed the result of the last wait, wait again for everyone
+        if (!wait())
+        {
+            return false;
+        }
+    }
+    entry.polled = true;
+    bool ready = entry.ready;
+    entry.ready = false;
+    return ready;
+}
+
+bool Ros2SubscriptionWaitSet::wait()
+{
+    const size_t subscriptionCount = m_entries.size() - m_freeSlots.size();
+    rcl_ret_t rc;
+    if (!m_waitSetInitialized)
+    {
+        m_waitSet = rcl_get_zero_initialized_wait_set();
+        rc = rcl_wait_set_init(&m_waitSet, subscriptionCount, 0, 0, 0, 0, 0, m_context.get(),
+                               rcl_get_default_allocator());
+        if (rc != RCL_RET_OK)
+        {
+            RCL_ERROR_MSG(Ros2SubscriptionWaitSet::wait, rcl_wait_set_init);
+            return false;
+        }
+        m_waitSetInitialized = true;
+        m_waitSetCapacity = subscriptionCount;
+    }
+    else if (m_waitSetCapacity < subscriptionCount)
+    {
+        rc = rcl_wait_set_resize(&m_waitSet, subscriptionCount, 0, 0, 0, 0, 0);
+        if (rc != RCL_RET_OK)
+        {
+            RCL_ERROR_MSG(Ros2SubscriptionWaitSet::wait, rcl_wait_set_resize);
+            return false;
+        }
+        m_waitSetCapacity = subscriptionCount;
+    }
+
+    rc = rcl_wait_set_clear(&m_waitSet);
+    if (rc != RCL_RET_OK)
+    {
+        RCL_ERROR_MSG(Ros2SubscriptionWaitSet::wait, rcl_wait_set_clear);
+        return false;
+    }
+    m_waitSetSlots.clear();
+    for (size_t slot = 0; slot < m_entries.size(); slot++)
+    {
+        Entry& entry = m_entries[slot];
+        entry.ready = false;
+        entry.polled = false;
+        if (!entry.subscription)
+        {
+            continue;
+        }
+        size_t index;
+        rc = rcl_wait_set_add_subscription(&m_waitSet, entry.subscription, &index);
+        if (rc != RCL_RET_OK)
+        {
+            RCL_ERROR_MSG(Ros2SubscriptionWaitSet::wait, rcl_wait_set_add_subscription);
+            return false;
+        }
+        if (m_waitSetSlots.size() <= index)
+        {
+            m_waitSetSlots.resize(index + 1);
+        }
+        m_waitSetSlots[index] = slot;
+    }
+
+    rc = rcl_wait(&m_waitSet, 0);
+    if (rc != RCL_RET_OK)
+    {
+        // RCL_RET_TIMEOUT when no subscription has a message ready
+        return rc == RCL_RET_TIMEOUT;
+    }
+    for (size_t index = 0; index < m_waitSetSlots.size(); index++)
+    {
+        if (m_waitSet.subscriptions[index])
+        {
+            m_entries[m_waitSetSlots[index]].ready = true;
+        }
+    }
+    return true;
+}
+
 Ros2SubscriberImpl::Ros2SubscriberImpl(Ros2NodeHandle* nodeHandle,
                                        const char* topicName,
                                        const void* typeSupport,
                                        const Ros2QoSProfile& qos)
-    : m_nodeHandle(nodeHandle), m_waitSetInitialized(false)
+    : m_nodeHandle(nodeHandle)
 {
     m_subscription = std::shared_ptr<rcl_subscription_t>(
         new rcl_subscription_t,
@@ -57,17 +206,20 @@ Ros2SubscriberImpl::Ros2SubscriberImpl(Ros2NodeHandle* nodeHandle,
         m_subscription.reset();
         return;
     }
+
+    // All the subscriptions of a context are waited on together
+    m_waitSet = static_cast<Ros2ContextHandleImpl*>(m_nodeHandle->getContextHandle())->getSubscriptionWaitSet();
+    if (m_waitSet)
+    {
+        m_waitSetSlot = m_waitSet->add(m_subscription.get());
+    }
 }
 Ros2SubscriberImpl::~Ros2SubscriberImpl()
 {
-    if (m_waitSetInitialized)
+    if (m_waitSet)
     {
-        rcl_ret_t rc = rcl_wait_set_fini(&m_waitSet);
-        if (rc != RCL_RET_OK)
-        {
-            RCL_ERROR_MSG(~Ros2SubscriberImpl, rcl_wait_set_fini);
-        }
-        m_waitSetInitialized = false;
+        m_waitSet->remove(m_waitSetSlot);
+        m_waitSet.reset();
     }
 
     m_subscription.reset();
@@ -76,51 +228,51 @@ Ros2SubscriberImpl::~Ros2SubscriberImpl()
 
 bool Ros2SubscriberImpl::spin(void* msg)
 {
-    if (!m_waitSetInitialized)
+    if (!m_waitSet)
     {
-        m_waitSet = rcl_get_zero_initialized_wait_set();
-        rcl_ret_t rc = rcl_wait_set_init(&m_waitSet, 1, 0, 0, 0, 0, 0,
-                                         static_cast<rcl_context_t*>(m_nodeHandle->getContextHandle()->getContext()),
-                                         rcl_get_default_allocator());
+        return false;
+    }
+    CARB_LOG_WARN_ONCE("Subscriber created, check topic name and message type if not active");
+    rcl_ret_t ret = m_waitSet->take(m_waitSetSlot, msg, true);
+    if (ret == RCL_RET_SUBSCRIPTION_TAKE_FAILED)
+    {
+        return false;
+    }
+    if (ret != RCL_RET_OK)
+    {
+        RCL_ERROR_MSG(spin, rcl_take);
+        return false;
+    }
+    return true;
+}
 
-        if (rc != RCL_RET_OK)
-        {
-            RCL_ERROR_MSG(spin, rcl_wait_set_init);
-            return false;
-        }
-        m_waitSetInitialized = true;
+bool Ros2SubscriberImpl::takeNext(void* msg)
+{
+    if (!m_subscription)
+    {
+        return false;
+    }
+    rcl_ret_t ret;
+    if (m_waitSet)
+    {
+        // Taken under the wait set lock, as another subscriber of the context may be waiting on it
+        ret = m_waitSet->take(m_waitSetSlot, msg, false);
     }
     else
     {
-        rcl_ret_t rc = rcl_wait_set_clear(&m_waitSet);
-        rc = rcl_wait_set_add_subscription(&m_waitSet, m_subscription.get(), nullptr);
-        if (rc != RCL_RET_OK)
-        {
-            RCL_ERROR_MSG(spin, rcl_wait_set_add_subscription);
-            return false;
-        }
-        rc = rcl_wait(&m_waitSet, 0);
-        CARB_LOG_WARN_ONCE("Subscriber created, check topic name and message type if not active");
-        if (rc != RCL_RET_OK)
-        {
-            // This keeps printing an error if the publisher is not active.
-            // Ideally only want to notify user once, when the subscription is created
-            // RCL_WARN_MSG(spin, rcl_wait);
-            return false;
-        }
-        if (m_waitSet.subscriptions[0])
-        {
-            rmw_message_info_t messageInfo;
-            rcl_ret_t ret = rcl_take(m_subscription.get(), msg, &messageInfo, nullptr);
-            if (ret != RCL_RET_OK)
-            {
-                RCL_ERROR_MSG(spin, rcl_take);
-                return false;
-            }
-            return true;
-        }
+        rmw_message_info_t messageInfo;
+        ret = rcl_take(m_subscription.get(), msg, &messageInfo, nullptr);
+    }
+    if (ret == RCL_RET_SUBSCRIPTION_TAKE_FAILED)
+    {
+        return false;
+    }
+    if (ret != RCL_RET_OK)
+    {
+        RCL_ERROR_MSG(takeNext, rcl_take);
+        return false;
     }
-    return false;
+    return true;
 }
 
 } // namespace bridge
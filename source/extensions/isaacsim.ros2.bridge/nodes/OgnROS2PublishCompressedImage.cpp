@@ -0,0 +1,316 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// clang-format off
+#include <pch/UsdPCH.h>
+// clang-format on
+
+#include <carb/profiler/Profile.h>
+#include <carb/tasking/ITasking.h>
+#include <carb/tasking/TaskingUtils.h>
+
+#include <isaacsim/core/includes/ScopedCudaDevice.h>
+#include <isaacsim/ros2/bridge/ImageEncoder.h>
+#include <isaacsim/ros2/bridge/Ros2Node.h>
+
+#include <OgnROS2PublishCompressedImageDatabase.h>
+#include <mutex>
+
+using namespace isaacsim::ros2::bridge;
+
+/**
+ * @brief Frame captured for compression, with the encoder, message and buffers it reuses each time it is published.
+ */
+class CompressedImageFrame
+{
+public:
+    carb::tasking::TaskGroup tasks;
+    std::shared_ptr<Ros2CompressedImageMessage> message;
+    ImageEncoder encoder;
+
+    std::vector<uint8_t> pixels; // Uncompressed image captured on the host
+    uint32_t width = 0;
+    uint32_t height = 0;
+    std::string encoding;
+    ImageCompression compression = ImageCompression::eJpeg;
+    int quality = 90;
+    uint64_t sequence = 0;
+};
+
+class OgnROS2PublishCompressedImage : public Ros2Node
+{
+public:
+    static bool compute(OgnROS2PublishCompressedImageDatabase& db)
+    {
+        auto& state = db.perInstanceState<OgnROS2PublishCompressedImage>();
+        // Spin once calls reset automatically if it was not successful
+        const auto& nodeObj = db.abi_node();
+        if (!state.isInitialized())
+        {
+            const GraphContextObj& context = db.abi_context();
+            // Find our stage
+            long stageId = context.iContext->getStageId(context);
+            auto stage = pxr::UsdUtilsStageCache::Get().Find(pxr::UsdStageCache::Id::FromLongInt(stageId));
+
+            if (!state.initializeNodeHandle(
+                    std::string(nodeObj.iNode->getPrimPath(nodeObj)),
+                    collectNamespace(db.inputs.nodeNamespace(),
+                                     stage->GetPrimAtPath(pxr::SdfPath(nodeObj.iNode->getPrimPath(nodeObj)))),
+                    db.inputs.context()))
+            {
+                db.logError("Unable to create ROS2 node, please check that namespace is valid");
+                return false;
+            }
+        }
+
+        // Publisher was not valid, create a new one
+        if (!state.m_publisher)
+        {
+            CARB_PROFILE_ZONE(0, "setup publisher");
+            // Setup ROS publisher
+            const std::string& topicName = db.inputs.topicName();
+            std::string fullTopicName = addTopicPrefix(state.m_namespaceName, topicName);
+            if (!state.m_factory->validateTopicName(fullTopicName))
+            {
+                db.logError("Unable to create ROS2 publisher, invalid topic name");
+                return false;
+            }
+
+            for (CompressedImageFrame& frame : state.m_frames)
+            {
+                frame.message = state.m_factory->createCompressedImageMessage();
+            }
+
+            Ros2QoSProfile qos;
+            const std::string& qosProfile = db.inputs.qosProfile();
+            if (qosProfile.empty())
+            {
+                qos.depth = db.inputs.queueSize();
+            }
+            else
+            {
+                if (!jsonToRos2QoSProfile(qos, qosProfile))
+                {
+                    return false;
+                }
+            }
+
+            state.m_publisher =
+                state.m_factory->createPublisher(state.m_nodeHandle.get(), fullTopicName.c_str(),
+                                                 state.m_frames[0].message->getTypeSupportHandle(), qos);
+
+            state.m_frameId = db.inputs.frameId();
+
+            // Get extension settings for multithreading
+            carb::settings::ISettings* threadSettings = carb::getCachedInterface<carb::settings::ISettings>();
+            static constexpr char s_kThreadDisable[] = "/exts/isaacsim.ros2.bridge/publish_multithreading_disabled";
+            state.m_multithreadingDisabled = threadSettings->getAsBool(s_kThreadDisable);
+            return true;
+        }
+
+        return state.publishCompressedImage(db);
+    }
+
+    bool publishCompressedImage(OgnROS2PublishCompressedImageDatabase& db)
+    {
+        CARB_PROFILE_ZONE(1, "publish compressed image function");
+        auto tasking = carb::getCachedInterface<carb::tasking::ITasking>();
+
+        // Frames alternate between two slots, so the previous frame keeps compressing while this one is captured
+        CompressedImageFrame& frame = m_frames[m_numFrames % 2];
+        {
+            CARB_PROFILE_ZONE(1, "wait for previous publish");
+            // Wait for the frame before the previous one, which used the same buffers
+            frame.tasks.wait();
+        }
+        // Check if subscription count is 0
+        if (!m_publishWithoutVerification && !m_publisher.get()->getSubscriptionCount())
+        {
+            return false;
+        }
+
+        if (db.inputs.width() == 0 || db.inputs.height() == 0)
+        {
+            db.logError("Width %d or height %d is not valid", db.inputs.width(), db.inputs.height());
+            return false;
+        }
+
+        const std::string encoding = db.tokenToString(db.inputs.encoding());
+        const int channels = ImageEncoder::getNumChannels(encoding);
+        if (channels == 0)
+        {
+            db.logError("Images with %s encoding cannot be compressed", encoding.c_str());
+            return false;
+        }
+        const std::string compressionFormat = db.tokenToString(db.inputs.compressionFormat());
+        if (compressionFormat != "jpeg" && compressionFormat != "qoi")
+        {
+            db.logError("Compression format %s is not supported", compressionFormat.c_str());
+            return false;
+        }
+
+        const size_t totalBytes = static_cast<size_t>(db.inputs.width()) * db.inputs.height() * channels;
+        frame.pixels.resize(totalBytes);
+        if (db.inputs.cudaDeviceIndex() == -1)
+        {
+            CARB_PROFILE_ZONE(1, "Data on host");
+            if (db.inputs.dataPtr() != 0 && totalBytes == db.inputs.bufferSize())
+            {
+                // Data is on host as ptr, buffer size matches
+                memcpy(frame.pixels.data(), reinterpret_cast<void*>(db.inputs.dataPtr()), totalBytes);
+            }
+            else if (db.inputs.dataPtr() == 0 && totalBytes == db.inputs.data.size())
+            {
+                // Data is on host as ogn data, copy from cpu
+                memcpy(frame.pixels.data(), reinterpret_cast<const uint8_t*>(db.inputs.data.cpu().data()), totalBytes);
+            }
+            else
+            {
+                db.logError("image format and expected size %d bytes does not match input buffer Size of %d bytes",
+                            totalBytes, db.inputs.bufferSize());
+                db.logError("dataPtr null and expected size %d bytes does not match input data Size of %d bytes",
+                            totalBytes, db.inputs.data.size());
+                return false;
+            }
+        }
+        else
+        {
+            if (db.inputs.dataPtr() == 0 || totalBytes != db.inputs.bufferSize())
+            {
+                db.logError("image format and expected size %d bytes does not match input buffer Size of %d bytes",
+                            totalBytes, db.inputs.bufferSize());
+                return false;
+            }
+            // The device buffer is only valid during this compute, so it is copied before handing the frame off
+            copyFromDevice(frame, reinterpret_cast<const void*>(db.inputs.dataPtr()), db.inputs.cudaDeviceIndex());
+        }
+
+        frame.message->writeHeader(db.inputs.timeStamp(), m_frameId);
+        frame.width = db.inputs.width();
+        frame.height = db.inputs.height();
+        frame.encoding = encoding;
+        frame.compression = compressionFormat == "qoi" ? ImageCompression::eQoi : ImageCompression::eJpeg;
+        frame.quality = db.inputs.jpegQuality();
+        frame.sequence = ++m_numFrames;
+
+        if (m_multithreadingDisabled)
+        {
+            return compressAndPublish(frame);
+        }
+        tasking->addTask(carb::tasking::Priority::eHigh, frame.tasks, [this, &frame] { compressAndPublish(frame); });
+        return true;
+    }
+
+    void copyFromDevice(CompressedImageFrame& frame, const void* devicePtr, int cudaDeviceIndex)
+    {
+        CARB_PROFILE_ZONE(1, "data in cuda memory");
+        isaacsim::core::includes::ScopedDevice scopedDev(cudaDeviceIndex);
+
+        // If the device doesn't match and we have created a stream, destroy it
+        if (m_streamDevice != cudaDeviceIndex && m_streamNotCreated == false)
+        {
+            CARB_PROFILE_ZONE(1, "Destroy stream");
+            CUDA_CHECK(cudaStreamDestroy(m_stream));
+            m_streamNotCreated = true;
+            m_streamDevice = -1;
+        }
+        // Create a stream if it does not exist
+        if (m_streamNotCreated)
+        {
+            CARB_PROFILE_ZONE(1, "Create stream");
+            CUDA_CHECK(cudaStreamCreate(&m_stream));
+            m_streamNotCreated = false;
+            m_streamDevice = cudaDeviceIndex;
+        }
+
+        CUDA_CHECK(cudaMemcpyAsync(frame.pixels.data(), devicePtr, frame.pixels.size(), cudaMemcpyDeviceToHost,
+                                   m_stream));
+        CUDA_CHECK(cudaStreamSynchronize(m_stream));
+    }
+
+    bool compressAndPublish(CompressedImageFrame& frame)
+    {
+        CARB_PROFILE_ZONE(1, "Publish Compressed Image Thread");
+        {
+            CARB_PROFILE_ZONE(1, "compress image");
+            if (!frame.encoder.encode(frame.pixels.data(), frame.width, frame.height, frame.encoding,
+                                      frame.compression, frame.quality, frame.message->getBuffer()))
+            {
+                CARB_LOG_ERROR("Failed to compress %ux%u %s image", frame.width, frame.height, frame.encoding.c_str());
+                return false;
+            }
+            frame.message->writeData(ImageEncoder::getFormat(frame.encoding, frame.compression));
+        }
+
+        CARB_PROFILE_ZONE(1, "compressed image publisher publish");
+        std::lock_guard<std::mutex> lock(m_publishMutex);
+        // A frame that finishes compressing after the next one is dropped rather than published out of order
+        if (frame.sequence < m_lastPublishedFrame)
+        {
+            return false;
+        }
+        m_publisher->publish(frame.message->getPtr());
+        m_lastPublishedFrame = frame.sequence;
+        return true;
+    }
+
+    static void releaseInstance(NodeObj const& nodeObj, GraphInstanceID instanceId)
+    {
+        auto& state = OgnROS2PublishCompressedImageDatabase::sPerInstanceState<OgnROS2PublishCompressedImage>(
+            nodeObj, instanceId);
+        state.reset();
+    }
+
+    virtual void reset()
+    {
+        {
+            CARB_PROFILE_ZONE(1, "wait for previous publish");
+            // Wait for last messages to publish before resetting
+            for (CompressedImageFrame& frame : m_frames)
+            {
+                frame.tasks.wait();
+            }
+        }
+        if (m_streamNotCreated == false)
+        {
+            isaacsim::core::includes::ScopedDevice scopedDev(m_streamDevice);
+            CUDA_CHECK(cudaStreamDestroy(m_stream));
+            m_streamDevice = -1;
+            m_streamNotCreated = true;
+        }
+        m_numFrames = 0;
+        m_lastPublishedFrame = 0;
+
+        m_publisher.reset(); // This should be reset before we reset the handle.
+        Ros2Node::reset();
+    }
+
+private:
+    std::shared_ptr<Ros2Publisher> m_publisher = nullptr;
+    CompressedImageFrame m_frames[2];
+    uint64_t m_numFrames = 0;
+
+    std::mutex m_publishMutex;
+    uint64_t m_lastPublishedFrame = 0;
+
+    cudaStream_t m_stream;
+    int m_streamDevice = -1;
+    bool m_streamNotCreated = true;
+
+    std::string m_frameId = "sim_camera";
+    bool m_multithreadingDisabled = false;
+};
+
+REGISTER_OGN_NODE()
@@ -127,6 +127,7 @@ public:
                 std::make_unique<isaacsim::core::includes::posetree::PoseTree>(state.m_stageId, state.m_simView);
             state.m_poseTree->setParentPrimPath(state.m_parentPath, "world");
             state.m_poseTree->setTargetPrimPaths(state.m_targets);
+            state.m_frameTableVersion = 0;
 
             // Setup ROS publisher
             const std::string& topicName = db.inputs.topicName();
@@ -203,32 +204,38 @@ public:
         }
 
         const double time = db.inputs.timeStamp();
-        std::vector<TfTransformStamped> transforms;
+        const float stageUnits = static_cast<float>(state.m_stageUnits);
 
-        double stageUnits = m_stageUnits;
+        const auto& frames = state.m_poseTree->computeFrameTransforms();
+        std::vector<TfTransformStamped>& transforms = state.m_transforms;
+        if (state.m_frameTableVersion != state.m_poseTree->getFrameTableVersion())
+        {
+            // Frame names only change when the pose tree rebuilds its frame table
+            const std::vector<std::string>& frameNames = state.m_poseTree->getFrameNames();
+            transforms.resize(frames.size());
+            for (size_t i = 0; i < frames.size(); i++)
+            {
+                transforms[i].parentFrame = frameNames[frames[i].parentFrame];
+                transforms[i].childFrame = frameNames[frames[i].childFrame];
+            }
+            state.m_frameTableVersion = state.m_poseTree->getFrameTableVersion();
+        }
 
-        std::function<void(const std::string&, const std::string&, const physx::PxTransform&)> addPoseLambda =
-            [stageUnits, &transforms, &time](
-                const std::string& parentFrame, const std::string& childFrame, const physx::PxTransform& t)
+        for (size_t i = 0; i < frames.size(); i++)
         {
-            TfTransformStamped currentMsg;
+            const physx::PxTransform& t = frames[i].transform;
+            TfTransformStamped& currentMsg = transforms[i];
             currentMsg.timeStamp = time;
-            currentMsg.childFrame = childFrame;
-            currentMsg.parentFrame = parentFrame;
 
-            currentMsg.translationX = t.p.x * static_cast<float>(stageUnits);
-            currentMsg.translationY = t.p.y * static_cast<float>(stageUnits);
-            currentMsg.translationZ = t.p.z * static_cast<float>(stageUnits);
+            currentMsg.translationX = t.p.x * stageUnits;
+            currentMsg.translationY = t.p.y * stageUnits;
+            currentMsg.translationZ = t.p.z * stageUnits;
 
             currentMsg.rotationX = t.q.x;
             currentMsg.rotationY = t.q.y;
             currentMsg.rotationZ = t.q.z;
             currentMsg.rotationW = t.q.w;
-
-            transforms.push_back(currentMsg);
-        };
-
-        m_poseTree->processAllFrames(addPoseLambda);
+        }
 
         state.m_message->writeData(time, transforms);
         state.m_publisher.get()->publish(state.m_message->getPtr());
@@ -248,6 +255,8 @@ public:
         m_publisher.reset(); // This should be reset before we reset the handle.
         Ros2Node::reset();
         m_poseTree.reset();
+        m_transforms.clear();
+        m_frameTableVersion = 0;
         m_firstIteration = true;
     }
 
@@ -266,6 +275,8 @@ private:
     long m_stageId;
     pxr::UsdStageRefPtr m_usdStage;
     std::unique_ptr<isaacsim::core::includes::posetree::PoseTree> m_poseTree;
+    std::vector<TfTransformStamped> m_transforms;
+    uint64_t m_frameTableVersion = 0;
 };
 
 REGISTER_OGN_NODE()
@@ -18,6 +18,7 @@
 // clang-format on
 
 #include <isaacsim/ros2/bridge/Ros2Node.h>
+#include <isaacsim/ros2/bridge/Ros2OgnUtils.h>
 
 #include <OgnROS2PublisherDatabase.h>
 
@@ -194,211 +195,10 @@ public:
             return false;
         }
 
-        auto messageData = std::static_pointer_cast<Ros2DynamicMessage>(state.m_message)->getVectorContainer(true);
-        auto messageFields = std::static_pointer_cast<Ros2DynamicMessage>(state.m_message)->getMessageFields();
-
-        size_t arraySize;
-        for (size_t i = 0; i < messageFields.size(); ++i)
+        if (!isaacsim::ros2::omnigraph_utils::writeMessageDataFromNode(db, state.m_message, "", false))
         {
-            auto messageField = messageFields.at(i);
-            switch (messageField.dataType)
-            {
-            case omni::fabric::BaseDataType::eBool:
-            {
-                if (messageField.isArray)
-                {
-                    auto inputValue =
-                        getAttributeReadableArrayData<bool*>(db.abi_node(), "inputs:" + messageField.name, arraySize);
-                    auto data = std::static_pointer_cast<std::vector<bool>>(messageData[i]);
-                    data->clear();
-                    data->resize(arraySize);
-                    // std::vector<bool> is a specialization that has no ::data
-                    for (size_t j = 0; j < arraySize; ++j)
-                    {
-                        (*data)[j] = *((*inputValue) + j);
-                    }
-                }
-                else
-                {
-                    auto inputValue = getAttributeReadableData<bool>(db.abi_node(), "inputs:" + messageField.name);
-                    *std::static_pointer_cast<bool>(messageData[i]) = *inputValue;
-                }
-                break;
-            }
-            case omni::fabric::BaseDataType::eUChar:
-            {
-                if (messageField.isArray)
-                {
-                    auto inputValue =
-                        getAttributeReadableArrayData<uint8_t*>(db.abi_node(), "inputs:" + messageField.name, arraySize);
-                    auto data = std::static_pointer_cast<std::vector<uint8_t>>(messageData[i]);
-                    data->clear();
-                    data->resize(arraySize);
-                    std::memcpy(data->data(), *inputValue, arraySize * sizeof(uint8_t));
-                }
-                else
-                {
-                    auto inputValue = getAttributeReadableData<uint8_t>(db.abi_node(), "inputs:" + messageField.name);
-                    *std::static_pointer_cast<uint8_t>(messageData[i]) = *inputValue;
-                }
-                break;
-            }
-            case omni::fabric::BaseDataType::eInt:
-            {
-                if (messageField.isArray)
-                {
-                    auto inputValue =
-                        getAttributeReadableArrayData<int32_t*>(db.abi_node(), "inputs:" + messageField.name, arraySize);
-                    auto data = std::static_pointer_cast<std::vector<int32_t>>(messageData[i]);
-                    data->clear();
-                    data->resize(arraySize);
-                    std::memcpy(data->data(), *inputValue, arraySize * sizeof(int32_t));
-                }
-                else
-                {
-                    auto inputValue = getAttributeReadableData<int32_t>(db.abi_node(), "inputs:" + messageField.name);
-                    *std::static_pointer_cast<int32_t>(messageData[i]) = *inputValue;
-                }
-                break;
-            }
-            case omni::fabric::BaseDataType::eUInt:
-            {
-                if (messageField.isArray)
-                {
-                    auto inputValue = getAttributeReadableArrayData<uint32_t*>(
-                        db.abi_node(), "inputs:" + messageField.name, arraySize);
-                    auto data = std::static_pointer_cast<std::vector<uint32_t>>(messageData[i]);
-                    data->clear();
-                    data->resize(arraySize);
-                    std::memcpy(data->data(), *inputValue, arraySize * sizeof(uint32_t));
-                }
-                else
-                {
-                    auto inputValue = getAttributeReadableData<uint32_t>(db.abi_node(), "inputs:" + messageField.name);
-                    *std::static_pointer_cast<uint32_t>(messageData[i]) = *inputValue;
-                }
-                break;
-            }
-            case omni::fabric::BaseDataType::eInt64:
-            {
-                if (messageField.isArray)
-                {
-                    auto inputValue =
-                        getAttributeReadableArrayData<int64_t*>(db.abi_node(), "inputs:" + messageField.name, arraySize);
-                    auto data = std::static_pointer_cast<std::vector<int64_t>>(messageData[i]);
-                    data->clear();
-                    data->resize(arraySize);
-                    std::memcpy(data->data(), *inputValue, arraySize * sizeof(int64_t));
-                }
-                else
-                {
-                    auto inputValue = getAttributeReadableData<int64_t>(db.abi_node(), "inputs:" + messageField.name);
-                    *std::static_pointer_cast<int64_t>(messageData[i]) = *inputValue;
-                }
-                break;
-            }
-            case omni::fabric::BaseDataType::eUInt64:
-            {
-                if (messageField.isArray)
-                {
-                    auto inputValue = getAttributeReadableArrayData<uint64_t*>(
-                        db.abi_node(), "inputs:" + messageField.name, arraySize);
-                    auto data = std::static_pointer_cast<std::vector<uint64_t>>(messageData[i]);
-                    data->clear();
-                    data->resize(arraySize);
-                    std::memcpy(data->data(), *inputValue, arraySize * sizeof(uint64_t));
-                }
-                else
-                {
-                    auto inputValue = getAttributeReadableData<uint64_t>(db.abi_node(), "inputs:" + messageField.name);
-                    *std::static_pointer_cast<uint64_t>(messageData[i]) = *inputValue;
-                }
-                break;
-            }
-            case omni::fabric::BaseDataType::eHalf:
-            {
-                // No half-precision floating point number in types for ROS message fields
-                break;
-            }
-            case omni::fabric::BaseDataType::eFloat:
-            {
-                if (messageField.isArray)
-                {
-                    auto inputValue =
-                        getAttributeReadableArrayData<float*>(db.abi_node(), "inputs:" + messageField.name, arraySize);
-                    auto data = std::static_pointer_cast<std::vector<float>>(messageData[i]);
-                    data->clear();
-                    data->resize(arraySize);
-                    std::memcpy(data->data(), *inputValue, arraySize * sizeof(float));
-                }
-                else
-                {
-                    auto inputValue = getAttributeReadableData<float>(db.abi_node(), "inputs:" + messageField.name);
-                    *std::static_pointer_cast<float>(messageData[i]) = *inputValue;
-                }
-                break;
-            }
-            case omni::fabric::BaseDataType::eDouble:
-            {
-                if (messageField.isArray)
-                {
-                    auto inputValue =
-                        getAttributeReadableArrayData<double*>(db.abi_node(), "inputs:" + messageField.name, arraySize);
-                    auto data = std::static_pointer_cast<std::vector<double>>(messageData[i]);
-                    data->clear();
-                    data->resize(arraySize);
-                    std::memcpy(data->data(), *inputValue, arraySize * sizeof(double));
-                }
-                else
-                {
-                    auto inputValue = getAttributeReadableData<double>(db.abi_node(), "inputs:" + messageField.name);
-                    *std::static_pointer_cast<double>(messageData[i]) = *inputValue;
-                }
-                break;
-            }
-            case omni::fabric::BaseDataType::eToken:
-            {
-                if (messageField.isArray)
-                {
-                    auto inputValue = getAttributeReadableArrayData<NameToken*>(
-                        db.abi_node(), "inputs:" + messageField.name, arraySize);
-                    auto data = std::static_pointer_cast<std::vector<std::string>>(messageData[i]);
-                    data->clear();
-                    data->resize(arraySize);
-                    for (size_t j = 0; j < arraySize; ++j)
-                    {
-                        (*data)[j] = db.tokenToString(*((*inputValue) + j));
-                    }
-                }
-                else
-                {
-                    auto inputValue = getAttributeReadableData<NameToken>(db.abi_node(), "inputs:" + messageField.name);
-                    *std::static_pointer_cast<std::string>(messageData[i]) = db.tokenToString(*inputValue);
-                }
-                break;
-            }
-            case omni::fabric::BaseDataType::eUnknown:
-            {
-                if (messageField.isArray)
-                {
-                    auto inputValue = getAttributeReadableArrayData<NameToken*>(
-                        db.abi_node(), "inputs:" + messageField.name, arraySize);
-                    auto data = std::static_pointer_cast<std::vector<nlohmann::json>>(messageData[i]);
-                    data->clear();
-                    data->resize(arraySize);
-                    for (size_t j = 0; j < arraySize; ++j)
-                    {
-                        (*data)[j] = nlohmann::json::parse(db.tokenToString(*((*inputValue) + j)));
-                    }
-                }
-                break;
-            }
-            default:
-                break;
-            }
+            return false;
         }
-
-        std::static_pointer_cast<Ros2DynamicMessage>(state.m_message)->writeData(messageData, true);
         state.m_publisher->publish(state.m_message->getPtr());
 
         db.outputs.execOut() = kExecutionAttributeStateEnabled;
@@ -429,31 +229,6 @@ private:
         return attrObj;
     }
 
-    template <typename T>
-    static const T* getAttributeReadableData(const NodeObj& nodeObj, const std::string& attrName)
-    {
-        GraphObj graphObj = nodeObj.iNode->getGraph(nodeObj);
-        GraphContextObj context = graphObj.iGraph->getDefaultGraphContext(graphObj);
-        ConstAttributeDataHandle handle =
-            getAttributeR(context, nodeObj.nodeContextHandle, Token(attrName.c_str()), kAccordingToContextIndex);
-        const T* value = getDataR<T>(context, handle);
-        return value;
-    }
-
-    template <typename T>
-    static T const* getAttributeReadableArrayData(const NodeObj& nodeObj, const std::string& attrName, size_t& countOut)
-    {
-        GraphObj graphObj = nodeObj.iNode->getGraph(nodeObj);
-        GraphContextObj context = graphObj.iGraph->getDefaultGraphContext(graphObj);
-        ConstAttributeDataHandle handle =
-            getAttributeR(context, nodeObj.nodeContextHandle, Token(attrName.c_str()), kAccordingToContextIndex);
-        // Get size
-        context.iAttributeData->getElementCount(&countOut, context, &handle, 1u);
-        // Get readable data
-        T const* value = getDataR<T>(context, handle);
-        return value;
-    }
-
     static const char* getTokenText(AttributeObj const& attrObj)
     {
         NodeObj nodeObj = attrObj.iAttribute->getNode(attrObj);
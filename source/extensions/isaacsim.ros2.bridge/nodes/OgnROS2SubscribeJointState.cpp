@@ -103,7 +103,8 @@ public:
     {
         auto& state = db.perInstanceState<OgnROS2SubscribeJointState>();
 
-        if (state.m_subscriber->spin(state.m_message->getPtr()))
+        if (state.takeMessage(
+                *state.m_subscriber, state.m_message->getPtr(), db.tokenToString(db.inputs.messageMode())))
         {
             size_t numActuators = state.m_message->getNumJoints();
             if (numActuators == 0)
@@ -129,7 +130,8 @@ public:
                     db.outputs.jointNames().at(i) = db.stringToToken(m_jointNames[i]);
                 }
 
-                db.outputs.execOut() = kExecutionAttributeStateEnabled;
+                db.outputs.execOut() = state.isDrainingSubscriber() ? kExecutionAttributeStateEnabledAndPush :
+                                                                      kExecutionAttributeStateEnabled;
             }
             else
             {
@@ -137,6 +139,10 @@ public:
                 return false;
             }
         }
+        else
+        {
+            db.outputs.execOut() = kExecutionAttributeStateDisabled;
+        }
         return true;
     }
 
@@ -21,15 +21,19 @@
 
 #include <carb/Framework.h>
 #include <carb/Types.h>
+#include <carb/settings/ISettings.h>
 
 #include <isaacsim/ros2/bridge/Ros2Node.h>
 #include <omni/fabric/FabricUSD.h>
+#include <omni/fabric/usd/PathConversion.h>
 #include <physxSchema/physxArticulationAPI.h>
 #include <pxr/usd/usdPhysics/articulationRootAPI.h>
 #include <pxr/usd/usdPhysics/collisionAPI.h>
 #include <pxr/usd/usdPhysics/fixedJoint.h>
 #include <pxr/usd/usdPhysics/meshCollisionAPI.h>
 #include <pxr/usd/usdPhysics/rigidBodyAPI.h>
+#include <usdrt/hierarchy/IFabricHierarchy.h>
+#include <usdrt/scenegraph/usd/usd/stage.h>
 
 #include <OgnROS2SubscribeTransformTreeDatabase.h>
 
@@ -37,6 +41,31 @@ using namespace isaacsim::ros2::bridge;
 
 class OgnROS2SubscribeTransformTree : public Ros2Node
 {
+private:
+    /**
+     * @brief Prim a ROS2 frame is mapped to, resolved once when the node starts.
+     */
+    struct FramePrim
+    {
+        pxr::SdfPath path;
+        omni::fabric::PathC fabricPath; // Only resolved when writing to Fabric
+        omni::fabric::PathC fabricUsdParentPath;
+        bool hasUsdParent = false;
+        usdrt::UsdAttribute localMatrixAttr;
+        pxr::UsdGeomXformOp translateXformOp; // Resolved on the first write through USD
+        pxr::UsdGeomXformOp orientXformOp;
+        pxr::UsdGeomXformOp scaleXformOp;
+    };
+
+    /**
+     * @brief Transform written to Fabric, to be written back to USD after the whole message.
+     */
+    struct UsdWrite
+    {
+        FramePrim* frame;
+        pxr::GfVec3d translation;
+        pxr::GfQuatd rotation;
+    };
 
 public:
     static void initInstance(NodeObj const& nodeObj, GraphInstanceID instanceId)
@@ -188,146 +217,166 @@ public:
             return true;
         }
 
-        // Receive all the messages that are available
-        bool gotMessage = false;
-        while (state.m_subscriber->spin(state.m_message->getPtr()))
+        // Receive all the messages that are available, waiting on the subscription only once per tick
+        bool gotMessage = state.m_subscriber->spin(state.m_message->getPtr());
+        for (bool pending = gotMessage; pending; pending = state.m_subscriber->takeNext(state.m_message->getPtr()))
         {
-            pxr::UsdEditContext editContext(m_usdStage, m_anonLayer);
-            gotMessage = true;
-
             // Get the tfMessages
-            std::vector<TfTransformStamped> transforms;
-            state.m_message->readData(transforms);
+            state.m_message->readData(m_transforms);
 
-            for (size_t i = 0; i < transforms.size(); i++)
+            if (m_useFabric)
             {
-                std::string childFrame = transforms[i].childFrame;
-                std::string parentFrame = transforms[i].parentFrame;
+                writeFabricTransforms();
+            }
+            else
+            {
+                writeUsdTransforms();
+            }
+        }
 
-                if (m_framePrimsMap.count(childFrame) == 0)
-                {
-                    continue;
-                }
-                if (m_framePrimsMap.count(parentFrame) == 0)
-                {
-                    continue;
-                }
+        if (gotMessage)
+        {
+            db.outputs.execOut() = kExecutionAttributeStateEnabled;
+        }
+        return gotMessage;
+    }
 
-                // We are given TFMessages with a transform between the child and parent frame, however in the scene
-                // the corresponding prim may have a different parent.  Given a child to parent transform,
-                // we need to calculate the child to usd parent transform.  This is done by combining child to parent,
-                // parent to world and the inverse of the usd parent to world transforms
-                std::string childPrimPath = m_framePrimsMap[childFrame];
-                std::string parentPrimPath = m_framePrimsMap[parentFrame];
-
-                pxr::UsdPrim childPrim = m_usdStage->GetPrimAtPath(pxr::SdfPath(childPrimPath));
-                pxr::UsdPrim parentPrim = m_usdStage->GetPrimAtPath(pxr::SdfPath(parentPrimPath));
-                pxr::UsdPrim usdParentPrim = childPrim.GetParent();
-
-                pxr::GfMatrix4d parentToWorldTransform = isaacsim::core::includes::getWorldTransformMatrix(parentPrim);
-                pxr::GfMatrix4d usdParentToWorldTransform =
-                    isaacsim::core::includes::getWorldTransformMatrix(usdParentPrim);
-
-                // The transform we're given in the TFMessage
-                pxr::GfMatrix4d childTransform;
-
-                childTransform.SetIdentity();
-                childTransform.SetTranslateOnly(
-                    pxr::GfVec3d(transforms[i].translationX, transforms[i].translationY, transforms[i].translationZ));
-                childTransform.SetRotateOnly(pxr::GfQuatd(
-                    transforms[i].rotationW,
-                    pxr::GfVec3d(transforms[i].rotationX, transforms[i].rotationY, transforms[i].rotationZ)));
-
-                // Now compose the final child to usd parent transform
-                pxr::GfMatrix4d newChildTransform;
-                newChildTransform = childTransform * parentToWorldTransform * usdParentToWorldTransform.GetInverse();
-
-                // Extract the translation and rotation from our new transform
-                pxr::GfVec3d translation, scale;
-                pxr::GfQuatd rotation;
-                translation = newChildTransform.ExtractTranslation();
-                rotation = newChildTransform.ExtractRotationQuat();
-                scale.Set(1.0, 1.0, 1.0);
-
-                // Next we take our new translation rotation and scale, and apply it to our prim.
-                // Since this may be in a reference, we are unable to clear out all the new xformOps.
-                // Below we go through the existing xformOps, either creating or overwriting the existing
-                // ones.  Then we set the xformOp order.
-                pxr::UsdGeomXform xform(childPrim);
-                pxr::UsdGeomXformOp translateXformOp, orientXformOp, scaleXformOp;
-
-                // Go through existing xformOps, extracting the translate, orient and scale ones
-                bool resetsXFormStack = false;
-                std::vector<pxr::UsdGeomXformOp> xformOps = xform.GetOrderedXformOps(&resetsXFormStack);
-                for (const pxr::UsdGeomXformOp& xformOp : xformOps)
-                {
-                    if (xformOp.GetOpType() == pxr::UsdGeomXformOp::TypeTranslate)
-                    {
-                        translateXformOp = xformOp;
-                    }
-                    else if (xformOp.GetOpType() == pxr::UsdGeomXformOp::TypeOrient)
-                    {
-                        orientXformOp = xformOp;
-                    }
-                    else if (xformOp.GetOpType() == pxr::UsdGeomXformOp::TypeScale)
-                    {
-                        scaleXformOp = xformOp;
-                    }
-                }
+    /**
+     * @brief Computes the transform of a child frame relative to the USD parent of its prim.
+     * @details
+     * We are given TFMessages with a transform between the child and parent frame, however in the scene the
+     * corresponding prim may have a different parent. Given a child to parent transform, we need to calculate the
+     * child to usd parent transform. This is done by combining child to parent, parent to world and the inverse of
+     * the usd parent to world transforms.
+     */
+    static void computeLocalTransform(const TfTransformStamped& transform,
+                                      const pxr::GfMatrix4d& parentToWorldTransform,
+                                      const pxr::GfMatrix4d& usdParentToWorldTransform,
+                                      pxr::GfVec3d& translation,
+                                      pxr::GfQuatd& rotation)
+    {
+        // The transform we're given in the TFMessage
+        pxr::GfMatrix4d childTransform;
+
+        childTransform.SetIdentity();
+        childTransform.SetTranslateOnly(
+            pxr::GfVec3d(transform.translationX, transform.translationY, transform.translationZ));
+        childTransform.SetRotateOnly(pxr::GfQuatd(
+            transform.rotationW, pxr::GfVec3d(transform.rotationX, transform.rotationY, transform.rotationZ)));
+
+        // Now compose the final child to usd parent transform
+        pxr::GfMatrix4d newChildTransform;
+        newChildTransform = childTransform * parentToWorldTransform * usdParentToWorldTransform.GetInverse();
+
+        // Extract the translation and rotation from our new transform
+        translation = newChildTransform.ExtractTranslation();
+        rotation = newChildTransform.ExtractRotationQuat();
+    }
 
-                // Add the XformOps if they didn't exist
-                if (!translateXformOp)
-                {
-                    translateXformOp =
-                        xform.AddXformOp(pxr::UsdGeomXformOp::TypeTranslate, pxr::UsdGeomXformOp::PrecisionDouble);
-                }
-                if (!orientXformOp)
-                {
-                    orientXformOp =
-                        xform.AddXformOp(pxr::UsdGeomXformOp::TypeOrient, pxr::UsdGeomXformOp::PrecisionDouble);
-                }
-                if (!scaleXformOp)
-                {
-                    scaleXformOp = xform.AddXformOp(pxr::UsdGeomXformOp::TypeScale, pxr::UsdGeomXformOp::PrecisionDouble);
-                }
+    /**
+     * @brief Writes the received transforms through USD, one prim at a time.
+     */
+    void writeUsdTransforms()
+    {
+        pxr::UsdEditContext editContext(m_usdStage, m_anonLayer);
 
-                // Set the XformOps with the proper precision
-                if (translateXformOp.GetPrecision() == pxr::UsdGeomXformOp::PrecisionDouble)
-                {
-                    translateXformOp.Set(translation);
-                }
-                else
-                {
-                    translateXformOp.Set(pxr::GfVec3f(translation));
-                }
-                if (orientXformOp.GetPrecision() == pxr::UsdGeomXformOp::PrecisionDouble)
-                {
-                    orientXformOp.Set(rotation);
-                }
-                else
-                {
-                    orientXformOp.Set(pxr::GfQuatf(rotation));
-                }
-                if (scaleXformOp.GetPrecision() == pxr::UsdGeomXformOp::PrecisionDouble)
-                {
-                    scaleXformOp.Set(scale);
-                }
-                else
-                {
-                    scaleXformOp.Set(pxr::GfVec3f(scale));
-                }
+        for (const TfTransformStamped& transform : m_transforms)
+        {
+            auto child = m_framePrimsMap.find(transform.childFrame);
+            auto parent = m_framePrimsMap.find(transform.parentFrame);
+            if (child == m_framePrimsMap.end() || parent == m_framePrimsMap.end())
+            {
+                continue;
+            }
 
-                // Clear the old xformOpOrder, and set the new one
-                xform.ClearXformOpOrder();
-                xform.SetXformOpOrder({ translateXformOp, orientXformOp, scaleXformOp });
+            pxr::UsdPrim childPrim = m_usdStage->GetPrimAtPath(child->second.path);
+            pxr::UsdPrim parentPrim = m_usdStage->GetPrimAtPath(parent->second.path);
+            pxr::UsdPrim usdParentPrim = childPrim.GetParent();
+
+            pxr::GfVec3d translation;
+            pxr::GfQuatd rotation;
+            computeLocalTransform(transform, isaacsim::core::includes::getWorldTransformMatrix(parentPrim),
+                                  isaacsim::core::includes::getWorldTransformMatrix(usdParentPrim), translation,
+                                  rotation);
+
+            FramePrim& frame = child->second;
+            resolveXformOps(frame);
+            setXformOps(frame, translation, rotation);
+        }
+    }
+
+    /**
+     * @brief Writes the received transforms to the Fabric local matrices of the prims, in a single update.
+     * @details
+     * World transforms are read from the Fabric hierarchy, which computes them from the local matrices written for
+     * earlier transforms of the same message, so chains of frames resolve as they do when writing through USD. The
+     * world matrices are then updated once for the whole message, and optionally written back to USD in one change
+     * block.
+     */
+    void writeFabricTransforms()
+    {
+        auto fabricHierarchy =
+            m_iFabricHierarchy->getFabricHierarchy(m_usdrtStage->GetFabricId(), m_usdrtStage->GetStageId());
+        if (!fabricHierarchy)
+        {
+            CARB_LOG_ERROR("Could not get the Fabric hierarchy of the stage, transforms were not written");
+            return;
+        }
+
+        m_usdWrites.clear();
+        for (const TfTransformStamped& transform : m_transforms)
+        {
+            auto child = m_framePrimsMap.find(transform.childFrame);
+            auto parent = m_framePrimsMap.find(transform.parentFrame);
+            if (child == m_framePrimsMap.end() || parent == m_framePrimsMap.end())
+            {
+                continue;
+            }
+            FramePrim& frame = child->second;
+
+            usdrt::GfMatrix4d parentToWorldTransform = fabricHierarchy->getWorldXform(parent->second.fabricPath);
+            usdrt::GfMatrix4d usdParentToWorldTransform(1.0);
+            if (frame.hasUsdParent)
+            {
+                usdParentToWorldTransform = fabricHierarchy->getWorldXform(frame.fabricUsdParentPath);
+            }
+
+            UsdWrite write;
+            write.frame = &frame;
+            computeLocalTransform(transform, reinterpret_cast<const pxr::GfMatrix4d&>(parentToWorldTransform),
+                                  reinterpret_cast<const pxr::GfMatrix4d&>(usdParentToWorldTransform),
+                                  write.translation, write.rotation);
+
+            // Scale is reset to 1, as it is when writing the xform ops
+            pxr::GfMatrix4d localTransform;
+            localTransform.SetRotate(write.rotation);
+            localTransform.SetTranslateOnly(write.translation);
+            frame.localMatrixAttr.Set(reinterpret_cast<const usdrt::GfMatrix4d&>(localTransform));
+
+            if (m_writeToUsd)
+            {
+                m_usdWrites.push_back(write);
             }
         }
+        fabricHierarchy->updateWorldXforms();
 
-        if (gotMessage)
+        if (m_usdWrites.empty())
         {
-            db.outputs.execOut() = kExecutionAttributeStateEnabled;
+            return;
+        }
+        pxr::UsdEditContext editContext(m_usdStage, m_anonLayer);
+        // Missing xform ops are authored first, as their attributes must exist to be resolved
+        for (const UsdWrite& write : m_usdWrites)
+        {
+            resolveXformOps(*write.frame);
+        }
+        {
+            pxr::SdfChangeBlock changeBlock;
+            for (const UsdWrite& write : m_usdWrites)
+            {
+                setXformOps(*write.frame, write.translation, write.rotation);
+            }
         }
-        return gotMessage;
     }
 
     void disablePhysicsArticulationAPIs(OgnROS2SubscribeTransformTreeDatabase& db)
@@ -440,7 +489,7 @@ private:
                 return false;
             }
 
-            state.m_framePrimsMap[frameName] = isaacPrimPath;
+            state.m_framePrimsMap[frameName].path = pxr::SdfPath(isaacPrimPath);
             state.m_primPaths.insert(isaacPrimPath);
         }
 
@@ -457,20 +506,164 @@ private:
             }
             state.m_articulationRoots.push_back(articulationPath);
         }
+
+        state.m_useFabric = db.inputs.useFabric() && resolveFabricPrims(db);
+        state.m_writeToUsd = db.inputs.writeToUsd();
+        return true;
+    }
+
+    bool resolveFabricPrims(OgnROS2SubscribeTransformTreeDatabase& db)
+    {
+        // Local matrices written to Fabric only propagate to descendants through IFabricHierarchy, which is only
+        // available if Fabric Scene Delegate (/app/useFabricSceneDelegate) is enabled
+        carb::settings::ISettings* settings = carb::getCachedInterface<carb::settings::ISettings>();
+        if (!settings->getAsBool("/app/useFabricSceneDelegate"))
+        {
+            db.logWarning("useFabric requires /app/useFabricSceneDelegate, transforms will be written through USD");
+            return false;
+        }
+        m_iFabricHierarchy = omni::core::createType<usdrt::hierarchy::IFabricHierarchy>();
+        if (!m_iFabricHierarchy)
+        {
+            db.logWarning("Could not create IFabricHierarchy, transforms will be written through USD");
+            return false;
+        }
+
+        omni::fabric::UsdStageId stageId = { static_cast<uint64_t>(
+            pxr::UsdUtilsStageCache::Get().GetId(m_usdStage).ToLongInt()) };
+        omni::fabric::IStageReaderWriter* iStageReaderWriter =
+            carb::getCachedInterface<omni::fabric::IStageReaderWriter>();
+        omni::fabric::StageReaderWriterId stageInProgress = iStageReaderWriter->get(stageId);
+        m_usdrtStage = usdrt::UsdStage::Attach(stageId, stageInProgress);
+
+        for (auto& entry : m_framePrimsMap)
+        {
+            FramePrim& frame = entry.second;
+            usdrt::UsdPrim prim = m_usdrtStage->GetPrimAtPath(frame.path.GetString());
+            frame.localMatrixAttr = prim ? prim.GetAttribute("omni:fabric:localMatrix") : usdrt::UsdAttribute();
+            if (!frame.localMatrixAttr.IsValid())
+            {
+                db.logWarning("Prim \"%s\" has no Fabric local matrix, transforms will be written through USD",
+                              frame.path.GetText());
+                return false;
+            }
+            frame.fabricPath = omni::fabric::asInt(frame.path);
+            pxr::SdfPath usdParentPath = frame.path.GetParentPath();
+            frame.hasUsdParent = usdParentPath != pxr::SdfPath::AbsoluteRootPath();
+            frame.fabricUsdParentPath = omni::fabric::asInt(usdParentPath);
+        }
         return true;
     }
 
+    /**
+     * @brief Finds or creates the translate, orient and scale xform ops of a prim.
+     * @details
+     * Since the prim may be in a reference, we are unable to clear out all the existing xformOps. We go through
+     * them, reusing the translate, orient and scale ones and creating the missing ones, then set the xformOp order.
+     * The ops are kept until their attributes become invalid, so this is only done once per prim.
+     */
+    void resolveXformOps(FramePrim& frame)
+    {
+        if (frame.translateXformOp && frame.orientXformOp && frame.scaleXformOp)
+        {
+            return;
+        }
+        pxr::UsdGeomXform xform(m_usdStage->GetPrimAtPath(frame.path));
+        frame.translateXformOp = pxr::UsdGeomXformOp();
+        frame.orientXformOp = pxr::UsdGeomXformOp();
+        frame.scaleXformOp = pxr::UsdGeomXformOp();
+
+        // Go through existing xformOps, extracting the translate, orient and scale ones
+        bool resetsXFormStack = false;
+        std::vector<pxr::UsdGeomXformOp> xformOps = xform.GetOrderedXformOps(&resetsXFormStack);
+        for (const pxr::UsdGeomXformOp& xformOp : xformOps)
+        {
+            if (xformOp.GetOpType() == pxr::UsdGeomXformOp::TypeTranslate)
+            {
+                frame.translateXformOp = xformOp;
+            }
+            else if (xformOp.GetOpType() == pxr::UsdGeomXformOp::TypeOrient)
+            {
+                frame.orientXformOp = xformOp;
+            }
+            else if (xformOp.GetOpType() == pxr::UsdGeomXformOp::TypeScale)
+            {
+                frame.scaleXformOp = xformOp;
+            }
+        }
+
+        // Add the XformOps if they didn't exist
+        if (!frame.translateXformOp)
+        {
+            frame.translateXformOp =
+                xform.AddXformOp(pxr::UsdGeomXformOp::TypeTranslate, pxr::UsdGeomXformOp::PrecisionDouble);
+        }
+        if (!frame.orientXformOp)
+        {
+            frame.orientXformOp =
+                xform.AddXformOp(pxr::UsdGeomXformOp::TypeOrient, pxr::UsdGeomXformOp::PrecisionDouble);
+        }
+        if (!frame.scaleXformOp)
+        {
+            frame.scaleXformOp = xform.AddXformOp(pxr::UsdGeomXformOp::TypeScale, pxr::UsdGeomXformOp::PrecisionDouble);
+        }
+
+        // Clear the old xformOpOrder, and set the new one
+        xform.ClearXformOpOrder();
+        xform.SetXformOpOrder({ frame.translateXformOp, frame.orientXformOp, frame.scaleXformOp });
+    }
+
+    /**
+     * @brief Sets the xform ops of a prim with their precision, resetting its scale to 1.
+     */
+    static void setXformOps(FramePrim& frame, const pxr::GfVec3d& translation, const pxr::GfQuatd& rotation)
+    {
+        const pxr::GfVec3d scale(1.0, 1.0, 1.0);
+        if (frame.translateXformOp.GetPrecision() == pxr::UsdGeomXformOp::PrecisionDouble)
+        {
+            frame.translateXformOp.Set(translation);
+        }
+        else
+        {
+            frame.translateXformOp.Set(pxr::GfVec3f(translation));
+        }
+        if (frame.orientXformOp.GetPrecision() == pxr::UsdGeomXformOp::PrecisionDouble)
+        {
+            frame.orientXformOp.Set(rotation);
+        }
+        else
+        {
+            frame.orientXformOp.Set(pxr::GfQuatf(rotation));
+        }
+        if (frame.scaleXformOp.GetPrecision() == pxr::UsdGeomXformOp::PrecisionDouble)
+        {
+            frame.scaleXformOp.Set(scale);
+        }
+        else
+        {
+            frame.scaleXformOp.Set(pxr::GfVec3f(scale));
+        }
+    }
+
     std::shared_ptr<Ros2Subscriber> m_subscriber = nullptr;
     std::shared_ptr<Ros2TfTreeMessage> m_message = nullptr;
 
-    std::map<std::string, std::string> m_framePrimsMap;
+    std::map<std::string, FramePrim> m_framePrimsMap;
     std::set<std::string> m_primPaths;
     std::vector<std::string> m_articulationRoots;
 
-    long m_stageId;
+    // Reused for each message
+    std::vector<TfTransformStamped> m_transforms;
+    std::vector<UsdWrite> m_usdWrites;
+
     pxr::UsdStageRefPtr m_usdStage;
     pxr::SdfLayerRefPtr m_anonLayer;
 
+    bool m_useFabric = false;
+    bool m_writeToUsd = false;
+    usdrt::UsdStageRefPtr m_usdrtStage;
+    omni::core::ObjectPtr<usdrt::hierarchy::IFabricHierarchy> m_iFabricHierarchy;
+
     uint64_t m_nodeId;
     int m_startupState = 0;
 };
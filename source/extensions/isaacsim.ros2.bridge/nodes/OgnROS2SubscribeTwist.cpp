@@ -125,15 +125,18 @@ public:
     {
         auto& state = db.perInstanceState<OgnROS2SubscribeTwist>();
 
-        if (state.m_subscriber->spin(state.m_message->getPtr()))
+        if (state.takeMessage(
+                *state.m_subscriber, state.m_message->getPtr(), db.tokenToString(db.inputs.messageMode())))
         {
             auto& linearVelocity = db.outputs.linearVelocity();
             auto& angularVelocity = db.outputs.angularVelocity();
 
             state.m_message->readData(linearVelocity, angularVelocity);
-            db.outputs.execOut() = kExecutionAttributeStateEnabled;
+            db.outputs.execOut() = state.isDrainingSubscriber() ? kExecutionAttributeStateEnabledAndPush :
+                                                                  kExecutionAttributeStateEnabled;
             return true;
         }
+        db.outputs.execOut() = kExecutionAttributeStateDisabled;
         return false;
     }
 
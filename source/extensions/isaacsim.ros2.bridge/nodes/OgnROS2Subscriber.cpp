@@ -14,6 +14,7 @@
 // limitations under the License.
 
 #include <isaacsim/ros2/bridge/Ros2Node.h>
+#include <isaacsim/ros2/bridge/Ros2OgnUtils.h>
 
 #include <OgnROS2SubscriberDatabase.h>
 
@@ -190,200 +191,20 @@ public:
         {
             return false;
         }
-        if (!state.m_subscriber->spin(state.m_message->getPtr()))
+        if (!state.takeMessage(
+                *state.m_subscriber, state.m_message->getPtr(), db.tokenToString(db.inputs.messageMode())))
         {
+            db.outputs.execOut() = kExecutionAttributeStateDisabled;
             return false;
         }
 
-        auto messageData = std::static_pointer_cast<Ros2DynamicMessage>(state.m_message)->readData(true);
-        auto messageFields = std::static_pointer_cast<Ros2DynamicMessage>(state.m_message)->getMessageFields();
-
-        for (size_t i = 0; i < messageFields.size(); ++i)
+        if (!isaacsim::ros2::omnigraph_utils::writeNodeAttributeFromMessage(db, state.m_message, "", true))
         {
-            if (!messageData.at(i))
-            {
-                continue;
-            }
-            auto messageField = messageFields.at(i);
-            switch (messageField.dataType)
-            {
-            case omni::fabric::BaseDataType::eBool:
-            {
-                if (messageField.isArray)
-                {
-                    auto data = *std::static_pointer_cast<const std::vector<bool>>(messageData.at(i));
-                    auto outputValue =
-                        getAttributeWritableArrayData<bool*>(db.abi_node(), "outputs:" + messageField.name, data.size());
-                    // std::vector<bool> is a specialization that has no ::data
-                    for (size_t j = 0; j < data.size(); ++j)
-                    {
-                        *((*outputValue) + j) = data.at(j);
-                    }
-                }
-                else
-                {
-                    auto outputValue = getAttributeWritableData<bool>(db.abi_node(), "outputs:" + messageField.name);
-                    *outputValue = *std::static_pointer_cast<const bool>(messageData.at(i));
-                }
-                break;
-            }
-            case omni::fabric::BaseDataType::eUChar:
-            {
-                if (messageField.isArray)
-                {
-                    auto data = *std::static_pointer_cast<const std::vector<uint8_t>>(messageData.at(i));
-                    auto outputValue = getAttributeWritableArrayData<uint8_t*>(
-                        db.abi_node(), "outputs:" + messageField.name, data.size());
-                    std::memcpy(*outputValue, data.data(), data.size() * sizeof(uint8_t));
-                }
-                else
-                {
-                    auto outputValue = getAttributeWritableData<uint8_t>(db.abi_node(), "outputs:" + messageField.name);
-                    *outputValue = *std::static_pointer_cast<const uint8_t>(messageData.at(i));
-                }
-                break;
-            }
-            case omni::fabric::BaseDataType::eInt:
-            {
-                if (messageField.isArray)
-                {
-                    auto data = *std::static_pointer_cast<const std::vector<int32_t>>(messageData.at(i));
-                    auto outputValue = getAttributeWritableArrayData<int32_t*>(
-                        db.abi_node(), "outputs:" + messageField.name, data.size());
-                    std::memcpy(*outputValue, data.data(), data.size() * sizeof(int32_t));
-                }
-                else
-                {
-                    auto outputValue = getAttributeWritableData<int32_t>(db.abi_node(), "outputs:" + messageField.name);
-                    *outputValue = *std::static_pointer_cast<const int32_t>(messageData.at(i));
-                }
-                break;
-            }
-            case omni::fabric::BaseDataType::eUInt:
-            {
-                if (messageField.isArray)
-                {
-                    auto data = *std::static_pointer_cast<const std::vector<uint32_t>>(messageData.at(i));
-                    auto outputValue = getAttributeWritableArrayData<uint32_t*>(
-                        db.abi_node(), "outputs:" + messageField.name, data.size());
-                    std::memcpy(*outputValue, data.data(), data.size() * sizeof(uint32_t));
-                }
-                else
-                {
-                    auto outputValue = getAttributeWritableData<uint32_t>(db.abi_node(), "outputs:" + messageField.name);
-                    *outputValue = *std::static_pointer_cast<const uint32_t>(messageData.at(i));
-                }
-                break;
-            }
-            case omni::fabric::BaseDataType::eInt64:
-            {
-                if (messageField.isArray)
-                {
-                    auto data = *std::static_pointer_cast<const std::vector<int64_t>>(messageData.at(i));
-                    auto outputValue = getAttributeWritableArrayData<int64_t*>(
-                        db.abi_node(), "outputs:" + messageField.name, data.size());
-                    std::memcpy(*outputValue, data.data(), data.size() * sizeof(int64_t));
-                }
-                else
-                {
-                    auto outputValue = getAttributeWritableData<int64_t>(db.abi_node(), "outputs:" + messageField.name);
-                    *outputValue = *std::static_pointer_cast<const int64_t>(messageData.at(i));
-                }
-                break;
-            }
-            case omni::fabric::BaseDataType::eUInt64:
-            {
-                if (messageField.isArray)
-                {
-                    auto data = *std::static_pointer_cast<const std::vector<uint64_t>>(messageData.at(i));
-                    auto outputValue = getAttributeWritableArrayData<uint64_t*>(
-                        db.abi_node(), "outputs:" + messageField.name, data.size());
-                    std::memcpy(*outputValue, data.data(), data.size() * sizeof(uint64_t));
-                }
-                else
-                {
-                    auto outputValue = getAttributeWritableData<uint64_t>(db.abi_node(), "outputs:" + messageField.name);
-                    *outputValue = *std::static_pointer_cast<const uint64_t>(messageData.at(i));
-                }
-                break;
-            }
-            case omni::fabric::BaseDataType::eHalf:
-            {
-                // no half-precision floating point number in types for ROS message fields
-                break;
-            }
-            case omni::fabric::BaseDataType::eFloat:
-            {
-                if (messageField.isArray)
-                {
-                    auto data = *std::static_pointer_cast<const std::vector<float>>(messageData.at(i));
-                    auto outputValue = getAttributeWritableArrayData<float*>(
-                        db.abi_node(), "outputs:" + messageField.name, data.size());
-                    std::memcpy(*outputValue, data.data(), data.size() * sizeof(float));
-                }
-                else
-                {
-                    auto outputValue = getAttributeWritableData<float>(db.abi_node(), "outputs:" + messageField.name);
-                    *outputValue = *std::static_pointer_cast<const float>(messageData.at(i));
-                }
-                break;
-            }
-            case omni::fabric::BaseDataType::eDouble:
-            {
-                if (messageField.isArray)
-                {
-                    auto data = *std::static_pointer_cast<const std::vector<double>>(messageData.at(i));
-                    auto outputValue = getAttributeWritableArrayData<double*>(
-                        db.abi_node(), "outputs:" + messageField.name, data.size());
-                    std::memcpy(*outputValue, data.data(), data.size() * sizeof(double));
-                }
-                else
-                {
-                    auto outputValue = getAttributeWritableData<double>(db.abi_node(), "outputs:" + messageField.name);
-                    *outputValue = *std::static_pointer_cast<const double>(messageData.at(i));
-                }
-                break;
-            }
-            case omni::fabric::BaseDataType::eToken:
-            {
-                if (messageField.isArray)
-                {
-                    auto stringValues = *std::static_pointer_cast<const std::vector<std::string>>(messageData.at(i));
-                    auto outputValue = getAttributeWritableArrayData<NameToken*>(
-                        db.abi_node(), "outputs:" + messageField.name, stringValues.size());
-                    for (size_t j = 0; j < stringValues.size(); ++j)
-                    {
-                        *((*outputValue) + j) = db.stringToToken(stringValues.at(j).c_str());
-                    }
-                }
-                else
-                {
-                    auto stringValue = *std::static_pointer_cast<const std::string>(messageData.at(i));
-                    auto outputValue = getAttributeWritableData<NameToken>(db.abi_node(), "outputs:" + messageField.name);
-                    *outputValue = db.stringToToken(stringValue.c_str());
-                }
-                break;
-            }
-            case omni::fabric::BaseDataType::eUnknown:
-            {
-                if (messageField.isArray)
-                {
-                    auto array = *std::static_pointer_cast<const std::vector<nlohmann::json>>(messageData.at(i));
-                    auto outputValue = getAttributeWritableArrayData<NameToken*>(
-                        db.abi_node(), "outputs:" + messageField.name, array.size());
-                    for (size_t j = 0; j < array.size(); ++j)
-                    {
-                        *((*outputValue) + j) = db.stringToToken(array.at(j).dump().c_str());
-                    }
-                }
-                break;
-            }
-            default:
-                break;
-            }
+            return false;
         }
 
-        db.outputs.execOut() = kExecutionAttributeStateEnabled;
+        db.outputs.execOut() =
+            state.isDrainingSubscriber() ? kExecutionAttributeStateEnabledAndPush : kExecutionAttributeStateEnabled;
         return true;
     }
 
@@ -411,31 +232,6 @@ private:
         return attrObj;
     }
 
-    template <typename T>
-    static T* getAttributeWritableData(const NodeObj& nodeObj, const std::string& attrName)
-    {
-        GraphObj graphObj = nodeObj.iNode->getGraph(nodeObj);
-        GraphContextObj context = graphObj.iGraph->getDefaultGraphContext(graphObj);
-        AttributeDataHandle handle =
-            getAttributeW(context, nodeObj.nodeContextHandle, Token(attrName.c_str()), kAccordingToContextIndex);
-        T* value = getDataW<T>(context, handle);
-        return value;
-    }
-
-    template <typename T>
-    static T* getAttributeWritableArrayData(const NodeObj& nodeObj, const std::string& attrName, size_t newCount)
-    {
-        GraphObj graphObj = nodeObj.iNode->getGraph(nodeObj);
-        GraphContextObj context = graphObj.iGraph->getDefaultGraphContext(graphObj);
-        AttributeDataHandle handle =
-            getAttributeW(context, nodeObj.nodeContextHandle, Token(attrName.c_str()), kAccordingToContextIndex);
-        // Resize first
-        context.iAttributeData->setElementCount(context, handle, newCount);
-        // Get writable data
-        T* value = getDataW<T>(context, handle);
-        return value;
-    }
-
     static const char* getTokenText(AttributeObj const& attrObj)
     {
         NodeObj nodeObj = attrObj.iAttribute->getNode(attrObj);
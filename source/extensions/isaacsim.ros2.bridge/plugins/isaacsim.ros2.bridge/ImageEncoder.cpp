@@ -0,0 +1,580 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <isaacsim/ros2/bridge/ImageEncoder.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace isaacsim
+{
+namespace ros2
+{
+namespace bridge
+{
+
+namespace
+{
+
+// Position in zigzag order of each coefficient of a row-major 8x8 block
+const uint8_t kZigzag[64] = { 0,  1,  5,  6,  14, 15, 27, 28, 2,  4,  7,  13, 16, 26, 29, 42,
+                              3,  8,  12, 17, 25, 30, 41, 43, 9,  11, 18, 24, 31, 40, 44, 53,
+                              10, 19, 23, 32, 39, 45, 52, 54, 20, 22, 33, 38, 46, 51, 55, 60,
+                              21, 34, 37, 47, 50, 56, 59, 61, 35, 36, 48, 49, 57, 58, 62, 63 };
+
+// Quantization tables of the JPEG standard (Annex K.1) for quality 50, row-major
+const uint8_t kLuminanceQuantization[64] = { 16, 11, 10, 16, 24,  40,  51,  61,  12, 12, 14, 19, 26,  58,  60,  55,
+                                             14, 13, 16, 24, 40,  57,  69,  56,  14, 17, 22, 29, 51,  87,  80,  62,
+                                             18, 22, 37, 56, 68,  109, 103, 77,  24, 35, 55, 64, 81,  104, 113, 92,
+                                             49, 64, 78, 87, 103, 121, 120, 101, 72, 92, 95, 98, 112, 100, 103, 99 };
+const uint8_t kChrominanceQuantization[64] = { 17, 18, 24, 47, 99, 99, 99, 99, 18, 21, 26, 66, 99, 99, 99, 99,
+                                               24, 26, 56, 99, 99, 99, 99, 99, 47, 66, 99, 99, 99, 99, 99, 99,
+                                               99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+                                               99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99 };
+
+// Scale factors of the AAN forward DCT
+const float kAanScales[8] = { 1.0f, 1.387039845f, 1.306562965f, 1.175875602f,
+                              1.0f, 0.785694958f, 0.541196100f, 0.275899379f };
+
+// Huffman tables of the JPEG standard (Annex K.3): number of codes of each length from 1 to 16, then the symbols
+const uint8_t kDcLuminanceBits[16] = { 0, 1, 5, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0 };
+const uint8_t kDcChrominanceBits[16] = { 0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0 };
+const uint8_t kDcSymbols[12] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+const uint8_t kAcLuminanceBits[16] = { 0, 2, 1, 3, 3, 2, 4, 3, 5, 5, 4, 4, 0, 0, 1, 0x7d };
+const uint8_t kAcLuminanceSymbols[162] = {
+    0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14,
+    0x32, 0x81, 0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09,
+    0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a,
+    0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65,
+    0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
+    0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9,
+    0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca,
+    0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea,
+    0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa
+};
+const uint8_t kAcChrominanceBits[16] = { 0, 2, 1, 2, 4, 4, 3, 4, 7, 5, 4, 4, 0, 1, 2, 0x77 };
+const uint8_t kAcChrominanceSymbols[162] = {
+    0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13, 0x22, 0x32,
+    0x81, 0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15, 0x62, 0x72, 0xd1, 0x0a, 0x16,
+    0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39,
+    0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64,
+    0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86,
+    0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7,
+    0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8,
+    0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9,
+    0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa
+};
+
+struct HuffmanCode
+{
+    uint16_t code = 0;
+    uint8_t length = 0;
+};
+
+// Codes of the standard Huffman tables indexed by symbol, for luminance (0) and chrominance (1)
+struct HuffmanTables
+{
+    HuffmanCode dc[2][12];
+    HuffmanCode ac[2][256];
+
+    HuffmanTables()
+    {
+        buildCodes(kDcLuminanceBits, kDcSymbols, dc[0]);
+        buildCodes(kDcChrominanceBits, kDcSymbols, dc[1]);
+        buildCodes(kAcLuminanceBits, kAcLuminanceSymbols, ac[0]);
+        buildCodes(kAcChrominanceBits, kAcChrominanceSymbols, ac[1]);
+    }
+
+    static void buildCodes(const uint8_t* bits, const uint8_t* symbols, HuffmanCode* codes)
+    {
+        uint16_t code = 0;
+        for (int length = 1, k = 0; length <= 16; length++, code <<= 1)
+        {
+            for (int i = 0; i < bits[length - 1]; i++, k++, code++)
+            {
+                codes[symbols[k]].code = code;
+                codes[symbols[k]].length = static_cast<uint8_t>(length);
+            }
+        }
+    }
+};
+
+const HuffmanTables& getHuffmanTables()
+{
+    static const HuffmanTables s_tables;
+    return s_tables;
+}
+
+// Writes the entropy-coded segment, stuffing a zero byte after each 0xFF
+class BitWriter
+{
+public:
+    explicit BitWriter(std::vector<uint8_t>& output) : m_output(output)
+    {
+    }
+
+    void write(uint32_t bits, int length)
+    {
+        m_count += length;
+        m_buffer |= bits << (24 - m_count);
+        while (m_count >= 8)
+        {
+            const uint8_t byte = static_cast<uint8_t>(m_buffer >> 16);
+            m_output.push_back(byte);
+            if (byte == 0xff)
+            {
+                m_output.push_back(0);
+            }
+            m_buffer <<= 8;
+            m_count -= 8;
+        }
+        m_buffer &= 0xffffff;
+    }
+
+    void write(const HuffmanCode& code)
+    {
+        write(code.code, code.length);
+    }
+
+    void flush()
+    {
+        // Pad the last byte with ones
+        write(0x7f, 7);
+    }
+
+private:
+    std::vector<uint8_t>& m_output;
+    uint32_t m_buffer = 0;
+    int m_count = 0;
+};
+
+// Number of bits of the magnitude of a coefficient, and the bits written for it
+inline int getMagnitudeCategory(int value, uint32_t& bits)
+{
+    int magnitude = value < 0 ? -value : value;
+    int category = 0;
+    while (magnitude)
+    {
+        category++;
+        magnitude >>= 1;
+    }
+    bits = static_cast<uint32_t>(value < 0 ? value - 1 : value) & ((1u << category) - 1);
+    return category;
+}
+
+// In-place AAN forward DCT of 8 values, leaving the output scaled by kAanScales
+inline void forwardDct(float* d, int stride)
+{
+    const float tmp0 = d[0] + d[7 * stride];
+    const float tmp7 = d[0] - d[7 * stride];
+    const float tmp1 = d[stride] + d[6 * stride];
+    const float tmp6 = d[stride] - d[6 * stride];
+    const float tmp2 = d[2 * stride] + d[5 * stride];
+    const float tmp5 = d[2 * stride] - d[5 * stride];
+    const float tmp3 = d[3 * stride] + d[4 * stride];
+    const float tmp4 = d[3 * stride] - d[4 * stride];
+
+    // Even part
+    float tmp10 = tmp0 + tmp3;
+    const float tmp13 = tmp0 - tmp3;
+    float tmp11 = tmp1 + tmp2;
+    float tmp12 = tmp1 - tmp2;
+    d[0] = tmp10 + tmp11;
+    d[4 * stride] = tmp10 - tmp11;
+    const float z1 = (tmp12 + tmp13) * 0.707106781f;
+    d[2 * stride] = tmp13 + z1;
+    d[6 * stride] = tmp13 - z1;
+
+    // Odd part
+    tmp10 = tmp4 + tmp5;
+    tmp11 = tmp5 + tmp6;
+    tmp12 = tmp6 + tmp7;
+    const float z5 = (tmp10 - tmp12) * 0.382683433f;
+    const float z2 = tmp10 * 0.541196100f + z5;
+    const float z4 = tmp12 * 1.306562965f + z5;
+    const float z3 = tmp11 * 0.707106781f;
+    const float z11 = tmp7 + z3;
+    const float z13 = tmp7 - z3;
+    d[5 * stride] = z13 + z2;
+    d[3 * stride] = z13 - z2;
+    d[stride] = z11 + z4;
+    d[7 * stride] = z11 - z4;
+}
+
+// Transforms, quantizes and entropy codes a row-major 8x8 block of level shifted samples
+void encodeBlock(float* block, const float* scales, int table, int& previousDc, BitWriter& writer)
+{
+    for (int i = 0; i < 8; i++)
+    {
+        forwardDct(block + i * 8, 1);
+    }
+    for (int i = 0; i < 8; i++)
+    {
+        forwardDct(block + i, 8);
+    }
+    int coefficients[64];
+    for (int i = 0; i < 64; i++)
+    {
+        const float value = block[i] * scales[i];
+        // Baseline JPEG codes AC coefficients with at most 10 bits
+        const int coefficient = static_cast<int>(value < 0 ? value - 0.5f : value + 0.5f);
+        coefficients[kZigzag[i]] = i == 0 ? coefficient : std::min(std::max(coefficient, -1023), 1023);
+    }
+
+    const HuffmanTables& tables = getHuffmanTables();
+    uint32_t bits;
+    const int dcCategory = getMagnitudeCategory(coefficients[0] - previousDc, bits);
+    previousDc = coefficients[0];
+    writer.write(tables.dc[table][dcCategory]);
+    writer.write(bits, dcCategory);
+
+    int last = 63;
+    while (last > 0 && coefficients[last] == 0)
+    {
+        last--;
+    }
+    for (int i = 1; i <= last; i++)
+    {
+        int run = 0;
+        while (coefficients[i] == 0)
+        {
+            run++;
+            i++;
+        }
+        for (; run >= 16; run -= 16)
+        {
+            writer.write(tables.ac[table][0xf0]);
+        }
+        const int acCategory = getMagnitudeCategory(coefficients[i], bits);
+        writer.write(tables.ac[table][(run << 4) | acCategory]);
+        writer.write(bits, acCategory);
+    }
+    if (last != 63)
+    {
+        // End of block
+        writer.write(tables.ac[table][0x00]);
+    }
+}
+
+inline void writeUint16(std::vector<uint8_t>& output, uint32_t value)
+{
+    output.push_back(static_cast<uint8_t>(value >> 8));
+    output.push_back(static_cast<uint8_t>(value));
+}
+
+inline void writeUint32(std::vector<uint8_t>& output, uint32_t value)
+{
+    writeUint16(output, value >> 16);
+    writeUint16(output, value);
+}
+
+void writeHuffmanTable(std::vector<uint8_t>& output,
+                       uint8_t tableClassAndId,
+                       const uint8_t* bits,
+                       const uint8_t* symbols,
+                       size_t numSymbols)
+{
+    output.push_back(tableClassAndId);
+    output.insert(output.end(), bits, bits + 16);
+    output.insert(output.end(), symbols, symbols + numSymbols);
+}
+
+} // namespace
+
+ImageEncoder::ImageEncoder()
+{
+    setJpegQuality(90);
+}
+
+int ImageEncoder::getNumChannels(const std::string& encoding)
+{
+    if (encoding == "mono8")
+    {
+        return 1;
+    }
+    if (encoding == "rgb8" || encoding == "bgr8")
+    {
+        return 3;
+    }
+    if (encoding == "rgba8" || encoding == "bgra8")
+    {
+        return 4;
+    }
+    return 0;
+}
+
+std::string ImageEncoder::getFormat(const std::string& encoding, ImageCompression compression)
+{
+    if (compression == ImageCompression::eJpeg)
+    {
+        return encoding + (encoding == "mono8" ? "; jpeg compressed mono8" : "; jpeg compressed bgr8");
+    }
+    const bool alpha = encoding == "rgba8" || encoding == "bgra8";
+    return encoding + (alpha ? "; qoi compressed rgba8" : "; qoi compressed rgb8");
+}
+
+bool ImageEncoder::encode(const uint8_t* pixels,
+                          uint32_t width,
+                          uint32_t height,
+                          const std::string& encoding,
+                          ImageCompression compression,
+                          int quality,
+                          std::vector<uint8_t>& output)
+{
+    output.clear();
+    const int channels = getNumChannels(encoding);
+    if (!pixels || width == 0 || height == 0 || channels == 0)
+    {
+        return false;
+    }
+    const bool bgr = encoding[0] == 'b';
+    if (compression == ImageCompression::eJpeg)
+    {
+        if (width > 0xffff || height > 0xffff)
+        {
+            return false;
+        }
+        encodeJpeg(pixels, width, height, channels, bgr, quality, output);
+    }
+    else
+    {
+        encodeQoi(pixels, width, height, channels, bgr, output);
+    }
+    return true;
+}
+
+void ImageEncoder::setJpegQuality(int quality)
+{
+    quality = std::min(std::max(quality, 1), 100);
+    if (quality == m_quality)
+    {
+        return;
+    }
+    m_quality = quality;
+    // Scaling of the standard tables used by libjpeg
+    const int scale = quality < 50 ? 5000 / quality : 200 - quality * 2;
+    const uint8_t* standardTables[2] = { kLuminanceQuantization, kChrominanceQuantization };
+    for (int table = 0; table < 2; table++)
+    {
+        for (int i = 0; i < 64; i++)
+        {
+            const int value = std::min(std::max((standardTables[table][i] * scale + 50) / 100, 1), 255);
+            m_quantTables[table][kZigzag[i]] = static_cast<uint8_t>(value);
+            m_dctScales[table][i] = 1.0f / (value * kAanScales[i / 8] * kAanScales[i % 8] * 8.0f);
+        }
+    }
+}
+
+void ImageEncoder::encodeJpeg(const uint8_t* pixels,
+                              uint32_t width,
+                              uint32_t height,
+                              int channels,
+                              bool bgr,
+                              int quality,
+                              std::vector<uint8_t>& output)
+{
+    setJpegQuality(quality);
+    const int numComponents = channels == 1 ? 1 : 3;
+    const int numQuantTables = channels == 1 ? 1 : 2;
+
+    // Start of image and JFIF header
+    static const uint8_t s_kJfifHeader[] = { 0xff, 0xd8, 0xff, 0xe0, 0, 16,  'J', 'F', 'I', 'F',
+                                             0,    1,    1,    0,    0, 1,   0,   1,   0,   0 };
+    output.insert(output.end(), s_kJfifHeader, s_kJfifHeader + sizeof(s_kJfifHeader));
+
+    // Quantization tables
+    writeUint16(output, 0xffdb);
+    writeUint16(output, 2 + 65 * numQuantTables);
+    for (int table = 0; table < numQuantTables; table++)
+    {
+        output.push_back(static_cast<uint8_t>(table));
+        output.insert(output.end(), m_quantTables[table], m_quantTables[table] + 64);
+    }
+
+    // Baseline frame with one (luminance) or three (YCbCr) components, without subsampling
+    writeUint16(output, 0xffc0);
+    writeUint16(output, 8 + 3 * numComponents);
+    output.push_back(8);
+    writeUint16(output, height);
+    writeUint16(output, width);
+    output.push_back(static_cast<uint8_t>(numComponents));
+    for (int component = 0; component < numComponents; component++)
+    {
+        output.push_back(static_cast<uint8_t>(component + 1));
+        output.push_back(0x11);
+        output.push_back(component == 0 ? 0 : 1);
+    }
+
+    // Huffman tables
+    writeUint16(output, 0xffc4);
+    writeUint16(output, 2 + (17 + 12) * 2 + (17 + 162) * 2);
+    writeHuffmanTable(output, 0x00, kDcLuminanceBits, kDcSymbols, sizeof(kDcSymbols));
+    writeHuffmanTable(output, 0x10, kAcLuminanceBits, kAcLuminanceSymbols, sizeof(kAcLuminanceSymbols));
+    writeHuffmanTable(output, 0x01, kDcChrominanceBits, kDcSymbols, sizeof(kDcSymbols));
+    writeHuffmanTable(output, 0x11, kAcChrominanceBits, kAcChrominanceSymbols, sizeof(kAcChrominanceSymbols));
+
+    // Start of scan
+    writeUint16(output, 0xffda);
+    writeUint16(output, 6 + 2 * numComponents);
+    output.push_back(static_cast<uint8_t>(numComponents));
+    for (int component = 0; component < numComponents; component++)
+    {
+        output.push_back(static_cast<uint8_t>(component + 1));
+        output.push_back(component == 0 ? 0x00 : 0x11);
+    }
+    output.push_back(0);
+    output.push_back(63);
+    output.push_back(0);
+
+    const int red = bgr ? 2 : 0;
+    const int blue = bgr ? 0 : 2;
+    BitWriter writer(output);
+    int previousDc[3] = { 0, 0, 0 };
+    float y[64], cb[64], cr[64];
+    for (uint32_t blockY = 0; blockY < height; blockY += 8)
+    {
+        for (uint32_t blockX = 0; blockX < width; blockX += 8)
+        {
+            for (uint32_t row = 0, i = 0; row < 8; row++)
+            {
+                // Blocks past the image edges repeat the last row and column
+                const uint32_t pixelY = std::min(blockY + row, height - 1);
+                const uint8_t* line = pixels + static_cast<size_t>(pixelY) * width * channels;
+                for (uint32_t column = 0; column < 8; column++, i++)
+                {
+                    const uint8_t* pixel = line + static_cast<size_t>(std::min(blockX + column, width - 1)) * channels;
+                    if (channels == 1)
+                    {
+                        y[i] = pixel[0] - 128.0f;
+                        continue;
+                    }
+                    const float r = pixel[red];
+                    const float g = pixel[1];
+                    const float b = pixel[blue];
+                    y[i] = 0.29900f * r + 0.58700f * g + 0.11400f * b - 128.0f;
+                    cb[i] = -0.16874f * r - 0.33126f * g + 0.50000f * b;
+                    cr[i] = 0.50000f * r - 0.41869f * g - 0.08131f * b;
+                }
+            }
+            encodeBlock(y, m_dctScales[0], 0, previousDc[0], writer);
+            if (numComponents == 3)
+            {
+                encodeBlock(cb, m_dctScales[1], 1, previousDc[1], writer);
+                encodeBlock(cr, m_dctScales[1], 1, previousDc[2], writer);
+            }
+        }
+    }
+    writer.flush();
+
+    // End of image
+    writeUint16(output, 0xffd9);
+}
+
+void ImageEncoder::encodeQoi(
+    const uint8_t* pixels, uint32_t width, uint32_t height, int channels, bool bgr, std::vector<uint8_t>& output)
+{
+    const bool alpha = channels == 4;
+    output.reserve(14 + static_cast<size_t>(width) * height * (alpha ? 5 : 4) + 8);
+    output.insert(output.end(), { 'q', 'o', 'i', 'f' });
+    writeUint32(output, width);
+    writeUint32(output, height);
+    output.push_back(alpha ? 4 : 3);
+    output.push_back(0);
+
+    const int red = bgr ? 2 : 0;
+    const int blue = bgr ? 0 : 2;
+    uint8_t index[64][4] = {};
+    uint8_t previous[4] = { 0, 0, 0, 255 };
+    uint8_t pixel[4] = { 0, 0, 0, 255 };
+    int run = 0;
+    const size_t numPixels = static_cast<size_t>(width) * height;
+    for (size_t p = 0; p < numPixels; p++)
+    {
+        const uint8_t* source = pixels + p * channels;
+        if (channels == 1)
+        {
+            pixel[0] = pixel[1] = pixel[2] = source[0];
+        }
+        else
+        {
+            pixel[0] = source[red];
+            pixel[1] = source[1];
+            pixel[2] = source[blue];
+            if (alpha)
+            {
+                pixel[3] = source[3];
+            }
+        }
+
+        if (std::memcmp(pixel, previous, 4) == 0)
+        {
+            run++;
+            if (run == 62 || p == numPixels - 1)
+            {
+                output.push_back(static_cast<uint8_t>(0xc0 | (run - 1)));
+                run = 0;
+            }
+            continue;
+        }
+        if (run > 0)
+        {
+            output.push_back(static_cast<uint8_t>(0xc0 | (run - 1)));
+            run = 0;
+        }
+
+        const int hash = (pixel[0] * 3 + pixel[1] * 5 + pixel[2] * 7 + pixel[3] * 11) % 64;
+        if (std::memcmp(index[hash], pixel, 4) == 0)
+        {
+            output.push_back(static_cast<uint8_t>(hash));
+        }
+        else
+        {
+            std::memcpy(index[hash], pixel, 4);
+            if (pixel[3] == previous[3])
+            {
+                const int8_t dr = static_cast<int8_t>(pixel[0] - previous[0]);
+                const int8_t dg = static_cast<int8_t>(pixel[1] - previous[1]);
+                const int8_t db = static_cast<int8_t>(pixel[2] - previous[2]);
+                const int drDg = dr - dg;
+                const int dbDg = db - dg;
+                if (dr > -3 && dr < 2 && dg > -3 && dg < 2 && db > -3 && db < 2)
+                {
+                    output.push_back(static_cast<uint8_t>(0x40 | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2)));
+                }
+                else if (drDg > -9 && drDg < 8 && dg > -33 && dg < 32 && dbDg > -9 && dbDg < 8)
+                {
+                    output.push_back(static_cast<uint8_t>(0x80 | (dg + 32)));
+                    output.push_back(static_cast<uint8_t>(((drDg + 8) << 4) | (dbDg + 8)));
+                }
+                else
+                {
+                    output.insert(output.end(), { 0xfe, pixel[0], pixel[1], pixel[2] });
+                }
+            }
+            else
+            {
+                output.insert(output.end(), { 0xff, pixel[0], pixel[1], pixel[2], pixel[3] });
+            }
+        }
+        std::memcpy(previous, pixel, 4);
+    }
+
+    // End marker
+    output.insert(output.end(), { 0, 0, 0, 0, 0, 0, 0, 1 });
+}
+
+} // namespace bridge
+} // namespace ros2
+} // namespace isaacsim
@@ -0,0 +1,144 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import io
+
+import cv2
+import numpy as np
+import omni.graph.core as og
+import omni.kit.test
+from isaacsim.core.utils.stage import create_new_stage_async
+from PIL import Image
+
+from .common import ROS2TestCase, get_qos_profile
+
+
+def make_image(width, height, channels):
+    """Smooth gradient per channel, with an alpha channel varying along each row"""
+    x = np.arange(width) * 140 // max(width - 1, 1)
+    y = np.arange(height) * 50 // max(height - 1, 1)
+    image = np.zeros((height, width, channels), dtype=np.uint8)
+    for channel in range(min(channels, 3)):
+        image[:, :, channel] = y[:, None] + x[None, :] + 20 * channel
+    if channels == 4:
+        image[:, :, 3] = 100 + np.arange(width)[None, :]
+    return image
+
+
+def psnr(expected, actual):
+    mse = np.mean((expected.astype(np.float64) - actual.astype(np.float64)) ** 2)
+    return float("inf") if mse == 0 else 10 * np.log10(255.0**2 / mse)
+
+
+class TestRos2CompressedImage(ROS2TestCase):
+    # Before running each test
+    async def setUp(self):
+        await super().setUp()
+        await create_new_stage_async()
+        await omni.kit.app.get_app().next_update_async()
+
+    # After running each test
+    async def tearDown(self):
+        await super().tearDown()
+
+    async def test_compressed_image(self):
+        import rclpy
+        from sensor_msgs.msg import CompressedImage
+
+        (test_graph, new_nodes, _, _) = og.Controller.edit(
+            {"graph_path": "/ActionGraph", "evaluator_name": "execution"},
+            {
+                og.Controller.Keys.CREATE_NODES: [
+                    ("OnPlaybackTick", "omni.graph.action.OnPlaybackTick"),
+                    ("PublishCompressedImage", "isaacsim.ros2.bridge.ROS2PublishCompressedImage"),
+                ],
+                og.Controller.Keys.SET_VALUES: [
+                    ("PublishCompressedImage.inputs:topicName", "image/compressed"),
+                    ("PublishCompressedImage.inputs:jpegQuality", 90),
+                ],
+                og.Controller.Keys.CONNECT: [
+                    ("OnPlaybackTick.outputs:tick", "PublishCompressedImage.inputs:execIn"),
+                ],
+            },
+        )
+        publish_node = new_nodes[-1]
+
+        messages = []
+        node = rclpy.create_node("compressed_image_tester")
+        subscriber = node.create_subscription(
+            CompressedImage, "image/compressed", lambda msg: messages.append(msg), get_qos_profile()
+        )
+
+        # Small images of each channel count, including odd sizes that do not fill whole JPEG blocks
+        cases = [
+            ("mono8", 1, 16, 8),
+            ("rgb8", 3, 16, 16),
+            ("bgra8", 4, 16, 16),
+            ("rgb8", 3, 17, 11),
+        ]
+        self._timeline.play()
+        for encoding, channels, width, height in cases:
+            image = make_image(width, height, channels)
+            og.Controller.attribute("inputs:data", publish_node).set(image.flatten())
+            og.Controller.attribute("inputs:width", publish_node).set(width)
+            og.Controller.attribute("inputs:height", publish_node).set(height)
+            og.Controller.attribute("inputs:encoding", publish_node).set(encoding)
+
+            # Expected pixels in the channel order of the decoded images, QOI stores mono images as RGB
+            rgb = image[:, :, 2::-1] if encoding.startswith("bgr") else image[:, :, :3]
+            lossless = np.repeat(image, 3, axis=2) if channels == 1 else np.concatenate([rgb, image[:, :, 3:]], axis=2)
+
+            for compression in ["jpeg", "qoi"]:
+                og.Controller.attribute("inputs:compressionFormat", publish_node).set(compression)
+                if compression == "jpeg":
+                    expected_format = f"{encoding}; jpeg compressed " + ("mono8" if channels == 1 else "bgr8")
+                else:
+                    expected_format = f"{encoding}; qoi compressed " + ("rgba8" if channels == 4 else "rgb8")
+
+                # Frames are compressed on a worker thread, so wait for one of this size and format
+                decoded = None
+                for _ in range(30):
+                    await omni.kit.app.get_app().next_update_async()
+                    rclpy.spin_once(node, timeout_sec=0.1)
+                    while messages:
+                        msg = messages.pop(0)
+                        if msg.format != expected_format:
+                            continue
+                        data = np.frombuffer(bytes(msg.data), dtype=np.uint8)
+                        if compression == "jpeg":
+                            candidate = cv2.imdecode(data, cv2.IMREAD_UNCHANGED)
+                        else:
+                            candidate = np.asarray(Image.open(io.BytesIO(data.tobytes())))
+                        if candidate is not None and candidate.shape[:2] == (height, width):
+                            decoded = candidate
+                    if decoded is not None:
+                        break
+                self.assertIsNotNone(decoded, f"No {width}x{height} {expected_format} image received")
+
+                if compression == "qoi":
+                    # Lossless
+                    self.assertEqual(decoded.shape, lossless.shape)
+                    self.assertTrue(np.array_equal(decoded, lossless), f"{encoding} QOI image does not round trip")
+                elif channels == 1:
+                    self.assertEqual(decoded.shape, (height, width))
+                    self.assertGreater(psnr(image[:, :, 0], decoded), 35.0)
+                else:
+                    # JPEG drops the alpha channel, and is decoded in BGR order by OpenCV
+                    self.assertEqual(decoded.shape, (height, width, 3))
+                    self.assertGreater(psnr(rgb, decoded[:, :, ::-1]), 35.0)
+
+        self._timeline.stop()
+        node.destroy_subscription(subscriber)
+        node.destroy_node()
@@ -137,6 +137,158 @@ class TestRos2PoseTree(ROS2TestCase):
         spin()
         pass
 
+    async def test_articulation_rigid_body_parent(self):
+        import rclpy
+        from pxr import PhysxSchema
+        from tf2_msgs.msg import TFMessage
+
+        await add_franka()
+        await add_cube("/cube", 0.75, (2.00, 0, 0.75))
+
+        # Keep the parent body in place so the expected transforms do not change while the test reads them
+        stage = omni.usd.get_context().get_stage()
+        PhysxSchema.PhysxRigidBodyAPI.Apply(stage.GetPrimAtPath("/cube")).CreateDisableGravityAttr(True)
+
+        self._tf_data = None
+
+        def tf_callback(data: TFMessage):
+            self._tf_data = data
+
+        node = rclpy.create_node("tf_tester")
+        tf_sub = node.create_subscription(TFMessage, "/tf_test", tf_callback, get_qos_profile())
+
+        og.Controller.edit(
+            {"graph_path": "/ActionGraph", "evaluator_name": "execution"},
+            {
+                og.Controller.Keys.CREATE_NODES: [
+                    ("OnPlaybackTick", "omni.graph.action.OnPlaybackTick"),
+                    ("ReadSimTime", "isaacsim.core.nodes.IsaacReadSimulationTime"),
+                    ("PublishTF", "isaacsim.ros2.bridge.ROS2PublishTransformTree"),
+                ],
+                og.Controller.Keys.SET_VALUES: [
+                    ("PublishTF.inputs:topicName", "/tf_test"),
+                    ("PublishTF.inputs:targetPrims", [usdrt.Sdf.Path("/panda")]),
+                    ("PublishTF.inputs:parentPrim", [usdrt.Sdf.Path("/cube")]),
+                ],
+                og.Controller.Keys.CONNECT: [
+                    ("OnPlaybackTick.outputs:tick", "PublishTF.inputs:execIn"),
+                    ("ReadSimTime.outputs:simulationTime", "PublishTF.inputs:timeStamp"),
+                ],
+            },
+        )
+
+        def spin():
+            rclpy.spin_once(node, timeout_sec=0.1)
+
+        self._timeline.play()
+        await omni.kit.app.get_app().next_update_async()
+        await simulate_async(1, 60, spin)
+
+        self.assertIsNotNone(self._tf_data)
+        transforms = {transform.child_frame_id: transform for transform in self._tf_data.transforms}
+
+        # The articulation root is published relative to the rigid body parent
+        root = transforms["panda_link0"]
+        self.assertEqual(root.header.frame_id, "cube")
+        cube_position, _ = XFormPrim("/cube").get_world_poses()
+        link_position, _ = XFormPrim("/panda/panda_link0").get_world_poses()
+        translation = root.transform.translation
+        self.assertTrue(
+            np.allclose([translation.x, translation.y, translation.z], link_position[0] - cube_position[0], atol=1e-3),
+            f"panda_link0 relative to cube is {translation}",
+        )
+
+        # Links are published relative to their parent link, not to the parent prim
+        self.assertEqual(transforms["panda_link1"].header.frame_id, "panda_link0")
+        self.assertNotIn("cube", transforms)
+
+        self._timeline.stop()
+        spin()
+        node.destroy_subscription(tf_sub)
+        node.destroy_node()
+
+    async def test_targets_changed_while_playing(self):
+        import rclpy
+        from pxr import PhysxSchema, UsdPhysics
+        from tf2_msgs.msg import TFMessage
+
+        await add_cube("/cube_a", 0.25, (0.0, 0, 0.5))
+        await add_cube("/cube_b", 0.25, (1.0, 0, 0.5))
+        await add_cube("/cube_c", 0.25, (2.0, 0, 0.5))
+        stage = omni.usd.get_context().get_stage()
+        # Keep the body that is turned into a transform in place so its published pose is known
+        PhysxSchema.PhysxRigidBodyAPI.Apply(stage.GetPrimAtPath("/cube_c")).CreateDisableGravityAttr(True)
+        UsdGeom.Xform.Define(stage, "/marker").AddTranslateOp().Set((3.0, 0, 0.5))
+
+        self._tf_data = None
+
+        def tf_callback(data: TFMessage):
+            self._tf_data = data
+
+        node = rclpy.create_node("tf_tester")
+        tf_sub = node.create_subscription(TFMessage, "/tf_test", tf_callback, get_qos_profile())
+
+        og.Controller.edit(
+            {"graph_path": "/ActionGraph", "evaluator_name": "execution"},
+            {
+                og.Controller.Keys.CREATE_NODES: [
+                    ("OnPlaybackTick", "omni.graph.action.OnPlaybackTick"),
+                    ("ReadSimTime", "isaacsim.core.nodes.IsaacReadSimulationTime"),
+                    ("PublishTF", "isaacsim.ros2.bridge.ROS2PublishTransformTree"),
+                ],
+                og.Controller.Keys.SET_VALUES: [
+                    ("PublishTF.inputs:topicName", "/tf_test"),
+                    (
+                        "PublishTF.inputs:targetPrims",
+                        [
+                            usdrt.Sdf.Path("/cube_a"),
+                            usdrt.Sdf.Path("/cube_b"),
+                            usdrt.Sdf.Path("/cube_c"),
+                            usdrt.Sdf.Path("/marker"),
+                        ],
+                    ),
+                ],
+                og.Controller.Keys.CONNECT: [
+                    ("OnPlaybackTick.outputs:tick", "PublishTF.inputs:execIn"),
+                    ("ReadSimTime.outputs:simulationTime", "PublishTF.inputs:timeStamp"),
+                ],
+            },
+        )
+
+        def spin():
+            rclpy.spin_once(node, timeout_sec=0.1)
+
+        def published_frames():
+            return {transform.child_frame_id: transform for transform in self._tf_data.transforms}
+
+        self._timeline.play()
+        await omni.kit.app.get_app().next_update_async()
+        await simulate_async(0.5, 60, spin)
+        self.assertIsNotNone(self._tf_data)
+        self.assertEqual(set(published_frames()), {"cube_a", "cube_b", "cube_c", "marker"})
+
+        # Remove a rigid body target, and turn another one into a plain transform, while the timeline is playing
+        stage.RemovePrim("/cube_b")
+        stage.GetPrimAtPath("/cube_c").RemoveAPI(UsdPhysics.RigidBodyAPI)
+        self._tf_data = None
+        await simulate_async(0.5, 60, spin)
+        self.assertIsNotNone(self._tf_data)
+        frames = published_frames()
+        self.assertEqual(set(frames), {"cube_a", "cube_c", "marker"})
+
+        # The retyped target is posed from its transform, the falling rigid body is still read from physics
+        translation = frames["cube_c"].transform.translation
+        self.assertTrue(
+            np.allclose([translation.x, translation.y, translation.z], [2.0, 0.0, 0.5], atol=1e-3),
+            f"cube_c is at {translation}",
+        )
+        self.assertLess(frames["cube_a"].transform.translation.z, 0.5)
+
+        self._timeline.stop()
+        spin()
+        node.destroy_subscription(tf_sub)
+        node.destroy_node()
+
     async def test_duplicate_names_tree(self):
         import rclpy
         from tf2_msgs.msg import TFMessage
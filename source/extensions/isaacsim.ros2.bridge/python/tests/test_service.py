@@ -13,6 +13,8 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
+import json
+
 import omni.graph.core as og
 import omni.kit.test
 from isaacsim.core.utils.stage import create_new_stage_async
@@ -98,3 +100,76 @@ class TestRos2Service(ROS2TestCase):
         print("client response = ", client_result)
         self.assertEqual(client_result, 21)
         self._timeline.stop()
+
+    async def test_service_embedded_message_arrays(self):
+        self._timeline.play()
+        await omni.kit.app.get_app().next_update_async()
+
+        # rcl_interfaces/srv/SetParameters has embedded message arrays in both its request and response
+        (test_graph, new_nodes, _, _) = og.Controller.edit(
+            {"graph_path": "/ActionGraph", "evaluator_name": "execution"},
+            {
+                og.Controller.Keys.CREATE_NODES: [
+                    ("OnPlaybackTick", "omni.graph.action.OnPlaybackTick"),
+                    ("ServerRequest", "isaacsim.ros2.bridge.OgnROS2ServiceServerRequest"),
+                    ("ServerResponse", "isaacsim.ros2.bridge.OgnROS2ServiceServerResponse"),
+                    ("Client", "isaacsim.ros2.bridge.OgnROS2ServiceClient"),
+                ],
+                og.Controller.Keys.SET_VALUES: [
+                    ("ServerRequest.inputs:serviceName", "/set_parameters_service"),
+                    ("ServerRequest.inputs:messagePackage", "rcl_interfaces"),
+                    ("ServerRequest.inputs:messageSubfolder", "srv"),
+                    ("ServerRequest.inputs:messageName", "SetParameters"),
+                    ("ServerResponse.inputs:messagePackage", "rcl_interfaces"),
+                    ("ServerResponse.inputs:messageSubfolder", "srv"),
+                    ("ServerResponse.inputs:messageName", "SetParameters"),
+                    ("Client.inputs:serviceName", "/set_parameters_service"),
+                    ("Client.inputs:messagePackage", "rcl_interfaces"),
+                    ("Client.inputs:messageSubfolder", "srv"),
+                    ("Client.inputs:messageName", "SetParameters"),
+                ],
+                og.Controller.Keys.CONNECT: [
+                    ("OnPlaybackTick.outputs:tick", "Client.inputs:execIn"),
+                    ("OnPlaybackTick.outputs:tick", "ServerRequest.inputs:execIn"),
+                    ("ServerRequest.outputs:onReceived", "ServerResponse.inputs:onReceived"),
+                    ("ServerRequest.outputs:serverHandle", "ServerResponse.inputs:serverHandle"),
+                ],
+            },
+        )
+
+        await og.Controller.evaluate(test_graph)
+        await omni.kit.app.get_app().next_update_async()
+        server_req_node = new_nodes[1]
+        server_res_node = new_nodes[2]
+        client_node = new_nodes[3]
+
+        # Embedded messages are set as JSON strings, and converted field by field into the message
+        parameters = [
+            {"name": "gain", "value": {"type": 3, "double_value": 2.5}},
+            {"name": "label", "value": {"type": 4, "string_value": "abc"}},
+        ]
+        og.Controller.attribute("inputs:Request:parameters", client_node).set([json.dumps(p) for p in parameters])
+
+        # wait for the client to executes and send the request
+        await omni.kit.app.get_app().next_update_async()
+        await og.Controller.evaluate(test_graph)
+        received = [json.loads(p) for p in og.Controller.attribute("outputs:Request:parameters", server_req_node).get()]
+        self.assertEqual(len(received), 2)
+        self.assertEqual(received[0]["name"], "gain")
+        self.assertEqual(received[0]["value"]["type"], 3)
+        self.assertAlmostEqual(received[0]["value"]["double_value"], 2.5)
+        self.assertEqual(received[1]["name"], "label")
+        self.assertEqual(received[1]["value"]["string_value"], "abc")
+
+        await omni.kit.app.get_app().next_update_async()
+        results = [{"successful": True, "reason": ""}, {"successful": False, "reason": "read only"}]
+        og.Controller.attribute("inputs:Response:results", server_res_node).set([json.dumps(r) for r in results])
+
+        # wait for the server to executes and send the response
+        await omni.kit.app.get_app().next_update_async()
+        await omni.kit.app.get_app().next_update_async()
+
+        client_results = [json.loads(r) for r in og.Controller.attribute("outputs:Response:results", client_node).get()]
+        self._timeline.stop()
+        self.assertEqual([r["successful"] for r in client_results], [True, False])
+        self.assertEqual(client_results[1]["reason"], "read only")
@@ -249,6 +249,54 @@ class TestRos2Subscribers(ROS2TestCase):
 
         pass
 
+    async def test_multiple_subscribers_share_context(self):
+
+        import rclpy
+        from builtin_interfaces.msg import Time
+        from rosgraph_msgs.msg import Clock
+
+        self._stage = omni.usd.get_context().get_stage()
+
+        node = rclpy.create_node("isaac_sim_test_multiple_subscribers")
+        num_subscribers = 8
+        publishers = [node.create_publisher(Clock, f"clock_sub_{i}", 10) for i in range(num_subscribers)]
+
+        self.graph_path = "/ActionGraph"
+        create_nodes = [("OnPlaybackTick", "omni.graph.action.OnPlaybackTick")]
+        set_values = []
+        connect = []
+        for i in range(num_subscribers):
+            create_nodes.append((f"SubscribeClock{i}", "isaacsim.ros2.bridge.ROS2SubscribeClock"))
+            set_values.append((f"SubscribeClock{i}.inputs:topicName", f"clock_sub_{i}"))
+            connect.append(("OnPlaybackTick.outputs:tick", f"SubscribeClock{i}.inputs:execIn"))
+        og.Controller.edit(
+            {"graph_path": self.graph_path, "evaluator_name": "execution"},
+            {
+                og.Controller.Keys.CREATE_NODES: create_nodes,
+                og.Controller.Keys.SET_VALUES: set_values,
+                og.Controller.Keys.CONNECT: connect,
+            },
+        )
+
+        self._timeline.play()
+        await omni.kit.app.get_app().next_update_async()
+        await omni.kit.app.get_app().next_update_async()
+        await omni.kit.app.get_app().next_update_async()
+
+        # Every subscription of the context is waited on together, each one must still get its own message
+        for i, publisher in enumerate(publishers):
+            msg = Clock()
+            msg.clock = Time(sec=i + 1)
+            publisher.publish(msg)
+        await simulate_async(0.5, 60)
+
+        for i in range(num_subscribers):
+            stamp = og.Controller.get(og.Controller.attribute(f"{self.graph_path}/SubscribeClock{i}.outputs:timeStamp"))
+            self.assertAlmostEqual(stamp, i + 1)
+
+        self._timeline.stop()
+        node.destroy_node()
+
     async def test_twist_subscriber_queue(self):
 
         import rclpy
@@ -330,6 +378,86 @@ class TestRos2Subscribers(ROS2TestCase):
 
         pass
 
+    async def test_twist_subscriber_message_modes(self):
+
+        import rclpy
+        from geometry_msgs.msg import Twist
+
+        self._stage = omni.usd.get_context().get_stage()
+
+        node = rclpy.create_node("isaac_sim_test_twist_sub_modes")
+        ros_topic = "twist_sub_modes"
+        test_pub = node.create_publisher(Twist, ros_topic, 1)
+
+        self.graph_path = "/ActionGraph"
+        self.sub_node_time_attribute_path = self.graph_path + "/SubscribeTwist.outputs:linearVelocity"
+        mode_attribute_path = self.graph_path + "/SubscribeTwist.inputs:messageMode"
+        count_attribute_path = self.graph_path + "/Counter.outputs:count"
+
+        og.Controller.edit(
+            {"graph_path": self.graph_path, "evaluator_name": "execution"},
+            {
+                og.Controller.Keys.CREATE_NODES: [
+                    ("OnPlaybackTick", "omni.graph.action.OnPlaybackTick"),
+                    ("SubscribeTwist", "isaacsim.ros2.bridge.ROS2SubscribeTwist"),
+                    ("Counter", "omni.graph.action.Counter"),
+                ],
+                og.Controller.Keys.SET_VALUES: [
+                    ("SubscribeTwist.inputs:topicName", ros_topic),
+                    ("SubscribeTwist.inputs:queueSize", self.queue_size),
+                ],
+                og.Controller.Keys.CONNECT: [
+                    ("OnPlaybackTick.outputs:tick", "SubscribeTwist.inputs:execIn"),
+                    ("SubscribeTwist.outputs:execOut", "Counter.inputs:execIn"),
+                ],
+            },
+        )
+
+        def publish_data():
+            # We are using linear.x to store message sequence
+            for count in range(1, self.MAX_COUNT):
+                msg = Twist()
+                msg.linear.x = float(count)
+                test_pub.publish(msg)
+                time.sleep(0.01)
+
+        # "latest" drains the whole queue in one tick and only outputs the newest message
+        og.Controller.set(og.Controller.attribute(mode_attribute_path), "latest")
+        self.sub_data = []
+        self._timeline.play()
+        await omni.kit.app.get_app().next_update_async()
+        await omni.kit.app.get_app().next_update_async()
+        await omni.kit.app.get_app().next_update_async()
+        count_before = og.Controller.get(og.Controller.attribute(count_attribute_path))
+
+        publish_data()
+        await simulate_async(2, 60, self.spin)
+        self._timeline.stop()
+
+        self.assertEqual(self.sub_data, [self.MAX_COUNT - 1])
+        self.assertEqual(og.Controller.get(og.Controller.attribute(count_attribute_path)) - count_before, 1)
+
+        # "all" triggers execOut once per queued message, within a single tick
+        og.Controller.set(og.Controller.attribute(mode_attribute_path), "all")
+        self.prev_seq = None
+        self.sub_data = []
+        self._timeline.play()
+        await omni.kit.app.get_app().next_update_async()
+        await omni.kit.app.get_app().next_update_async()
+        await omni.kit.app.get_app().next_update_async()
+        count_before = og.Controller.get(og.Controller.attribute(count_attribute_path))
+
+        publish_data()
+        await simulate_async(2, 60, self.spin)
+        self._timeline.stop()
+
+        self.assertEqual(self.sub_data, [self.MAX_COUNT - 1])
+        self.assertEqual(
+            og.Controller.get(og.Controller.attribute(count_attribute_path)) - count_before, self.queue_size
+        )
+
+        node.destroy_node()
+
     async def test_ackermann_subscriber_queue(self):
 
         import rclpy
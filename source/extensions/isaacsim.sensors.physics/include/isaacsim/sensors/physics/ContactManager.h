@@ -133,12 +133,35 @@ struct ContactPair
     }
 };
 
+/**
+ * @struct ContactPairHash
+ * @brief Hash functor for using ContactPair as an unordered container key.
+ */
+struct ContactPairHash
+{
+    /**
+     * @brief Computes the hash of a contact pair.
+     * @param[in] p Contact pair to hash.
+     * @return Combined hash of both body IDs.
+     */
+    size_t operator()(const ContactPair& p) const
+    {
+        size_t seed = std::hash<uint64_t>()(p.body0);
+        return seed ^ (std::hash<uint64_t>()(p.body1) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+    }
+};
+
 /**
  * @class ContactManager
  * @brief Manages contact events and data in the physics simulation.
  * @details
  * Handles the processing and storage of contact events between physical bodies,
  * providing access to raw contact data and managing contact sensor states.
+ *
+ * Contact events of a physics step are staged per contact pair and merged into the
+ * persistent contact list once, after which the contacts are bucketed by body into a
+ * contiguous per-body index. Looking up the contacts of a body is a single hash lookup
+ * returning a span, instead of a filtered copy of every contact in the scene.
  */
 class ContactManager
 {
@@ -160,6 +183,10 @@ public:
 
     /**
      * @brief Processes a contact event from the physics engine.
+     * @details
+     * The event is staged for its contact pair, replacing any event already staged for the same
+     * pair this step. Staged events are applied to the contact data by onPhysicsStep.
+     *
      * @param[in] c Contact event header.
      * @param[in] contactDataBuffer Buffer containing contact data.
      * @param[in,out] dataIdx Index into the contact data buffer.
@@ -180,7 +207,8 @@ public:
      * @brief Gets raw contact data for a specific body token.
      * @param[in] token Body identifier token.
      * @param[out] size Number of contact data points.
-     * @return Pointer to array of raw contact data.
+     * @return Pointer to array of raw contact data, valid until the next physics step, or nullptr if the body
+     *         has no contacts.
      */
     CsRawData* getCsRawData(uint64_t token, size_t& size);
 
@@ -204,11 +232,46 @@ public:
     float getCurrentTime();
 
 private:
-    /** @brief Vector of raw contact data. */
+    /**
+     * @struct ContactSpan
+     * @brief Range of contact data in a contiguous buffer.
+     */
+    struct ContactSpan
+    {
+        /** @brief Index of the first contact in the buffer. */
+        size_t offset{ 0 };
+
+        /** @brief Number of contacts in the range. */
+        size_t count{ 0 };
+    };
+
+    /**
+     * @brief Applies the contact events staged this step to the persistent contact data.
+     */
+    void applyStagedContacts();
+
+    /**
+     * @brief Rebuilds the per-body contact index from the persistent contact data.
+     */
+    void rebuildBodyIndex();
+
+    /** @brief Vector of raw contact data, grouped by contact pair. */
     std::vector<CsRawData> m_contactRaw;
 
-    /** @brief Map of body tokens to their raw contact data. */
-    std::map<uint64_t, std::vector<CsRawData>> m_contactRawMap;
+    /** @brief Contacts reported during the current step, referenced by m_stagedPairs. */
+    std::vector<CsRawData> m_stagedContacts;
+
+    /** @brief Latest staged contact range of each pair reported during the current step. */
+    std::unordered_map<ContactPair, ContactSpan, ContactPairHash> m_stagedPairs;
+
+    /** @brief Pairs reported during the current step, in report order. */
+    std::vector<ContactPair> m_stagedPairOrder;
+
+    /** @brief Raw contact data bucketed by body, each contact appearing once for each of its bodies. */
+    std::vector<CsRawData> m_contactsByBody;
+
+    /** @brief Map of body tokens to their range in m_contactsByBody. */
+    std::unordered_map<uint64_t, ContactSpan> m_bodySpans;
 
     /** @brief Subscription to contact event callbacks. */
     carb::events::ISubscriptionPtr m_contactCallbackPtr;
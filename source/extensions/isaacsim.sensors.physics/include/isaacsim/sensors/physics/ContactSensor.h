@@ -84,6 +84,7 @@ public:
 
     /**
      * @brief Processes raw contact data into sensor readings.
+     * @details Contacts are compared against the sensor position queried by the last prePhysicsStep.
      * @param[in] rawContact Array of raw contact data.
      * @param[in] size Number of contact data points.
      * @param[in] index Index indicating data recency (0 for old, 1 for new).
@@ -96,6 +97,11 @@ public:
      */
     virtual void onPhysicsStep();
 
+    /**
+     * @brief Gets the raw contacts of the parent body and the sensor position for the next onPhysicsStep.
+     */
+    virtual void prePhysicsStep();
+
     /**
      * @brief Called each tick to update sensor state.
      * @note onPhysicsStep is used to update the sensor state.
@@ -156,6 +162,9 @@ private:
     /** @brief Raw contact data from physics simulation. */
     CsRawData* m_contactsRawData = nullptr;
 
+    /** @brief World position of the sensor, queried before processing the raw contacts. */
+    pxr::GfVec3d m_sensorPosition{ 0.0 };
+
     /** @brief Pointer to the contact manager instance. */
     ContactManager* m_contactManagerPtr = nullptr;
 
@@ -15,6 +15,8 @@
 
 #pragma once
 
+#include <carb/tasking/ITasking.h>
+
 #include <isaacSensorSchema/isaacImuSensor.h>
 #include <isaacsim/sensors/physics/IPhysicsSensor.h>
 #include <isaacsim/sensors/physics/IsaacSensorComponent.h>
@@ -22,8 +24,10 @@
 #include <omni/renderer/IDebugDraw.h>
 #include <pxr/usd/usd/inherits.h>
 #include <usdrt/gf/matrix.h>
+#include <usdrt/gf/quat.h>
 #include <usdrt/gf/vec.h>
 
+#include <array>
 #include <map>
 #include <memory>
 #include <vector>
@@ -35,6 +39,49 @@ namespace sensors
 namespace physics
 {
 
+/**
+ * @struct ImuSensorBatch
+ * @brief Structure of arrays scratch space for evaluating many IMU sensors in one pass
+ * @details Holds one entry per sensor for each component, so the frame transforms of all sensors
+ *          run as a single loop over contiguous arrays. Owned by the caller and reused across steps.
+ */
+struct ImuSensorBatch
+{
+    /** @brief Body linear velocity in world frame, rotated in place into sensor frame */
+    std::array<std::vector<double>, 3> linVel;
+
+    /** @brief Body angular velocity in world frame, rotated in place into sensor frame */
+    std::array<std::vector<double>, 3> angVel;
+
+    /** @brief Gravity in world frame, rotated in place into sensor frame */
+    std::array<std::vector<double>, 3> gravity;
+
+    /** @brief Row major world to sensor rotation, one array per matrix element */
+    std::array<std::vector<double>, 9> rotation;
+
+    /** @brief Sensor orientation in world frame */
+    std::vector<omni::math::linalg::quatd> orientation;
+
+    /**
+     * @brief Resizes every array to hold the given number of sensors
+     * @param[in] count Number of sensors in the batch
+     */
+    void resize(size_t count)
+    {
+        for (size_t i = 0; i < 3; i++)
+        {
+            linVel[i].resize(count);
+            angVel[i].resize(count);
+            gravity[i].resize(count);
+        }
+        for (auto& element : rotation)
+        {
+            element.resize(count);
+        }
+        orientation.resize(count);
+    }
+};
+
 /**
  * @class ImuSensor
  * @brief Implementation of an Inertial Measurement Unit (IMU) sensor component
@@ -42,6 +89,8 @@ namespace physics
  *          It handles acceleration, angular velocity, and orientation measurements, with support
  *          for raw data buffering and interpolation. The sensor supports configurable filtering
  *          for various measurements and maintains a history of readings for signal processing.
+ *          The history is a fixed capacity ring buffer and the moving average filters keep running
+ *          sums, so a physics step costs the same regardless of the filter widths.
  */
 class ImuSensor : public IsaacBaseSensorComponent
 {
@@ -52,7 +101,6 @@ public:
      */
     ImuSensor() : IsaacBaseSensorComponent()
     {
-        m_rawBuffer.resize(m_rawBufferSize, IsRawData());
         reset();
     }
 
@@ -91,6 +139,29 @@ public:
      */
     virtual void onPhysicsStep();
 
+    /**
+     * @brief Updates several IMU sensors for the current physics step in one batched pass
+     * @details Equivalent to calling onPhysicsStep on each sensor. The sensor poses are queried first,
+     *          then all velocities and gravity vectors are rotated into their sensor frames in a single
+     *          loop over the batch arrays, and finally each sensor history is updated. Poses are queried
+     *          on the calling thread, only the history updates run in parallel when a tasking interface is given.
+     * @param[in] sensors Sensors to update, each must have a rigid body data buffer
+     * @param[in,out] batch Scratch space reused across calls
+     * @param[in] tasking Tasking interface used to update sensor histories in parallel, serial if nullptr
+     */
+    static void onPhysicsStepBatch(const std::vector<ImuSensor*>& sensors,
+                                   ImuSensorBatch& batch,
+                                   carb::tasking::ITasking* tasking = nullptr);
+
+    /**
+     * @brief Checks whether the sensor has been given its rigid body data buffer
+     * @return True if the sensor can be updated on physics steps
+     */
+    bool hasDataBuffer() const
+    {
+        return m_rigidBodyDataBuffer != nullptr;
+    }
+
     /**
      * @brief Empty tick implementation as processing is done in onPhysicsStep
      */
@@ -123,6 +194,76 @@ public:
     void printIsReading(const IsReading& reading);
 
 private:
+    /**
+     * @brief Computes the world to sensor transform for the current step
+     * @param[out] qWb Sensor orientation in world frame
+     * @return Transform from world frame to sensor frame
+     */
+    usdrt::GfMatrix4d computeWorldToSensor(omni::math::linalg::quatd& qWb);
+
+    /**
+     * @brief Adds a new sample to the history and updates the filtered reading
+     * @param[in] vB Linear velocity in sensor frame
+     * @param[in] wB Angular velocity in sensor frame
+     * @param[in] qWb Sensor orientation in world frame
+     */
+    void pushSample(const omni::math::linalg::vec3d& vB,
+                    const omni::math::linalg::vec3d& wB,
+                    const omni::math::linalg::quatd& qWb);
+
+    /**
+     * @brief Copies the reading history, latest first, into m_sensorReadingsSensorFrame
+     */
+    void copyReadingsToSensorFrame();
+
+    /**
+     * @brief Resizes the ring buffers to m_rawBufferSize, keeping the most recent history
+     */
+    void resizeHistory();
+
+    /**
+     * @brief Recomputes the finite differences and running filter sums from the raw history
+     */
+    void recomputeFilterSums();
+
+    /**
+     * @brief Computes the linear acceleration finite difference between a raw sample and an older one
+     * @param[in] newer Newer raw sample
+     * @param[in] older Raw sample m_linearAccelerationFilterSize steps older
+     * @return Finite difference acceleration, zero if both samples have the same time
+     */
+    static omni::math::linalg::vec3d finiteDifference(const IsRawData& newer, const IsRawData& older);
+
+    /**
+     * @brief Gets the raw sample recorded a number of steps ago
+     * @param[in] age Number of steps ago, 0 is the latest sample
+     * @return Raw sample at the given age
+     */
+    IsRawData& rawAt(size_t age)
+    {
+        return m_rawBuffer[(m_historyHead + age) % m_rawBuffer.size()];
+    }
+
+    /**
+     * @brief Gets the finite difference acceleration of the raw sample recorded a number of steps ago
+     * @param[in] age Number of steps ago, 0 is the latest sample
+     * @return Finite difference acceleration at the given age
+     */
+    omni::math::linalg::vec3d& linAccTermAt(size_t age)
+    {
+        return m_linAccTerms[(m_historyHead + age) % m_linAccTerms.size()];
+    }
+
+    /**
+     * @brief Gets the reading computed a number of steps ago
+     * @param[in] age Number of steps ago, 0 is the latest reading
+     * @return Reading at the given age
+     */
+    IsReading& readingAt(size_t age)
+    {
+        return m_sensorReadings[(m_historyHead + age) % m_sensorReadings.size()];
+    }
+
     /** @brief Properties structure for the IMU sensor */
     IsProperties m_props;
 
@@ -138,9 +279,24 @@ private:
     /** @brief Initial buffer state */
     IsRawData m_initBuffer;
 
-    /** @brief Raw velocities data array */
+    /** @brief Raw velocities ring buffer, indexed through rawAt */
     std::vector<IsRawData> m_rawBuffer;
 
+    /** @brief Finite difference accelerations of each raw sample, sharing the raw buffer indexing */
+    std::vector<omni::math::linalg::vec3d> m_linAccTerms;
+
+    /** @brief Ring buffer position of the latest sample */
+    size_t m_historyHead = 0;
+
+    /** @brief Running sum of the angular velocities in the filter window */
+    omni::math::linalg::vec3d m_angVelSum{ 0.0, 0.0, 0.0 };
+
+    /** @brief Running sum of the finite difference accelerations in the filter window */
+    omni::math::linalg::vec3d m_linAccSum{ 0.0, 0.0, 0.0 };
+
+    /** @brief Running sum of the orientations in the filter window, (w, x, y, z) */
+    std::array<double, 4> m_orientationSum{ 0.0, 0.0, 0.0, 0.0 };
+
     /** @brief Moving average window size for angular velocities */
     int m_angularVelocityFilterSize = 1;
 
@@ -153,7 +309,7 @@ private:
     /** @brief IsReading at the measurement sensor period */
     std::vector<IsReading> m_sensorReadingsSensorFrame;
 
-    /** @brief Sensor readings in sensor timestamps */
+    /** @brief Sensor readings ring buffer, indexed through readingAt */
     std::vector<IsReading> m_sensorReadings;
 
     /** @brief Unit scale factor for measurements */
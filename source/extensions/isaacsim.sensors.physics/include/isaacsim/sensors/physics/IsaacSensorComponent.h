@@ -162,6 +162,15 @@ public:
         return m_parentPrim;
     }
 
+    /**
+     * @brief Called each physics step before onPhysicsStep, on the thread stepping the sensors.
+     * @details Reads what onPhysicsStep needs from the stage, such as the sensor pose, since onPhysicsStep
+     *          may run concurrently for different sensors. Default implementation does nothing.
+     */
+    virtual void prePhysicsStep()
+    {
+    }
+
 protected:
     /**
      * @brief USD prim that is the parent of this sensor.
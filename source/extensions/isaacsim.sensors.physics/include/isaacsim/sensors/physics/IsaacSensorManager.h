@@ -19,6 +19,7 @@
 #include <carb/PluginUtils.h>
 #include <carb/events/EventsUtils.h>
 #include <carb/logging/Log.h>
+#include <carb/tasking/ITasking.h>
 
 #include <isaacSensorSchema/isaacContactSensor.h>
 #include <isaacsim/core/includes/PrimManager.h>
@@ -82,10 +83,12 @@ public:
      * @brief Constructs a new IsaacSensorManager instance.
      * @details Initializes the manager with a PhysX interface and creates a contact manager instance.
      * @param[in] physXInterface Pointer to the PhysX interface used for physics simulation.
+     * @param[in] taskingPtr Pointer to the tasking interface used to update sensors in parallel.
      */
-    IsaacSensorManager(omni::physx::IPhysx* physXInterface)
+    IsaacSensorManager(omni::physx::IPhysx* physXInterface, carb::tasking::ITasking* taskingPtr)
     {
         m_physXInterface = physXInterface;
+        m_tasking = taskingPtr;
         m_contactManager = std::make_unique<ContactManager>();
     }
 
@@ -216,6 +219,9 @@ public:
      * @details
      * Processes physics updates for all sensor components, including contact and IMU sensors.
      * Handles component initialization, timestep updates, and sensor-specific physics calculations.
+     * IMU sensors are collected and evaluated together in one batched pass after the other components.
+     * The contact report is gathered first and each sensor reads its pose from the stage serially, then the
+     * sensors only read shared data and are updated in parallel.
      *
      * @param[in] dt Time step delta in seconds.
      */
@@ -224,6 +230,8 @@ public:
 
         m_contactManager->onPhysicsStep(static_cast<float>(m_timeSeconds), static_cast<float>(dt));
 
+        m_activeComponents.clear();
+        m_imuSensors.clear();
         for (auto& component : m_components)
         {
             if (component.second->mDoStart == true)
@@ -239,9 +247,29 @@ public:
             if (component.second->getEnabled())
             {
                 component.second.get()->updateTimestamp(this->m_timeSeconds, dt, this->m_timeNanoSeconds);
-                component.second->onPhysicsStep();
+                ImuSensor* imuSensor = dynamic_cast<ImuSensor*>(component.second.get());
+                if (imuSensor == nullptr)
+                {
+                    m_activeComponents.push_back(component.second.get());
+                }
+                else if (imuSensor->hasDataBuffer())
+                {
+                    m_imuSensors.push_back(imuSensor);
+                }
             }
         }
+        {
+            CARB_PROFILE_ZONE(0, "Isaac Sensor Manager - physics step components");
+            for (IsaacBaseSensorComponent* component : m_activeComponents)
+            {
+                component->prePhysicsStep();
+            }
+            forEachActiveComponent([](IsaacBaseSensorComponent* component) { component->onPhysicsStep(); });
+        }
+        if (!m_imuSensors.empty())
+        {
+            ImuSensor::onPhysicsStepBatch(m_imuSensors, m_imuBatch, m_tasking);
+        }
         this->m_timeSeconds += dt;
         this->m_timeNanoSeconds = static_cast<int64_t>(m_timeSeconds * 1e9);
 
@@ -332,12 +360,41 @@ public:
     }
 
 private:
+    /**
+     * @brief Calls a function on every component in m_activeComponents.
+     * @details
+     * Runs in parallel on the tasking interface when there is more than one component. The components are
+     * gathered into a vector beforehand so each task indexes it directly instead of walking the component map.
+     *
+     * @param[in] fn Function taking a component pointer, must be safe to call concurrently on different components.
+     */
+    template <typename Fn>
+    void forEachActiveComponent(Fn&& fn)
+    {
+        if (m_tasking != nullptr && m_activeComponents.size() > 1)
+        {
+            m_tasking->applyRange(m_activeComponents.size(), [&](size_t index) { fn(m_activeComponents[index]); });
+        }
+        else
+        {
+            for (IsaacBaseSensorComponent* component : m_activeComponents)
+            {
+                fn(component);
+            }
+        }
+    }
+
     /**
      * @brief Pointer to the PhysX interface used for physics simulation.
      * @details Provides access to the PhysX physics engine functionality.
      */
     omni::physx::IPhysx* m_physXInterface = nullptr;
 
+    /**
+     * @brief Pointer to the tasking interface used to update sensors in parallel.
+     */
+    carb::tasking::ITasking* m_tasking = nullptr;
+
     /**
      * @brief Unique pointer to the contact manager instance.
      * @details Manages contact-related functionality for all contact sensors.
@@ -355,6 +412,23 @@ private:
      * @details Stores physics-related data for rigid bodies in the simulation.
      */
     std::vector<float> m_rigidBodyDataBuffer;
+
+    /**
+     * @brief Enabled components dispatched in the current physics step, excluding batched IMU sensors.
+     * @details Rebuilt every step, kept as a member to reuse its allocation.
+     */
+    std::vector<IsaacBaseSensorComponent*> m_activeComponents;
+
+    /**
+     * @brief Enabled IMU sensors evaluated in the current physics step.
+     * @details Rebuilt every step, kept as a member to reuse its allocation.
+     */
+    std::vector<ImuSensor*> m_imuSensors;
+
+    /**
+     * @brief Scratch space for the batched IMU evaluation.
+     */
+    ImuSensorBatch m_imuBatch;
 };
 }
 }
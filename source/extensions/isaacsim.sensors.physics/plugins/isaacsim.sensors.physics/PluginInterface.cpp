@@ -33,6 +33,7 @@
 #include <carb/PluginUtils.h>
 #include <carb/logging/Log.h>
 #include <carb/settings/ISettings.h>
+#include <carb/tasking/ITasking.h>
 
 #include <isaacsim/sensors/physics/IPhysicsSensor.h>
 #include <omni/fabric/usd/PathConversion.h>
@@ -59,7 +60,8 @@ CARB_PLUGIN_IMPL(g_kPluginDesc,
 CARB_PLUGIN_IMPL_DEPS(omni::physx::IPhysx,
                       omni::physx::IPhysxSceneQuery,
                       omni::kit::IStageUpdate,
-                      omni::graph::core::IGraphRegistry)
+                      omni::graph::core::IGraphRegistry,
+                      carb::tasking::ITasking)
 
 DECLARE_OGN_NODES()
 
@@ -413,7 +415,8 @@ CARB_EXPORT void carbOnPluginStartup()
     static constexpr char s_kSetting[] = "/physics/suppressReadback";
     g_settings->setBool(s_kSetting, false);
 
-    g_isaacSensorManager = std::make_unique<isaacsim::sensors::physics::IsaacSensorManager>(g_physx);
+    g_isaacSensorManager = std::make_unique<isaacsim::sensors::physics::IsaacSensorManager>(
+        g_physx, carb::getCachedInterface<carb::tasking::ITasking>());
 
     omni::kit::StageUpdateNodeDesc desc = { nullptr };
     desc.displayName = "Isaac Sensor Interface";
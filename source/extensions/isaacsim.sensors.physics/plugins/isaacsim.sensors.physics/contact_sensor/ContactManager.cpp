@@ -21,6 +21,8 @@
 
 #include <isaacsim/sensors/physics/ContactManager.h>
 
+#include <algorithm>
+
 
 namespace isaacsim
 {
@@ -42,11 +44,12 @@ ContactManager::~ContactManager()
 
 void ContactManager::resetSensors()
 {
-    for (auto& it : m_contactRawMap)
-    {
-        it.second.resize(0);
-    }
     m_contactRaw.clear();
+    m_stagedContacts.clear();
+    m_stagedPairs.clear();
+    m_stagedPairOrder.clear();
+    m_contactsByBody.clear();
+    m_bodySpans.clear();
     m_currentTime = 0.0f;
 }
 
@@ -55,13 +58,21 @@ void ContactManager::processContact(const omni::physx::ContactEventHeader c,
                                     uint32_t& dataIdx)
 {
     // CARB_LOG_INFO("onContactReport");
+    ContactPair pair(c.actor0, c.actor1);
+    auto result = m_stagedPairs.emplace(pair, ContactSpan());
+    if (result.second)
+    {
+        m_stagedPairOrder.push_back(pair);
+    }
+    // A later event for the same pair supersedes the earlier one, a lost contact stages an empty range
+    ContactSpan& span = result.first->second;
+    span.offset = m_stagedContacts.size();
+    span.count = 0;
     switch (c.type)
     {
     case omni::physx::ContactEventType::Enum::eCONTACT_FOUND:
     case omni::physx::ContactEventType::Enum::eCONTACT_PERSIST:
     {
-        // CARB_LOG_INFO("Contact Header");
-
         // pxr::SdfPath body0 = reinterpret_cast<const pxr::SdfPath&>(c.actor0);
         // pxr::SdfPath body1 = reinterpret_cast<const pxr::SdfPath&>(c.actor1);
 
@@ -72,26 +83,21 @@ void ContactManager::processContact(const omni::physx::ContactEventHeader c,
         contact.dt = m_currentDt;
         contact.body0 = c.actor0;
         contact.body1 = c.actor1;
-        removeRawData(ContactPair(c.actor0, c.actor1));
-        // CARB_LOG_INFO("Adding to contact Raw");
         for (uint32_t i = 0; i < c.numContactData; i++)
         {
-            auto data = contactDataBuffer[i + dataIdx];
-            // CARB_LOG_INFO("Contact Data");
+            const omni::physx::ContactData& data = contactDataBuffer[i + dataIdx];
             contact.normal = data.normal;
             contact.position = data.position;
             contact.impulse = data.impulse;
-            m_contactRaw.push_back(contact);
+            m_stagedContacts.push_back(contact);
         }
+        span.count = c.numContactData;
         dataIdx += c.numContactData;
         break;
     }
     case omni::physx::ContactEventType::Enum::eCONTACT_LOST:
     {
-        // search for contact on persistent data
         // CARB_LOG_INFO("Contact Lost");
-
-        removeRawData(ContactPair(c.actor0, c.actor1));
         break;
     }
     }
@@ -105,35 +111,83 @@ CsRawData* ContactManager::getCsRawData(const char* usdPath, size_t& size)
 
 CsRawData* ContactManager::getCsRawData(uint64_t token, size_t& size)
 {
-    // If filtered list was not generated, create it now
-    if (m_contactRawMap.find(token) == m_contactRawMap.end() || m_contactRawMap[token].empty())
+    auto it = m_bodySpans.find(token);
+    if (it == m_bodySpans.end() || it->second.count == 0)
     {
-        m_contactRawMap[token].resize(m_contactRaw.size());
-        auto it = std::copy_if(m_contactRaw.begin(), m_contactRaw.end(), m_contactRawMap[token].begin(),
-                               [token](const CsRawData& i) { return i.body0 == token || i.body1 == token; });
-        m_contactRawMap[token].resize(std::distance(m_contactRawMap[token].begin(), it));
+        size = 0;
+        return nullptr;
     }
-    size = m_contactRawMap[token].size();
-    return m_contactRawMap[token].data();
+    size = it->second.count;
+    return m_contactsByBody.data() + it->second.offset;
 }
 
 void ContactManager::removeRawData(const ContactPair& p)
 {
-    // CARB_LOG_INFO("Remove Raw Data %s %s", std::string(p.body0).c_str(), std::string(p.body1).c_str());
-    if (m_contactRawMap.find(p.body0) != m_contactRawMap.end())
-    {
-        m_contactRawMap[p.body0].resize(0);
-    }
-    if (m_contactRawMap.find(p.body1) != m_contactRawMap.end())
-    {
-        m_contactRawMap[p.body1].resize(0);
-    }
     if (!m_contactRaw.empty())
     {
         auto it = std::remove_if(
             m_contactRaw.begin(), m_contactRaw.end(), [p](const CsRawData& d) { return p == ContactPair(d); });
         m_contactRaw.erase(it, m_contactRaw.end());
     }
+    rebuildBodyIndex();
+}
+
+void ContactManager::applyStagedContacts()
+{
+    CARB_PROFILE_ZONE(0, "Contact Sensor manager - apply staged contacts");
+    if (!m_contactRaw.empty())
+    {
+        // Drop the previous data of every reported pair in a single pass
+        auto it = std::remove_if(m_contactRaw.begin(), m_contactRaw.end(), [this](const CsRawData& d)
+                                 { return m_stagedPairs.find(ContactPair(d)) != m_stagedPairs.end(); });
+        m_contactRaw.erase(it, m_contactRaw.end());
+    }
+    for (const ContactPair& pair : m_stagedPairOrder)
+    {
+        const ContactSpan& span = m_stagedPairs[pair];
+        m_contactRaw.insert(m_contactRaw.end(), m_stagedContacts.begin() + span.offset,
+                            m_stagedContacts.begin() + span.offset + span.count);
+    }
+    m_stagedContacts.clear();
+    m_stagedPairs.clear();
+    m_stagedPairOrder.clear();
+}
+
+void ContactManager::rebuildBodyIndex()
+{
+    CARB_PROFILE_ZONE(0, "Contact Sensor manager - rebuild body index");
+    // Bodies stay in the map with an empty range once their contacts are lost, so that steady state steps do not
+    // allocate map nodes
+    for (auto& it : m_bodySpans)
+    {
+        it.second.count = 0;
+    }
+    for (const CsRawData& d : m_contactRaw)
+    {
+        m_bodySpans[d.body0].count++;
+        if (d.body1 != d.body0)
+        {
+            m_bodySpans[d.body1].count++;
+        }
+    }
+    size_t offset = 0;
+    for (auto& it : m_bodySpans)
+    {
+        it.second.offset = offset;
+        offset += it.second.count;
+        it.second.count = 0;
+    }
+    m_contactsByBody.resize(offset);
+    for (const CsRawData& d : m_contactRaw)
+    {
+        ContactSpan& span0 = m_bodySpans[d.body0];
+        m_contactsByBody[span0.offset + span0.count++] = d;
+        if (d.body1 != d.body0)
+        {
+            ContactSpan& span1 = m_bodySpans[d.body1];
+            m_contactsByBody[span1.offset + span1.count++] = d;
+        }
+    }
 }
 
 void ContactManager::onPhysicsStep(const float& currentTime, const float& timeElapsed)
@@ -163,6 +217,11 @@ void ContactManager::onPhysicsStep(const float& currentTime, const float& timeEl
         }
         // CARB_LOG_WARN("Num Contacts: %ld - %ld",numContactHeaders, numContactData);
     }
+    if (!m_stagedPairOrder.empty())
+    {
+        applyStagedContacts();
+        rebuildBodyIndex();
+    }
 }
 
 float ContactManager::getCurrentTime()
@@ -114,10 +114,7 @@ void ContactSensor::processRawContacts(CsRawData* rawContact, const size_t& size
 
     if (size > static_cast<size_t>(0))
     {
-        usdrt::GfMatrix4d usdTransform =
-            isaacsim::core::includes::pose::computeWorldXformNoCache(m_stage, m_usdrtStage, m_prim.GetPath());
-        const double* sensorPose = usdTransform.ExtractTranslation().GetArray();
-        pxr::GfVec3d pose(sensorPose[0], sensorPose[1], sensorPose[2]);
+        const pxr::GfVec3d& pose = m_sensorPosition;
         pxr::GfVec3d totalImpulse(0.0, 0.0, 0.0);
         for (size_t i = 0; i < size; ++i)
         {
@@ -155,6 +152,24 @@ void ContactSensor::processRawContacts(CsRawData* rawContact, const size_t& size
     }
 }
 
+void ContactSensor::prePhysicsStep()
+{
+    if (m_contactManagerPtr == nullptr)
+    {
+        return;
+    }
+
+    m_contactsRawData = m_contactManagerPtr->getCsRawData(asInt(m_parentPrim.GetPath()), m_size);
+    if (m_contactsRawData != nullptr && m_size > 0)
+    {
+        // Querying the pose is not thread safe, so it is done here rather than in onPhysicsStep
+        usdrt::GfMatrix4d usdTransform =
+            isaacsim::core::includes::pose::computeWorldXformNoCache(m_stage, m_usdrtStage, m_prim.GetPath());
+        const double* sensorPose = usdTransform.ExtractTranslation().GetArray();
+        m_sensorPosition = pxr::GfVec3d(sensorPose[0], sensorPose[1], sensorPose[2]);
+    }
+}
+
 void ContactSensor::onPhysicsStep()
 {
     CARB_PROFILE_ZONE(0, "ContactSensor::physics step");
@@ -164,8 +179,6 @@ void ContactSensor::onPhysicsStep()
         return;
     }
 
-    m_contactsRawData = m_contactManagerPtr->getCsRawData(asInt(m_parentPrim.GetPath()), m_size);
-
     m_current = !m_current;
     processRawContacts(m_contactsRawData, m_size, m_current, m_timeSeconds);
 
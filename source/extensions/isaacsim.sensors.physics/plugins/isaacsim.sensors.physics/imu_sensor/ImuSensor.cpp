@@ -57,6 +57,7 @@
 
 #include <PxRigidDynamic.h>
 #include <PxScene.h>
+#include <algorithm>
 #include <map>
 #include <string>
 #include <vector>
@@ -102,12 +103,12 @@ IsReading ImuSensor::getSensorReading(const std::function<IsReading(std::vector<
         // or internal time + sensor period time is behind the last step time, then something went wrong
         // i.e. sensor was disabled for a long time and then re-enabled
         // get the latest time and measurement
-        if (m_props.sensorPeriod <= m_timeDelta || m_sensorTime + m_props.sensorPeriod < m_sensorReadings[1].time ||
+        if (m_props.sensorPeriod <= m_timeDelta || m_sensorTime + m_props.sensorPeriod < readingAt(1).time ||
             getLatestValue)
         {
-            sensorReading = m_sensorReadings[0];
+            sensorReading = readingAt(0);
             sensorReading.isValid = true;
-            if (m_props.sensorPeriod > 0 && m_sensorTime + m_props.sensorPeriod < m_sensorReadings[1].time)
+            if (m_props.sensorPeriod > 0 && m_sensorTime + m_props.sensorPeriod < readingAt(1).time)
             {
                 CARB_LOG_WARN("*** warning IMU sensor time out of sync, using latest measurements");
             }
@@ -172,150 +173,276 @@ IsReading ImuSensor::getSensorReading(const std::function<IsReading(std::vector<
 
 void ImuSensor::reset()
 {
-    m_rawBuffer.resize(m_rawBufferSize, IsRawData());
-    m_sensorReadings.resize(m_rawBufferSize, IsReading());
+    resizeHistory();
     m_sensorReadingsSensorFrame.resize(m_rawBufferSize, IsReading());
     m_sensorTime = 0;
 }
 
-void ImuSensor::onPhysicsStep()
+void ImuSensor::resizeHistory()
 {
-    if (m_rigidBodyDataBuffer == nullptr)
+    const size_t size = static_cast<size_t>(m_rawBufferSize);
+    if (m_rawBuffer.size() != size || m_historyHead != 0)
     {
-        return;
+        // Unroll the ring so the latest sample is at the front, keeping as much history as fits
+        std::vector<IsRawData> rawBuffer(size, IsRawData());
+        std::vector<IsReading> sensorReadings(size, IsReading());
+        const size_t kept = std::min(size, m_rawBuffer.size());
+        for (size_t i = 0; i < kept; i++)
+        {
+            rawBuffer[i] = rawAt(i);
+            sensorReadings[i] = readingAt(i);
+        }
+        m_rawBuffer.swap(rawBuffer);
+        m_sensorReadings.swap(sensorReadings);
+        m_historyHead = 0;
     }
-    // vW linear velocity in world frame
-    omni::math::linalg::vec3d vW = omni::math::linalg::vec3d((*m_rigidBodyDataBuffer)[m_dataBufferIndex],
-                                                             (*m_rigidBodyDataBuffer)[m_dataBufferIndex + 1],
-                                                             (*m_rigidBodyDataBuffer)[m_dataBufferIndex + 2]);
+    m_linAccTerms.resize(size);
+    recomputeFilterSums();
+}
 
-    // wW angular velocity in world frame
-    omni::math::linalg::vec3d wW = omni::math::linalg::vec3d((*m_rigidBodyDataBuffer)[m_dataBufferIndex + 3],
-                                                             (*m_rigidBodyDataBuffer)[m_dataBufferIndex + 4],
-                                                             (*m_rigidBodyDataBuffer)[m_dataBufferIndex + 5]);
+omni::math::linalg::vec3d ImuSensor::finiteDifference(const IsRawData& newer, const IsRawData& older)
+{
+    float dt = newer.time - older.time;
+    if (dt > 1e-10)
+    {
+        return omni::math::linalg::vec3d((newer.linVelX - older.linVelX) / dt, (newer.linVelY - older.linVelY) / dt,
+                                         (newer.linVelZ - older.linVelZ) / dt);
+    }
+    return omni::math::linalg::vec3d(0.0, 0.0, 0.0);
+}
+
+void ImuSensor::recomputeFilterSums()
+{
+    const size_t size = m_rawBuffer.size();
+    const size_t linearAccelerationFilterSize = static_cast<size_t>(m_linearAccelerationFilterSize);
+    for (size_t i = 0; i < size; i++)
+    {
+        linAccTermAt(i) = i + linearAccelerationFilterSize < size ?
+                              finiteDifference(rawAt(i), rawAt(i + linearAccelerationFilterSize)) :
+                              omni::math::linalg::vec3d(0.0, 0.0, 0.0);
+    }
+
+    m_angVelSum = omni::math::linalg::vec3d(0.0, 0.0, 0.0);
+    for (size_t i = 0; i < static_cast<size_t>(m_angularVelocityFilterSize); i++)
+    {
+        const IsRawData& raw = rawAt(i);
+        m_angVelSum += omni::math::linalg::vec3d(raw.angVelX, raw.angVelY, raw.angVelZ);
+    }
 
+    m_linAccSum = omni::math::linalg::vec3d(0.0, 0.0, 0.0);
+    for (size_t i = 0; i < linearAccelerationFilterSize; i++)
+    {
+        m_linAccSum += linAccTermAt(i);
+    }
+
+    m_orientationSum = { 0.0, 0.0, 0.0, 0.0 };
+    for (size_t i = 0; i < static_cast<size_t>(m_orientationFilterSize); i++)
+    {
+        const IsRawData& raw = rawAt(i);
+        m_orientationSum[0] += raw.orientation.w;
+        m_orientationSum[1] += raw.orientation.x;
+        m_orientationSum[2] += raw.orientation.y;
+        m_orientationSum[3] += raw.orientation.z;
+    }
+}
 
+void ImuSensor::copyReadingsToSensorFrame()
+{
+    m_sensorReadingsSensorFrame.resize(m_sensorReadings.size());
+    for (size_t i = 0; i < m_sensorReadings.size(); i++)
+    {
+        m_sensorReadingsSensorFrame[i] = readingAt(i);
+    }
+}
+
+usdrt::GfMatrix4d ImuSensor::computeWorldToSensor(omni::math::linalg::quatd& qWb)
+{
     // Get transformation matrix from body to world
     usdrt::GfMatrix4d rBw =
         isaacsim::core::includes::pose::computeWorldXformNoCache(m_stage, m_usdrtStage, m_prim.GetPath())
             .GetOrthonormalized();
 
-    // Inverse to get transformation matrix from world to body
-    usdrt::GfMatrix4d rWb = rBw.GetInverse();
-
     // sensor orientation in world frame
     usdrt::GfMatrix3d rW = rBw.ExtractRotationMatrix();
-    omni::math::linalg::quatd qWb = rW.ExtractRotation();
+    qWb = rW.ExtractRotation();
+
+    // Inverse to get transformation matrix from world to body
+    return rBw.GetInverse();
+}
+
+void ImuSensor::onPhysicsStep()
+{
+    if (m_rigidBodyDataBuffer == nullptr)
+    {
+        return;
+    }
+    const float* data = m_rigidBodyDataBuffer->data() + m_dataBufferIndex;
 
-    // velocity of sensor frame in sensor frame
-    omni::math::linalg::vec3d vB = rWb.TransformDir(vW);
+    // vW linear velocity in world frame
+    omni::math::linalg::vec3d vW = omni::math::linalg::vec3d(data[0], data[1], data[2]);
+
+    // wW angular velocity in world frame
+    omni::math::linalg::vec3d wW = omni::math::linalg::vec3d(data[3], data[4], data[5]);
 
-    // angular velocity of sensor frame in sensor frame
-    omni::math::linalg::vec3d wB = rWb.TransformDir(wW);
+    omni::math::linalg::quatd qWb;
+    usdrt::GfMatrix4d rWb = computeWorldToSensor(qWb);
 
     // gravity that the IMU experience in sensor frame
     m_gravitySensorFrame = rWb.TransformDir(m_gravity);
 
-    // we then finite diff vB to get a_b, to reduce noise, average multiple finite diffs
-    // save raw data into a buffer list , buffer 0 always saves the latest velocities
-    if (!m_rawBuffer.empty())
+    // velocity and angular velocity of sensor frame in sensor frame
+    pushSample(rWb.TransformDir(vW), rWb.TransformDir(wW), qWb);
+}
+
+void ImuSensor::onPhysicsStepBatch(const std::vector<ImuSensor*>& sensors,
+                                   ImuSensorBatch& batch,
+                                   carb::tasking::ITasking* tasking)
+{
+    CARB_PROFILE_ZONE(0, "ImuSensor::onPhysicsStepBatch");
+    const size_t count = sensors.size();
+    batch.resize(count);
+
+    // Gather the inputs, querying the sensor pose is the only part that has to visit each prim. It is not thread
+    // safe, so this runs on the calling thread
+    const omni::math::linalg::vec3d axes[3] = { omni::math::linalg::vec3d(1.0, 0.0, 0.0),
+                                                omni::math::linalg::vec3d(0.0, 1.0, 0.0),
+                                                omni::math::linalg::vec3d(0.0, 0.0, 1.0) };
+    for (size_t i = 0; i < count; i++)
     {
-        m_rawBuffer.pop_back();
+        ImuSensor* sensor = sensors[i];
+        const float* data = sensor->m_rigidBodyDataBuffer->data() + sensor->m_dataBufferIndex;
+        usdrt::GfMatrix4d rWb = sensor->computeWorldToSensor(batch.orientation[i]);
+        for (size_t row = 0; row < 3; row++)
+        {
+            const omni::math::linalg::vec3d r = rWb.TransformDir(axes[row]);
+            batch.rotation[row * 3][i] = r[0];
+            batch.rotation[row * 3 + 1][i] = r[1];
+            batch.rotation[row * 3 + 2][i] = r[2];
+            batch.linVel[row][i] = data[row];
+            batch.angVel[row][i] = data[row + 3];
+            batch.gravity[row][i] = sensor->m_gravity[row];
+        }
     }
 
-    const double* imaginary = qWb.GetImaginary().GetArray();
-
-    // read in new data
-    m_rawBuffer.insert(m_rawBuffer.begin(), IsRawData());
-    m_rawBuffer[0].time = static_cast<float>(m_timeSeconds);
-    m_rawBuffer[0].dt = static_cast<float>(m_timeDelta);
-    m_rawBuffer[0].linVelX = static_cast<float>(vB[0]);
-    m_rawBuffer[0].linVelY = static_cast<float>(vB[1]);
-    m_rawBuffer[0].linVelZ = static_cast<float>(vB[2]);
-    m_rawBuffer[0].angVelX = static_cast<float>(wB[0]);
-    m_rawBuffer[0].angVelY = static_cast<float>(wB[1]);
-    m_rawBuffer[0].angVelZ = static_cast<float>(wB[2]);
-    m_rawBuffer[0].orientation.w = static_cast<float>(qWb.GetReal());
-    m_rawBuffer[0].orientation.x = static_cast<float>(imaginary[0]);
-    m_rawBuffer[0].orientation.y = static_cast<float>(imaginary[1]);
-    m_rawBuffer[0].orientation.z = static_cast<float>(imaginary[2]);
-
-    if (!m_sensorReadings.empty())
+    // Rotate every world frame vector into its sensor frame, matching GfMatrix4d::TransformDir
+    auto rotate = [&batch, count](std::array<std::vector<double>, 3>& v)
     {
-        m_sensorReadings.pop_back();
-    }
-    m_sensorReadings.insert(m_sensorReadings.begin(), IsReading());
+        const auto& r = batch.rotation;
+        for (size_t i = 0; i < count; i++)
+        {
+            const double x = v[0][i];
+            const double y = v[1][i];
+            const double z = v[2][i];
+            v[0][i] = x * r[0][i] + y * r[3][i] + z * r[6][i];
+            v[1][i] = x * r[1][i] + y * r[4][i] + z * r[7][i];
+            v[2][i] = x * r[2][i] + y * r[5][i] + z * r[8][i];
+        }
+    };
+    rotate(batch.linVel);
+    rotate(batch.angVel);
+    rotate(batch.gravity);
 
-    // signal processing
-    m_sensorReadings[0].time = static_cast<float>(m_timeSeconds);
-    // ang_vel output strategy: average past m_angularVelocityFilterSize timesteps
-    float tmpSumX = 0, tmpSumY = 0, tmpSumZ = 0;
-    for (int i = 0; i < m_angularVelocityFilterSize; i++)
+    // Each sensor only updates its own history, so the sensors can be split across threads
+    auto updateSensor = [&sensors, &batch](size_t i)
+    {
+        ImuSensor* sensor = sensors[i];
+        sensor->m_gravitySensorFrame =
+            omni::math::linalg::vec3d(batch.gravity[0][i], batch.gravity[1][i], batch.gravity[2][i]);
+        sensor->pushSample(omni::math::linalg::vec3d(batch.linVel[0][i], batch.linVel[1][i], batch.linVel[2][i]),
+                           omni::math::linalg::vec3d(batch.angVel[0][i], batch.angVel[1][i], batch.angVel[2][i]),
+                           batch.orientation[i]);
+    };
+    if (tasking != nullptr && count > 1)
     {
-        tmpSumX += m_rawBuffer[i].angVelX;
-        tmpSumY += m_rawBuffer[i].angVelY;
-        tmpSumZ += m_rawBuffer[i].angVelZ;
+        tasking->applyRange(count, updateSensor);
     }
-    m_sensorReadings[0].angVelX = static_cast<float>(tmpSumX / m_angularVelocityFilterSize);
-    m_sensorReadings[0].angVelY = static_cast<float>(tmpSumY / m_angularVelocityFilterSize);
-    m_sensorReadings[0].angVelZ = static_cast<float>(tmpSumZ / m_angularVelocityFilterSize);
-
-    // lin acc output strategy: average m_linearAccelerationFilterSize finite diffs
-    // say if m_linearAccelerationFilterSize = 2, we do (([0] - [2]) / (2dt) + ([1] - [3]) / (2dt))/2
-    tmpSumX = 0.0f;
-    tmpSumY = 0.0f;
-    tmpSumZ = 0.0f;
-    for (int i = 0; i < m_linearAccelerationFilterSize; i++)
+    else
     {
-        float dt = m_rawBuffer[i].time - m_rawBuffer[i + m_linearAccelerationFilterSize].time;
-
-        if (dt > 1e-10)
+        for (size_t i = 0; i < count; i++)
         {
-            tmpSumX += (m_rawBuffer[i].linVelX - m_rawBuffer[i + m_linearAccelerationFilterSize].linVelX) / dt;
-            tmpSumY += (m_rawBuffer[i].linVelY - m_rawBuffer[i + m_linearAccelerationFilterSize].linVelY) / dt;
-            tmpSumZ += (m_rawBuffer[i].linVelZ - m_rawBuffer[i + m_linearAccelerationFilterSize].linVelZ) / dt;
+            updateSensor(i);
         }
     }
+}
 
+void ImuSensor::pushSample(const omni::math::linalg::vec3d& vB,
+                           const omni::math::linalg::vec3d& wB,
+                           const omni::math::linalg::quatd& qWb)
+{
+    // we then finite diff vB to get a_b, to reduce noise, average multiple finite diffs
+    // save raw data into the ring buffer, age 0 always holds the latest velocities and overwrites the oldest
+    const size_t size = m_rawBuffer.size();
+    m_historyHead = (m_historyHead + size - 1) % size;
 
-    // average acc
-    m_sensorReadings[0].linAccX = static_cast<float>(tmpSumX / m_linearAccelerationFilterSize);
-    m_sensorReadings[0].linAccY = static_cast<float>(tmpSumY / m_linearAccelerationFilterSize);
-    m_sensorReadings[0].linAccZ = static_cast<float>(tmpSumZ / m_linearAccelerationFilterSize);
-
-    // // add gravity
-    // m_sensorReadings[0].linAccX += static_cast<float>(g_b[0]);
-    // m_sensorReadings[0].linAccY += static_cast<float>(g_b[1]);
-    // m_sensorReadings[0].linAccZ += static_cast<float>(g_b[2]);
-
-    float tmpSumW = 0.0;
-    tmpSumX = 0.0f;
-    tmpSumY = 0.0f;
-    tmpSumZ = 0.0f;
+    const double* imaginary = qWb.GetImaginary().GetArray();
 
-    for (int i = 0; i < m_orientationFilterSize; i++)
+    // read in new data
+    IsRawData& raw = rawAt(0);
+    raw = IsRawData();
+    raw.time = static_cast<float>(m_timeSeconds);
+    raw.dt = static_cast<float>(m_timeDelta);
+    raw.linVelX = static_cast<float>(vB[0]);
+    raw.linVelY = static_cast<float>(vB[1]);
+    raw.linVelZ = static_cast<float>(vB[2]);
+    raw.angVelX = static_cast<float>(wB[0]);
+    raw.angVelY = static_cast<float>(wB[1]);
+    raw.angVelZ = static_cast<float>(wB[2]);
+    raw.orientation.w = static_cast<float>(qWb.GetReal());
+    raw.orientation.x = static_cast<float>(imaginary[0]);
+    raw.orientation.y = static_cast<float>(imaginary[1]);
+    raw.orientation.z = static_cast<float>(imaginary[2]);
+
+    if (m_historyHead == 0)
+    {
+        // Once per lap of the ring, rebuild the sums so rounding and non finite samples do not accumulate
+        recomputeFilterSums();
+    }
+    else
     {
-        tmpSumW += m_rawBuffer[i].orientation.w;
-        tmpSumX += m_rawBuffer[i].orientation.x;
-        tmpSumY += m_rawBuffer[i].orientation.y;
-        tmpSumZ += m_rawBuffer[i].orientation.z;
+        // Moving averages add the new sample and drop the one leaving the filter window
+        const IsRawData& angVelOut = rawAt(static_cast<size_t>(m_angularVelocityFilterSize));
+        m_angVelSum += omni::math::linalg::vec3d(
+            raw.angVelX - angVelOut.angVelX, raw.angVelY - angVelOut.angVelY, raw.angVelZ - angVelOut.angVelZ);
+
+        // lin acc output strategy: average m_linearAccelerationFilterSize finite diffs
+        // say if m_linearAccelerationFilterSize = 2, we do (([0] - [2]) / (2dt) + ([1] - [3]) / (2dt))/2
+        linAccTermAt(0) = finiteDifference(raw, rawAt(static_cast<size_t>(m_linearAccelerationFilterSize)));
+        m_linAccSum += linAccTermAt(0) - linAccTermAt(static_cast<size_t>(m_linearAccelerationFilterSize));
+
+        const IsRawData& orientationOut = rawAt(static_cast<size_t>(m_orientationFilterSize));
+        m_orientationSum[0] += raw.orientation.w - orientationOut.orientation.w;
+        m_orientationSum[1] += raw.orientation.x - orientationOut.orientation.x;
+        m_orientationSum[2] += raw.orientation.y - orientationOut.orientation.y;
+        m_orientationSum[3] += raw.orientation.z - orientationOut.orientation.z;
     }
 
-    m_sensorReadings[0].orientation.w = static_cast<float>(tmpSumW / m_orientationFilterSize);
-    m_sensorReadings[0].orientation.x = static_cast<float>(tmpSumX / m_orientationFilterSize);
-    m_sensorReadings[0].orientation.y = static_cast<float>(tmpSumY / m_orientationFilterSize);
-    m_sensorReadings[0].orientation.z = static_cast<float>(tmpSumZ / m_orientationFilterSize);
+    // signal processing
+    IsReading& reading = readingAt(0);
+    reading = IsReading();
+    reading.time = static_cast<float>(m_timeSeconds);
+
+    reading.angVelX = static_cast<float>(m_angVelSum[0] / m_angularVelocityFilterSize);
+    reading.angVelY = static_cast<float>(m_angVelSum[1] / m_angularVelocityFilterSize);
+    reading.angVelZ = static_cast<float>(m_angVelSum[2] / m_angularVelocityFilterSize);
+
+    reading.linAccX = static_cast<float>(m_linAccSum[0] / m_linearAccelerationFilterSize);
+    reading.linAccY = static_cast<float>(m_linAccSum[1] / m_linearAccelerationFilterSize);
+    reading.linAccZ = static_cast<float>(m_linAccSum[2] / m_linearAccelerationFilterSize);
+
+    reading.orientation.w = static_cast<float>(m_orientationSum[0] / m_orientationFilterSize);
+    reading.orientation.x = static_cast<float>(m_orientationSum[1] / m_orientationFilterSize);
+    reading.orientation.y = static_cast<float>(m_orientationSum[2] / m_orientationFilterSize);
+    reading.orientation.z = static_cast<float>(m_orientationSum[3] / m_orientationFilterSize);
 
     if (m_props.sensorPeriod <= m_timeDelta)
     {
-        m_sensorTime = m_sensorReadings[0].time;
+        m_sensorTime = reading.time;
     }
-    else if (m_sensorTime + m_props.sensorPeriod <= m_sensorReadings[0].time)
+    else if (m_sensorTime + m_props.sensorPeriod <= reading.time)
     {
         m_sensorTime += m_props.sensorPeriod;
-        m_sensorReadingsSensorFrame = m_sensorReadings;
+        copyReadingsToSensorFrame();
     }
-    // }
 }
 
 bool ImuSensor::findValidParent()
@@ -365,12 +492,9 @@ void ImuSensor::onComponentChange()
 
     // size of the raw data must be 2 times larger than the max rolling avg size
     // also the buffer should be sufficiently large (20)
-    if (this->m_rawBufferSize != 2 * maxRollingSize)
-    {
-        this->m_rawBufferSize = std::max(2 * maxRollingSize, 20);
-        m_rawBuffer.resize(m_rawBufferSize, IsRawData());
-        m_sensorReadings.resize(m_rawBufferSize, IsReading());
-    }
+    // the filter widths may have changed, so the running sums are rebuilt even if the size is unchanged
+    this->m_rawBufferSize = std::max(2 * maxRollingSize, 20);
+    resizeHistory();
     pxr::GfQuatd sensorQuat(0.0);
     m_prim.GetPrim().GetAttribute(pxr::TfToken("xformOp:orient")).Get(&sensorQuat);
     sensorQuat.Normalize();
@@ -431,9 +555,7 @@ void ImuSensor::onComponentChange()
         {
             this->onPhysicsStep(); // force on physics step to run to get up to date value
             m_sensorTime = static_cast<float>(m_timeSeconds);
-            m_rawBuffer.resize(m_rawBufferSize, IsRawData());
-            m_sensorReadings.resize(m_rawBufferSize, IsReading());
-            m_sensorReadingsSensorFrame = m_sensorReadings;
+            copyReadingsToSensorFrame();
         }
         else
         {
@@ -122,6 +122,7 @@ public:
             return;
         }
 
+        m_activeComponents.clear();
         for (auto& component : m_components)
         {
             if (component.second->mDoStart == true)
@@ -137,44 +138,34 @@ public:
             if (component.second->getEnabled())
             {
                 component.second->preTick();
+                m_activeComponents.push_back(component.second.get());
             }
         }
         // No need to make threads if there is only one sensor.
-        if (m_components.size() > 1)
+        // Tasks index the gathered vector directly instead of walking the component map from the start.
+        if (m_activeComponents.size() > 1)
         {
-            m_tasking->applyRange(m_components.size(),
+            m_tasking->applyRange(m_activeComponents.size(),
                                   [&](size_t index)
                                   {
-                                      auto it = m_components.begin();
-                                      std::advance(it, index);
-
-                                      if (it->second.get()->getEnabled())
-                                      {
-                                          it->second.get()->updateTimestamp(
-                                              this->m_timeSeconds, dt, this->m_timeNanoSeconds);
-                                          it->second.get()->tick();
-                                      }
+                                      RangeSensorComponent* component = m_activeComponents[index];
+                                      component->updateTimestamp(this->m_timeSeconds, dt, this->m_timeNanoSeconds);
+                                      component->tick();
                                   });
         }
         else
         {
-            for (auto& component : m_components)
+            for (RangeSensorComponent* component : m_activeComponents)
             {
-                if (component.second->getEnabled())
-                {
-                    component.second.get()->updateTimestamp(this->m_timeSeconds, dt, this->m_timeNanoSeconds);
-                    component.second->tick();
-                }
+                component->updateTimestamp(this->m_timeSeconds, dt, this->m_timeNanoSeconds);
+                component->tick();
             }
         }
 
 
-        for (auto& component : m_components)
+        for (RangeSensorComponent* component : m_activeComponents)
         {
-            if (component.second->getEnabled())
-            {
-                component.second.get()->draw();
-            }
+            component->draw();
         }
 
         this->m_timeSeconds += dt;
@@ -312,6 +303,11 @@ private:
      * @brief Pointer to the tasking interface for parallel processing
      */
     carb::tasking::ITasking* m_tasking = nullptr;
+
+    /**
+     * @brief Enabled components updated in the current tick, kept as a member to reuse its allocation
+     */
+    std::vector<RangeSensorComponent*> m_activeComponents;
 };
 }
 }
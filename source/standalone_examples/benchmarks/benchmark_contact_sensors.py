@@ -0,0 +1,132 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import argparse
+import math
+import time
+
+parser = argparse.ArgumentParser()
+parser.add_argument("--num-cubes", type=int, default=1024, help="Number of touching cubes reporting contacts")
+parser.add_argument("--num-sensors", type=int, default=256, help="Number of cubes carrying a contact sensor")
+parser.add_argument("--num-layers", type=int, default=4, help="Number of cube layers in the packed pile")
+parser.add_argument("--num-frames", type=int, default=600, help="Number of physics steps to run benchmark for")
+parser.add_argument(
+    "--backend-type",
+    default="OmniPerfKPIFile",
+    choices=["LocalLogMetrics", "JSONFileMetrics", "OsmoKPIFile", "OmniPerfKPIFile"],
+    help="Benchmarking backend, defaults",
+)
+
+args, unknown = parser.parse_known_args()
+
+from isaacsim import SimulationApp
+
+simulation_app = SimulationApp({"headless": True})
+
+import numpy as np
+from isaacsim.core.api import World
+from isaacsim.core.api.objects import DynamicCuboid
+from isaacsim.core.utils.extensions import enable_extension
+from isaacsim.sensors.physics import ContactSensor
+from pxr import PhysxSchema
+
+enable_extension("isaacsim.benchmark.services")
+from isaacsim.benchmark.services import BaseIsaacBenchmark
+from isaacsim.benchmark.services.metrics.measurements import SingleMeasurement
+
+# ----------------------------------------------------------------------
+# Create benchmark
+benchmark = BaseIsaacBenchmark(
+    benchmark_name="benchmark_contact_sensors",
+    workflow_metadata={
+        "metadata": [
+            {"name": "num_cubes", "data": args.num_cubes},
+            {"name": "num_sensors", "data": args.num_sensors},
+            {"name": "num_layers", "data": args.num_layers},
+            {"name": "num_frames", "data": args.num_frames},
+        ]
+    },
+    backend_type=args.backend_type,
+)
+benchmark.set_phase("loading", start_recording_frametime=False, start_recording_runtime=True)
+
+world = World(stage_units_in_meters=1.0, physics_dt=1.0 / 60.0)
+world.scene.add_default_ground_plane()
+
+# Cubes packed side by side in layers, so every cube touches its neighbors and the number of contact pairs grows
+# with the number of cubes
+cube_size = 0.1
+per_layer = math.ceil(args.num_cubes / args.num_layers)
+side = math.ceil(math.sqrt(per_layer))
+num_sensors = min(args.num_sensors, args.num_cubes)
+sensors = []
+for i in range(args.num_cubes):
+    layer, index = divmod(i, per_layer)
+    row, col = divmod(index, side)
+    cube_path = f"/World/Cube_{i}"
+    world.scene.add(
+        DynamicCuboid(
+            prim_path=cube_path,
+            name=f"cube_{i}",
+            position=np.array([row * cube_size, col * cube_size, (layer + 0.5) * cube_size]),
+            size=cube_size,
+        )
+    )
+    PhysxSchema.PhysxContactReportAPI.Apply(world.stage.GetPrimAtPath(cube_path)).CreateThresholdAttr(0)
+    if i < num_sensors:
+        sensors.append(
+            world.scene.add(
+                ContactSensor(
+                    prim_path=f"{cube_path}/contact_sensor",
+                    name=f"contact_sensor_{i}",
+                    min_threshold=0,
+                    max_threshold=10000000,
+                    radius=-1,
+                )
+            )
+        )
+
+world.reset()
+# Let the pile settle so contacts persist between steps
+for _ in range(60):
+    world.step(render=False)
+
+benchmark.store_measurements()
+
+# ----------------------------------------------------------------------
+# Measure physics steps, including contact processing for every sensor
+phase = "benchmark"
+benchmark.set_phase(phase)
+in_contact = 0
+start = time.perf_counter()
+for _ in range(args.num_frames):
+    world.step(render=False)
+    in_contact = sum(1 for sensor in sensors if sensor.get_current_frame().get("in_contact", False))
+elapsed = time.perf_counter() - start
+benchmark.store_measurements()
+
+benchmark.store_custom_measurement(
+    phase, SingleMeasurement(name="Mean Physics Step Time", value=elapsed / args.num_frames * 1000, unit="ms")
+)
+benchmark.store_custom_measurement(phase, SingleMeasurement(name="Sensors In Contact", value=in_contact, unit=""))
+print(
+    f"{args.num_cubes} cubes, {num_sensors} contact sensors ({in_contact} in contact): "
+    f"{elapsed / args.num_frames * 1000:.3f} ms/step"
+)
+
+world.stop()
+benchmark.stop()
+
+simulation_app.close()
@@ -0,0 +1,133 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import argparse
+import time
+
+parser = argparse.ArgumentParser()
+parser.add_argument("--map-size", type=int, default=4096, help="Number of rows and columns of the freespace map")
+parser.add_argument("--num-obstacles", type=int, default=1500, help="Number of wall segments added to the map")
+parser.add_argument("--num-queries", type=int, default=10, help="Number of start and end pairs to plan")
+parser.add_argument(
+    "--methods",
+    nargs="+",
+    default=["flood", "astar", "jps", "batch"],
+    choices=["flood", "astar", "jps", "batch"],
+    help="Planners to benchmark, flood runs generate_paths() over the whole map and unrolls the path, "
+    "batch solves all queries in one PathPlanner.find_paths() call",
+)
+parser.add_argument("--num-threads", type=int, default=0, help="Worker threads of the batch planner, 0 uses all cores")
+parser.add_argument("--seed", type=int, default=0, help="Random seed of the map and queries")
+parser.add_argument(
+    "--backend-type",
+    default="OmniPerfKPIFile",
+    choices=["LocalLogMetrics", "JSONFileMetrics", "OsmoKPIFile", "OmniPerfKPIFile"],
+    help="Benchmarking backend, defaults",
+)
+
+args, unknown = parser.parse_known_args()
+
+from isaacsim import SimulationApp
+
+simulation_app = SimulationApp({"headless": True})
+
+import numpy as np
+from isaacsim.core.utils.extensions import enable_extension
+
+enable_extension("isaacsim.replicator.mobility_gen")
+enable_extension("isaacsim.benchmark.services")
+from isaacsim.benchmark.services import BaseIsaacBenchmark
+from isaacsim.benchmark.services.metrics.measurements import SingleMeasurement
+from isaacsim.replicator.mobility_gen.impl.path_planner import PathPlanner, find_path, generate_paths
+
+# ----------------------------------------------------------------------
+# Create benchmark
+benchmark = BaseIsaacBenchmark(
+    benchmark_name="benchmark_mobility_gen_path_planning",
+    workflow_metadata={
+        "metadata": [
+            {"name": "map_size", "data": args.map_size},
+            {"name": "num_obstacles", "data": args.num_obstacles},
+            {"name": "num_queries", "data": args.num_queries},
+        ]
+    },
+    backend_type=args.backend_type,
+)
+
+# Synthetic map made of thin horizontal and vertical walls
+rng = np.random.default_rng(args.seed)
+freespace = np.ones((args.map_size, args.map_size), dtype=np.uint8)
+for i in range(args.num_obstacles):
+    row, column = rng.integers(0, args.map_size, size=2)
+    long_side = int(rng.integers(1, max(2, args.map_size // 25)))
+    short_side = int(rng.integers(1, 8))
+    height, width = (short_side, long_side) if i % 2 == 0 else (long_side, short_side)
+    freespace[row : row + height, column : column + width] = 0
+
+
+def sample_free_cell():
+    while True:
+        row, column = rng.integers(0, args.map_size, size=2)
+        if freespace[row, column]:
+            return (int(row), int(column))
+
+
+queries = [(sample_free_cell(), sample_free_cell()) for _ in range(args.num_queries)]
+
+
+def plan(method, start, end):
+    if method == "flood":
+        output = generate_paths(start=start, freespace=freespace)
+        if not output.visited[end]:
+            return np.zeros((0, 2), dtype=np.int64)
+        return output.unroll_path(end=end)
+    return find_path(start=start, end=end, freespace=freespace, method=method)
+
+
+for method in args.methods:
+    phase = f"benchmark_{method}"
+    benchmark.set_phase(phase, start_recording_frametime=False, start_recording_runtime=True)
+    elapsed = []
+    path_lengths = []
+    if method == "batch":
+        planner = PathPlanner(freespace, num_threads=args.num_threads)
+        starts = np.array([start for start, _ in queries])
+        ends = np.array([end for _, end in queries])
+        begin = time.perf_counter()
+        points, offsets = planner.find_paths(starts, ends)
+        elapsed = [(time.perf_counter() - begin) / len(queries)] * len(queries)
+        path_lengths = np.diff(offsets)
+    else:
+        for start, end in queries:
+            begin = time.perf_counter()
+            path = plan(method, start, end)
+            elapsed.append(time.perf_counter() - begin)
+            path_lengths.append(len(path))
+    benchmark.store_measurements()
+    benchmark.store_custom_measurement(
+        phase, SingleMeasurement(name="Mean Query Time", value=np.mean(elapsed) * 1000, unit="ms")
+    )
+    benchmark.store_custom_measurement(
+        phase, SingleMeasurement(name="Max Query Time", value=np.max(elapsed) * 1000, unit="ms")
+    )
+    print(
+        f"{method}: {args.num_queries} queries on {args.map_size}x{args.map_size}, "
+        f"mean {np.mean(elapsed) * 1000:.1f} ms, max {np.max(elapsed) * 1000:.1f} ms, "
+        f"mean path length {np.mean(path_lengths):.0f} cells"
+    )
+
+benchmark.stop()
+
+simulation_app.close()
@@ -0,0 +1,122 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import argparse
+import time
+
+parser = argparse.ArgumentParser()
+parser.add_argument("--cell-size", type=float, default=0.05, help="Occupancy map cell size in meters")
+parser.add_argument(
+    "--min-bound", type=float, nargs=3, default=[-12.0, -25.0, 0.1], help="Minimum map bound <x> <y> <z>"
+)
+parser.add_argument("--max-bound", type=float, nargs=3, default=[12.0, 25.0, 0.6], help="Maximum map bound <x> <y> <z>")
+parser.add_argument(
+    "--num-threads",
+    type=int,
+    nargs="+",
+    default=[1, 0],
+    help="Worker thread counts to benchmark, 0 uses all hardware threads and 1 is the serial path",
+)
+parser.add_argument(
+    "--adaptive-levels",
+    type=int,
+    nargs="+",
+    default=[0],
+    help="Coarse-to-fine octree levels to benchmark, 0 tests every cell individually",
+)
+parser.add_argument("--num-runs", type=int, default=3, help="Number of generations per thread count")
+parser.add_argument("--generate-3d", action="store_true", help="Benchmark 3D instead of 2D map generation")
+parser.add_argument(
+    "--backend-type",
+    default="OmniPerfKPIFile",
+    choices=["LocalLogMetrics", "JSONFileMetrics", "OsmoKPIFile", "OmniPerfKPIFile"],
+    help="Benchmarking backend, defaults",
+)
+
+args, unknown = parser.parse_known_args()
+
+from isaacsim import SimulationApp
+
+simulation_app = SimulationApp({"headless": True})
+
+import omni
+from isaacsim.core.api import PhysicsContext
+from isaacsim.core.utils.extensions import enable_extension
+
+enable_extension("isaacsim.asset.gen.omap")
+enable_extension("isaacsim.benchmark.services")
+from isaacsim.asset.gen.omap.bindings import _omap
+from isaacsim.benchmark.services import BaseIsaacBenchmark
+from isaacsim.benchmark.services.metrics.measurements import SingleMeasurement
+
+# ----------------------------------------------------------------------
+# Create benchmark
+benchmark = BaseIsaacBenchmark(
+    benchmark_name="benchmark_omap_generation",
+    workflow_metadata={
+        "metadata": [
+            {"name": "cell_size", "data": args.cell_size},
+            {"name": "generate_3d", "data": args.generate_3d},
+            {"name": "adaptive_levels", "data": args.adaptive_levels},
+        ]
+    },
+    backend_type=args.backend_type,
+)
+benchmark.set_phase("loading", start_recording_frametime=False, start_recording_runtime=True)
+
+scene_path = "/Isaac/Environments/Simple_Warehouse/full_warehouse.usd"
+benchmark.fully_load_stage(benchmark.assets_root_path + scene_path)
+PhysicsContext(physics_dt=1.0 / 60.0)
+
+timeline = omni.timeline.get_timeline_interface()
+timeline.play()
+omni.kit.app.get_app().update()
+
+benchmark.store_measurements()
+
+generator = _omap.Generator(omni.physx.get_physx_interface(), omni.usd.get_context().get_stage_id())
+generator.update_settings(args.cell_size, 4, 5, 6)
+generator.set_transform((0, 0, 0), tuple(args.min_bound), tuple(args.max_bound))
+generate = generator.generate3d if args.generate_3d else generator.generate2d
+
+dims = [int(round((hi - lo) / args.cell_size)) for lo, hi in zip(args.min_bound, args.max_bound)]
+num_cells = dims[0] * dims[1] * (dims[2] if args.generate_3d else 1)
+
+for adaptive_levels in args.adaptive_levels:
+    for num_threads in args.num_threads:
+        phase = f"benchmark_levels_{adaptive_levels}_threads_{num_threads}"
+        generator.set_adaptive_levels(adaptive_levels)
+        generator.set_num_threads(num_threads)
+        elapsed = []
+        for _ in range(args.num_runs):
+            start = time.perf_counter()
+            generate()
+            elapsed.append(time.perf_counter() - start)
+        best = min(elapsed)
+        benchmark.store_custom_measurement(
+            phase, SingleMeasurement(name="Generation Time", value=best * 1000, unit="ms")
+        )
+        benchmark.store_custom_measurement(
+            phase, SingleMeasurement(name="Cells Per Second", value=num_cells / best, unit="cells/s")
+        )
+        print(
+            f"adaptive_levels={adaptive_levels} num_threads={num_threads}: "
+            f"{num_cells} cells in {best * 1000:.1f} ms ({num_cells / best:.0f} cells/s)"
+        )
+
+timeline.stop()
+benchmark.stop()
+
+simulation_app.close()
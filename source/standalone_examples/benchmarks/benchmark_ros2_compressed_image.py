@@ -0,0 +1,169 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import argparse
+import time
+
+parser = argparse.ArgumentParser()
+parser.add_argument("--num-cameras", type=int, default=12, help="Number of image publishers")
+parser.add_argument("--width", type=int, default=1280, help="Width of the published rgb8 images")
+parser.add_argument("--height", type=int, default=720, help="Height of the published rgb8 images")
+parser.add_argument("--num-frames", type=int, default=300, help="Number of frames to run each mode for")
+parser.add_argument(
+    "--backend-type",
+    default="OmniPerfKPIFile",
+    choices=["LocalLogMetrics", "JSONFileMetrics", "OsmoKPIFile", "OmniPerfKPIFile"],
+    help="Benchmarking backend, defaults",
+)
+
+args, unknown = parser.parse_known_args()
+
+from isaacsim import SimulationApp
+
+simulation_app = SimulationApp({"headless": True})
+
+import numpy as np
+import omni
+import omni.graph.core as og
+from isaacsim.core.utils.extensions import enable_extension
+
+enable_extension("isaacsim.ros2.bridge")
+enable_extension("isaacsim.benchmark.services")
+from isaacsim.benchmark.services import BaseIsaacBenchmark
+from isaacsim.benchmark.services.metrics.measurements import SingleMeasurement
+
+omni.kit.app.get_app().update()
+
+import rclpy
+from rclpy.qos import QoSProfile
+from sensor_msgs.msg import CompressedImage, Image
+
+# ----------------------------------------------------------------------
+# Create benchmark
+benchmark = BaseIsaacBenchmark(
+    benchmark_name="benchmark_ros2_compressed_image",
+    workflow_metadata={
+        "metadata": [
+            {"name": "num_cameras", "data": args.num_cameras},
+            {"name": "width", "data": args.width},
+            {"name": "height", "data": args.height},
+            {"name": "num_frames", "data": args.num_frames},
+        ]
+    },
+    backend_type=args.backend_type,
+)
+benchmark.set_phase("loading", start_recording_frametime=False, start_recording_runtime=True)
+
+# A smooth gradient with noise, compressing roughly like a rendered scene rather than like random data
+y, x = np.mgrid[0 : args.height, 0 : args.width]
+image = np.stack([x * 255 // args.width, y * 255 // args.height, (x + y) * 255 // (args.width + args.height)], axis=-1)
+image = np.clip(image + np.random.randint(-4, 5, size=image.shape), 0, 255).astype(np.uint8).flatten()
+
+# Publishers of raw images, and of images compressed by the bridge
+modes = {
+    "raw": ("isaacsim.ros2.bridge.ROS2PublishImage", Image, {}),
+    "jpeg": ("isaacsim.ros2.bridge.ROS2PublishCompressedImage", CompressedImage, {"compressionFormat": "jpeg"}),
+    "qoi": ("isaacsim.ros2.bridge.ROS2PublishCompressedImage", CompressedImage, {"compressionFormat": "qoi"}),
+}
+rclpy.init()
+node = rclpy.create_node("compressed_image_benchmark")
+received = {"messages": 0, "bytes": 0}
+
+
+def count(msg):
+    received["messages"] += 1
+    received["bytes"] += len(msg.data)
+
+
+timeline = omni.timeline.get_timeline_interface()
+benchmark.store_measurements()
+
+# ----------------------------------------------------------------------
+# Measure the frame time and the bandwidth received by a subscriber on the same host for each mode
+for mode, (node_type, message_type, inputs) in modes.items():
+    # A graph with a publisher per camera, replaced for each mode
+    graph_path = f"/ActionGraph_{mode}"
+    nodes = [("OnPlaybackTick", "omni.graph.action.OnPlaybackTick")]
+    values = []
+    connections = []
+    subscriptions = []
+    for i in range(args.num_cameras):
+        name = f"Publish{i}"
+        topic = f"{mode}/camera_{i}"
+        nodes.append((name, node_type))
+        values += [
+            (f"{name}.inputs:topicName", topic),
+            (f"{name}.inputs:encoding", "rgb8"),
+            (f"{name}.inputs:width", args.width),
+            (f"{name}.inputs:height", args.height),
+        ]
+        values += [(f"{name}.inputs:{key}", value) for key, value in inputs.items()]
+        connections.append(("OnPlaybackTick.outputs:tick", f"{name}.inputs:execIn"))
+        subscriptions.append(node.create_subscription(message_type, topic, count, QoSProfile(depth=1)))
+    og.Controller.edit(
+        {"graph_path": graph_path, "evaluator_name": "execution"},
+        {
+            og.Controller.Keys.CREATE_NODES: nodes,
+            og.Controller.Keys.SET_VALUES: values,
+            og.Controller.Keys.CONNECT: connections,
+        },
+    )
+    for i in range(args.num_cameras):
+        og.Controller.attribute(f"{graph_path}/Publish{i}.inputs:data").set(image)
+
+    timeline.play()
+    # Let the nodes create their publishers and the subscriber discover them
+    for _ in range(10):
+        omni.kit.app.get_app().update()
+        rclpy.spin_once(node, timeout_sec=0)
+
+    phase = f"benchmark_{mode}"
+    benchmark.set_phase(phase)
+    received.update({"messages": 0, "bytes": 0})
+    start = time.perf_counter()
+    for _ in range(args.num_frames):
+        omni.kit.app.get_app().update()
+        rclpy.spin_once(node, timeout_sec=0)
+    elapsed = time.perf_counter() - start
+    benchmark.store_measurements()
+    timeline.stop()
+    omni.kit.app.get_app().update()
+    omni.usd.get_context().get_stage().RemovePrim(graph_path)
+    for subscription in subscriptions:
+        node.destroy_subscription(subscription)
+
+    bytes_per_image = received["bytes"] / max(received["messages"], 1)
+    benchmark.store_custom_measurement(
+        phase, SingleMeasurement(name="Mean Frame Time", value=elapsed / args.num_frames * 1000, unit="ms")
+    )
+    benchmark.store_custom_measurement(
+        phase, SingleMeasurement(name="Images Received Per Second", value=received["messages"] / elapsed, unit="Hz")
+    )
+    benchmark.store_custom_measurement(
+        phase, SingleMeasurement(name="Received Bandwidth", value=received["bytes"] / elapsed / 1e6, unit="MB/s")
+    )
+    benchmark.store_custom_measurement(
+        phase, SingleMeasurement(name="Mean Image Size", value=bytes_per_image / 1e3, unit="kB")
+    )
+    print(
+        f"{mode}: {elapsed / args.num_frames * 1000:.2f} ms/frame, {received['messages']} images received "
+        f"({bytes_per_image / 1e3:.1f} kB each, {received['bytes'] / elapsed / 1e6:.1f} MB/s)"
+    )
+
+node.destroy_node()
+rclpy.shutdown()
+benchmark.stop()
+
+simulation_app.close()
@@ -0,0 +1,129 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import argparse
+import time
+
+parser = argparse.ArgumentParser()
+parser.add_argument("--num-pairs", type=int, default=32, help="Number of generic publisher/subscriber node pairs")
+parser.add_argument("--num-frames", type=int, default=600, help="Number of frames to run benchmark for")
+parser.add_argument("--array-size", type=int, default=64, help="Number of joints in each published JointState")
+parser.add_argument(
+    "--backend-type",
+    default="OmniPerfKPIFile",
+    choices=["LocalLogMetrics", "JSONFileMetrics", "OsmoKPIFile", "OmniPerfKPIFile"],
+    help="Benchmarking backend, defaults",
+)
+
+args, unknown = parser.parse_known_args()
+
+from isaacsim import SimulationApp
+
+simulation_app = SimulationApp({"headless": True})
+
+import omni
+import omni.graph.core as og
+from isaacsim.core.utils.extensions import enable_extension
+
+enable_extension("isaacsim.ros2.bridge")
+enable_extension("isaacsim.benchmark.services")
+from isaacsim.benchmark.services import BaseIsaacBenchmark
+from isaacsim.benchmark.services.metrics.measurements import SingleMeasurement
+
+# ----------------------------------------------------------------------
+# Create benchmark
+benchmark = BaseIsaacBenchmark(
+    benchmark_name="benchmark_ros2_dynamic_message",
+    workflow_metadata={
+        "metadata": [
+            {"name": "num_pairs", "data": args.num_pairs},
+            {"name": "num_frames", "data": args.num_frames},
+            {"name": "array_size", "data": args.array_size},
+        ]
+    },
+    backend_type=args.backend_type,
+)
+benchmark.set_phase("loading", start_recording_frametime=False, start_recording_runtime=True)
+
+# Generic publishers and subscribers exchanging sensor_msgs/JointState, which mixes scalar, string,
+# string array and numeric array fields
+graph_path = "/ActionGraph"
+nodes = [("OnPlaybackTick", "omni.graph.action.OnPlaybackTick")]
+values = []
+connections = []
+for i in range(args.num_pairs):
+    for kind in ["Publisher", "Subscriber"]:
+        name = f"{kind}{i}"
+        nodes.append((name, f"isaacsim.ros2.bridge.ROS2{kind}"))
+        values.append((f"{name}.inputs:topicName", f"dynamic_message_{i}"))
+        connections.append(("OnPlaybackTick.outputs:tick", f"{name}.inputs:execIn"))
+og.Controller.edit(
+    {"graph_path": graph_path, "evaluator_name": "execution"},
+    {
+        og.Controller.Keys.CREATE_NODES: nodes,
+        og.Controller.Keys.SET_VALUES: values,
+        og.Controller.Keys.CONNECT: connections,
+    },
+)
+for name, _ in nodes[1:]:
+    node = og.Controller.node(f"{graph_path}/{name}")
+    og.Controller.attribute("inputs:messagePackage", node).set("sensor_msgs")
+    og.Controller.attribute("inputs:messageSubfolder", node).set("msg")
+    og.Controller.attribute("inputs:messageName", node).set("JointState")
+omni.kit.app.get_app().update()
+
+joint_names = [f"joint_{j}" for j in range(args.array_size)]
+joint_values = [float(j) for j in range(args.array_size)]
+for i in range(args.num_pairs):
+    node = og.Controller.node(f"{graph_path}/Publisher{i}")
+    og.Controller.attribute("inputs:header:frame_id", node).set("base_link")
+    og.Controller.attribute("inputs:name", node).set(joint_names)
+    for field in ["position", "velocity", "effort"]:
+        og.Controller.attribute(f"inputs:{field}", node).set(joint_values)
+
+timeline = omni.timeline.get_timeline_interface()
+timeline.play()
+# Let the nodes create their ROS 2 publishers and subscriptions
+for _ in range(10):
+    omni.kit.app.get_app().update()
+
+benchmark.store_measurements()
+
+# ----------------------------------------------------------------------
+# Measure how many messages the generic nodes convert per second
+phase = "benchmark"
+benchmark.set_phase(phase)
+start = time.perf_counter()
+for _ in range(args.num_frames):
+    omni.kit.app.get_app().update()
+elapsed = time.perf_counter() - start
+benchmark.store_measurements()
+
+num_messages = 2 * args.num_pairs * args.num_frames
+benchmark.store_custom_measurement(
+    phase, SingleMeasurement(name="Messages Per Second", value=num_messages / elapsed, unit="messages/s")
+)
+benchmark.store_custom_measurement(
+    phase, SingleMeasurement(name="Mean Frame Time", value=elapsed / args.num_frames * 1000, unit="ms")
+)
+print(
+    f"{args.num_pairs} publisher/subscriber pairs, {args.num_frames} frames: "
+    f"{num_messages / elapsed:.0f} messages/s ({elapsed / args.num_frames * 1000:.2f} ms/frame)"
+)
+
+timeline.stop()
+benchmark.stop()
+
+simulation_app.close()
@@ -0,0 +1,157 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import argparse
+import math
+import time
+
+parser = argparse.ArgumentParser()
+parser.add_argument("--num-transforms", type=int, default=300, help="Number of transforms in each TF message")
+parser.add_argument("--num-frames", type=int, default=300, help="Number of frames to run each mode for")
+parser.add_argument(
+    "--backend-type",
+    default="OmniPerfKPIFile",
+    choices=["LocalLogMetrics", "JSONFileMetrics", "OsmoKPIFile", "OmniPerfKPIFile"],
+    help="Benchmarking backend, defaults",
+)
+
+args, unknown = parser.parse_known_args()
+
+from isaacsim import SimulationApp
+
+# Writing transforms to Fabric requires the Fabric Scene Delegate
+simulation_app = SimulationApp({"headless": True, "extra_args": ["--/app/useFabricSceneDelegate=1"]})
+
+import omni
+import omni.graph.core as og
+from isaacsim.core.utils.extensions import enable_extension
+from pxr import UsdGeom
+
+enable_extension("isaacsim.ros2.bridge")
+enable_extension("isaacsim.benchmark.services")
+from isaacsim.benchmark.services import BaseIsaacBenchmark
+from isaacsim.benchmark.services.metrics.measurements import SingleMeasurement
+
+omni.kit.app.get_app().update()
+
+import rclpy
+from geometry_msgs.msg import TransformStamped
+from rclpy.qos import QoSProfile
+from tf2_msgs.msg import TFMessage
+
+# ----------------------------------------------------------------------
+# Create benchmark
+benchmark = BaseIsaacBenchmark(
+    benchmark_name="benchmark_ros2_subscribe_transform_tree",
+    workflow_metadata={
+        "metadata": [
+            {"name": "num_transforms", "data": args.num_transforms},
+            {"name": "num_frames", "data": args.num_frames},
+        ]
+    },
+    backend_type=args.backend_type,
+)
+benchmark.set_phase("loading", start_recording_frametime=False, start_recording_runtime=True)
+
+# A prim per frame, half of them nested under the previous one so parent transforms are propagated
+stage = omni.usd.get_context().get_stage()
+UsdGeom.Xform.Define(stage, "/World")
+frame_names_map = []
+prim_path = "/World"
+for i in range(args.num_transforms):
+    prim_path = f"{prim_path}/frame_{i}" if i % 2 else f"/World/frame_{i}"
+    UsdGeom.Xform.Define(stage, prim_path)
+    frame_names_map += [prim_path, f"frame_{i}"]
+frame_names_map += ["/World", "world"]
+
+# A TF message moving every frame, each one relative to the world frame
+message = TFMessage()
+for i in range(args.num_transforms):
+    transform = TransformStamped()
+    transform.header.frame_id = "world"
+    transform.child_frame_id = f"frame_{i}"
+    transform.transform.rotation.w = 1.0
+    message.transforms.append(transform)
+
+rclpy.init()
+node = rclpy.create_node("subscribe_transform_tree_benchmark")
+publisher = node.create_publisher(TFMessage, "tf_benchmark", QoSProfile(depth=10))
+
+
+def publish(step):
+    for i, transform in enumerate(message.transforms):
+        transform.transform.translation.x = math.sin(0.01 * step + i)
+        transform.transform.translation.y = math.cos(0.01 * step + i)
+    publisher.publish(message)
+
+
+# Transforms written through USD, batched in Fabric, and batched in Fabric with USD write-back
+modes = {
+    "usd": {"useFabric": False},
+    "fabric": {"useFabric": True, "writeToUsd": False},
+    "fabric_usd": {"useFabric": True, "writeToUsd": True},
+}
+
+timeline = omni.timeline.get_timeline_interface()
+benchmark.store_measurements()
+
+# ----------------------------------------------------------------------
+# Measure the frame time of each mode, with a TF message published before every frame
+for mode, inputs in modes.items():
+    graph_path = f"/ActionGraph_{mode}"
+    og.Controller.edit(
+        {"graph_path": graph_path, "evaluator_name": "execution"},
+        {
+            og.Controller.Keys.CREATE_NODES: [
+                ("OnPlaybackTick", "omni.graph.action.OnPlaybackTick"),
+                ("SubscribeTF", "isaacsim.ros2.bridge.ROS2SubscribeTransformTree"),
+            ],
+            og.Controller.Keys.SET_VALUES: [
+                ("SubscribeTF.inputs:topicName", "tf_benchmark"),
+                ("SubscribeTF.inputs:frameNamesMap", frame_names_map),
+            ]
+            + [(f"SubscribeTF.inputs:{key}", value) for key, value in inputs.items()],
+            og.Controller.Keys.CONNECT: [("OnPlaybackTick.outputs:tick", "SubscribeTF.inputs:execIn")],
+        },
+    )
+
+    timeline.play()
+    # Let the node resolve its frames and the subscriber discover the publisher
+    for step in range(10):
+        publish(step)
+        omni.kit.app.get_app().update()
+
+    phase = f"benchmark_{mode}"
+    benchmark.set_phase(phase)
+    start = time.perf_counter()
+    for step in range(args.num_frames):
+        publish(step)
+        omni.kit.app.get_app().update()
+    elapsed = time.perf_counter() - start
+    benchmark.store_measurements()
+    timeline.stop()
+    omni.kit.app.get_app().update()
+    stage.RemovePrim(graph_path)
+
+    benchmark.store_custom_measurement(
+        phase, SingleMeasurement(name="Mean Frame Time", value=elapsed / args.num_frames * 1000, unit="ms")
+    )
+    print(f"{mode}: {elapsed / args.num_frames * 1000:.2f} ms/frame for {args.num_transforms} transforms")
+
+node.destroy_node()
+rclpy.shutdown()
+benchmark.stop()
+
+simulation_app.close()
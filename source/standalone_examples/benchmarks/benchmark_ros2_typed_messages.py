@@ -0,0 +1,170 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import argparse
+import ctypes
+import sys
+import time
+
+parser = argparse.ArgumentParser()
+parser.add_argument("--num-robots", type=int, default=32, help="Number of articulations publishing joint states")
+parser.add_argument("--num-frames", type=int, default=600, help="Number of frames to run benchmark for")
+parser.add_argument(
+    "--backend-type",
+    default="OmniPerfKPIFile",
+    choices=["LocalLogMetrics", "JSONFileMetrics", "OsmoKPIFile", "OmniPerfKPIFile"],
+    help="Benchmarking backend, defaults",
+)
+
+args, unknown = parser.parse_known_args()
+
+from isaacsim import SimulationApp
+
+simulation_app = SimulationApp({"headless": True})
+
+import carb
+import omni
+import omni.graph.core as og
+import usdrt.Sdf
+from isaacsim.core.api import PhysicsContext
+from isaacsim.core.utils.extensions import enable_extension
+from isaacsim.core.utils.stage import add_reference_to_stage
+from pxr import Gf, UsdGeom
+
+enable_extension("isaacsim.ros2.bridge")
+enable_extension("isaacsim.benchmark.services")
+from isaacsim.benchmark.services import BaseIsaacBenchmark
+from isaacsim.benchmark.services.metrics.measurements import SingleMeasurement
+
+# ----------------------------------------------------------------------
+# Create benchmark
+benchmark = BaseIsaacBenchmark(
+    benchmark_name="benchmark_ros2_typed_messages",
+    workflow_metadata={
+        "metadata": [
+            {"name": "num_robots", "data": args.num_robots},
+            {"name": "num_frames", "data": args.num_frames},
+        ]
+    },
+    backend_type=args.backend_type,
+)
+benchmark.set_phase("loading", start_recording_frametime=False, start_recording_runtime=True)
+
+
+def heap_in_use():
+    """Bytes currently allocated on the native heap, None where glibc is not available."""
+    if not sys.platform.startswith("linux"):
+        return None
+
+    class MallInfo2(ctypes.Structure):
+        _fields_ = [(name, ctypes.c_size_t) for name in ["arena", "ordblks", "smblks", "hblks", "hblkhd"]] + [
+            (name, ctypes.c_size_t) for name in ["usmblks", "fsmblks", "uordblks", "fordblks", "keepcost"]
+        ]
+
+    libc = ctypes.CDLL("libc.so.6")
+    if not hasattr(libc, "mallinfo2"):
+        return None
+    libc.mallinfo2.restype = MallInfo2
+    info = libc.mallinfo2()
+    return info.uordblks + info.hblkhd
+
+
+# Articulations each publishing sensor_msgs/JointState, and one tf2_msgs/TFMessage with all of them
+robot_usd_path = benchmark.assets_root_path + "/Isaac/Robots/IsaacSim/SimpleArticulation/articulation_3_joints.usd"
+stage = omni.usd.get_context().get_stage()
+PhysicsContext(physics_dt=1.0 / 60.0)
+robot_paths = []
+for i in range(args.num_robots):
+    robot_path = f"/World/Robot_{i}"
+    add_reference_to_stage(robot_usd_path, robot_path)
+    UsdGeom.XformCommonAPI(stage.GetPrimAtPath(robot_path)).SetTranslate(Gf.Vec3d(2.0 * (i % 8), 2.0 * (i // 8), 0))
+    robot_paths.append(robot_path)
+
+graph_path = "/ActionGraph"
+nodes = [
+    ("OnPlaybackTick", "omni.graph.action.OnPlaybackTick"),
+    ("ReadSimTime", "isaacsim.core.nodes.IsaacReadSimulationTime"),
+    ("PublishTF", "isaacsim.ros2.bridge.ROS2PublishTransformTree"),
+]
+values = [("PublishTF.inputs:targetPrims", [usdrt.Sdf.Path(path) for path in robot_paths])]
+connections = [
+    ("OnPlaybackTick.outputs:tick", "PublishTF.inputs:execIn"),
+    ("ReadSimTime.outputs:simulationTime", "PublishTF.inputs:timeStamp"),
+]
+for i, path in enumerate(robot_paths):
+    name = f"PublishJointState{i}"
+    nodes.append((name, "isaacsim.ros2.bridge.ROS2PublishJointState"))
+    values += [
+        (f"{name}.inputs:targetPrim", [usdrt.Sdf.Path(path)]),
+        (f"{name}.inputs:topicName", f"joint_states_{i}"),
+    ]
+    connections += [
+        ("OnPlaybackTick.outputs:tick", f"{name}.inputs:execIn"),
+        ("ReadSimTime.outputs:simulationTime", f"{name}.inputs:timeStamp"),
+    ]
+og.Controller.edit(
+    {"graph_path": graph_path, "evaluator_name": "execution"},
+    {
+        og.Controller.Keys.CREATE_NODES: nodes,
+        og.Controller.Keys.SET_VALUES: values,
+        og.Controller.Keys.CONNECT: connections,
+    },
+)
+
+# Publish regardless of subscribers
+carb.settings.get_settings().set_bool("/exts/isaacsim.ros2.bridge/publish_without_verification", True)
+
+timeline = omni.timeline.get_timeline_interface()
+timeline.play()
+# Let the nodes create their publishers and size their messages
+for _ in range(10):
+    omni.kit.app.get_app().update()
+
+benchmark.store_measurements()
+
+# ----------------------------------------------------------------------
+# Measure the publish rate and whether publishing keeps allocating heap memory
+phase = "benchmark"
+benchmark.set_phase(phase)
+heap_start = heap_in_use()
+start = time.perf_counter()
+for _ in range(args.num_frames):
+    omni.kit.app.get_app().update()
+elapsed = time.perf_counter() - start
+heap_end = heap_in_use()
+benchmark.store_measurements()
+
+num_messages = (args.num_robots + 1) * args.num_frames
+benchmark.store_custom_measurement(
+    phase, SingleMeasurement(name="Messages Per Second", value=num_messages / elapsed, unit="messages/s")
+)
+benchmark.store_custom_measurement(
+    phase, SingleMeasurement(name="Mean Frame Time", value=elapsed / args.num_frames * 1000, unit="ms")
+)
+if heap_start is not None and heap_end is not None:
+    heap_growth = (heap_end - heap_start) / num_messages
+    benchmark.store_custom_measurement(
+        phase, SingleMeasurement(name="Heap Growth Per Message", value=heap_growth, unit="bytes")
+    )
+    print(f"Heap growth: {heap_growth:.1f} bytes/message")
+print(
+    f"{args.num_robots} joint state publishers and 1 transform tree publisher, {args.num_frames} frames: "
+    f"{num_messages / elapsed:.0f} messages/s ({elapsed / args.num_frames * 1000:.2f} ms/frame)"
+)
+
+timeline.stop()
+benchmark.stop()
+
+simulation_app.close()
@@ -0,0 +1,126 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import argparse
+import os
+import tempfile
+import time
+
+parser = argparse.ArgumentParser()
+parser.add_argument("--num-links", type=int, default=10000, help="Number of links in the generated URDF")
+parser.add_argument(
+    "--branching", type=int, default=4, help="Number of child links per link, 1 generates a single serial chain"
+)
+parser.add_argument("--num-runs", type=int, default=3, help="Number of parses to run")
+parser.add_argument(
+    "--backend-type",
+    default="OmniPerfKPIFile",
+    choices=["LocalLogMetrics", "JSONFileMetrics", "OsmoKPIFile", "OmniPerfKPIFile"],
+    help="Benchmarking backend, defaults",
+)
+
+args, unknown = parser.parse_known_args()
+
+from isaacsim import SimulationApp
+
+simulation_app = SimulationApp({"headless": True})
+
+import omni.kit.commands
+from isaacsim.core.utils.extensions import enable_extension
+
+enable_extension("isaacsim.asset.importer.urdf")
+enable_extension("isaacsim.benchmark.services")
+from isaacsim.benchmark.services import BaseIsaacBenchmark
+from isaacsim.benchmark.services.metrics.measurements import SingleMeasurement
+
+# ----------------------------------------------------------------------
+# Create benchmark
+benchmark = BaseIsaacBenchmark(
+    benchmark_name="benchmark_urdf_parse",
+    workflow_metadata={
+        "metadata": [
+            {"name": "num_links", "data": args.num_links},
+            {"name": "branching", "data": args.branching},
+            {"name": "num_runs", "data": args.num_runs},
+        ]
+    },
+    backend_type=args.backend_type,
+)
+benchmark.set_phase("loading", start_recording_frametime=False, start_recording_runtime=True)
+
+
+def write_synthetic_urdf(path, num_links, branching):
+    """Writes a robot whose links each carry a visual, a collision and an inertial, joined in a tree."""
+    lines = [
+        '<?xml version="1.0"?>',
+        '<robot name="synthetic">',
+        '  <material name="grey"><color rgba="0.5 0.5 0.5 1"/></material>',
+    ]
+    for i in range(num_links):
+        lines += [
+            f'  <link name="link_{i}">',
+            '    <inertial><origin xyz="0 0 0.05"/><mass value="0.1"/>'
+            '<inertia ixx="1e-4" ixy="0" ixz="0" iyy="1e-4" iyz="0" izz="1e-4"/></inertial>',
+            '    <visual><origin xyz="0 0 0.05"/><geometry><box size="0.05 0.05 0.1"/></geometry>'
+            '<material name="grey"/></visual>',
+            '    <collision><origin xyz="0 0 0.05"/><geometry><box size="0.05 0.05 0.1"/></geometry></collision>',
+            "  </link>",
+        ]
+    for i in range(1, num_links):
+        parent = (i - 1) // branching
+        joint_type = "revolute" if i % 2 else "fixed"
+        lines += [
+            f'  <joint name="joint_{i}" type="{joint_type}">',
+            f'    <parent link="link_{parent}"/><child link="link_{i}"/>',
+            '    <origin xyz="0 0.05 0.1" rpy="0 0 0.1"/><axis xyz="0 0 1"/>',
+            '    <limit lower="-1.57" upper="1.57" effort="10" velocity="1"/>',
+            "  </joint>",
+        ]
+    lines.append("</robot>")
+    with open(path, "w") as f:
+        f.write("\n".join(lines))
+
+
+urdf_path = os.path.join(tempfile.mkdtemp(), "synthetic.urdf")
+write_synthetic_urdf(urdf_path, args.num_links, args.branching)
+status, import_config = omni.kit.commands.execute("URDFCreateImportConfig")
+import_config.merge_fixed_joints = False
+
+benchmark.store_measurements()
+
+# ----------------------------------------------------------------------
+# Measure parsing the file into the robot description, including the per joint inertia estimates
+phase = "benchmark"
+benchmark.set_phase(phase)
+elapsed = []
+num_parsed_links = 0
+for _ in range(args.num_runs):
+    start = time.perf_counter()
+    status, robot = omni.kit.commands.execute("URDFParseFile", urdf_path=urdf_path, import_config=import_config)
+    elapsed.append(time.perf_counter() - start)
+    num_parsed_links = len(robot.links)
+benchmark.store_measurements()
+
+best = min(elapsed)
+benchmark.store_custom_measurement(phase, SingleMeasurement(name="Parse Time", value=best * 1000, unit="ms"))
+benchmark.store_custom_measurement(
+    phase, SingleMeasurement(name="Links Per Second", value=num_parsed_links / best, unit="links/s")
+)
+print(f"{num_parsed_links} links (branching {args.branching}): parsed in {best * 1000:.1f} ms")
+
+os.remove(urdf_path)
+benchmark.stop()
+
+simulation_app.close()